@@ -111,8 +111,12 @@ int main( int argc, char * const argv[] )
 		"Use evtexport to export items stored in a Windows Event Log (EVT) file.";
 
 	evttools_option_t options[ ] = {
+		{ 'B', "buffer_size", "size of the output buffer in bytes, 0 disables output buffering (default is 1048576)" },
 		{ 'c', "codepage", "codepage of ASCII strings, options: ascii, windows-874, windows-932, windows-936, windows-949, windows-950, windows-1250, windows-1251, windows-1252 (default), windows-1253, windows-1254, windows-1255, windows-1256, windows-1257 or windows-1258" },
+		{ 'C', "cache_size", "maximum number of resource files that are kept open, for both the resource files and the MUI resource files (default is 64)" },
+		{ 'f', "format", "output format, options: jsonl, text (default). 'jsonl' writes one JSON object per record" },
 		{ 'h', NULL, "shows this help" },
+		{ 'j', "number_of_threads", "number of threads used to read and format the records, the records are written in their original order (default is 1)" },
 		{ 'l', "log_file", "logs information about the exported items" },
 		{ 'm', "mode", "export mode, option: all, items (default), recovered. 'all' exports the (allocated) items and recovered items, 'items' exports the (allocated) items and 'recovered' exports the recovered items" },
 		{ 'p', "resource_files_path", "search PATH for the resource files (default is the current working directory)" },
@@ -130,8 +134,12 @@ int main( int argc, char * const argv[] )
 	log_handle_t *log_handle                              = NULL;
 	system_character_t *option_ascii_codepage             = NULL;
 	system_character_t *option_event_log_type             = NULL;
+	system_character_t *option_export_format              = NULL;
 	system_character_t *option_export_mode                = NULL;
 	system_character_t *option_log_filename               = NULL;
+	system_character_t *option_number_of_threads          = NULL;
+	system_character_t *option_output_buffer_size         = NULL;
+	system_character_t *option_resource_file_cache_size   = NULL;
 	system_character_t *option_resource_files_path        = NULL;
 	system_character_t *option_preferred_language         = NULL;
 	system_character_t *option_registry_directory_name    = NULL;
@@ -143,6 +151,7 @@ int main( int argc, char * const argv[] )
 	int number_of_options                                 = (int) ( sizeof( options ) / sizeof( evttools_option_t ) );
 	int result                                            = 0;
 	int verbose                                           = 0;
+	uint8_t export_format                                 = EXPORT_FORMAT_TEXT;
 
 #if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
 	_setmode( _fileno( stdout ), _O_BINARY );
@@ -175,10 +184,6 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	evttools_output_version_fprint(
-	 stdout,
-	 program );
-
 	if( evttools_getopt_get_options_string(
 	     options,
 	     number_of_options,
@@ -205,6 +210,10 @@ int main( int argc, char * const argv[] )
 				 "Invalid argument: %" PRIs_SYSTEM "\n",
 				 argv[ optind - 1 ] );
 
+				evttools_output_version_fprint(
+				 stdout,
+				 program );
+
 				evttools_getopt_usage_fprint(
 				 stdout,
 				 program,
@@ -214,12 +223,31 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (system_integer_t) 'B':
+				option_output_buffer_size = optarg;
+
+				break;
+
 			case (system_integer_t) 'c':
 				option_ascii_codepage = optarg;
 
 				break;
 
+			case (system_integer_t) 'C':
+				option_resource_file_cache_size = optarg;
+
+				break;
+
+			case (system_integer_t) 'f':
+				option_export_format = optarg;
+
+				break;
+
 			case (system_integer_t) 'h':
+				evttools_output_version_fprint(
+				 stdout,
+				 program );
+
 				evttools_getopt_usage_fprint(
 				 stdout,
 				 program,
@@ -229,6 +257,11 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'j':
+				option_number_of_threads = optarg;
+
+				break;
+
 			case (system_integer_t) 'l':
 				option_log_filename = optarg;
 
@@ -270,6 +303,10 @@ int main( int argc, char * const argv[] )
 				break;
 
 			case (system_integer_t) 'V':
+				evttools_output_version_fprint(
+				 stdout,
+				 program );
+
 				evttools_output_copyright_fprint(
 				 stdout );
 
@@ -282,6 +319,10 @@ int main( int argc, char * const argv[] )
 		 stderr,
 		 "Missing source file.\n" );
 
+		evttools_output_version_fprint(
+		 stdout,
+		 program );
+
 		evttools_getopt_usage_fprint(
 		 stdout,
 		 program,
@@ -398,6 +439,105 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+	if( option_export_format != NULL )
+	{
+		result = export_handle_set_export_format(
+			  evtexport_export_handle,
+			  option_export_format,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set export format.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported export format defaulting to: text.\n" );
+		}
+		export_format = evtexport_export_handle->export_format;
+	}
+	/* The JSON Lines output only contains the records
+	 */
+	if( export_format == EXPORT_FORMAT_TEXT )
+	{
+		evttools_output_version_fprint(
+		 stdout,
+		 program );
+	}
+	if( option_output_buffer_size != NULL )
+	{
+		result = export_handle_set_output_buffer_size(
+		          evtexport_export_handle,
+		          option_output_buffer_size,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set output buffer size in export handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported output buffer size defaulting to: %d.\n",
+			 OUTPUT_HANDLE_DEFAULT_BUFFER_SIZE );
+		}
+	}
+	if( option_number_of_threads != NULL )
+	{
+		result = export_handle_set_number_of_threads(
+		          evtexport_export_handle,
+		          option_number_of_threads,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of threads in export handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads defaulting to: 1.\n" );
+		}
+	}
+	if( option_resource_file_cache_size != NULL )
+	{
+		result = export_handle_set_resource_file_cache_size(
+		          evtexport_export_handle,
+		          option_resource_file_cache_size,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set resource file cache size in export handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported resource file cache size defaulting to: %d.\n",
+			 RESOURCE_FILE_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES );
+		}
+	}
 	if( option_resource_files_path != NULL )
 	{
 		if( export_handle_set_resource_files_path(
@@ -546,7 +686,8 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( result == 0 )
+	if( ( result == 0 )
+	 && ( export_format == EXPORT_FORMAT_TEXT ) )
 	{
 		fprintf(
 		 stdout,
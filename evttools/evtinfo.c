@@ -148,7 +148,7 @@ int main( int argc, char * const argv[] )
 		goto on_error;
 	}
 	if( evttools_output_initialize(
-	     _IONBF,
+	     _IOLBF,
 	     &error ) != 1 )
 	{
 		fprintf(
@@ -28,14 +28,17 @@
 #include "evttools_libcerror.h"
 #include "evttools_libcnotify.h"
 #include "evttools_libclocale.h"
+#include "evttools_libcthreads.h"
 #include "evttools_libevt.h"
-#include "evttools_libfdatetime.h"
 #include "evttools_unused.h"
 #include "export_handle.h"
 #include "log_handle.h"
 #include "message_handle.h"
 #include "message_string.h"
+#include "output_handle.h"
+#include "record_buffer.h"
 #include "resource_file.h"
+#include "resource_file_cache.h"
 
 #define EXPORT_HANDLE_NOTIFY_STREAM		stdout
 
@@ -177,11 +180,15 @@ int export_handle_initialize(
 
 		goto on_error;
 	}
+	( *export_handle )->export_format  = EXPORT_FORMAT_TEXT;
 	( *export_handle )->export_mode    = EXPORT_MODE_ITEMS;
 	( *export_handle )->event_log_type = EVTTOOLS_EVENT_LOG_TYPE_UNKNOWN;
 	( *export_handle )->ascii_codepage = LIBEVT_CODEPAGE_WINDOWS_1252;
 	( *export_handle )->notify_stream  = EXPORT_HANDLE_NOTIFY_STREAM;
 
+	( *export_handle )->output_buffer_size = OUTPUT_HANDLE_DEFAULT_BUFFER_SIZE;
+	( *export_handle )->number_of_threads  = 1;
+
 	return( 1 );
 
 on_error:
@@ -240,6 +247,22 @@ int export_handle_free(
 				result = -1;
 			}
 		}
+		if( ( *export_handle )->record_buffer != NULL )
+		{
+			if( record_buffer_free(
+			     &( ( *export_handle )->record_buffer ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record buffer.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( message_handle_free(
 		     &( ( *export_handle )->message_handle ),
 		     error ) != 1 )
@@ -328,6 +351,70 @@ int export_handle_signal_abort(
 	return( 1 );
 }
 
+/* Sets the export format
+ * Returns 1 if successful, 0 if unsupported values or -1 on error
+ */
+int export_handle_set_export_format(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_export_format";
+	size_t string_length  = 0;
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 4 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "text" ),
+		     4 ) == 0 )
+		{
+			export_handle->export_format = EXPORT_FORMAT_TEXT;
+
+			result = 1;
+		}
+	}
+	else if( string_length == 5 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "jsonl" ),
+		     5 ) == 0 )
+		{
+			export_handle->export_format = EXPORT_FORMAT_JSONL;
+
+			result = 1;
+		}
+	}
+	return( result );
+}
+
 /* Sets the export mode
  * Returns 1 if successful, 0 if unsupported values or -1 on error
  */
@@ -752,6 +839,218 @@ int export_handle_set_resource_files_path(
 	return( 1 );
 }
 
+/* Sets the output buffer size
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_output_buffer_size(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_output_buffer_size";
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 0 )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		value_64bit *= 10;
+		value_64bit += (uint64_t) ( string[ string_index ] - (system_character_t) '0' );
+
+		if( value_64bit > (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			return( 0 );
+		}
+	}
+	export_handle->output_buffer_size = (size_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the number of threads
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_number_of_threads(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_number_of_threads";
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	int number_of_threads = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 0 )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		number_of_threads *= 10;
+		number_of_threads += (int) ( string[ string_index ] - (system_character_t) '0' );
+
+		if( number_of_threads > EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS )
+		{
+			return( 0 );
+		}
+	}
+	if( number_of_threads == 0 )
+	{
+		return( 0 );
+	}
+	export_handle->number_of_threads = number_of_threads;
+
+	return( 1 );
+}
+
+/* Sets the maximum number of resource files that are kept open
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_resource_file_cache_size(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function         = "export_handle_set_resource_file_cache_size";
+	size_t string_index           = 0;
+	size_t string_length          = 0;
+	int maximum_number_of_entries = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 0 )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		maximum_number_of_entries *= 10;
+		maximum_number_of_entries += (int) ( string[ string_index ] - (system_character_t) '0' );
+
+		if( maximum_number_of_entries > RESOURCE_FILE_CACHE_MAXIMUM_NUMBER_OF_ENTRIES )
+		{
+			return( 0 );
+		}
+	}
+	if( maximum_number_of_entries == 0 )
+	{
+		return( 0 );
+	}
+	if( message_handle_set_resource_file_cache_size(
+	     export_handle->message_handle,
+	     maximum_number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set resource file cache size in message handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Opens the input
  * Returns 1 if successful or -1 on error
  */
@@ -900,15 +1199,13 @@ int export_handle_close_input(
  */
 int export_handle_posix_time_value_fprint(
      export_handle_t *export_handle,
+     record_buffer_t *record_buffer,
      const char *value_name,
      uint32_t value_32bit,
      libcerror_error_t **error )
 {
-	system_character_t date_time_string[ 32 ];
-
-	libfdatetime_posix_time_t *posix_time = NULL;
-	static char *function                 = "export_handle_posix_time_fprint";
-	int result                            = 0;
+	static char *function = "export_handle_posix_time_value_fprint";
+	int result            = 0;
 
 	if( export_handle == NULL )
 	{
@@ -921,99 +1218,67 @@ int export_handle_posix_time_value_fprint(
 
 		return( -1 );
 	}
-	if( value_32bit == 0 )
+	if( record_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record buffer.",
+		 function );
+
+		return( -1 );
+	}
+	result = output_handle_write_string(
+	          record_buffer->output_handle,
+	          value_name,
+	          error );
+
+	if( result == 1 )
 	{
-		fprintf(
-		 export_handle->notify_stream,
-		 "%s: Not set (0)\n",
-		 value_name );
+		result = output_handle_write_string(
+		          record_buffer->output_handle,
+		          ": ",
+		          error );
 	}
-	else
+	if( result == 1 )
 	{
-		if( libfdatetime_posix_time_initialize(
-		     &posix_time,
-		     error ) != 1 )
+		if( value_32bit == 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create POSIX time.",
-			 function );
-
-			goto on_error;
+			result = output_handle_write_string(
+			          record_buffer->output_handle,
+			          "Not set (0)\n",
+			          error );
 		}
-		if( libfdatetime_posix_time_copy_from_32bit(
-		     posix_time,
-		     value_32bit,
-		     LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
-		     error ) != 1 )
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to copy POSIX time from 32-bit.",
-			 function );
+			result = output_handle_write_posix_time(
+			          record_buffer->output_handle,
+			          (int32_t) value_32bit,
+			          OUTPUT_HANDLE_DATE_TIME_FORMAT_CTIME,
+			          error );
 
-			goto on_error;
-		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libfdatetime_posix_time_copy_to_utf16_string(
-			  posix_time,
-			  (uint16_t *) date_time_string,
-			  32,
-			  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
-			  error );
-#else
-		result = libfdatetime_posix_time_copy_to_utf8_string(
-			  posix_time,
-			  (uint8_t *) date_time_string,
-			  32,
-			  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
-			  error );
-#endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to copy POSIX time to string.",
-			 function );
-
-			goto on_error;
-		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "%s: %" PRIs_SYSTEM " UTC\n",
-		 value_name,
-		 date_time_string );
-
-		if( libfdatetime_posix_time_free(
-		     &posix_time,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free POSIX time.",
-			 function );
-
-			goto on_error;
+			if( result == 1 )
+			{
+				result = output_handle_write_string(
+				          record_buffer->output_handle,
+				          " UTC\n",
+				          error );
+			}
 		}
 	}
-	return( 1 );
-
-on_error:
-	if( posix_time != NULL )
+	if( result != 1 )
 	{
-		libfdatetime_posix_time_free(
-		 &posix_time,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write POSIX time value.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
+	return( 1 );
 }
 
 /* Exports the record event category
@@ -1021,6 +1286,7 @@ on_error:
  */
 int export_handle_export_record_event_category(
      export_handle_t *export_handle,
+     record_buffer_t *record_buffer,
      libevt_record_t *record,
      const system_character_t *event_source,
      size_t event_source_length,
@@ -1048,6 +1314,17 @@ int export_handle_export_record_event_category(
 
 		return( -1 );
 	}
+	if( record_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record buffer.",
+		 function );
+
+		return( -1 );
+	}
 	if( libevt_record_get_event_category(
 	     record,
 	     &event_category,
@@ -1064,14 +1341,16 @@ int export_handle_export_record_event_category(
 	}
 	if( event_source != NULL )
 	{
-		result = message_handle_get_value_by_event_source(
+		result = message_handle_copy_message_string_by_event_source(
 		          export_handle->message_handle,
 		          event_source,
 		          event_source_length,
 		          _SYSTEM_STRING( "CategoryMessageFile" ),
 		          19,
+		          (uint32_t) event_category,
 		          &message_filename,
 		          &message_filename_size,
+		          record_buffer->message_string,
 		          error );
 
 		if( result == -1 )
@@ -1080,44 +1359,46 @@ int export_handle_export_record_event_category(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve category message filename.",
+			 "%s: unable to retrieve category message string.",
 			 function );
 
 			goto on_error;
 		}
 		else if( result != 0 )
 		{
-			fprintf(
-			 export_handle->notify_stream,
-			 "Category message filename\t: %" PRIs_SYSTEM "\n",
-			 message_filename );
-
-			result = message_handle_get_message_string(
-				  export_handle->message_handle,
-				  message_filename,
-				  message_filename_size - 1,
-				  (uint32_t) event_category,
-				  &message_string,
-				  error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve message string: 0x%08" PRIx32 " from: %" PRIs_SYSTEM ".",
-				 function,
-				 (uint32_t) event_category,
-				 message_filename );
-
-				goto on_error;
-			}
-			memory_free(
-			 message_filename );
+			message_string = record_buffer->message_string;
+		}
+	}
+	if( message_filename != NULL )
+	{
+		if( ( output_handle_write_string(
+		       record_buffer->output_handle,
+		       "Category message filename\t: ",
+		       error ) != 1 )
+		 || ( output_handle_write_system_string(
+		       record_buffer->output_handle,
+		       message_filename,
+		       system_string_length(
+		        message_filename ),
+		       error ) != 1 )
+		 || ( output_handle_write_character(
+		       record_buffer->output_handle,
+		       '\n',
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write category message filename.",
+			 function );
 
-			message_filename = NULL;
+			goto on_error;
 		}
+		memory_free(
+		 message_filename );
+
+		message_filename = NULL;
 	}
 	if( message_string != NULL )
 	{
@@ -1131,18 +1412,63 @@ int export_handle_export_record_event_category(
 				( message_string->string )[ message_string_index ] = 0;
 			}
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "Event category\t\t\t: %" PRIs_SYSTEM " (%" PRIu16 ")\n",
-		 message_string->string,
-		 event_category );
+		if( ( output_handle_write_string(
+		       record_buffer->output_handle,
+		       "Event category\t\t\t: ",
+		       error ) != 1 )
+		 || ( output_handle_write_system_string(
+		       record_buffer->output_handle,
+		       message_string->string,
+		       system_string_length(
+		        message_string->string ),
+		       error ) != 1 )
+		 || ( output_handle_write_string(
+		       record_buffer->output_handle,
+		       " (",
+		       error ) != 1 )
+		 || ( output_handle_write_decimal(
+		       record_buffer->output_handle,
+		       (uint64_t) event_category,
+		       error ) != 1 )
+		 || ( output_handle_write_string(
+		       record_buffer->output_handle,
+		       ")\n",
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write event category.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	else
 	{
-		fprintf(
-		 export_handle->notify_stream,
-		 "Event category\t\t\t: %" PRIu16 "\n",
-		 event_category );
+		if( ( output_handle_write_string(
+		       record_buffer->output_handle,
+		       "Event category\t\t\t: ",
+		       error ) != 1 )
+		 || ( output_handle_write_decimal(
+		       record_buffer->output_handle,
+		       (uint64_t) event_category,
+		       error ) != 1 )
+		 || ( output_handle_write_character(
+		       record_buffer->output_handle,
+		       '\n',
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write event category.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	return( 1 );
 
@@ -1160,6 +1486,7 @@ on_error:
  */
 int export_handle_export_record_event_message(
      export_handle_t *export_handle,
+     record_buffer_t *record_buffer,
      libevt_record_t *record,
      const system_character_t *event_source,
      size_t event_source_length,
@@ -1190,16 +1517,29 @@ int export_handle_export_record_event_message(
 
 		return( -1 );
 	}
+	if( record_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record buffer.",
+		 function );
+
+		return( -1 );
+	}
 	if( event_source != NULL )
 	{
-		result = message_handle_get_value_by_event_source(
+		result = message_handle_copy_message_string_by_event_source(
 		          export_handle->message_handle,
 		          event_source,
 		          event_source_length,
 		          _SYSTEM_STRING( "EventMessageFile" ),
 		          16,
+		          event_identifier,
 		          &message_filename,
 		          &message_filename_size,
+		          record_buffer->message_string,
 		          error );
 
 		if( result == -1 )
@@ -1208,44 +1548,46 @@ int export_handle_export_record_event_message(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve message filename.",
+			 "%s: unable to retrieve message string.",
 			 function );
 
 			goto on_error;
 		}
 		else if( result != 0 )
 		{
-			fprintf(
-			 export_handle->notify_stream,
-			 "Message filename\t\t: %" PRIs_SYSTEM "\n",
-			 message_filename );
-
-			result = message_handle_get_message_string(
-				  export_handle->message_handle,
-				  message_filename,
-				  message_filename_size - 1,
-				  event_identifier,
-				  &message_string,
-				  error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve message string: 0x%08" PRIx32 " from: %" PRIs_SYSTEM ".",
-				 function,
-				 event_identifier,
-				 message_filename );
-
-				goto on_error;
-			}
-			memory_free(
-			 message_filename );
+			message_string = record_buffer->message_string;
+		}
+	}
+	if( message_filename != NULL )
+	{
+		if( ( output_handle_write_string(
+		       record_buffer->output_handle,
+		       "Message filename\t\t: ",
+		       error ) != 1 )
+		 || ( output_handle_write_system_string(
+		       record_buffer->output_handle,
+		       message_filename,
+		       system_string_length(
+		        message_filename ),
+		       error ) != 1 )
+		 || ( output_handle_write_character(
+		       record_buffer->output_handle,
+		       '\n',
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write message filename.",
+			 function );
 
-			message_filename = NULL;
+			goto on_error;
 		}
+		memory_free(
+		 message_filename );
+
+		message_filename = NULL;
 	}
 	if( libevt_record_get_number_of_strings(
 	     record,
@@ -1261,19 +1603,54 @@ int export_handle_export_record_event_message(
 
 		goto on_error;
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "Number of strings\t\t: %d\n",
-	 number_of_strings );
+	if( ( output_handle_write_string(
+	       record_buffer->output_handle,
+	       "Number of strings\t\t: ",
+	       error ) != 1 )
+	 || ( output_handle_write_decimal(
+	       record_buffer->output_handle,
+	       (uint64_t) number_of_strings,
+	       error ) != 1 )
+	 || ( output_handle_write_character(
+	       record_buffer->output_handle,
+	       '\n',
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write number of strings.",
+		 function );
 
+		goto on_error;
+	}
 	for( value_string_index = 0;
 	     value_string_index < number_of_strings;
 	     value_string_index++ )
 	{
-		fprintf(
-		 export_handle->notify_stream,
-		 "String: %d\t\t\t: ",
-		 value_string_index + 1 );
+		if( ( output_handle_write_string(
+		       record_buffer->output_handle,
+		       "String: ",
+		       error ) != 1 )
+		 || ( output_handle_write_decimal(
+		       record_buffer->output_handle,
+		       (uint64_t) ( value_string_index + 1 ),
+		       error ) != 1 )
+		 || ( output_handle_write_string(
+		       record_buffer->output_handle,
+		       "\t\t\t: ",
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write string description.",
+			 function );
+
+			goto on_error;
+		}
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 		result = libevt_record_get_utf16_string_size(
@@ -1343,26 +1720,48 @@ int export_handle_export_record_event_message(
 
 				goto on_error;
 			}
-			fprintf(
-			 export_handle->notify_stream,
-			 "%" PRIs_SYSTEM "",
-			 value_string );
+			if( output_handle_write_system_string(
+			     record_buffer->output_handle,
+			     value_string,
+			     system_string_length(
+			      value_string ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write string.",
+				 function );
 
+				goto on_error;
+			}
 			memory_free(
 			 value_string );
 
 			value_string = NULL;
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "\n" );
+		if( output_handle_write_character(
+		     record_buffer->output_handle,
+		     '\n',
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write new line.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	if( message_string != NULL )
 	{
 		if( message_string_fprint(
 		     message_string,
 		     record,
-		     export_handle->notify_stream,
+		     record_buffer->output_handle,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1396,6 +1795,7 @@ on_error:
  */
 int export_handle_export_record(
      export_handle_t *export_handle,
+     record_buffer_t *record_buffer,
      libevt_record_t *record,
      log_handle_t *log_handle,
      libcerror_error_t **error )
@@ -1422,6 +1822,37 @@ int export_handle_export_record(
 
 		return( -1 );
 	}
+	if( record_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->export_format == EXPORT_FORMAT_JSONL )
+	{
+		if( export_handle_export_record_jsonl(
+		     export_handle,
+		     record_buffer,
+		     record,
+		     log_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export record as JSON.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
 	if( libevt_record_get_identifier(
 	     record,
 	     &value_32bit,
@@ -1436,11 +1867,28 @@ int export_handle_export_record(
 
 		goto on_error;
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "Event number\t\t\t: %" PRIu32 "\n",
-	 value_32bit );
+	if( ( output_handle_write_string(
+	       record_buffer->output_handle,
+	       "Event number\t\t\t: ",
+	       error ) != 1 )
+	 || ( output_handle_write_decimal(
+	       record_buffer->output_handle,
+	       (uint64_t) value_32bit,
+	       error ) != 1 )
+	 || ( output_handle_write_character(
+	       record_buffer->output_handle,
+	       '\n',
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write event number.",
+		 function );
 
+		goto on_error;
+	}
 	if( libevt_record_get_creation_time(
 	     record,
 	     &value_32bit,
@@ -1457,6 +1905,7 @@ int export_handle_export_record(
 	}
 	if( export_handle_posix_time_value_fprint(
 	     export_handle,
+	     record_buffer,
 	     "Creation time\t\t\t",
 	     value_32bit,
 	     error ) != 1 )
@@ -1486,6 +1935,7 @@ int export_handle_export_record(
 	}
 	if( export_handle_posix_time_value_fprint(
 	     export_handle,
+	     record_buffer,
 	     "Written time\t\t\t",
 	     value_32bit,
 	     error ) != 1 )
@@ -1513,12 +1963,37 @@ int export_handle_export_record(
 
 		goto on_error;
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "Event type\t\t\t: %s (%" PRIu16 ")\n",
-	 export_handle_get_event_type(
-	  event_type ),
-	 event_type );
+	if( ( output_handle_write_string(
+	       record_buffer->output_handle,
+	       "Event type\t\t\t: ",
+	       error ) != 1 )
+	 || ( output_handle_write_string(
+	       record_buffer->output_handle,
+	       export_handle_get_event_type(
+	        event_type ),
+	       error ) != 1 )
+	 || ( output_handle_write_string(
+	       record_buffer->output_handle,
+	       " (",
+	       error ) != 1 )
+	 || ( output_handle_write_decimal(
+	       record_buffer->output_handle,
+	       (uint64_t) event_type,
+	       error ) != 1 )
+	 || ( output_handle_write_string(
+	       record_buffer->output_handle,
+	       ")\n",
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write event type.",
+		 function );
+
+		goto on_error;
+	}
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	result = libevt_record_get_utf16_user_security_identifier_size(
@@ -1583,11 +2058,30 @@ int export_handle_export_record(
 
 			goto on_error;
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "User security identifier\t: %" PRIs_SYSTEM "\n",
-		 value_string );
+		if( ( output_handle_write_string(
+		       record_buffer->output_handle,
+		       "User security identifier\t: ",
+		       error ) != 1 )
+		 || ( output_handle_write_system_string(
+		       record_buffer->output_handle,
+		       value_string,
+		       system_string_length(
+		        value_string ),
+		       error ) != 1 )
+		 || ( output_handle_write_character(
+		       record_buffer->output_handle,
+		       '\n',
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write user security identifier.",
+			 function );
 
+			goto on_error;
+		}
 		memory_free(
 		 value_string );
 
@@ -1656,11 +2150,30 @@ int export_handle_export_record(
 
 			goto on_error;
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "Computer name\t\t\t: %" PRIs_SYSTEM "\n",
-		 value_string );
+		if( ( output_handle_write_string(
+		       record_buffer->output_handle,
+		       "Computer name\t\t\t: ",
+		       error ) != 1 )
+		 || ( output_handle_write_system_string(
+		       record_buffer->output_handle,
+		       value_string,
+		       system_string_length(
+		        value_string ),
+		       error ) != 1 )
+		 || ( output_handle_write_character(
+		       record_buffer->output_handle,
+		       '\n',
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write computer name.",
+			 function );
 
+			goto on_error;
+		}
 		memory_free(
 		 value_string );
 
@@ -1729,13 +2242,34 @@ int export_handle_export_record(
 
 			goto on_error;
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "Source name\t\t\t: %" PRIs_SYSTEM "\n",
-		 source_name );
+		if( ( output_handle_write_string(
+		       record_buffer->output_handle,
+		       "Source name\t\t\t: ",
+		       error ) != 1 )
+		 || ( output_handle_write_system_string(
+		       record_buffer->output_handle,
+		       source_name,
+		       system_string_length(
+		        source_name ),
+		       error ) != 1 )
+		 || ( output_handle_write_character(
+		       record_buffer->output_handle,
+		       '\n',
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write source name.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	if( export_handle_export_record_event_category(
 	     export_handle,
+	     record_buffer,
 	     record,
 	     source_name,
 	     source_name_size - 1,
@@ -1765,14 +2299,39 @@ int export_handle_export_record(
 
 		goto on_error;
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "Event identifier\t\t: 0x%08" PRIx32 " (%" PRIu32 ")\n",
-	 event_identifier,
-	 event_identifier );
+	if( ( output_handle_write_string(
+	       record_buffer->output_handle,
+	       "Event identifier\t\t: 0x",
+	       error ) != 1 )
+	 || ( output_handle_write_hexadecimal(
+	       record_buffer->output_handle,
+	       event_identifier,
+	       error ) != 1 )
+	 || ( output_handle_write_string(
+	       record_buffer->output_handle,
+	       " (",
+	       error ) != 1 )
+	 || ( output_handle_write_decimal(
+	       record_buffer->output_handle,
+	       (uint64_t) event_identifier,
+	       error ) != 1 )
+	 || ( output_handle_write_string(
+	       record_buffer->output_handle,
+	       ")\n",
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write event identifier.",
+		 function );
 
+		goto on_error;
+	}
 	if( export_handle_export_record_event_message(
 	     export_handle,
+	     record_buffer,
 	     record,
 	     source_name,
 	     source_name_size - 1,
@@ -1789,10 +2348,20 @@ int export_handle_export_record(
 
 		goto on_error;
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "\n" );
+	if( output_handle_write_character(
+	     record_buffer->output_handle,
+	     '\n',
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write new line.",
+		 function );
 
+		goto on_error;
+	}
 	if( source_name != NULL )
 	{
 		memory_free(
@@ -1816,19 +2385,19 @@ on_error:
 	return( -1 );
 }
 
-/* Exports the records
- * Returns the 1 if successful, 0 if no records are available or -1 on error
+/* Writes a JSON string value preceded by a prefix
+ * The string is escaped while it is written
+ * Returns 1 if successful or -1 on error
  */
-int export_handle_export_records(
+int export_handle_write_json_string(
      export_handle_t *export_handle,
-     libevt_file_t *file,
-     log_handle_t *log_handle,
+     record_buffer_t *record_buffer,
+     const char *prefix,
+     const system_character_t *string,
+     size_t string_length,
      libcerror_error_t **error )
 {
-	libevt_record_t *record = NULL;
-	static char *function   = "export_handle_export_records";
-	int number_of_records   = 0;
-	int record_index        = 0;
+	static char *function = "export_handle_write_json_string";
 
 	if( export_handle == NULL )
 	{
@@ -1841,102 +2410,1862 @@ int export_handle_export_records(
 
 		return( -1 );
 	}
-	if( file == NULL )
+	if( record_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 "%s: invalid record buffer.",
 		 function );
 
 		return( -1 );
 	}
-	if( libevt_file_get_number_of_records(
-	     file,
-	     &number_of_records,
-	     error ) != 1 )
+	if( ( output_handle_write_string(
+	       record_buffer->output_handle,
+	       prefix,
+	       error ) != 1 )
+	 || ( output_handle_write_character(
+	       record_buffer->output_handle,
+	       '"',
+	       error ) != 1 )
+	 || ( output_handle_set_escape_mode(
+	       record_buffer->output_handle,
+	       OUTPUT_HANDLE_ESCAPE_MODE_JSON,
+	       error ) != 1 )
+	 || ( output_handle_write_system_string(
+	       record_buffer->output_handle,
+	       string,
+	       string_length,
+	       error ) != 1 )
+	 || ( output_handle_set_escape_mode(
+	       record_buffer->output_handle,
+	       OUTPUT_HANDLE_ESCAPE_MODE_NONE,
+	       error ) != 1 )
+	 || ( output_handle_write_character(
+	       record_buffer->output_handle,
+	       '"',
+	       error ) != 1 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of records.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write JSON string.",
 		 function );
 
 		return( -1 );
 	}
-	if( number_of_records == 0 )
-	{
-		return( 0 );
-	}
+	return( 1 );
+}
+
+/* Writes a JSON POSIX time value preceded by a prefix
+ * A value of 0 is written as null
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_json_posix_time(
+     export_handle_t *export_handle,
+     record_buffer_t *record_buffer,
+     const char *prefix,
+     uint32_t value_32bit,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_write_json_posix_time";
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record buffer.",
+		 function );
+
+		return( -1 );
+	}
+	result = output_handle_write_string(
+	          record_buffer->output_handle,
+	          prefix,
+	          error );
+
+	if( result == 1 )
+	{
+		if( value_32bit == 0 )
+		{
+			result = output_handle_write_string(
+			          record_buffer->output_handle,
+			          "null",
+			          error );
+		}
+		else
+		{
+			result = output_handle_write_character(
+			          record_buffer->output_handle,
+			          '"',
+			          error );
+
+			if( result == 1 )
+			{
+				result = output_handle_write_posix_time(
+				          record_buffer->output_handle,
+				          (int32_t) value_32bit,
+				          OUTPUT_HANDLE_DATE_TIME_FORMAT_ISO8601,
+				          error );
+			}
+			if( result == 1 )
+			{
+				result = output_handle_write_character(
+				          record_buffer->output_handle,
+				          '"',
+				          error );
+			}
+		}
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write JSON POSIX time value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the message string of an event source
+ * The message string is copied into the record buffer
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int export_handle_get_message_string(
+     export_handle_t *export_handle,
+     record_buffer_t *record_buffer,
+     const system_character_t *event_source,
+     size_t event_source_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     uint32_t message_identifier,
+     message_string_t **message_string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_get_message_string";
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string.",
+		 function );
+
+		return( -1 );
+	}
+	*message_string = NULL;
+
+	if( event_source == NULL )
+	{
+		return( 0 );
+	}
+	result = message_handle_copy_message_string_by_event_source(
+	          export_handle->message_handle,
+	          event_source,
+	          event_source_length,
+	          value_name,
+	          value_name_length,
+	          message_identifier,
+	          NULL,
+	          NULL,
+	          record_buffer->message_string,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve message string: 0x%08" PRIx32 ".",
+		 function,
+		 message_identifier );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*message_string = record_buffer->message_string;
+	}
+	return( result );
+}
+
+/* Exports the record as a JSON object on a single line
+ * Strings are escaped while they are written and the record values are retrieved
+ * into buffers that are reused between records
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_record_jsonl(
+     export_handle_t *export_handle,
+     record_buffer_t *record_buffer,
+     libevt_record_t *record,
+     log_handle_t *log_handle EVTTOOLS_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	message_string_t *message_string = NULL;
+	system_character_t *source_name  = NULL;
+	system_character_t *value_string = NULL;
+	static char *function            = "export_handle_export_record_jsonl";
+	size_t data_size                 = 0;
+	size_t source_name_size          = 0;
+	size_t string_index              = 0;
+	size_t value_string_size         = 0;
+	uint32_t event_identifier        = 0;
+	uint32_t value_32bit             = 0;
+	uint16_t event_category          = 0;
+	uint16_t event_type              = 0;
+	int number_of_strings            = 0;
+	int result                       = 0;
+	int value_string_index           = 0;
+
+	EVTTOOLS_UNREFERENCED_PARAMETER( log_handle )
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevt_record_get_identifier(
+	     record,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( output_handle_write_string(
+	       record_buffer->output_handle,
+	       "{\"identifier\":",
+	       error ) != 1 )
+	 || ( output_handle_write_decimal(
+	       record_buffer->output_handle,
+	       (uint64_t) value_32bit,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_record_get_creation_time(
+	     record,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve creation time.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_write_json_posix_time(
+	     export_handle,
+	     record_buffer,
+	     ",\"creation_time\":",
+	     value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write creation time.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_record_get_written_time(
+	     record,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve written time.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_write_json_posix_time(
+	     export_handle,
+	     record_buffer,
+	     ",\"written_time\":",
+	     value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write written time.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_record_get_event_identifier(
+	     record,
+	     &event_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_record_get_event_type(
+	     record,
+	     &event_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event type.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_record_get_event_category(
+	     record,
+	     &event_category,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event category.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( output_handle_write_string(
+	       record_buffer->output_handle,
+	       ",\"event_identifier\":",
+	       error ) != 1 )
+	 || ( output_handle_write_decimal(
+	       record_buffer->output_handle,
+	       (uint64_t) event_identifier,
+	       error ) != 1 )
+	 || ( output_handle_write_string(
+	       record_buffer->output_handle,
+	       ",\"event_type\":",
+	       error ) != 1 )
+	 || ( output_handle_write_decimal(
+	       record_buffer->output_handle,
+	       (uint64_t) event_type,
+	       error ) != 1 )
+	 || ( output_handle_write_string(
+	       record_buffer->output_handle,
+	       ",\"event_type_string\":\"",
+	       error ) != 1 )
+	 || ( output_handle_write_string(
+	       record_buffer->output_handle,
+	       export_handle_get_event_type(
+	        event_type ),
+	       error ) != 1 )
+	 || ( output_handle_write_string(
+	       record_buffer->output_handle,
+	       "\",\"event_category\":",
+	       error ) != 1 )
+	 || ( output_handle_write_decimal(
+	       record_buffer->output_handle,
+	       (uint64_t) event_category,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write event values.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libevt_record_get_utf16_source_name_size(
+	          record,
+	          &source_name_size,
+	          error );
+#else
+	result = libevt_record_get_utf8_source_name_size(
+	          record,
+	          &source_name_size,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve source name size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( result != 0 )
+	 && ( source_name_size > 0 ) )
+	{
+		if( record_buffer_resize_buffer(
+		     &( record_buffer->source_name_buffer ),
+		     &( record_buffer->source_name_buffer_size ),
+		     sizeof( system_character_t ) * source_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize source name buffer.",
+			 function );
+
+			goto on_error;
+		}
+		source_name = (system_character_t *) record_buffer->source_name_buffer;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libevt_record_get_utf16_source_name(
+		          record,
+		          (uint16_t *) source_name,
+		          source_name_size,
+		          error );
+#else
+		result = libevt_record_get_utf8_source_name(
+		          record,
+		          (uint8_t *) source_name,
+		          source_name_size,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source name.",
+			 function );
+
+			goto on_error;
+		}
+		if( export_handle_write_json_string(
+		     export_handle,
+		     record_buffer,
+		     ",\"source_name\":",
+		     source_name,
+		     source_name_size - 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write source name.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libevt_record_get_utf16_computer_name_size(
+	          record,
+	          &value_string_size,
+	          error );
+#else
+	result = libevt_record_get_utf8_computer_name_size(
+	          record,
+	          &value_string_size,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve computer name size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( result != 0 )
+	 && ( value_string_size > 0 ) )
+	{
+		if( record_buffer_resize_buffer(
+		     &( record_buffer->value_string_buffer ),
+		     &( record_buffer->value_string_buffer_size ),
+		     sizeof( system_character_t ) * value_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize value string buffer.",
+			 function );
+
+			goto on_error;
+		}
+		value_string = (system_character_t *) record_buffer->value_string_buffer;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libevt_record_get_utf16_computer_name(
+		          record,
+		          (uint16_t *) value_string,
+		          value_string_size,
+		          error );
+#else
+		result = libevt_record_get_utf8_computer_name(
+		          record,
+		          (uint8_t *) value_string,
+		          value_string_size,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve computer name.",
+			 function );
+
+			goto on_error;
+		}
+		if( export_handle_write_json_string(
+		     export_handle,
+		     record_buffer,
+		     ",\"computer_name\":",
+		     value_string,
+		     value_string_size - 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write computer name.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libevt_record_get_utf16_user_security_identifier_size(
+	          record,
+	          &value_string_size,
+	          error );
+#else
+	result = libevt_record_get_utf8_user_security_identifier_size(
+	          record,
+	          &value_string_size,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve user security identifier size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( result != 0 )
+	 && ( value_string_size > 0 ) )
+	{
+		if( record_buffer_resize_buffer(
+		     &( record_buffer->value_string_buffer ),
+		     &( record_buffer->value_string_buffer_size ),
+		     sizeof( system_character_t ) * value_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize value string buffer.",
+			 function );
+
+			goto on_error;
+		}
+		value_string = (system_character_t *) record_buffer->value_string_buffer;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libevt_record_get_utf16_user_security_identifier(
+		          record,
+		          (uint16_t *) value_string,
+		          value_string_size,
+		          error );
+#else
+		result = libevt_record_get_utf8_user_security_identifier(
+		          record,
+		          (uint8_t *) value_string,
+		          value_string_size,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve user security identifier.",
+			 function );
+
+			goto on_error;
+		}
+		if( export_handle_write_json_string(
+		     export_handle,
+		     record_buffer,
+		     ",\"user_security_identifier\":",
+		     value_string,
+		     value_string_size - 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write user security identifier.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	result = export_handle_get_message_string(
+	          export_handle,
+	          record_buffer,
+	          source_name,
+	          source_name_size - 1,
+	          _SYSTEM_STRING( "CategoryMessageFile" ),
+	          19,
+	          (uint32_t) event_category,
+	          &message_string,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event category message string.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		/* The event category is the first line of the message string
+		 */
+		for( string_index = 0;
+		     string_index < message_string->string_size;
+		     string_index++ )
+		{
+			if( ( ( message_string->string )[ string_index ] == 0 )
+			 || ( ( message_string->string )[ string_index ] == (system_character_t) '\n' )
+			 || ( ( message_string->string )[ string_index ] == (system_character_t) '\r' ) )
+			{
+				break;
+			}
+		}
+		if( export_handle_write_json_string(
+		     export_handle,
+		     record_buffer,
+		     ",\"event_category_string\":",
+		     message_string->string,
+		     string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write event category string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libevt_record_get_number_of_strings(
+	     record,
+	     &number_of_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of strings in record.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_handle_write_string(
+	     record_buffer->output_handle,
+	     ",\"strings\":[",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write strings.",
+		 function );
+
+		goto on_error;
+	}
+	for( value_string_index = 0;
+	     value_string_index < number_of_strings;
+	     value_string_index++ )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libevt_record_get_utf16_string_size(
+			  record,
+			  value_string_index,
+			  &value_string_size,
+			  error );
+#else
+		result = libevt_record_get_utf8_string_size(
+			  record,
+			  value_string_index,
+			  &value_string_size,
+			  error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string: %d size.",
+			 function,
+			 value_string_index );
+
+			goto on_error;
+		}
+		if( value_string_size > 0 )
+		{
+			if( record_buffer_resize_buffer(
+			     &( record_buffer->value_string_buffer ),
+			     &( record_buffer->value_string_buffer_size ),
+			     sizeof( system_character_t ) * value_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize value string buffer.",
+				 function );
+
+				goto on_error;
+			}
+			value_string = (system_character_t *) record_buffer->value_string_buffer;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libevt_record_get_utf16_string(
+				  record,
+				  value_string_index,
+				  (uint16_t *) value_string,
+				  value_string_size,
+				  error );
+#else
+			result = libevt_record_get_utf8_string(
+				  record,
+				  value_string_index,
+				  (uint8_t *) value_string,
+				  value_string_size,
+				  error );
+#endif
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve string: %d.",
+				 function,
+				 value_string_index );
+
+				goto on_error;
+			}
+			result = export_handle_write_json_string(
+			          export_handle,
+			          record_buffer,
+			          ( value_string_index == 0 ) ? "" : ",",
+			          value_string,
+			          value_string_size - 1,
+			          error );
+		}
+		else
+		{
+			result = export_handle_write_json_string(
+			          export_handle,
+			          record_buffer,
+			          ( value_string_index == 0 ) ? "" : ",",
+			          _SYSTEM_STRING( "" ),
+			          0,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write string: %d.",
+			 function,
+			 value_string_index );
+
+			goto on_error;
+		}
+	}
+	if( output_handle_write_character(
+	     record_buffer->output_handle,
+	     ']',
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write strings.",
+		 function );
+
+		goto on_error;
+	}
+	result = export_handle_get_message_string(
+	          export_handle,
+	          record_buffer,
+	          source_name,
+	          source_name_size - 1,
+	          _SYSTEM_STRING( "EventMessageFile" ),
+	          16,
+	          event_identifier,
+	          &message_string,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event message string.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( ( output_handle_write_string(
+		       record_buffer->output_handle,
+		       ",\"message\":\"",
+		       error ) != 1 )
+		 || ( output_handle_set_escape_mode(
+		       record_buffer->output_handle,
+		       OUTPUT_HANDLE_ESCAPE_MODE_JSON,
+		       error ) != 1 )
+		 || ( message_string_write_expanded(
+		       message_string,
+		       record,
+		       record_buffer->output_handle,
+		       error ) != 1 )
+		 || ( output_handle_set_escape_mode(
+		       record_buffer->output_handle,
+		       OUTPUT_HANDLE_ESCAPE_MODE_NONE,
+		       error ) != 1 )
+		 || ( output_handle_write_character(
+		       record_buffer->output_handle,
+		       '"',
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write message.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	result = libevt_record_get_data_size(
+	          record,
+	          &data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( result != 0 )
+	 && ( data_size > 0 ) )
+	{
+		if( record_buffer_resize_buffer(
+		     &( record_buffer->data_buffer ),
+		     &( record_buffer->data_buffer_size ),
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize data buffer.",
+			 function );
+
+			goto on_error;
+		}
+		if( libevt_record_get_data(
+		     record,
+		     record_buffer->data_buffer,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( output_handle_write_string(
+		       record_buffer->output_handle,
+		       ",\"data\":\"",
+		       error ) != 1 )
+		 || ( output_handle_write_base64(
+		       record_buffer->output_handle,
+		       record_buffer->data_buffer,
+		       data_size,
+		       error ) != 1 )
+		 || ( output_handle_write_character(
+		       record_buffer->output_handle,
+		       '"',
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( output_handle_write_string(
+	     record_buffer->output_handle,
+	     "}\n",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write end of object.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	output_handle_set_escape_mode(
+	 record_buffer->output_handle,
+	 OUTPUT_HANDLE_ESCAPE_MODE_NONE,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Exports the records
+ * Returns the 1 if successful, 0 if no records are available or -1 on error
+ */
+int export_handle_export_records(
+     export_handle_t *export_handle,
+     libevt_file_t *file,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libevt_record_t *record = NULL;
+	static char *function   = "export_handle_export_records";
+	int number_of_records   = 0;
+	int record_index        = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	int result              = 0;
+#endif
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->number_of_threads > 1 )
+	{
+		result = export_handle_export_records_parallel(
+		          export_handle,
+		          file,
+		          log_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export records using multiple threads.",
+			 function );
+		}
+		return( result );
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	if( libevt_file_get_number_of_records(
+	     file,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records == 0 )
+	{
+		return( 0 );
+	}
 	for( record_index = 0;
 	     record_index < number_of_records;
 	     record_index++ )
 	{
-		if( export_handle->abort != 0 )
-		{
-			return( -1 );
-		}
-		if( libevt_file_get_record_by_index(
-		     file,
-		     record_index,
-		     &record,
-		     error ) != 1 )
+		if( export_handle->abort != 0 )
+		{
+			return( -1 );
+		}
+		if( libevt_file_get_record_by_index(
+		     file,
+		     record_index,
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		if( export_handle_export_record(
+		     export_handle,
+		     export_handle->record_buffer,
+		     record,
+		     log_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export record: %d.",
+			 function,
+			 record_index );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		if( libevt_record_free(
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record: %d.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Retrieves a record buffer that keeps the output of a record in memory
+ * A previously written record buffer is reused if available
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_get_record_buffer(
+     export_handle_t *export_handle,
+     record_buffer_t **record_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_get_record_buffer";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record buffer.",
+		 function );
+
+		return( -1 );
+	}
+	*record_buffer = NULL;
+
+	if( libcthreads_mutex_grab(
+	     export_handle->record_buffers_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab record buffers mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->number_of_unused_record_buffers > 0 )
+	{
+		export_handle->number_of_unused_record_buffers -= 1;
+
+		*record_buffer = export_handle->unused_record_buffers[ export_handle->number_of_unused_record_buffers ];
+
+		export_handle->unused_record_buffers[ export_handle->number_of_unused_record_buffers ] = NULL;
+	}
+	if( libcthreads_mutex_release(
+	     export_handle->record_buffers_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release record buffers mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( *record_buffer == NULL )
+	{
+		if( record_buffer_initialize(
+		     record_buffer,
+		     NULL,
+		     RECORD_BUFFER_INITIAL_OUTPUT_BUFFER_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *record_buffer != NULL )
+	{
+		record_buffer_free(
+		 record_buffer,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes a record buffer in record index order
+ * The record buffer is kept until the record buffers of all preceding records
+ * have been written. The export handle takes over management of the record buffer,
+ * also on error
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_record_buffer(
+     export_handle_t *export_handle,
+     int record_index,
+     record_buffer_t *record_buffer,
+     libcerror_error_t **error )
+{
+	record_buffer_t *pending_record_buffer = NULL;
+	static char *function                  = "export_handle_write_record_buffer";
+	int result                             = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( record_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_index < 0 )
+	 || ( record_index >= export_handle->number_of_records ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record index value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_grab(
+	     export_handle->record_buffers_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab record buffers mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( record_index < export_handle->next_record_index )
+	 || ( export_handle->pending_record_buffers[ record_index ] != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record buffer: %d value already set.",
+		 function,
+		 record_index );
+
+		result = -1;
+	}
+	else
+	{
+		export_handle->pending_record_buffers[ record_index ] = record_buffer;
+
+		record_buffer = NULL;
+	}
+	/* The thread that provides the next record in order writes all consecutive
+	 * pending record buffers, other threads return directly
+	 */
+	while( ( result == 1 )
+	    && ( export_handle->next_record_index < export_handle->number_of_records ) )
+	{
+		pending_record_buffer = export_handle->pending_record_buffers[ export_handle->next_record_index ];
+
+		if( pending_record_buffer == NULL )
+		{
+			break;
+		}
+		export_handle->pending_record_buffers[ export_handle->next_record_index ] = NULL;
+
+		export_handle->next_record_index += 1;
+
+		if( output_handle_write_buffered_data(
+		     export_handle->record_buffer->output_handle,
+		     pending_record_buffer->output_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write record buffer: %d.",
+			 function,
+			 export_handle->next_record_index - 1 );
+
+			result = -1;
+		}
+		export_handle->unused_record_buffers[ export_handle->number_of_unused_record_buffers ] = pending_record_buffer;
+
+		export_handle->number_of_unused_record_buffers += 1;
+	}
+	if( libcthreads_mutex_release(
+	     export_handle->record_buffers_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release record buffers mutex.",
+		 function );
+
+		result = -1;
+	}
+	if( record_buffer != NULL )
+	{
+		record_buffer_free(
+		 &record_buffer,
+		 NULL );
+	}
+	return( result );
+
+on_error:
+	if( record_buffer != NULL )
+	{
+		record_buffer_free(
+		 &record_buffer,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Exports a record that is parsed by one of the threads
+ * The record is written into a separate record buffer, which is written in record index order
+ * Returns 1 if successful, 0 to stop or -1 on error
+ */
+int export_handle_export_record_callback(
+     libevt_record_t *record,
+     int record_index,
+     void *user_data,
+     libcerror_error_t **error )
+{
+	export_handle_t *export_handle = NULL;
+	record_buffer_t *record_buffer = NULL;
+	static char *function          = "export_handle_export_record_callback";
+
+	if( user_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid user data.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle = (export_handle_t *) user_data;
+
+	if( export_handle->abort != 0 )
+	{
+		return( 0 );
+	}
+	if( export_handle_get_record_buffer(
+	     export_handle,
+	     &record_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_export_record(
+	     export_handle,
+	     record_buffer,
+	     record,
+	     export_handle->log_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to export record: %d.",
+		 function,
+		 record_index );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+#endif
+		libcerror_error_free(
+		 error );
+
+		/* Discard the partial output of the record so that its record index
+		 * does not block the records that follow
+		 */
+		output_handle_clear_buffer(
+		 record_buffer->output_handle,
+		 NULL );
+	}
+	if( export_handle_write_record_buffer(
+	     export_handle,
+	     record_index,
+	     record_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write record: %d.",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Exports the records using multiple threads
+ * The records are read, their messages resolved and formatted by a pool of threads
+ * and the resulting record buffers are written in record index order
+ * Returns the 1 if successful, 0 if no records are available or -1 on error
+ */
+int export_handle_export_records_parallel(
+     export_handle_t *export_handle,
+     libevt_file_t *file,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_export_records_parallel";
+	int number_of_records = 0;
+	int result            = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->record_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing record buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->record_buffers_mutex != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - record buffers mutex value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevt_file_get_number_of_records(
+	     file,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records == 0 )
+	{
+		return( 0 );
+	}
+	if( ( number_of_records < 0 )
+	 || ( (size_t) number_of_records > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( record_buffer_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every record buffer is either pending or unused once it has been written
+	 * and there are at most as many record buffers as records
+	 */
+	export_handle->pending_record_buffers = (record_buffer_t **) memory_allocate(
+	                                                              sizeof( record_buffer_t * ) * number_of_records );
+
+	if( export_handle->pending_record_buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create pending record buffers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     export_handle->pending_record_buffers,
+	     0,
+	     sizeof( record_buffer_t * ) * number_of_records ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear pending record buffers.",
+		 function );
+
+		goto on_error;
+	}
+	export_handle->unused_record_buffers = (record_buffer_t **) memory_allocate(
+	                                                             sizeof( record_buffer_t * ) * number_of_records );
+
+	if( export_handle->unused_record_buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create unused record buffers.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( export_handle->record_buffers_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record buffers mutex.",
+		 function );
+
+		goto on_error;
+	}
+	export_handle->number_of_records               = number_of_records;
+	export_handle->next_record_index               = 0;
+	export_handle->number_of_unused_record_buffers = 0;
+	export_handle->log_handle                      = log_handle;
+
+	/* The records are parsed without preserving their order so that
+	 * the threads do not wait on each other while formatting
+	 */
+	if( libevt_file_parse_records_parallel(
+	     file,
+	     export_handle->number_of_threads,
+	     &export_handle_export_record_callback,
+	     (void *) export_handle,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to parse records.",
+		 function );
+
+		result = -1;
+	}
+	else if( export_handle->abort != 0 )
+	{
+		result = -1;
+	}
+	if( export_handle_free_record_buffers(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record buffers.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+
+on_error:
+	export_handle_free_record_buffers(
+	 export_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Frees the record buffers used to export the records using multiple threads
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_free_record_buffers(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function   = "export_handle_free_record_buffers";
+	int record_buffer_index = 0;
+	int result              = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->pending_record_buffers != NULL )
+	{
+		for( record_buffer_index = export_handle->next_record_index;
+		     record_buffer_index < export_handle->number_of_records;
+		     record_buffer_index++ )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve record: %d.",
-			 function,
-			 record_index );
+			if( record_buffer_free(
+			     &( export_handle->pending_record_buffers[ record_buffer_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free pending record buffer: %d.",
+				 function,
+				 record_buffer_index );
 
-			return( -1 );
+				result = -1;
+			}
 		}
-		if( export_handle_export_record(
-		     export_handle,
-		     record,
-		     log_handle,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export record: %d.",
-			 function,
-			 record_index );
+		memory_free(
+		 export_handle->pending_record_buffers );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
+		export_handle->pending_record_buffers = NULL;
+	}
+	if( export_handle->unused_record_buffers != NULL )
+	{
+		for( record_buffer_index = 0;
+		     record_buffer_index < export_handle->number_of_unused_record_buffers;
+		     record_buffer_index++ )
+		{
+			if( record_buffer_free(
+			     &( export_handle->unused_record_buffers[ record_buffer_index ] ),
+			     error ) != 1 )
 			{
-				libcnotify_print_error_backtrace(
-				 *error );
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free unused record buffer: %d.",
+				 function,
+				 record_buffer_index );
+
+				result = -1;
 			}
-#endif
-			libcerror_error_free(
-			 error );
 		}
-		if( libevt_record_free(
-		     &record,
+		memory_free(
+		 export_handle->unused_record_buffers );
+
+		export_handle->unused_record_buffers = NULL;
+	}
+	if( export_handle->record_buffers_mutex != NULL )
+	{
+		if( libcthreads_mutex_free(
+		     &( export_handle->record_buffers_mutex ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free record: %d.",
-			 function,
-			 record_index );
+			 "%s: unable to free record buffers mutex.",
+			 function );
 
-			return( -1 );
+			result = -1;
 		}
 	}
-	return( 1 );
+	export_handle->number_of_records               = 0;
+	export_handle->next_record_index               = 0;
+	export_handle->number_of_unused_record_buffers = 0;
+	export_handle->log_handle                      = NULL;
+
+	return( result );
 }
 
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 /* Exports the recovered records
  * Returns the 1 if successful, 0 if no records are available or -1 on error
  */
@@ -2017,6 +4346,7 @@ int export_handle_export_recovered_records(
 		}
 		if( export_handle_export_record(
 		     export_handle,
+		     export_handle->record_buffer,
 		     record,
 		     log_handle,
 		     error ) != 1 )
@@ -2058,6 +4388,99 @@ int export_handle_export_recovered_records(
 	return( 1 );
 }
 
+/* Writes the resource file cache statistics to the log
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_log_resource_file_cache_statistics(
+     export_handle_t *export_handle,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	resource_file_cache_t *resource_file_cache = NULL;
+	static char *function                      = "export_handle_log_resource_file_cache_statistics";
+	int cache_index                            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing message handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( cache_index = 0;
+	     cache_index < 2;
+	     cache_index++ )
+	{
+		if( cache_index == 0 )
+		{
+			resource_file_cache = export_handle->message_handle->resource_file_cache;
+
+			log_handle_printf(
+			 log_handle,
+			 "Resource file cache statistics:\n" );
+		}
+		else
+		{
+			resource_file_cache = export_handle->message_handle->mui_resource_file_cache;
+
+			log_handle_printf(
+			 log_handle,
+			 "MUI resource file cache statistics:\n" );
+		}
+		if( resource_file_cache == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid message handle - missing resource file cache: %d.",
+			 function,
+			 cache_index );
+
+			return( -1 );
+		}
+		log_handle_printf(
+		 log_handle,
+		 "\tmaximum number of entries\t: %d\n",
+		 resource_file_cache->maximum_number_of_entries );
+
+		log_handle_printf(
+		 log_handle,
+		 "\tnumber of hits\t\t\t: %" PRIu64 "\n",
+		 resource_file_cache->number_of_hits );
+
+		log_handle_printf(
+		 log_handle,
+		 "\tnumber of misses\t\t: %" PRIu64 "\n",
+		 resource_file_cache->number_of_misses );
+
+		log_handle_printf(
+		 log_handle,
+		 "\tnumber of evictions\t\t: %" PRIu64 "\n",
+		 resource_file_cache->number_of_evictions );
+
+		log_handle_printf(
+		 log_handle,
+		 "\n" );
+	}
+	return( 1 );
+}
+
 /* Exports the records from the file
  * Returns the 1 if successful, 0 if no records are available or -1 on error
  */
@@ -2081,6 +4504,32 @@ int export_handle_export_file(
 
 		return( -1 );
 	}
+	if( export_handle->record_buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - record buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_buffer_initialize(
+	     &( export_handle->record_buffer ),
+	     export_handle->notify_stream,
+	     export_handle->output_buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record buffer.",
+		 function );
+
+		goto on_error;
+	}
 	if( export_handle->export_mode != EXPORT_MODE_RECOVERED )
 	{
 		result_records = export_handle_export_records(
@@ -2098,7 +4547,7 @@ int export_handle_export_file(
 			 "%s: unable to export records.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 	}
 	if( export_handle->export_mode != EXPORT_MODE_ITEMS )
@@ -2118,14 +4567,50 @@ int export_handle_export_file(
 			 "%s: unable to export recovered records.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 	}
+	if( export_handle_log_resource_file_cache_statistics(
+	     export_handle,
+	     log_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to log resource file cache statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( record_buffer_free(
+	     &( export_handle->record_buffer ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record buffer.",
+		 function );
+
+		goto on_error;
+	}
 	if( ( result_records != 0 )
 	 || ( result_recovered_records != 0 ) )
 	{
 		return( 1 );
 	}
 	return( 0 );
+
+on_error:
+	if( export_handle->record_buffer != NULL )
+	{
+		record_buffer_free(
+		 &( export_handle->record_buffer ),
+		 NULL );
+	}
+	return( -1 );
 }
 
@@ -27,15 +27,28 @@
 #include <types.h>
 
 #include "evttools_libcerror.h"
+#include "evttools_libcthreads.h"
 #include "evttools_libevt.h"
 #include "log_handle.h"
 #include "message_handle.h"
 #include "message_string.h"
+#include "output_handle.h"
+#include "record_buffer.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The maximum number of export threads
+ */
+#define EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS	256
+
+enum EXPORT_FORMATS
+{
+	EXPORT_FORMAT_JSONL			= (int) 'j',
+	EXPORT_FORMAT_TEXT			= (int) 't'
+};
+
 enum EXPORT_MODES
 {
 	EXPORT_MODE_ALL				= (int) 'a',
@@ -47,6 +60,10 @@ typedef struct export_handle export_handle_t;
 
 struct export_handle
 {
+	/* The export format
+	 */
+	uint8_t export_format;
+
 	/* The export mode
 	 */
 	uint8_t export_mode;
@@ -75,6 +92,48 @@ struct export_handle
 	 */
 	FILE *notify_stream;
 
+	/* The record buffer that writes to the notify stream
+	 */
+	record_buffer_t *record_buffer;
+
+	/* The output buffer size
+	 */
+	size_t output_buffer_size;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that serializes access to the record buffers of multiple threads
+	 */
+	libcthreads_mutex_t *record_buffers_mutex;
+
+	/* The record buffers that are waiting to be written, by record index
+	 */
+	record_buffer_t **pending_record_buffers;
+
+	/* The number of records
+	 */
+	int number_of_records;
+
+	/* The index of the next record to be written
+	 */
+	int next_record_index;
+
+	/* The record buffers that can be reused
+	 */
+	record_buffer_t **unused_record_buffers;
+
+	/* The number of record buffers that can be reused
+	 */
+	int number_of_unused_record_buffers;
+
+	/* The log handle used by the threads
+	 */
+	log_handle_t *log_handle;
+#endif
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -98,6 +157,11 @@ int export_handle_signal_abort(
      export_handle_t *export_handle,
      libcerror_error_t **error );
 
+int export_handle_set_export_format(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
 int export_handle_set_export_mode(
      export_handle_t *export_handle,
      const system_character_t *string,
@@ -143,6 +207,21 @@ int export_handle_set_resource_files_path(
      const system_character_t *path,
      libcerror_error_t **error );
 
+int export_handle_set_output_buffer_size(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_number_of_threads(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_resource_file_cache_size(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
 int export_handle_open_input(
      export_handle_t *export_handle,
      const system_character_t *filename,
@@ -154,6 +233,7 @@ int export_handle_close_input(
 
 int export_handle_posix_time_value_fprint(
      export_handle_t *export_handle,
+     record_buffer_t *record_buffer,
      const char *value_name,
      uint32_t value_32bit,
      libcerror_error_t **error );
@@ -162,6 +242,7 @@ int export_handle_posix_time_value_fprint(
  */
 int export_handle_export_record_event_category(
      export_handle_t *export_handle,
+     record_buffer_t *record_buffer,
      libevt_record_t *record,
      const system_character_t *event_source,
      size_t event_source_length,
@@ -170,6 +251,7 @@ int export_handle_export_record_event_category(
 
 int export_handle_export_record_event_message(
      export_handle_t *export_handle,
+     record_buffer_t *record_buffer,
      libevt_record_t *record,
      const system_character_t *event_source,
      size_t event_source_length,
@@ -179,6 +261,42 @@ int export_handle_export_record_event_message(
 
 int export_handle_export_record(
      export_handle_t *export_handle,
+     record_buffer_t *record_buffer,
+     libevt_record_t *record,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+/* Record specific JSON Lines export functions
+ */
+int export_handle_write_json_string(
+     export_handle_t *export_handle,
+     record_buffer_t *record_buffer,
+     const char *prefix,
+     const system_character_t *string,
+     size_t string_length,
+     libcerror_error_t **error );
+
+int export_handle_write_json_posix_time(
+     export_handle_t *export_handle,
+     record_buffer_t *record_buffer,
+     const char *prefix,
+     uint32_t value_32bit,
+     libcerror_error_t **error );
+
+int export_handle_get_message_string(
+     export_handle_t *export_handle,
+     record_buffer_t *record_buffer,
+     const system_character_t *event_source,
+     size_t event_source_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     uint32_t message_identifier,
+     message_string_t **message_string,
+     libcerror_error_t **error );
+
+int export_handle_export_record_jsonl(
+     export_handle_t *export_handle,
+     record_buffer_t *record_buffer,
      libevt_record_t *record,
      log_handle_t *log_handle,
      libcerror_error_t **error );
@@ -191,12 +309,48 @@ int export_handle_export_records(
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int export_handle_get_record_buffer(
+     export_handle_t *export_handle,
+     record_buffer_t **record_buffer,
+     libcerror_error_t **error );
+
+int export_handle_write_record_buffer(
+     export_handle_t *export_handle,
+     int record_index,
+     record_buffer_t *record_buffer,
+     libcerror_error_t **error );
+
+int export_handle_export_record_callback(
+     libevt_record_t *record,
+     int record_index,
+     void *user_data,
+     libcerror_error_t **error );
+
+int export_handle_export_records_parallel(
+     export_handle_t *export_handle,
+     libevt_file_t *file,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int export_handle_free_record_buffers(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 int export_handle_export_recovered_records(
      export_handle_t *export_handle,
      libevt_file_t *file,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+int export_handle_log_resource_file_cache_statistics(
+     export_handle_t *export_handle,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
 int export_handle_export_file(
      export_handle_t *export_handle,
      log_handle_t *log_handle,
@@ -420,6 +420,7 @@ int info_handle_file_fprint(
 	uint32_t major_version                   = 0;
 	uint32_t minor_version                   = 0;
 	int is_corrupted                         = 0;
+	int number_of_duplicate_records          = 0;
 	int number_of_recovered_records          = 0;
 	int number_of_records                    = 0;
 
@@ -506,6 +507,20 @@ int info_handle_file_fprint(
 
 		return( -1 );
 	}
+	if( libevt_file_get_number_of_duplicate_recovered_records(
+	     info_handle->input_file,
+	     &number_of_duplicate_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of duplicate recovered records.",
+		 function );
+
+		return( -1 );
+	}
 	fprintf(
 	 info_handle->notify_stream,
 	 "Windows Event Log (EVT) information:\n" );
@@ -526,6 +541,11 @@ int info_handle_file_fprint(
 	 "\tNumber of recovered records\t: %d\n",
 	 number_of_recovered_records );
 
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of recovered duplicates\t: %d\n",
+	 number_of_duplicate_records );
+
 	switch( info_handle->event_log_type )
 	{
 		case EVTTOOLS_EVENT_LOG_TYPE_APPLICATION:
@@ -30,8 +30,8 @@
 #include "evttools_libcerror.h"
 #include "evttools_libcpath.h"
 #include "evttools_libcsplit.h"
+#include "evttools_libcthreads.h"
 #include "evttools_libevt.h"
-#include "evttools_libfcache.h"
 #include "evttools_libfwevt.h"
 #include "evttools_libregf.h"
 #include "evttools_system_split_string.h"
@@ -41,6 +41,7 @@
 #include "path_handle.h"
 #include "registry_file.h"
 #include "resource_file.h"
+#include "resource_file_cache.h"
 
 /* Creates a message handle
  * Make sure the value message_handle is referencing, is set to NULL
@@ -120,9 +121,9 @@ int message_handle_initialize(
 
 		goto on_error;
 	}
-	if( libfcache_cache_initialize(
+	if( resource_file_cache_initialize(
 	     &( ( *message_handle )->resource_file_cache ),
-	     16,
+	     RESOURCE_FILE_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -134,9 +135,9 @@ int message_handle_initialize(
 
 		goto on_error;
 	}
-	if( libfcache_cache_initialize(
+	if( resource_file_cache_initialize(
 	     &( ( *message_handle )->mui_resource_file_cache ),
-	     16,
+	     RESOURCE_FILE_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -148,6 +149,49 @@ int message_handle_initialize(
 
 		goto on_error;
 	}
+	if( string_cache_initialize(
+	     &( ( *message_handle )->event_source_cache ),
+	     STRING_CACHE_DEFAULT_NUMBER_OF_BUCKETS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create event source cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( string_cache_initialize(
+	     &( ( *message_handle )->resource_file_path_cache ),
+	     STRING_CACHE_DEFAULT_NUMBER_OF_BUCKETS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create resource file path cache.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *message_handle )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	( *message_handle )->ascii_codepage                = LIBREGF_CODEPAGE_WINDOWS_1252;
 	( *message_handle )->preferred_language_identifier = 0x00000409UL;
 
@@ -156,9 +200,27 @@ int message_handle_initialize(
 on_error:
 	if( *message_handle != NULL )
 	{
+		if( ( *message_handle )->resource_file_path_cache != NULL )
+		{
+			string_cache_free(
+			 &( ( *message_handle )->resource_file_path_cache ),
+			 NULL );
+		}
+		if( ( *message_handle )->event_source_cache != NULL )
+		{
+			string_cache_free(
+			 &( ( *message_handle )->event_source_cache ),
+			 NULL );
+		}
+		if( ( *message_handle )->mui_resource_file_cache != NULL )
+		{
+			resource_file_cache_free(
+			 &( ( *message_handle )->mui_resource_file_cache ),
+			 NULL );
+		}
 		if( ( *message_handle )->resource_file_cache != NULL )
 		{
-			libfcache_cache_free(
+			resource_file_cache_free(
 			 &( ( *message_handle )->resource_file_cache ),
 			 NULL );
 		}
@@ -269,7 +331,7 @@ int message_handle_free(
 
 			result = -1;
 		}
-		if( libfcache_cache_free(
+		if( resource_file_cache_free(
 		     &( ( *message_handle )->resource_file_cache ),
 		     error ) != 1 )
 		{
@@ -282,7 +344,7 @@ int message_handle_free(
 
 			result = -1;
 		}
-		if( libfcache_cache_free(
+		if( resource_file_cache_free(
 		     &( ( *message_handle )->mui_resource_file_cache ),
 		     error ) != 1 )
 		{
@@ -295,6 +357,32 @@ int message_handle_free(
 
 			result = -1;
 		}
+		if( string_cache_free(
+		     &( ( *message_handle )->event_source_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free event source cache.",
+			 function );
+
+			result = -1;
+		}
+		if( string_cache_free(
+		     &( ( *message_handle )->resource_file_path_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free resource file path cache.",
+			 function );
+
+			result = -1;
+		}
 		if( ( *message_handle )->winevt_publishers_key != NULL )
 		{
 			if( libregf_key_free(
@@ -343,6 +431,21 @@ int message_handle_free(
 				result = -1;
 			}
 		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *message_handle )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 *message_handle );
 
@@ -458,6 +561,58 @@ int message_handle_set_preferred_language_identifier(
 	return( 1 );
 }
 
+/* Sets the maximum number of resource files in the resource file caches
+ * Returns 1 if successful or -1 on error
+ */
+int message_handle_set_resource_file_cache_size(
+     message_handle_t *message_handle,
+     int maximum_number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "message_handle_set_resource_file_cache_size";
+
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file_cache_set_maximum_number_of_entries(
+	     message_handle->resource_file_cache,
+	     maximum_number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum number of entries in resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file_cache_set_maximum_number_of_entries(
+	     message_handle->mui_resource_file_cache,
+	     maximum_number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum number of entries in MUI resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Sets the name of the software registry file
  * Returns 1 if successful or -1 error
  */
@@ -1701,7 +1856,7 @@ int message_handle_close_input(
 			result = -1;
 		}
 	}
-	if( libfcache_cache_empty(
+	if( resource_file_cache_empty(
 	     message_handle->resource_file_cache,
 	     error ) != 1 )
 	{
@@ -1714,7 +1869,7 @@ int message_handle_close_input(
 
 		result = -1;
 	}
-	if( libfcache_cache_empty(
+	if( resource_file_cache_empty(
 	     message_handle->mui_resource_file_cache,
 	     error ) != 1 )
 	{
@@ -1727,6 +1882,34 @@ int message_handle_close_input(
 
 		result = -1;
 	}
+	/* The cached values depend on the eventlog key and paths of the input
+	 */
+	if( string_cache_empty(
+	     message_handle->event_source_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty event source cache.",
+		 function );
+
+		result = -1;
+	}
+	if( string_cache_empty(
+	     message_handle->resource_file_path_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty resource file path cache.",
+		 function );
+
+		result = -1;
+	}
 	return( result );
 }
 
@@ -1744,10 +1927,12 @@ int message_handle_get_value_by_event_source(
      size_t *value_string_size,
      libcerror_error_t **error )
 {
-	libregf_key_t *key     = NULL;
-	libregf_value_t *value = NULL;
-	static char *function  = "message_handle_get_value_by_event_source";
-	int result             = 0;
+	const system_character_t *cached_value_string = NULL;
+	libregf_key_t *key                            = NULL;
+	libregf_value_t *value                        = NULL;
+	static char *function                         = "message_handle_get_value_by_event_source";
+	size_t cached_value_string_size               = 0;
+	int result                                    = 0;
 
 	if( message_handle == NULL )
 	{
@@ -1793,6 +1978,72 @@ int message_handle_get_value_by_event_source(
 
 		return( -1 );
 	}
+	if( message_handle->event_source_cache != NULL )
+	{
+		result = string_cache_get_value(
+		          message_handle->event_source_cache,
+		          value_name,
+		          value_name_length,
+		          event_source,
+		          event_source_length,
+		          &cached_value_string,
+		          &cached_value_string_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %" PRIs_SYSTEM " of event source: %" PRIs_SYSTEM " from cache.",
+			 function,
+			 value_name,
+			 event_source );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			/* A cached value without a value string indicates the event source has no such value
+			 */
+			if( cached_value_string == NULL )
+			{
+				return( 0 );
+			}
+			*value_string = system_string_allocate(
+			                 cached_value_string_size );
+
+			if( *value_string == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create value string.",
+				 function );
+
+				goto on_error;
+			}
+			if( memory_copy(
+			     *value_string,
+			     cached_value_string,
+			     sizeof( system_character_t ) * cached_value_string_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy value string.",
+				 function );
+
+				goto on_error;
+			}
+			*value_string_size = cached_value_string_size;
+
+			return( 1 );
+		}
+	}
 	if( message_handle->control_set_1_eventlog_services_key != NULL )
 	{
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -1978,6 +2229,30 @@ int message_handle_get_value_by_event_source(
 			goto on_error;
 		}
 	}
+	if( message_handle->event_source_cache != NULL )
+	{
+		if( string_cache_set_value(
+		     message_handle->event_source_cache,
+		     value_name,
+		     value_name_length,
+		     event_source,
+		     event_source_length,
+		     *value_string,
+		     *value_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set value: %" PRIs_SYSTEM " of event source: %" PRIs_SYSTEM " in cache.",
+			 function,
+			 value_name,
+			 event_source );
+
+			goto on_error;
+		}
+	}
 	return( result );
 
 on_error:
@@ -2260,11 +2535,13 @@ int message_handle_get_resource_file_path(
      size_t *resource_file_path_size,
      libcerror_error_t **error )
 {
+	const system_character_t *cached_resource_file_path   = NULL;
 	system_character_t *resource_filename_string_segment  = NULL;
 	system_character_t *mui_string                        = NULL;
 	system_split_string_t *resource_filename_split_string = NULL;
 	system_character_t *safe_resource_file_path           = NULL;
 	static char *function                                 = "message_handle_get_resource_file_path";
+	size_t cached_resource_file_path_size                 = 0;
 	size_t mui_string_size                                = 0;
 	size_t resource_file_path_index                       = 0;
 	size_t resource_files_path_length                     = 0;
@@ -2394,6 +2671,71 @@ int message_handle_get_resource_file_path(
 
 		return( -1 );
 	}
+	if( message_handle->resource_file_path_cache != NULL )
+	{
+		result = string_cache_get_value(
+		          message_handle->resource_file_path_cache,
+		          language_string,
+		          language_string_length,
+		          resource_filename,
+		          resource_filename_length,
+		          &cached_resource_file_path,
+		          &cached_resource_file_path_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve resource file path from cache.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			/* A cached path without a value indicates the resource file was not found
+			 */
+			if( cached_resource_file_path == NULL )
+			{
+				return( 0 );
+			}
+			safe_resource_file_path = system_string_allocate(
+			                           cached_resource_file_path_size );
+
+			if( safe_resource_file_path == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create resource file path.",
+				 function );
+
+				goto on_error;
+			}
+			if( memory_copy(
+			     safe_resource_file_path,
+			     cached_resource_file_path,
+			     sizeof( system_character_t ) * cached_resource_file_path_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy resource file path.",
+				 function );
+
+				goto on_error;
+			}
+			*resource_file_path      = safe_resource_file_path;
+			*resource_file_path_size = cached_resource_file_path_size;
+
+			return( 1 );
+		}
+	}
 	if( resource_filename_length > 2 )
 	{
 		/* Check if the resource filename starts with a volume letter
@@ -2927,6 +3269,37 @@ int message_handle_get_resource_file_path(
 
 		goto on_error;
 	}
+	if( result == 0 )
+	{
+		memory_free(
+		 safe_resource_file_path );
+
+		safe_resource_file_path      = NULL;
+		safe_resource_file_path_size = 0;
+		resource_file_path_index     = 0;
+	}
+	if( message_handle->resource_file_path_cache != NULL )
+	{
+		if( string_cache_set_value(
+		     message_handle->resource_file_path_cache,
+		     language_string,
+		     language_string_length,
+		     resource_filename,
+		     resource_filename_length,
+		     safe_resource_file_path,
+		     resource_file_path_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set resource file path in cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	*resource_file_path      = safe_resource_file_path;
 	*resource_file_path_size = safe_resource_file_path_size;
 
@@ -2964,7 +3337,6 @@ int message_handle_get_resource_file(
      libcerror_error_t **error )
 {
 	static char *function = "message_handle_get_resource_file";
-	int64_t timestamp     = 0;
 
 	if( message_handle == NULL )
 	{
@@ -3032,46 +3404,20 @@ int message_handle_get_resource_file(
 
 		goto on_error;
 	}
-	if( libfcache_date_time_get_timestamp(
-	     &timestamp,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve cache timestamp.",
-		 function );
-
-		return( -1 );
-	}
-	if( libfcache_cache_set_value_by_index(
+	if( resource_file_cache_set_resource_file(
 	     message_handle->resource_file_cache,
-	     message_handle->next_resource_file_cache_index,
-	     0,
-	     message_handle->next_resource_file_cache_index,
-	     timestamp,
-	     (intptr_t *) *resource_file,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &resource_file_free,
-	     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	     *resource_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set resource file in cache entry: %d.",
-		 function,
-		 message_handle->next_resource_file_cache_index );
+		 "%s: unable to set resource file in cache.",
+		 function );
 
 		goto on_error;
 	}
-	message_handle->next_resource_file_cache_index++;
-
-	if( message_handle->next_resource_file_cache_index == 16 )
-	{
-		message_handle->next_resource_file_cache_index = 0;
-	}
 	return( 1 );
 
 on_error:
@@ -3094,10 +3440,8 @@ int message_handle_get_resource_file_from_cache(
      resource_file_t **resource_file,
      libcerror_error_t **error )
 {
-	libfcache_cache_value_t *cache_value = NULL;
-	static char *function                = "message_handle_get_resource_file_from_cache";
-	int cache_index                      = 0;
-	int result                           = 0;
+	static char *function = "message_handle_get_resource_file_from_cache";
+	int result            = 0;
 
 	if( message_handle == NULL )
 	{
@@ -3110,80 +3454,24 @@ int message_handle_get_resource_file_from_cache(
 
 		return( -1 );
 	}
-	if( resource_file == NULL )
+	result = resource_file_cache_get_resource_file(
+	          message_handle->resource_file_cache,
+	          resource_filename,
+	          resource_filename_length,
+	          resource_file,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid resource file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resource file from cache.",
 		 function );
 
 		return( -1 );
 	}
-	for( cache_index = 0;
-	     cache_index < 16;
-	     cache_index++ )
-	{
-		if( libfcache_cache_get_value_by_index(
-		     message_handle->resource_file_cache,
-		     cache_index,
-		     &cache_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve cache value: %d.",
-			 function,
-			 cache_index );
-
-			return( -1 );
-		}
-		if( cache_value != NULL )
-		{
-			if( libfcache_cache_value_get_value(
-			     cache_value,
-			     (intptr_t **) resource_file,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve resource file from cache value: %d.",
-				 function,
-				 cache_index );
-
-				return( -1 );
-			}
-		}
-		if( *resource_file != NULL )
-		{
-			if( ( resource_filename_length + 1 ) != ( *resource_file )->name_size )
-			{
-				*resource_file = NULL;
-			}
-			else if( system_string_compare(
-				  resource_filename,
-				  ( *resource_file )->name,
-				  resource_filename_length ) != 0 )
-			{
-				*resource_file = NULL;
-			}
-		}
-		if( *resource_file != NULL )
-		{
-			result = 1;
-
-			break;
-		}
-	}
-	if( result == 0 )
-	{
-		*resource_file = NULL;
-	}
 	return( result );
 }
 
@@ -3199,7 +3487,6 @@ int message_handle_get_mui_resource_file(
      libcerror_error_t **error )
 {
 	static char *function = "message_handle_get_mui_resource_file";
-	int64_t timestamp     = 0;
 
 	if( message_handle == NULL )
 	{
@@ -3267,50 +3554,24 @@ int message_handle_get_mui_resource_file(
 
 		goto on_error;
 	}
-	if( libfcache_date_time_get_timestamp(
-	     &timestamp,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve cache timestamp.",
-		 function );
-
-		return( -1 );
-	}
-	if( libfcache_cache_set_value_by_index(
+	if( resource_file_cache_set_resource_file(
 	     message_handle->mui_resource_file_cache,
-	     message_handle->next_mui_resource_file_cache_index,
-	     0,
-	     message_handle->next_mui_resource_file_cache_index,
-	     timestamp,
-	     (intptr_t *) *resource_file,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &resource_file_free,
-	     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	     *resource_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set resource file in cache entry: %d.",
-		 function,
-		 message_handle->next_mui_resource_file_cache_index );
+		 "%s: unable to set resource file in cache.",
+		 function );
 
 		goto on_error;
 	}
-	message_handle->next_mui_resource_file_cache_index++;
-
-	if( message_handle->next_mui_resource_file_cache_index == 16 )
-	{
-		message_handle->next_mui_resource_file_cache_index = 0;
-	}
 	return( 1 );
 
 on_error:
-	if( resource_file != NULL )
+	if( *resource_file != NULL )
 	{
 		resource_file_free(
 		 resource_file,
@@ -3329,10 +3590,8 @@ int message_handle_get_mui_resource_file_from_cache(
      resource_file_t **resource_file,
      libcerror_error_t **error )
 {
-	libfcache_cache_value_t *cache_value = NULL;
-	static char *function                = "message_handle_get_mui_resource_file_from_cache";
-	int cache_index                      = 0;
-	int result                           = 0;
+	static char *function = "message_handle_get_mui_resource_file_from_cache";
+	int result            = 0;
 
 	if( message_handle == NULL )
 	{
@@ -3345,76 +3604,24 @@ int message_handle_get_mui_resource_file_from_cache(
 
 		return( -1 );
 	}
-	if( resource_file == NULL )
+	result = resource_file_cache_get_resource_file(
+	          message_handle->mui_resource_file_cache,
+	          resource_filename,
+	          resource_filename_length,
+	          resource_file,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid resource file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resource file from cache.",
 		 function );
 
 		return( -1 );
 	}
-	for( cache_index = 0;
-	     cache_index < 16;
-	     cache_index++ )
-	{
-		if( libfcache_cache_get_value_by_index(
-		     message_handle->mui_resource_file_cache,
-		     cache_index,
-		     &cache_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve cache value: %d.",
-			 function,
-			 cache_index );
-
-			return( -1 );
-		}
-		if( cache_value != NULL )
-		{
-			if( libfcache_cache_value_get_value(
-			     cache_value,
-			     (intptr_t **) resource_file,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve resource file from cache value: %d.",
-				 function,
-				 cache_index );
-
-				return( -1 );
-			}
-		}
-		if( *resource_file != NULL )
-		{
-			if( ( resource_filename_length + 1 ) != ( *resource_file )->name_size )
-			{
-				*resource_file = NULL;
-			}
-			else if( system_string_compare(
-				  resource_filename,
-				  ( *resource_file )->name,
-				  resource_filename_length ) != 0 )
-			{
-				*resource_file = NULL;
-			}
-		}
-		if( *resource_file != NULL )
-		{
-			result = 1;
-
-			break;
-		}
-	}
 	return( result );
 }
 
@@ -3884,6 +4091,193 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves a copy of the message string of an event source
+ * The message filename is retrieved from the value of the event source and
+ * if message_filename is not NULL an allocated copy of it is returned
+ * The message string is copied so that it remains valid when the resource file
+ * cache changes. This function can be called from multiple threads
+ * Returns 1 if successful, 0 if not available or -1 error
+ */
+int message_handle_copy_message_string_by_event_source(
+     message_handle_t *message_handle,
+     const system_character_t *event_source,
+     size_t event_source_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     uint32_t message_identifier,
+     system_character_t **message_filename,
+     size_t *message_filename_size,
+     message_string_t *message_string,
+     libcerror_error_t **error )
+{
+	message_string_t *cached_message_string = NULL;
+	system_character_t *value_string        = NULL;
+	static char *function                   = "message_handle_copy_message_string_by_event_source";
+	size_t value_string_size                = 0;
+	int result                              = 0;
+
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( message_filename != NULL )
+	 && ( message_filename_size == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message filename size.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     message_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = message_handle_get_value_by_event_source(
+	          message_handle,
+	          event_source,
+	          event_source_length,
+	          value_name,
+	          value_name_length,
+	          &value_string,
+	          &value_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve message filename.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		result = message_handle_get_message_string(
+		          message_handle,
+		          value_string,
+		          value_string_size - 1,
+		          message_identifier,
+		          &cached_message_string,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve message string: 0x%08" PRIx32 " from: %" PRIs_SYSTEM ".",
+			 function,
+			 message_identifier,
+			 value_string );
+
+			goto on_error;
+		}
+		else if( ( result != 0 )
+		      && ( cached_message_string != NULL ) )
+		{
+			if( message_string_copy(
+			     message_string,
+			     cached_message_string,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy message string.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			result = 0;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     message_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		if( value_string != NULL )
+		{
+			memory_free(
+			 value_string );
+		}
+		return( -1 );
+	}
+#endif
+	if( message_filename != NULL )
+	{
+		*message_filename      = value_string;
+		*message_filename_size = value_string_size;
+	}
+	else if( value_string != NULL )
+	{
+		memory_free(
+		 value_string );
+	}
+	return( result );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 message_handle->mutex,
+	 NULL );
+#endif
+	if( value_string != NULL )
+	{
+		memory_free(
+		 value_string );
+	}
+	return( -1 );
+}
+
 /* Retrieves a specific resource file by provider identifier
  * Returns 1 if successful, 0 if not available or -1 error
  */
@@ -26,12 +26,14 @@
 #include <types.h>
 
 #include "evttools_libcerror.h"
-#include "evttools_libfcache.h"
+#include "evttools_libcthreads.h"
 #include "evttools_libregf.h"
 #include "message_string.h"
 #include "path_handle.h"
 #include "registry_file.h"
 #include "resource_file.h"
+#include "resource_file_cache.h"
+#include "string_cache.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -115,19 +117,19 @@ struct message_handle
 
 	/* The resource file cache
 	 */
-	libfcache_cache_t *resource_file_cache;
+	resource_file_cache_t *resource_file_cache;
 
-	/* The next available resource file cache index
+	/* The MUI resource file cache
 	 */
-	int next_resource_file_cache_index;
+	resource_file_cache_t *mui_resource_file_cache;
 
-	/* The MUI resource file cache
+	/* The event source cache, maps a value name and event source to the value string
 	 */
-	libfcache_cache_t *mui_resource_file_cache;
+	string_cache_t *event_source_cache;
 
-	/* The next available MUI resource file cache index
+	/* The resource file path cache, maps a language and resource filename to the resource file path
 	 */
-	int next_mui_resource_file_cache_index;
+	string_cache_t *resource_file_path_cache;
 
 	/* The ascii codepage
 	 */
@@ -136,6 +138,12 @@ struct message_handle
 	/* The preferred language identifier
 	 */
 	uint32_t preferred_language_identifier;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that serializes message string lookups of multiple threads
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
 };
 
 int message_handle_initialize(
@@ -160,6 +168,11 @@ int message_handle_set_preferred_language_identifier(
      uint32_t preferred_language_identifier,
      libcerror_error_t **error );
 
+int message_handle_set_resource_file_cache_size(
+     message_handle_t *message_handle,
+     int maximum_number_of_entries,
+     libcerror_error_t **error );
+
 int message_handle_set_event_log_type_from_filename(
      message_handle_t *message_handle,
      const system_character_t *filename,
@@ -287,6 +300,18 @@ int message_handle_get_message_string(
      message_string_t **message_string,
      libcerror_error_t **error );
 
+int message_handle_copy_message_string_by_event_source(
+     message_handle_t *message_handle,
+     const system_character_t *event_source,
+     size_t event_source_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     uint32_t message_identifier,
+     system_character_t **message_filename,
+     size_t *message_filename_size,
+     message_string_t *message_string,
+     libcerror_error_t **error );
+
 int message_handle_get_resource_file_by_provider_identifier(
      message_handle_t *message_handle,
      const system_character_t *resource_filename,
@@ -149,6 +149,106 @@ int message_string_free(
 	return( result );
 }
 
+/* Copies a message string
+ * The string of the destination message string is reused if it is large enough
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_copy(
+     message_string_t *destination_message_string,
+     const message_string_t *source_message_string,
+     libcerror_error_t **error )
+{
+	system_character_t *reallocation = NULL;
+	static char *function            = "message_string_copy";
+
+	if( destination_message_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination message string.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_message_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source message string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( source_message_string->string == NULL )
+	 && ( source_message_string->string_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid source message string - missing string.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_message_string->string_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid source message string - string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_message_string->string_size > destination_message_string->allocated_string_size )
+	{
+		reallocation = (system_character_t *) memory_reallocate(
+		                                       destination_message_string->string,
+		                                       sizeof( system_character_t ) * source_message_string->string_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize string.",
+			 function );
+
+			return( -1 );
+		}
+		destination_message_string->string                = reallocation;
+		destination_message_string->allocated_string_size = source_message_string->string_size;
+	}
+	if( source_message_string->string_size > 0 )
+	{
+		if( memory_copy(
+		     destination_message_string->string,
+		     source_message_string->string,
+		     sizeof( system_character_t ) * source_message_string->string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	destination_message_string->identifier  = source_message_string->identifier;
+	destination_message_string->string_size = source_message_string->string_size;
+
+	return( 1 );
+}
+
 /* Retrieve the message string from the message table resource
  * Returns 1 if successful, 0 if not available or -1 on error
  */
@@ -242,6 +342,8 @@ int message_string_get_from_message_table_resource(
 
 			goto on_error;
 		}
+		message_string->allocated_string_size = message_string->string_size;
+
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 		result = libwrc_message_table_resource_get_utf16_string(
 			  message_table_resource,
@@ -280,26 +382,29 @@ on_error:
 
 		message_string->string = NULL;
 	}
-	message_string->string_size = 0;
+	message_string->string_size           = 0;
+	message_string->allocated_string_size = 0;
 
 	return( -1 );
 }
 
-/* Prints the message string to a FILE stream
+/* Writes the message string with the conversion specifiers replaced by the record strings
  * Returns 1 if successful or -1 on error
  */
-int message_string_fprint(
+int message_string_write_expanded(
      message_string_t *message_string,
      libevt_record_t *record,
-     FILE *stream,
+     output_handle_t *output_handle,
      libcerror_error_t **error )
 {
 	system_character_t *value_string   = NULL;
-	static char *function              = "message_string_fprint";
+	static char *function              = "message_string_write_expanded";
 	size_t conversion_specifier_length = 0;
 	size_t message_string_length       = 0;
 	size_t message_string_index        = 0;
+	size_t run_length                  = 0;
 	size_t value_string_size           = 0;
+	system_character_t character       = 0;
 	system_character_t last_character  = 0;
 	int number_of_strings              = 0;
 	int result                         = 0;
@@ -330,16 +435,6 @@ int message_string_fprint(
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	fprintf(
-	 stream,
-	 "Message format string\t\t: %" PRIs_SYSTEM "\n",
-	 message_string->string );
-#endif
-	fprintf(
-	 stream,
-	 "Message string\t\t\t: " );
-
 	message_string_length = message_string->string_size - 1;
 	message_string_index  = 0;
 
@@ -348,10 +443,12 @@ int message_string_fprint(
 		if( ( ( message_string->string )[ message_string_index ] == (system_character_t) '%' )
 		 && ( ( message_string_index + 1 ) < message_string_length ) )
 		{
+			character = ( message_string->string )[ message_string_index + 1 ];
+
 /* TODO add support for more conversion specifiers */
 			/* Ignore %0 = end of string, %r = cariage return */
-			if( ( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) '0' )
-			 || ( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) 'r' ) )
+			if( ( character == (system_character_t) '0' )
+			 || ( character == (system_character_t) 'r' ) )
 			{
 				message_string_index += 2;
 
@@ -362,69 +459,58 @@ int message_string_fprint(
 			 *  %! = !
 			 *  %% = %
 			 *  %. = .
+			 *  %b = <space>
+			 *  %n = <new line>
+			 *  %t = <tab>
 			 */
-			if( ( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) ' ' )
-			 || ( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) '!' )
-			 || ( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) '%' )
-			 || ( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) '.' ) )
+			if( ( character == (system_character_t) ' ' )
+			 || ( character == (system_character_t) '!' )
+			 || ( character == (system_character_t) '%' )
+			 || ( character == (system_character_t) '.' )
+			 || ( character == (system_character_t) 'b' )
+			 || ( character == (system_character_t) 'n' )
+			 || ( character == (system_character_t) 't' ) )
 			{
-				last_character = ( message_string->string )[ message_string_index + 1 ];
-
-				fprintf(
-				 stream,
-				 "%c",
-				 last_character );
-
-				message_string_index += 2;
-
-				continue;
-			}
-			/* Replace %b = <space> */
-			if( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) 'b' )
-			{
-				last_character = (system_character_t) ' ';
-
-				fprintf(
-				 stream,
-				 "%c",
-				 last_character );
-
-				message_string_index += 2;
-
-				continue;
-			}
-			/* Replace %n = <new line> */
-			if( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) 'n' )
-			{
-				if( last_character != (system_character_t) '\n' )
+				if( character == (system_character_t) 'b' )
 				{
-					last_character = (system_character_t) '\n';
-
-					fprintf(
-					 stream,
-					 "%c",
-					 last_character );
+					character = (system_character_t) ' ';
 				}
-				message_string_index += 2;
-
-				continue;
-			}
-			/* Replace %t = <tab> */
-			if( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) 't' )
-			{
-				last_character = (system_character_t) '\t';
+				else if( character == (system_character_t) 'n' )
+				{
+					character = (system_character_t) '\n';
+				}
+				else if( character == (system_character_t) 't' )
+				{
+					character = (system_character_t) '\t';
+				}
+				/* Ignore multiple new lines
+				 */
+				if( ( character != (system_character_t) '\n' )
+				 || ( last_character != (system_character_t) '\n' ) )
+				{
+					last_character = character;
 
-				fprintf(
-				 stream,
-				 "%c",
-				 last_character );
+					if( output_handle_write_character(
+					     output_handle,
+					     (char) character,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_WRITE_FAILED,
+						 "%s: unable to write character.",
+						 function );
 
+						goto on_error;
+					}
+				}
 				message_string_index += 2;
 
 				continue;
 			}
-			if( ( ( message_string->string )[ message_string_index + 1 ] < (system_character_t) '1' )
-			 || ( ( message_string->string )[ message_string_index + 1 ] > (system_character_t) '9' ) )
+			if( ( character < (system_character_t) '1' )
+			 || ( character > (system_character_t) '9' ) )
 			{
 				libcerror_error_set(
 				 error,
@@ -436,7 +522,7 @@ int message_string_fprint(
 
 				goto on_error;
 			}
-			value_string_index = (int) ( message_string->string )[ message_string_index + 1 ] - (int) '0';
+			value_string_index = (int) character - (int) '0';
 
 			conversion_specifier_length = 2;
 
@@ -540,11 +626,23 @@ int message_string_fprint(
 
 						goto on_error;
 					}
-					fprintf(
-					 stream,
-					 "%" PRIs_SYSTEM "",
-					 value_string );
+					if( output_handle_write_system_string(
+					     output_handle,
+					     value_string,
+					     system_string_length(
+					      value_string ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_WRITE_FAILED,
+						 "%s: unable to write string: %d.",
+						 function,
+						 value_string_index );
 
+						goto on_error;
+					}
 					memory_free(
 					 value_string );
 
@@ -554,50 +652,101 @@ int message_string_fprint(
 			}
 			else
 			{
-				do
+				if( output_handle_write_system_string(
+				     output_handle,
+				     &( ( message_string->string )[ message_string_index ] ),
+				     conversion_specifier_length,
+				     error ) != 1 )
 				{
-					fprintf(
-					 stream,
-					 "%" PRIc_SYSTEM "",
-					 ( message_string->string )[ message_string_index++ ] );
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write conversion specifier.",
+					 function );
 
-					conversion_specifier_length--;
+					goto on_error;
 				}
-				while( conversion_specifier_length > 0 );
+				message_string_index += conversion_specifier_length;
 
 				last_character = ( message_string->string )[ message_string_index ];
 			}
 		}
 		else
 		{
-			if( ( message_string->string )[ message_string_index ] != 0 )
+			character = ( message_string->string )[ message_string_index ];
+
+			if( ( character == 0 )
+			 || ( character == (system_character_t) '\r' ) )
+			{
+				/* Ignore \r characters */
+			}
+			else if( character == (system_character_t) '\n' )
 			{
-				if( ( message_string->string )[ message_string_index ] == (system_character_t) '\r' )
+				/* Ignore multiple \n characters */
+				if( last_character != (system_character_t) '\n' )
 				{
-					/* Ignore \r characters */
+					last_character = character;
+
+					if( output_handle_write_character(
+					     output_handle,
+					     '\n',
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_WRITE_FAILED,
+						 "%s: unable to write new line.",
+						 function );
+
+						goto on_error;
+					}
 				}
-				else if( ( ( message_string->string )[ message_string_index ] == (system_character_t) '\n' )
-				      && ( last_character == (system_character_t) '\n' ) )
+			}
+			else
+			{
+				/* Write the characters up to the next special character at once
+				 */
+				run_length = 1;
+
+				while( ( message_string_index + run_length ) < message_string_length )
 				{
-					/* Ignore multiple \n characters */
+					character = ( message_string->string )[ message_string_index + run_length ];
+
+					if( ( character == 0 )
+					 || ( character == (system_character_t) '%' )
+					 || ( character == (system_character_t) '\r' )
+					 || ( character == (system_character_t) '\n' ) )
+					{
+						break;
+					}
+					run_length++;
 				}
-				else
+				if( output_handle_write_system_string(
+				     output_handle,
+				     &( ( message_string->string )[ message_string_index ] ),
+				     run_length,
+				     error ) != 1 )
 				{
-					fprintf(
-					 stream,
-					 "%" PRIc_SYSTEM "",
-					 ( message_string->string )[ message_string_index ] );
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write characters.",
+					 function );
 
-					last_character = ( message_string->string )[ message_string_index ];
+					goto on_error;
 				}
+				message_string_index += run_length;
+
+				last_character = ( message_string->string )[ message_string_index - 1 ];
+
+				continue;
 			}
 			message_string_index += 1;
 		}
 	}
-	fprintf(
-	 stream,
-	 "\n" );
-
 	return( 1 );
 
 on_error:
@@ -609,3 +758,97 @@ on_error:
 	return( -1 );
 }
 
+/* Prints the message string to an output handle
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_fprint(
+     message_string_t *message_string,
+     libevt_record_t *record,
+     output_handle_t *output_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "message_string_fprint";
+
+	if( message_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( ( output_handle_write_string(
+	       output_handle,
+	       "Message format string\t\t: ",
+	       error ) != 1 )
+	 || ( output_handle_write_system_string(
+	       output_handle,
+	       message_string->string,
+	       system_string_length(
+	        message_string->string ),
+	       error ) != 1 )
+	 || ( output_handle_write_character(
+	       output_handle,
+	       '\n',
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write message format string.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( output_handle_write_string(
+	     output_handle,
+	     "Message string\t\t\t: ",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write message string description.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_string_write_expanded(
+	     message_string,
+	     record,
+	     output_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write message string.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_handle_write_character(
+	     output_handle,
+	     '\n',
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write new line.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -29,6 +29,7 @@
 #include "evttools_libcerror.h"
 #include "evttools_libevt.h"
 #include "evttools_libwrc.h"
+#include "output_handle.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -49,6 +50,10 @@ struct message_string
 	/* The string size
 	 */
 	size_t string_size;
+
+	/* The allocated string size
+	 */
+	size_t allocated_string_size;
 };
 
 int message_string_initialize(
@@ -60,15 +65,26 @@ int message_string_free(
      message_string_t **message_string,
      libcerror_error_t **error );
 
+int message_string_copy(
+     message_string_t *destination_message_string,
+     const message_string_t *source_message_string,
+     libcerror_error_t **error );
+
 int message_string_get_from_message_table_resource(
      message_string_t *message_string,
      libwrc_message_table_resource_t *message_table_resource,
      libcerror_error_t **error );
 
+int message_string_write_expanded(
+     message_string_t *message_string,
+     libevt_record_t *record,
+     output_handle_t *output_handle,
+     libcerror_error_t **error );
+
 int message_string_fprint(
      message_string_t *message_string,
      libevt_record_t *record,
-     FILE *stream,
+     output_handle_t *output_handle,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
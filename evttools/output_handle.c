@@ -0,0 +1,1466 @@
+/*
+ * Buffered output handle
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_WRITEV )
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_SYS_UIO_H )
+#include <sys/uio.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#endif /* defined( HAVE_WRITEV ) */
+
+#include "evttools_libcerror.h"
+#include "output_handle.h"
+
+const char *output_handle_month_names = "JanFebMarAprMayJunJulAugSepOctNovDec";
+
+const char *output_handle_hexadecimal_digits = "0123456789abcdef";
+
+const char *output_handle_base64_digits = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/* Creates an output handle
+ * Make sure the value output_handle is referencing, is set to NULL
+ * A buffer size of 0 writes all data directly to the stream
+ * If stream is NULL the data is kept in the buffer, which grows as needed,
+ * until it is written to another output handle
+ * Returns 1 if successful or -1 on error
+ */
+int output_handle_initialize(
+     output_handle_t **output_handle,
+     FILE *stream,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "output_handle_initialize";
+
+	if( output_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *output_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid output handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*output_handle = memory_allocate_structure(
+	                  output_handle_t );
+
+	if( *output_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create output handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *output_handle,
+	     0,
+	     sizeof( output_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear output handle.",
+		 function );
+
+		memory_free(
+		 *output_handle );
+
+		*output_handle = NULL;
+
+		return( -1 );
+	}
+	if( buffer_size > 0 )
+	{
+		( *output_handle )->buffer = (uint8_t *) memory_allocate(
+		                                          sizeof( uint8_t ) * buffer_size );
+
+		if( ( *output_handle )->buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *output_handle )->stream      = stream;
+	( *output_handle )->buffer_size = buffer_size;
+	( *output_handle )->escape_mode = OUTPUT_HANDLE_ESCAPE_MODE_NONE;
+
+	if( stream != NULL )
+	{
+		/* Make sure data written to the stream before is not reordered
+		 */
+		if( fflush(
+		     stream ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush stream.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WRITEV )
+		( *output_handle )->file_descriptor = fileno(
+		                                       stream );
+
+		if( ( *output_handle )->file_descriptor == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file descriptor of stream.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+	}
+	return( 1 );
+
+on_error:
+	if( *output_handle != NULL )
+	{
+		if( ( *output_handle )->buffer != NULL )
+		{
+			memory_free(
+			 ( *output_handle )->buffer );
+		}
+		memory_free(
+		 *output_handle );
+
+		*output_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an output handle
+ * Any data remaining in the buffer is written to the stream first, if any
+ * Returns 1 if successful or -1 on error
+ */
+int output_handle_free(
+     output_handle_t **output_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "output_handle_free";
+	int result            = 1;
+
+	if( output_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *output_handle != NULL )
+	{
+		if( output_handle_flush(
+		     *output_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush output handle.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *output_handle )->buffer != NULL )
+		{
+			memory_free(
+			 ( *output_handle )->buffer );
+		}
+		memory_free(
+		 *output_handle );
+
+		*output_handle = NULL;
+	}
+	return( result );
+}
+
+/* Sets the escape mode
+ * The escape mode applies to characters and strings, not to data and numeric values
+ * Returns 1 if successful or -1 on error
+ */
+int output_handle_set_escape_mode(
+     output_handle_t *output_handle,
+     uint8_t escape_mode,
+     libcerror_error_t **error )
+{
+	static char *function = "output_handle_set_escape_mode";
+
+	if( output_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( escape_mode != OUTPUT_HANDLE_ESCAPE_MODE_NONE )
+	 && ( escape_mode != OUTPUT_HANDLE_ESCAPE_MODE_JSON ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported escape mode.",
+		 function );
+
+		return( -1 );
+	}
+	output_handle->escape_mode = escape_mode;
+
+	return( 1 );
+}
+
+/* Writes up to two segments of data directly to the stream
+ * If available the segments are written with a single writev call
+ * Returns 1 if successful or -1 on error
+ */
+int output_handle_write_segments(
+     output_handle_t *output_handle,
+     const uint8_t *first_segment,
+     size_t first_segment_size,
+     const uint8_t *second_segment,
+     size_t second_segment_size,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_WRITEV )
+	struct iovec io_vector[ 2 ];
+
+	ssize_t write_count    = 0;
+	int number_of_segments = 0;
+	int segment_index      = 0;
+#endif
+	static char *function  = "output_handle_write_segments";
+
+	if( output_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_handle->stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid output handle - missing stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_segment == NULL )
+	 && ( first_segment_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_segment_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid first segment size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( second_segment == NULL )
+	 && ( second_segment_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_segment_size > ( (size_t) SSIZE_MAX - first_segment_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid second segment size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WRITEV )
+	if( first_segment_size > 0 )
+	{
+		io_vector[ number_of_segments ].iov_base = (void *) first_segment;
+		io_vector[ number_of_segments ].iov_len  = first_segment_size;
+
+		number_of_segments++;
+	}
+	if( second_segment_size > 0 )
+	{
+		io_vector[ number_of_segments ].iov_base = (void *) second_segment;
+		io_vector[ number_of_segments ].iov_len  = second_segment_size;
+
+		number_of_segments++;
+	}
+	while( number_of_segments > 0 )
+	{
+		write_count = writev(
+		               output_handle->file_descriptor,
+		               &( io_vector[ segment_index ] ),
+		               number_of_segments );
+
+		if( write_count < 0 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 errno,
+			 "%s: unable to write segments.",
+			 function );
+
+			return( -1 );
+		}
+		/* Skip the data that was written, writev can return after a partial write
+		 */
+		while( ( number_of_segments > 0 )
+		    && ( (size_t) write_count >= io_vector[ segment_index ].iov_len ) )
+		{
+			write_count -= (ssize_t) io_vector[ segment_index ].iov_len;
+
+			segment_index++;
+			number_of_segments--;
+		}
+		if( number_of_segments > 0 )
+		{
+			io_vector[ segment_index ].iov_base = &( ( (uint8_t *) io_vector[ segment_index ].iov_base )[ write_count ] );
+			io_vector[ segment_index ].iov_len -= (size_t) write_count;
+		}
+	}
+#else
+	if( first_segment_size > 0 )
+	{
+		if( file_stream_write(
+		     output_handle->stream,
+		     first_segment,
+		     first_segment_size ) != first_segment_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write first segment.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( second_segment_size > 0 )
+	{
+		if( file_stream_write(
+		     output_handle->stream,
+		     second_segment,
+		     second_segment_size ) != second_segment_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write second segment.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif /* defined( HAVE_WRITEV ) */
+
+	return( 1 );
+}
+
+/* Writes the data in the buffer to the stream
+ * Without a stream the data remains in the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int output_handle_flush(
+     output_handle_t *output_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "output_handle_flush";
+
+	if( output_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_handle->stream == NULL )
+	{
+		return( 1 );
+	}
+	if( output_handle->buffer_offset > 0 )
+	{
+		if( output_handle_write_segments(
+		     output_handle,
+		     output_handle->buffer,
+		     output_handle->buffer_offset,
+		     NULL,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write buffer.",
+			 function );
+
+			return( -1 );
+		}
+		output_handle->buffer_offset = 0;
+	}
+#if !defined( HAVE_WRITEV )
+	if( fflush(
+	     output_handle->stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush stream.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Writes data
+ * The data is copied into the buffer, a full buffer is written to the stream.
+ * Data that is larger than the buffer is written together with the buffered data
+ * without copying it. Without a stream the buffer is resized instead
+ * Returns 1 if successful or -1 on error
+ */
+int output_handle_write_data(
+     output_handle_t *output_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "output_handle_write_data";
+	size_t buffer_size    = 0;
+	size_t copy_size      = 0;
+
+	if( output_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size <= ( output_handle->buffer_size - output_handle->buffer_offset ) )
+	{
+		if( data_size > 0 )
+		{
+			if( memory_copy(
+			     &( ( output_handle->buffer )[ output_handle->buffer_offset ] ),
+			     data,
+			     data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data to buffer.",
+				 function );
+
+				return( -1 );
+			}
+			output_handle->buffer_offset += data_size;
+		}
+		return( 1 );
+	}
+	if( output_handle->stream == NULL )
+	{
+		if( data_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - output_handle->buffer_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid data size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		/* Double the buffer size to limit the number of reallocations
+		 */
+		buffer_size = output_handle->buffer_offset + data_size;
+
+		if( buffer_size < ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+		{
+			buffer_size *= 2;
+		}
+		reallocation = (uint8_t *) memory_reallocate(
+		                            output_handle->buffer,
+		                            sizeof( uint8_t ) * buffer_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize buffer.",
+			 function );
+
+			return( -1 );
+		}
+		output_handle->buffer      = reallocation;
+		output_handle->buffer_size = buffer_size;
+
+		if( memory_copy(
+		     &( ( output_handle->buffer )[ output_handle->buffer_offset ] ),
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to buffer.",
+			 function );
+
+			return( -1 );
+		}
+		output_handle->buffer_offset += data_size;
+
+		return( 1 );
+	}
+	if( data_size >= output_handle->buffer_size )
+	{
+		if( output_handle_write_segments(
+		     output_handle,
+		     output_handle->buffer,
+		     output_handle->buffer_offset,
+		     data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write buffer and data.",
+			 function );
+
+			return( -1 );
+		}
+		output_handle->buffer_offset = 0;
+
+		return( 1 );
+	}
+	/* Fill the buffer so that the stream is written in full blocks
+	 */
+	copy_size = output_handle->buffer_size - output_handle->buffer_offset;
+
+	if( memory_copy(
+	     &( ( output_handle->buffer )[ output_handle->buffer_offset ] ),
+	     data,
+	     copy_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data to buffer.",
+		 function );
+
+		return( -1 );
+	}
+	output_handle->buffer_offset = output_handle->buffer_size;
+
+	if( output_handle_flush(
+	     output_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     output_handle->buffer,
+	     &( data[ copy_size ] ),
+	     data_size - copy_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data to buffer.",
+		 function );
+
+		return( -1 );
+	}
+	output_handle->buffer_offset = data_size - copy_size;
+
+	return( 1 );
+}
+
+/* Writes the data buffered by another output handle
+ * The buffer of the source output handle is emptied afterwards
+ * Returns 1 if successful or -1 on error
+ */
+int output_handle_write_buffered_data(
+     output_handle_t *output_handle,
+     output_handle_t *source_output_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "output_handle_write_buffered_data";
+
+	if( output_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_output_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source output handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_output_handle->buffer_offset == 0 )
+	{
+		return( 1 );
+	}
+	if( output_handle_write_data(
+	     output_handle,
+	     source_output_handle->buffer,
+	     source_output_handle->buffer_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write buffered data.",
+		 function );
+
+		return( -1 );
+	}
+	source_output_handle->buffer_offset = 0;
+
+	return( 1 );
+}
+
+/* Discards the data in the buffer without writing it
+ * Returns 1 if successful or -1 on error
+ */
+int output_handle_clear_buffer(
+     output_handle_t *output_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "output_handle_clear_buffer";
+
+	if( output_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output handle.",
+		 function );
+
+		return( -1 );
+	}
+	output_handle->buffer_offset = 0;
+	output_handle->escape_mode   = OUTPUT_HANDLE_ESCAPE_MODE_NONE;
+
+	return( 1 );
+}
+
+/* Writes UTF-8 encoded data using the escape mode
+ * Runs of characters that do not need escaping are written at once
+ * Returns 1 if successful or -1 on error
+ */
+int output_handle_write_escaped_data(
+     output_handle_t *output_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t escape_string[ 6 ];
+
+	static char *function = "output_handle_write_escaped_data";
+	size_t data_offset    = 0;
+	size_t escape_size    = 0;
+	size_t run_size       = 0;
+	uint8_t byte_value    = 0;
+
+	if( output_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_handle->escape_mode == OUTPUT_HANDLE_ESCAPE_MODE_NONE )
+	{
+		run_size = data_size;
+	}
+	while( data_offset < data_size )
+	{
+		/* JSON requires ", \ and control characters to be escaped
+		 */
+		while( ( data_offset + run_size ) < data_size )
+		{
+			byte_value = data[ data_offset + run_size ];
+
+			if( ( byte_value < 0x20 )
+			 || ( byte_value == (uint8_t) '"' )
+			 || ( byte_value == (uint8_t) '\\' ) )
+			{
+				break;
+			}
+			run_size++;
+		}
+		if( run_size > 0 )
+		{
+			if( output_handle_write_data(
+			     output_handle,
+			     &( data[ data_offset ] ),
+			     run_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write data.",
+				 function );
+
+				return( -1 );
+			}
+			data_offset += run_size;
+			run_size     = 0;
+
+			continue;
+		}
+		byte_value = data[ data_offset++ ];
+
+		escape_string[ 0 ] = (uint8_t) '\\';
+		escape_size        = 2;
+
+		switch( byte_value )
+		{
+			case (uint8_t) '"':
+			case (uint8_t) '\\':
+				escape_string[ 1 ] = byte_value;
+				break;
+
+			case (uint8_t) '\b':
+				escape_string[ 1 ] = (uint8_t) 'b';
+				break;
+
+			case (uint8_t) '\f':
+				escape_string[ 1 ] = (uint8_t) 'f';
+				break;
+
+			case (uint8_t) '\n':
+				escape_string[ 1 ] = (uint8_t) 'n';
+				break;
+
+			case (uint8_t) '\r':
+				escape_string[ 1 ] = (uint8_t) 'r';
+				break;
+
+			case (uint8_t) '\t':
+				escape_string[ 1 ] = (uint8_t) 't';
+				break;
+
+			default:
+				escape_string[ 1 ] = (uint8_t) 'u';
+				escape_string[ 2 ] = (uint8_t) '0';
+				escape_string[ 3 ] = (uint8_t) '0';
+				escape_string[ 4 ] = (uint8_t) output_handle_hexadecimal_digits[ byte_value >> 4 ];
+				escape_string[ 5 ] = (uint8_t) output_handle_hexadecimal_digits[ byte_value & 0x0f ];
+
+				escape_size = 6;
+
+				break;
+		}
+		if( output_handle_write_data(
+		     output_handle,
+		     escape_string,
+		     escape_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write escaped character.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Writes a character
+ * Returns 1 if successful or -1 on error
+ */
+int output_handle_write_character(
+     output_handle_t *output_handle,
+     char character,
+     libcerror_error_t **error )
+{
+	static char *function = "output_handle_write_character";
+
+	if( output_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( output_handle->escape_mode == OUTPUT_HANDLE_ESCAPE_MODE_NONE )
+	 && ( output_handle->buffer_offset < output_handle->buffer_size ) )
+	{
+		( output_handle->buffer )[ output_handle->buffer_offset++ ] = (uint8_t) character;
+
+		return( 1 );
+	}
+	if( output_handle_write_escaped_data(
+	     output_handle,
+	     (uint8_t *) &character,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write character.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a narrow string
+ * Returns 1 if successful or -1 on error
+ */
+int output_handle_write_string(
+     output_handle_t *output_handle,
+     const char *string,
+     libcerror_error_t **error )
+{
+	static char *function = "output_handle_write_string";
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_handle_write_escaped_data(
+	     output_handle,
+	     (uint8_t *) string,
+	     narrow_string_length(
+	      string ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a system string
+ * Wide system strings are written as UTF-8
+ * Returns 1 if successful or -1 on error
+ */
+int output_handle_write_system_string(
+     output_handle_t *output_handle,
+     const system_character_t *string,
+     size_t string_length,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	uint8_t utf8_string[ 64 ];
+
+	size_t string_index       = 0;
+	size_t utf8_string_index  = 0;
+	uint32_t unicode_character = 0;
+#endif
+	static char *function     = "output_handle_write_system_string";
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	while( string_index < string_length )
+	{
+		unicode_character = (uint32_t) string[ string_index++ ];
+
+		if( ( unicode_character >= 0x0000d800UL )
+		 && ( unicode_character <= 0x0000dbffUL )
+		 && ( string_index < string_length )
+		 && ( (uint32_t) string[ string_index ] >= 0x0000dc00UL )
+		 && ( (uint32_t) string[ string_index ] <= 0x0000dfffUL ) )
+		{
+			unicode_character -= 0x0000d800UL;
+			unicode_character <<= 10;
+			unicode_character += (uint32_t) string[ string_index++ ] - 0x0000dc00UL;
+			unicode_character += 0x00010000UL;
+		}
+		else if( ( ( unicode_character >= 0x0000d800UL )
+		       &&  ( unicode_character <= 0x0000dfffUL ) )
+		      || ( unicode_character > 0x0010ffffUL ) )
+		{
+			unicode_character = 0x0000fffdUL;
+		}
+		if( unicode_character < 0x00000080UL )
+		{
+			utf8_string[ utf8_string_index++ ] = (uint8_t) unicode_character;
+		}
+		else if( unicode_character < 0x00000800UL )
+		{
+			utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0xc0 | ( unicode_character >> 6 ) );
+			utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( unicode_character & 0x3f ) );
+		}
+		else if( unicode_character < 0x00010000UL )
+		{
+			utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0xe0 | ( unicode_character >> 12 ) );
+			utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( ( unicode_character >> 6 ) & 0x3f ) );
+			utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( unicode_character & 0x3f ) );
+		}
+		else
+		{
+			utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0xf0 | ( unicode_character >> 18 ) );
+			utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( ( unicode_character >> 12 ) & 0x3f ) );
+			utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( ( unicode_character >> 6 ) & 0x3f ) );
+			utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( unicode_character & 0x3f ) );
+		}
+		if( ( utf8_string_index > ( 64 - 4 ) )
+		 || ( string_index >= string_length ) )
+		{
+			if( output_handle_write_escaped_data(
+			     output_handle,
+			     utf8_string,
+			     utf8_string_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write UTF-8 string.",
+				 function );
+
+				return( -1 );
+			}
+			utf8_string_index = 0;
+		}
+	}
+#else
+	if( output_handle_write_escaped_data(
+	     output_handle,
+	     (uint8_t *) string,
+	     string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write string.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+	return( 1 );
+}
+
+/* Writes an unsigned integer value in decimal
+ * Returns 1 if successful or -1 on error
+ */
+int output_handle_write_decimal(
+     output_handle_t *output_handle,
+     uint64_t value,
+     libcerror_error_t **error )
+{
+	char string[ 20 ];
+
+	static char *function = "output_handle_write_decimal";
+	size_t string_index   = 20;
+
+	do
+	{
+		string[ --string_index ] = (char) ( '0' + ( value % 10 ) );
+
+		value /= 10;
+	}
+	while( value > 0 );
+
+	if( output_handle_write_data(
+	     output_handle,
+	     (uint8_t *) &( string[ string_index ] ),
+	     20 - string_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write decimal value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a 32-bit value as 8 lower case hexadecimal digits
+ * Returns 1 if successful or -1 on error
+ */
+int output_handle_write_hexadecimal(
+     output_handle_t *output_handle,
+     uint32_t value,
+     libcerror_error_t **error )
+{
+	char string[ 8 ];
+
+	static char *function = "output_handle_write_hexadecimal";
+	size_t string_index   = 8;
+
+	while( string_index > 0 )
+	{
+		string[ --string_index ] = output_handle_hexadecimal_digits[ value & 0x0f ];
+
+		value >>= 4;
+	}
+	if( output_handle_write_data(
+	     output_handle,
+	     (uint8_t *) string,
+	     8,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write hexadecimal value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes data as base64 with padding
+ * Returns 1 if successful or -1 on error
+ */
+int output_handle_write_base64(
+     output_handle_t *output_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t base64_string[ 64 ];
+
+	static char *function      = "output_handle_write_base64";
+	size_t base64_string_index = 0;
+	size_t data_offset         = 0;
+	uint32_t base64_triplet    = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	while( data_offset < data_size )
+	{
+		base64_triplet = (uint32_t) data[ data_offset ] << 16;
+
+		if( ( data_offset + 1 ) < data_size )
+		{
+			base64_triplet |= (uint32_t) data[ data_offset + 1 ] << 8;
+		}
+		if( ( data_offset + 2 ) < data_size )
+		{
+			base64_triplet |= (uint32_t) data[ data_offset + 2 ];
+		}
+		base64_string[ base64_string_index++ ] = (uint8_t) output_handle_base64_digits[ ( base64_triplet >> 18 ) & 0x3f ];
+		base64_string[ base64_string_index++ ] = (uint8_t) output_handle_base64_digits[ ( base64_triplet >> 12 ) & 0x3f ];
+
+		if( ( data_offset + 1 ) < data_size )
+		{
+			base64_string[ base64_string_index++ ] = (uint8_t) output_handle_base64_digits[ ( base64_triplet >> 6 ) & 0x3f ];
+		}
+		else
+		{
+			base64_string[ base64_string_index++ ] = (uint8_t) '=';
+		}
+		if( ( data_offset + 2 ) < data_size )
+		{
+			base64_string[ base64_string_index++ ] = (uint8_t) output_handle_base64_digits[ base64_triplet & 0x3f ];
+		}
+		else
+		{
+			base64_string[ base64_string_index++ ] = (uint8_t) '=';
+		}
+		data_offset += 3;
+
+		if( ( base64_string_index == 64 )
+		 || ( data_offset >= data_size ) )
+		{
+			if( output_handle_write_data(
+			     output_handle,
+			     base64_string,
+			     base64_string_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write base64 string.",
+				 function );
+
+				return( -1 );
+			}
+			base64_string_index = 0;
+		}
+	}
+	return( 1 );
+}
+
+/* Writes a signed 32-bit POSIX timestamp in seconds
+ * The date and time are written as: Mon DD, YYYY hh:mm:ss for the ctime format
+ * or as: YYYY-MM-DDThh:mm:ssZ for the ISO 8601 format
+ * Returns 1 if successful or -1 on error
+ */
+int output_handle_write_posix_time(
+     output_handle_t *output_handle,
+     int32_t posix_time,
+     uint8_t date_time_format,
+     libcerror_error_t **error )
+{
+	char string[ 21 ];
+
+	static char *function   = "output_handle_write_posix_time";
+	size_t string_length    = 0;
+	uint32_t day_of_era     = 0;
+	uint32_t day_of_year    = 0;
+	uint32_t era            = 0;
+	uint32_t month_index    = 0;
+	uint32_t number_of_days = 0;
+	uint32_t year_of_era    = 0;
+	int64_t days            = 0;
+	int64_t seconds         = 0;
+	uint16_t year           = 0;
+	uint8_t day_of_month    = 0;
+	uint8_t hours           = 0;
+	uint8_t minutes         = 0;
+
+	days    = (int64_t) posix_time / 86400;
+	seconds = (int64_t) posix_time % 86400;
+
+	if( seconds < 0 )
+	{
+		seconds += 86400;
+		days    -= 1;
+	}
+	hours   = (uint8_t) ( seconds / 3600 );
+	minutes = (uint8_t) ( ( seconds / 60 ) % 60 );
+	seconds = seconds % 60;
+
+	/* Determine the date relative to March 1, 0000 so that leap days
+	 * are at the end of the year, the value is always positive
+	 * for a 32-bit timestamp
+	 */
+	number_of_days = (uint32_t) ( days + 719468 );
+	era            = number_of_days / 146097;
+	day_of_era     = number_of_days - ( era * 146097 );
+	year_of_era    = ( day_of_era - ( day_of_era / 1460 ) + ( day_of_era / 36524 ) - ( day_of_era / 146096 ) ) / 365;
+	day_of_year    = day_of_era - ( ( 365 * year_of_era ) + ( year_of_era / 4 ) - ( year_of_era / 100 ) );
+	month_index    = ( ( 5 * day_of_year ) + 2 ) / 153;
+	day_of_month   = (uint8_t) ( day_of_year - ( ( ( 153 * month_index ) + 2 ) / 5 ) + 1 );
+	year           = (uint16_t) ( year_of_era + ( era * 400 ) );
+
+	if( month_index < 10 )
+	{
+		month_index += 2;
+	}
+	else
+	{
+		month_index -= 10;
+		year        += 1;
+	}
+	if( date_time_format == OUTPUT_HANDLE_DATE_TIME_FORMAT_ISO8601 )
+	{
+		month_index += 1;
+
+		string[ 0 ]  = (char) ( '0' + ( year / 1000 ) );
+		string[ 1 ]  = (char) ( '0' + ( ( year / 100 ) % 10 ) );
+		string[ 2 ]  = (char) ( '0' + ( ( year / 10 ) % 10 ) );
+		string[ 3 ]  = (char) ( '0' + ( year % 10 ) );
+		string[ 4 ]  = '-';
+		string[ 5 ]  = (char) ( '0' + ( month_index / 10 ) );
+		string[ 6 ]  = (char) ( '0' + ( month_index % 10 ) );
+		string[ 7 ]  = '-';
+		string[ 8 ]  = (char) ( '0' + ( day_of_month / 10 ) );
+		string[ 9 ]  = (char) ( '0' + ( day_of_month % 10 ) );
+		string[ 10 ] = 'T';
+		string[ 11 ] = (char) ( '0' + ( hours / 10 ) );
+		string[ 12 ] = (char) ( '0' + ( hours % 10 ) );
+		string[ 13 ] = ':';
+		string[ 14 ] = (char) ( '0' + ( minutes / 10 ) );
+		string[ 15 ] = (char) ( '0' + ( minutes % 10 ) );
+		string[ 16 ] = ':';
+		string[ 17 ] = (char) ( '0' + ( seconds / 10 ) );
+		string[ 18 ] = (char) ( '0' + ( seconds % 10 ) );
+		string[ 19 ] = 'Z';
+
+		string_length = 20;
+	}
+	else
+	{
+		string[ 0 ]  = output_handle_month_names[ ( month_index * 3 ) ];
+		string[ 1 ]  = output_handle_month_names[ ( month_index * 3 ) + 1 ];
+		string[ 2 ]  = output_handle_month_names[ ( month_index * 3 ) + 2 ];
+		string[ 3 ]  = ' ';
+		string[ 4 ]  = (char) ( '0' + ( day_of_month / 10 ) );
+		string[ 5 ]  = (char) ( '0' + ( day_of_month % 10 ) );
+		string[ 6 ]  = ',';
+		string[ 7 ]  = ' ';
+		string[ 8 ]  = (char) ( '0' + ( year / 1000 ) );
+		string[ 9 ]  = (char) ( '0' + ( ( year / 100 ) % 10 ) );
+		string[ 10 ] = (char) ( '0' + ( ( year / 10 ) % 10 ) );
+		string[ 11 ] = (char) ( '0' + ( year % 10 ) );
+		string[ 12 ] = ' ';
+		string[ 13 ] = (char) ( '0' + ( hours / 10 ) );
+		string[ 14 ] = (char) ( '0' + ( hours % 10 ) );
+		string[ 15 ] = ':';
+		string[ 16 ] = (char) ( '0' + ( minutes / 10 ) );
+		string[ 17 ] = (char) ( '0' + ( minutes % 10 ) );
+		string[ 18 ] = ':';
+		string[ 19 ] = (char) ( '0' + ( seconds / 10 ) );
+		string[ 20 ] = (char) ( '0' + ( seconds % 10 ) );
+
+		string_length = 21;
+	}
+	if( output_handle_write_data(
+	     output_handle,
+	     (uint8_t *) string,
+	     string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
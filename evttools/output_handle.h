@@ -0,0 +1,173 @@
+/*
+ * Buffered output handle
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _OUTPUT_HANDLE_H )
+#define _OUTPUT_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "evttools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default output buffer size
+ */
+#define OUTPUT_HANDLE_DEFAULT_BUFFER_SIZE	1048576
+
+enum OUTPUT_HANDLE_DATE_TIME_FORMATS
+{
+	OUTPUT_HANDLE_DATE_TIME_FORMAT_CTIME	= (int) 'c',
+	OUTPUT_HANDLE_DATE_TIME_FORMAT_ISO8601	= (int) 'i'
+};
+
+enum OUTPUT_HANDLE_ESCAPE_MODES
+{
+	OUTPUT_HANDLE_ESCAPE_MODE_NONE		= (int) 'n',
+	OUTPUT_HANDLE_ESCAPE_MODE_JSON		= (int) 'j'
+};
+
+typedef struct output_handle output_handle_t;
+
+struct output_handle
+{
+	/* The output stream, NULL if the data is kept in the buffer
+	 */
+	FILE *stream;
+
+#if defined( HAVE_WRITEV )
+	/* The output file descriptor
+	 */
+	int file_descriptor;
+#endif
+
+	/* The buffer
+	 */
+	uint8_t *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The buffer offset
+	 */
+	size_t buffer_offset;
+
+	/* The escape mode
+	 */
+	uint8_t escape_mode;
+};
+
+int output_handle_initialize(
+     output_handle_t **output_handle,
+     FILE *stream,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int output_handle_free(
+     output_handle_t **output_handle,
+     libcerror_error_t **error );
+
+int output_handle_set_escape_mode(
+     output_handle_t *output_handle,
+     uint8_t escape_mode,
+     libcerror_error_t **error );
+
+int output_handle_write_segments(
+     output_handle_t *output_handle,
+     const uint8_t *first_segment,
+     size_t first_segment_size,
+     const uint8_t *second_segment,
+     size_t second_segment_size,
+     libcerror_error_t **error );
+
+int output_handle_flush(
+     output_handle_t *output_handle,
+     libcerror_error_t **error );
+
+int output_handle_write_data(
+     output_handle_t *output_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int output_handle_write_buffered_data(
+     output_handle_t *output_handle,
+     output_handle_t *source_output_handle,
+     libcerror_error_t **error );
+
+int output_handle_clear_buffer(
+     output_handle_t *output_handle,
+     libcerror_error_t **error );
+
+int output_handle_write_escaped_data(
+     output_handle_t *output_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int output_handle_write_character(
+     output_handle_t *output_handle,
+     char character,
+     libcerror_error_t **error );
+
+int output_handle_write_string(
+     output_handle_t *output_handle,
+     const char *string,
+     libcerror_error_t **error );
+
+int output_handle_write_system_string(
+     output_handle_t *output_handle,
+     const system_character_t *string,
+     size_t string_length,
+     libcerror_error_t **error );
+
+int output_handle_write_decimal(
+     output_handle_t *output_handle,
+     uint64_t value,
+     libcerror_error_t **error );
+
+int output_handle_write_hexadecimal(
+     output_handle_t *output_handle,
+     uint32_t value,
+     libcerror_error_t **error );
+
+int output_handle_write_base64(
+     output_handle_t *output_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int output_handle_write_posix_time(
+     output_handle_t *output_handle,
+     int32_t posix_time,
+     uint8_t date_time_format,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _OUTPUT_HANDLE_H ) */
+
@@ -0,0 +1,291 @@
+/*
+ * Record buffer
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "evttools_libcerror.h"
+#include "message_string.h"
+#include "output_handle.h"
+#include "record_buffer.h"
+
+/* Creates a record buffer
+ * Make sure the value record_buffer is referencing, is set to NULL
+ * If stream is NULL the output of the record is kept in memory until it is written
+ * to another output handle, otherwise the output is written to the stream
+ * Returns 1 if successful or -1 on error
+ */
+int record_buffer_initialize(
+     record_buffer_t **record_buffer,
+     FILE *stream,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "record_buffer_initialize";
+
+	if( record_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*record_buffer = memory_allocate_structure(
+	                  record_buffer_t );
+
+	if( *record_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *record_buffer,
+	     0,
+	     sizeof( record_buffer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record buffer.",
+		 function );
+
+		memory_free(
+		 *record_buffer );
+
+		*record_buffer = NULL;
+
+		return( -1 );
+	}
+	if( output_handle_initialize(
+	     &( ( *record_buffer )->output_handle ),
+	     stream,
+	     buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create output handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( message_string_initialize(
+	     &( ( *record_buffer )->message_string ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create message string.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *record_buffer != NULL )
+	{
+		if( ( *record_buffer )->output_handle != NULL )
+		{
+			output_handle_free(
+			 &( ( *record_buffer )->output_handle ),
+			 NULL );
+		}
+		memory_free(
+		 *record_buffer );
+
+		*record_buffer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a record buffer
+ * Any output remaining in the buffer is written to the stream first, if any
+ * Returns 1 if successful or -1 on error
+ */
+int record_buffer_free(
+     record_buffer_t **record_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "record_buffer_free";
+	int result            = 1;
+
+	if( record_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_buffer != NULL )
+	{
+		if( output_handle_free(
+		     &( ( *record_buffer )->output_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free output handle.",
+			 function );
+
+			result = -1;
+		}
+		if( message_string_free(
+		     &( ( *record_buffer )->message_string ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free message string.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *record_buffer )->source_name_buffer != NULL )
+		{
+			memory_free(
+			 ( *record_buffer )->source_name_buffer );
+		}
+		if( ( *record_buffer )->value_string_buffer != NULL )
+		{
+			memory_free(
+			 ( *record_buffer )->value_string_buffer );
+		}
+		if( ( *record_buffer )->data_buffer != NULL )
+		{
+			memory_free(
+			 ( *record_buffer )->data_buffer );
+		}
+		memory_free(
+		 *record_buffer );
+
+		*record_buffer = NULL;
+	}
+	return( result );
+}
+
+/* Resizes a buffer that is reused between records
+ * The buffer is only reallocated when it is smaller than the requested size
+ * Returns 1 if successful or -1 on error
+ */
+int record_buffer_resize_buffer(
+     uint8_t **buffer,
+     size_t *buffer_size,
+     size_t size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "record_buffer_resize_buffer";
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > *buffer_size )
+	{
+		reallocation = (uint8_t *) memory_reallocate(
+		                            *buffer,
+		                            sizeof( uint8_t ) * size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize buffer.",
+			 function );
+
+			return( -1 );
+		}
+		*buffer      = reallocation;
+		*buffer_size = size;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,99 @@
+/*
+ * Record buffer
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _RECORD_BUFFER_H )
+#define _RECORD_BUFFER_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "evttools_libcerror.h"
+#include "message_string.h"
+#include "output_handle.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial output buffer size of a record buffer that keeps the output in memory
+ */
+#define RECORD_BUFFER_INITIAL_OUTPUT_BUFFER_SIZE	4096
+
+typedef struct record_buffer record_buffer_t;
+
+struct record_buffer
+{
+	/* The output handle
+	 */
+	output_handle_t *output_handle;
+
+	/* The source name buffer
+	 */
+	uint8_t *source_name_buffer;
+
+	/* The source name buffer size
+	 */
+	size_t source_name_buffer_size;
+
+	/* The value string buffer
+	 */
+	uint8_t *value_string_buffer;
+
+	/* The value string buffer size
+	 */
+	size_t value_string_buffer_size;
+
+	/* The data buffer
+	 */
+	uint8_t *data_buffer;
+
+	/* The data buffer size
+	 */
+	size_t data_buffer_size;
+
+	/* The message string
+	 */
+	message_string_t *message_string;
+};
+
+int record_buffer_initialize(
+     record_buffer_t **record_buffer,
+     FILE *stream,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int record_buffer_free(
+     record_buffer_t **record_buffer,
+     libcerror_error_t **error );
+
+int record_buffer_resize_buffer(
+     uint8_t **buffer,
+     size_t *buffer_size,
+     size_t size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _RECORD_BUFFER_H ) */
+
@@ -0,0 +1,890 @@
+/*
+ * Resource file cache
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "evttools_libcerror.h"
+#include "resource_file.h"
+#include "resource_file_cache.h"
+#include "string_cache.h"
+
+/* Frees a resource file cache entry and the resource file it contains
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_entry_free(
+     resource_file_cache_entry_t **resource_file_cache_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "resource_file_cache_entry_free";
+	int result            = 1;
+
+	if( resource_file_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *resource_file_cache_entry != NULL )
+	{
+		if( ( *resource_file_cache_entry )->resource_file != NULL )
+		{
+			if( resource_file_free(
+			     &( ( *resource_file_cache_entry )->resource_file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free resource file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *resource_file_cache_entry );
+
+		*resource_file_cache_entry = NULL;
+	}
+	return( result );
+}
+
+/* Creates a resource file cache
+ * Make sure the value resource_file_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_initialize(
+     resource_file_cache_t **resource_file_cache,
+     int maximum_number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "resource_file_cache_initialize";
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *resource_file_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid resource file cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_entries <= 0 )
+	 || ( maximum_number_of_entries > RESOURCE_FILE_CACHE_MAXIMUM_NUMBER_OF_ENTRIES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*resource_file_cache = memory_allocate_structure(
+	                        resource_file_cache_t );
+
+	if( *resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create resource file cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *resource_file_cache,
+	     0,
+	     sizeof( resource_file_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear resource file cache.",
+		 function );
+
+		memory_free(
+		 *resource_file_cache );
+
+		*resource_file_cache = NULL;
+
+		return( -1 );
+	}
+	/* Use a bucket per entry so that the chains remain short
+	 */
+	( *resource_file_cache )->buckets = (resource_file_cache_entry_t **) memory_allocate(
+	                                                                      sizeof( resource_file_cache_entry_t * ) * maximum_number_of_entries );
+
+	if( ( *resource_file_cache )->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *resource_file_cache )->buckets,
+	     0,
+	     sizeof( resource_file_cache_entry_t * ) * maximum_number_of_entries ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		goto on_error;
+	}
+	( *resource_file_cache )->number_of_buckets         = maximum_number_of_entries;
+	( *resource_file_cache )->maximum_number_of_entries = maximum_number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( *resource_file_cache != NULL )
+	{
+		if( ( *resource_file_cache )->buckets != NULL )
+		{
+			memory_free(
+			 ( *resource_file_cache )->buckets );
+		}
+		memory_free(
+		 *resource_file_cache );
+
+		*resource_file_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a resource file cache
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_free(
+     resource_file_cache_t **resource_file_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "resource_file_cache_free";
+	int result            = 1;
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *resource_file_cache != NULL )
+	{
+		if( resource_file_cache_empty(
+		     *resource_file_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty resource file cache.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 ( *resource_file_cache )->buckets );
+
+		memory_free(
+		 *resource_file_cache );
+
+		*resource_file_cache = NULL;
+	}
+	return( result );
+}
+
+/* Empties a resource file cache
+ * The statistics are retained
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_empty(
+     resource_file_cache_t *resource_file_cache,
+     libcerror_error_t **error )
+{
+	resource_file_cache_entry_t *resource_file_cache_entry = NULL;
+	static char *function                                  = "resource_file_cache_empty";
+	int bucket_index                                       = 0;
+	int result                                             = 1;
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	while( resource_file_cache->first_entry != NULL )
+	{
+		resource_file_cache_entry = resource_file_cache->first_entry;
+
+		resource_file_cache->first_entry = resource_file_cache_entry->next_entry;
+
+		if( resource_file_cache_entry_free(
+		     &resource_file_cache_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free entry.",
+			 function );
+
+			result = -1;
+		}
+	}
+	for( bucket_index = 0;
+	     bucket_index < resource_file_cache->number_of_buckets;
+	     bucket_index++ )
+	{
+		resource_file_cache->buckets[ bucket_index ] = NULL;
+	}
+	resource_file_cache->last_entry        = NULL;
+	resource_file_cache->number_of_entries = 0;
+
+	return( result );
+}
+
+/* Removes an entry from the buckets and the most recently used list
+ * The entry is not freed
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_remove_entry(
+     resource_file_cache_t *resource_file_cache,
+     resource_file_cache_entry_t *resource_file_cache_entry,
+     libcerror_error_t **error )
+{
+	resource_file_cache_entry_t **bucket_entry = NULL;
+	static char *function                      = "resource_file_cache_remove_entry";
+	int bucket_index                           = 0;
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = (int) ( resource_file_cache_entry->hash % (uint32_t) resource_file_cache->number_of_buckets );
+
+	bucket_entry = &( resource_file_cache->buckets[ bucket_index ] );
+
+	while( *bucket_entry != NULL )
+	{
+		if( *bucket_entry == resource_file_cache_entry )
+		{
+			break;
+		}
+		bucket_entry = &( ( *bucket_entry )->next_bucket_entry );
+	}
+	if( *bucket_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid resource file cache entry - missing in bucket: %d.",
+		 function,
+		 bucket_index );
+
+		return( -1 );
+	}
+	*bucket_entry = resource_file_cache_entry->next_bucket_entry;
+
+	if( resource_file_cache_entry->previous_entry != NULL )
+	{
+		resource_file_cache_entry->previous_entry->next_entry = resource_file_cache_entry->next_entry;
+	}
+	else
+	{
+		resource_file_cache->first_entry = resource_file_cache_entry->next_entry;
+	}
+	if( resource_file_cache_entry->next_entry != NULL )
+	{
+		resource_file_cache_entry->next_entry->previous_entry = resource_file_cache_entry->previous_entry;
+	}
+	else
+	{
+		resource_file_cache->last_entry = resource_file_cache_entry->previous_entry;
+	}
+	resource_file_cache_entry->next_bucket_entry = NULL;
+	resource_file_cache_entry->previous_entry    = NULL;
+	resource_file_cache_entry->next_entry        = NULL;
+
+	resource_file_cache->number_of_entries -= 1;
+
+	return( 1 );
+}
+
+/* Removes and frees the least recently used entry
+ * Returns 1 if successful, 0 if the resource file cache is empty or -1 on error
+ */
+int resource_file_cache_remove_last_entry(
+     resource_file_cache_t *resource_file_cache,
+     libcerror_error_t **error )
+{
+	resource_file_cache_entry_t *resource_file_cache_entry = NULL;
+	static char *function                                  = "resource_file_cache_remove_last_entry";
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	resource_file_cache_entry = resource_file_cache->last_entry;
+
+	if( resource_file_cache_entry == NULL )
+	{
+		return( 0 );
+	}
+	if( resource_file_cache_remove_entry(
+	     resource_file_cache,
+	     resource_file_cache_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove least recently used entry.",
+		 function );
+
+		return( -1 );
+	}
+	resource_file_cache->number_of_evictions += 1;
+
+	if( resource_file_cache_entry_free(
+	     &resource_file_cache_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free least recently used entry.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the maximum number of entries
+ * The least recently used entries are removed if the resource file cache contains more entries
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_set_maximum_number_of_entries(
+     resource_file_cache_t *resource_file_cache,
+     int maximum_number_of_entries,
+     libcerror_error_t **error )
+{
+	resource_file_cache_entry_t **buckets                  = NULL;
+	resource_file_cache_entry_t *resource_file_cache_entry = NULL;
+	static char *function                                  = "resource_file_cache_set_maximum_number_of_entries";
+	int bucket_index                                       = 0;
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_entries <= 0 )
+	 || ( maximum_number_of_entries > RESOURCE_FILE_CACHE_MAXIMUM_NUMBER_OF_ENTRIES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	buckets = (resource_file_cache_entry_t **) memory_allocate(
+	                                            sizeof( resource_file_cache_entry_t * ) * maximum_number_of_entries );
+
+	if( buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     buckets,
+	     0,
+	     sizeof( resource_file_cache_entry_t * ) * maximum_number_of_entries ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		memory_free(
+		 buckets );
+
+		return( -1 );
+	}
+	while( resource_file_cache->number_of_entries > maximum_number_of_entries )
+	{
+		if( resource_file_cache_remove_last_entry(
+		     resource_file_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove least recently used entry.",
+			 function );
+
+			memory_free(
+			 buckets );
+
+			return( -1 );
+		}
+	}
+	for( resource_file_cache_entry = resource_file_cache->first_entry;
+	     resource_file_cache_entry != NULL;
+	     resource_file_cache_entry = resource_file_cache_entry->next_entry )
+	{
+		bucket_index = (int) ( resource_file_cache_entry->hash % (uint32_t) maximum_number_of_entries );
+
+		resource_file_cache_entry->next_bucket_entry = buckets[ bucket_index ];
+		buckets[ bucket_index ]                      = resource_file_cache_entry;
+	}
+	memory_free(
+	 resource_file_cache->buckets );
+
+	resource_file_cache->buckets                   = buckets;
+	resource_file_cache->number_of_buckets         = maximum_number_of_entries;
+	resource_file_cache->maximum_number_of_entries = maximum_number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the resource file with a specific name
+ * The resource file becomes the most recently used and remains owned by the resource file cache
+ * Returns 1 if successful, 0 if the resource file is not in the cache or -1 on error
+ */
+int resource_file_cache_get_resource_file(
+     resource_file_cache_t *resource_file_cache,
+     const system_character_t *name,
+     size_t name_length,
+     resource_file_t **resource_file,
+     libcerror_error_t **error )
+{
+	resource_file_cache_entry_t *resource_file_cache_entry = NULL;
+	static char *function                                  = "resource_file_cache_get_resource_file";
+	uint32_t hash                                          = 0;
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_cache_calculate_hash(
+	     name,
+	     name_length,
+	     NULL,
+	     0,
+	     &hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate hash.",
+		 function );
+
+		return( -1 );
+	}
+	resource_file_cache_entry = resource_file_cache->buckets[ hash % (uint32_t) resource_file_cache->number_of_buckets ];
+
+	while( resource_file_cache_entry != NULL )
+	{
+		if( ( resource_file_cache_entry->hash == hash )
+		 && ( resource_file_cache_entry->resource_file->name_size == ( name_length + 1 ) )
+		 && ( system_string_compare(
+		       resource_file_cache_entry->resource_file->name,
+		       name,
+		       name_length ) == 0 ) )
+		{
+			break;
+		}
+		resource_file_cache_entry = resource_file_cache_entry->next_bucket_entry;
+	}
+	if( resource_file_cache_entry == NULL )
+	{
+		resource_file_cache->number_of_misses += 1;
+
+		*resource_file = NULL;
+
+		return( 0 );
+	}
+	resource_file_cache->number_of_hits += 1;
+
+	/* Move the entry to the front of the most recently used list
+	 */
+	if( resource_file_cache_entry->previous_entry != NULL )
+	{
+		resource_file_cache_entry->previous_entry->next_entry = resource_file_cache_entry->next_entry;
+
+		if( resource_file_cache_entry->next_entry != NULL )
+		{
+			resource_file_cache_entry->next_entry->previous_entry = resource_file_cache_entry->previous_entry;
+		}
+		else
+		{
+			resource_file_cache->last_entry = resource_file_cache_entry->previous_entry;
+		}
+		resource_file_cache_entry->previous_entry = NULL;
+		resource_file_cache_entry->next_entry     = resource_file_cache->first_entry;
+
+		resource_file_cache->first_entry->previous_entry = resource_file_cache_entry;
+		resource_file_cache->first_entry                 = resource_file_cache_entry;
+	}
+	*resource_file = resource_file_cache_entry->resource_file;
+
+	return( 1 );
+}
+
+/* Sets a resource file
+ * The resource file cache takes over ownership of the resource file if successful
+ * A resource file with the same name is replaced and if the resource file cache
+ * is full the least recently used resource file is removed
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_set_resource_file(
+     resource_file_cache_t *resource_file_cache,
+     resource_file_t *resource_file,
+     libcerror_error_t **error )
+{
+	resource_file_cache_entry_t *existing_entry            = NULL;
+	resource_file_cache_entry_t *resource_file_cache_entry = NULL;
+	static char *function                                  = "resource_file_cache_set_resource_file";
+	uint32_t hash                                          = 0;
+	int bucket_index                                       = 0;
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( resource_file->name == NULL )
+	 || ( resource_file->name_size == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid resource file - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_cache_calculate_hash(
+	     resource_file->name,
+	     resource_file->name_size - 1,
+	     NULL,
+	     0,
+	     &hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate hash.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = (int) ( hash % (uint32_t) resource_file_cache->number_of_buckets );
+
+	existing_entry = resource_file_cache->buckets[ bucket_index ];
+
+	while( existing_entry != NULL )
+	{
+		if( ( existing_entry->hash == hash )
+		 && ( existing_entry->resource_file->name_size == resource_file->name_size )
+		 && ( system_string_compare(
+		       existing_entry->resource_file->name,
+		       resource_file->name,
+		       resource_file->name_size - 1 ) == 0 ) )
+		{
+			break;
+		}
+		existing_entry = existing_entry->next_bucket_entry;
+	}
+	if( ( existing_entry != NULL )
+	 && ( existing_entry->resource_file == resource_file ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid resource file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	resource_file_cache_entry = memory_allocate_structure(
+	                             resource_file_cache_entry_t );
+
+	if( resource_file_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     resource_file_cache_entry,
+	     0,
+	     sizeof( resource_file_cache_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entry.",
+		 function );
+
+		memory_free(
+		 resource_file_cache_entry );
+
+		return( -1 );
+	}
+	if( existing_entry != NULL )
+	{
+		if( resource_file_cache_remove_entry(
+		     resource_file_cache,
+		     existing_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove existing entry.",
+			 function );
+
+			goto on_error;
+		}
+		if( resource_file_cache_entry_free(
+		     &existing_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free existing entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( resource_file_cache->number_of_entries >= resource_file_cache->maximum_number_of_entries )
+	{
+		if( resource_file_cache_remove_last_entry(
+		     resource_file_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove least recently used entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	resource_file_cache_entry->hash          = hash;
+	resource_file_cache_entry->resource_file = resource_file;
+
+	resource_file_cache_entry->next_bucket_entry = resource_file_cache->buckets[ bucket_index ];
+	resource_file_cache->buckets[ bucket_index ] = resource_file_cache_entry;
+
+	resource_file_cache_entry->next_entry = resource_file_cache->first_entry;
+
+	if( resource_file_cache->first_entry != NULL )
+	{
+		resource_file_cache->first_entry->previous_entry = resource_file_cache_entry;
+	}
+	else
+	{
+		resource_file_cache->last_entry = resource_file_cache_entry;
+	}
+	resource_file_cache->first_entry = resource_file_cache_entry;
+
+	resource_file_cache->number_of_entries += 1;
+
+	return( 1 );
+
+on_error:
+	memory_free(
+	 resource_file_cache_entry );
+
+	return( -1 );
+}
+
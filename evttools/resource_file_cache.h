@@ -0,0 +1,157 @@
+/*
+ * Resource file cache
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _RESOURCE_FILE_CACHE_H )
+#define _RESOURCE_FILE_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evttools_libcerror.h"
+#include "resource_file.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default maximum number of resource files in a resource file cache
+ */
+#define RESOURCE_FILE_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES	64
+
+/* The largest supported maximum number of resource files in a resource file cache
+ */
+#define RESOURCE_FILE_CACHE_MAXIMUM_NUMBER_OF_ENTRIES		65536
+
+typedef struct resource_file_cache_entry resource_file_cache_entry_t;
+
+struct resource_file_cache_entry
+{
+	/* The next entry in the same bucket
+	 */
+	resource_file_cache_entry_t *next_bucket_entry;
+
+	/* The previous (more recently used) entry
+	 */
+	resource_file_cache_entry_t *previous_entry;
+
+	/* The next (less recently used) entry
+	 */
+	resource_file_cache_entry_t *next_entry;
+
+	/* The hash of the resource file name
+	 */
+	uint32_t hash;
+
+	/* The resource file
+	 */
+	resource_file_t *resource_file;
+};
+
+typedef struct resource_file_cache resource_file_cache_t;
+
+struct resource_file_cache
+{
+	/* The buckets
+	 */
+	resource_file_cache_entry_t **buckets;
+
+	/* The number of buckets
+	 */
+	int number_of_buckets;
+
+	/* The most recently used entry
+	 */
+	resource_file_cache_entry_t *first_entry;
+
+	/* The least recently used entry
+	 */
+	resource_file_cache_entry_t *last_entry;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The maximum number of entries
+	 */
+	int maximum_number_of_entries;
+
+	/* The number of lookups that found the resource file
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of lookups that did not find the resource file
+	 */
+	uint64_t number_of_misses;
+
+	/* The number of resource files that were removed to make room for another
+	 */
+	uint64_t number_of_evictions;
+};
+
+int resource_file_cache_entry_free(
+     resource_file_cache_entry_t **resource_file_cache_entry,
+     libcerror_error_t **error );
+
+int resource_file_cache_initialize(
+     resource_file_cache_t **resource_file_cache,
+     int maximum_number_of_entries,
+     libcerror_error_t **error );
+
+int resource_file_cache_free(
+     resource_file_cache_t **resource_file_cache,
+     libcerror_error_t **error );
+
+int resource_file_cache_empty(
+     resource_file_cache_t *resource_file_cache,
+     libcerror_error_t **error );
+
+int resource_file_cache_remove_entry(
+     resource_file_cache_t *resource_file_cache,
+     resource_file_cache_entry_t *resource_file_cache_entry,
+     libcerror_error_t **error );
+
+int resource_file_cache_remove_last_entry(
+     resource_file_cache_t *resource_file_cache,
+     libcerror_error_t **error );
+
+int resource_file_cache_set_maximum_number_of_entries(
+     resource_file_cache_t *resource_file_cache,
+     int maximum_number_of_entries,
+     libcerror_error_t **error );
+
+int resource_file_cache_get_resource_file(
+     resource_file_cache_t *resource_file_cache,
+     const system_character_t *name,
+     size_t name_length,
+     resource_file_t **resource_file,
+     libcerror_error_t **error );
+
+int resource_file_cache_set_resource_file(
+     resource_file_cache_t *resource_file_cache,
+     resource_file_t *resource_file,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _RESOURCE_FILE_CACHE_H ) */
+
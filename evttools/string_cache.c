@@ -0,0 +1,853 @@
+/*
+ * String cache
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "evttools_libcerror.h"
+#include "string_cache.h"
+
+/* Frees a string cache entry
+ * Returns 1 if successful or -1 on error
+ */
+int string_cache_entry_free(
+     string_cache_entry_t **string_cache_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "string_cache_entry_free";
+
+	if( string_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_cache_entry != NULL )
+	{
+		if( ( *string_cache_entry )->value != NULL )
+		{
+			memory_free(
+			 ( *string_cache_entry )->value );
+		}
+		if( ( *string_cache_entry )->key != NULL )
+		{
+			memory_free(
+			 ( *string_cache_entry )->key );
+		}
+		memory_free(
+		 *string_cache_entry );
+
+		*string_cache_entry = NULL;
+	}
+	return( 1 );
+}
+
+/* Calculates the hash of a key
+ * The hash is a 32-bit FNV-1a hash of the characters of the first and second key string
+ * Returns 1 if successful or -1 on error
+ */
+int string_cache_calculate_hash(
+     const system_character_t *first_key,
+     size_t first_key_length,
+     const system_character_t *second_key,
+     size_t second_key_length,
+     uint32_t *hash,
+     libcerror_error_t **error )
+{
+	static char *function  = "string_cache_calculate_hash";
+	size_t character_index = 0;
+	uint32_t safe_hash     = 0x811c9dc5UL;
+
+	if( ( first_key == NULL )
+	 && ( first_key_length != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first key.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( second_key == NULL )
+	 && ( second_key_length != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second key.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	for( character_index = 0;
+	     character_index < first_key_length;
+	     character_index++ )
+	{
+		safe_hash ^= (uint32_t) first_key[ character_index ];
+		safe_hash *= 0x01000193UL;
+	}
+	/* Hash the end-of-string character that separates the keys
+	 * so that keys that only differ in where they are split
+	 * do not have the same hash
+	 */
+	safe_hash *= 0x01000193UL;
+
+	for( character_index = 0;
+	     character_index < second_key_length;
+	     character_index++ )
+	{
+		safe_hash ^= (uint32_t) second_key[ character_index ];
+		safe_hash *= 0x01000193UL;
+	}
+	*hash = safe_hash;
+
+	return( 1 );
+}
+
+/* Creates a string cache
+ * Make sure the value string_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int string_cache_initialize(
+     string_cache_t **string_cache,
+     int number_of_buckets,
+     libcerror_error_t **error )
+{
+	static char *function = "string_cache_initialize";
+
+	if( string_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid string cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buckets <= 0 )
+	 || ( (size_t) number_of_buckets > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( string_cache_entry_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buckets value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*string_cache = memory_allocate_structure(
+	                 string_cache_t );
+
+	if( *string_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create string cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *string_cache,
+	     0,
+	     sizeof( string_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear string cache.",
+		 function );
+
+		memory_free(
+		 *string_cache );
+
+		*string_cache = NULL;
+
+		return( -1 );
+	}
+	( *string_cache )->buckets = (string_cache_entry_t **) memory_allocate(
+	                                                        sizeof( string_cache_entry_t * ) * number_of_buckets );
+
+	if( ( *string_cache )->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *string_cache )->buckets,
+	     0,
+	     sizeof( string_cache_entry_t * ) * number_of_buckets ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		goto on_error;
+	}
+	( *string_cache )->number_of_buckets = number_of_buckets;
+
+	return( 1 );
+
+on_error:
+	if( *string_cache != NULL )
+	{
+		if( ( *string_cache )->buckets != NULL )
+		{
+			memory_free(
+			 ( *string_cache )->buckets );
+		}
+		memory_free(
+		 *string_cache );
+
+		*string_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a string cache
+ * Returns 1 if successful or -1 on error
+ */
+int string_cache_free(
+     string_cache_t **string_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "string_cache_free";
+	int result            = 1;
+
+	if( string_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_cache != NULL )
+	{
+		if( string_cache_empty(
+		     *string_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty string cache.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 ( *string_cache )->buckets );
+
+		memory_free(
+		 *string_cache );
+
+		*string_cache = NULL;
+	}
+	return( result );
+}
+
+/* Empties a string cache
+ * Returns 1 if successful or -1 on error
+ */
+int string_cache_empty(
+     string_cache_t *string_cache,
+     libcerror_error_t **error )
+{
+	string_cache_entry_t *string_cache_entry = NULL;
+	static char *function                    = "string_cache_empty";
+	int bucket_index                         = 0;
+	int result                               = 1;
+
+	if( string_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string cache.",
+		 function );
+
+		return( -1 );
+	}
+	for( bucket_index = 0;
+	     bucket_index < string_cache->number_of_buckets;
+	     bucket_index++ )
+	{
+		while( string_cache->buckets[ bucket_index ] != NULL )
+		{
+			string_cache_entry = string_cache->buckets[ bucket_index ];
+
+			string_cache->buckets[ bucket_index ] = string_cache_entry->next_entry;
+
+			if( string_cache_entry_free(
+			     &string_cache_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free entry.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+	string_cache->number_of_entries = 0;
+
+	return( result );
+}
+
+/* Resizes a string cache
+ * The entries are redistributed over the new buckets
+ * Returns 1 if successful or -1 on error
+ */
+int string_cache_resize(
+     string_cache_t *string_cache,
+     int number_of_buckets,
+     libcerror_error_t **error )
+{
+	string_cache_entry_t **buckets           = NULL;
+	string_cache_entry_t *string_cache_entry = NULL;
+	static char *function                    = "string_cache_resize";
+	int bucket_index                         = 0;
+	int new_bucket_index                     = 0;
+
+	if( string_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buckets <= 0 )
+	 || ( (size_t) number_of_buckets > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( string_cache_entry_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buckets value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	buckets = (string_cache_entry_t **) memory_allocate(
+	                                     sizeof( string_cache_entry_t * ) * number_of_buckets );
+
+	if( buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     buckets,
+	     0,
+	     sizeof( string_cache_entry_t * ) * number_of_buckets ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		memory_free(
+		 buckets );
+
+		return( -1 );
+	}
+	for( bucket_index = 0;
+	     bucket_index < string_cache->number_of_buckets;
+	     bucket_index++ )
+	{
+		while( string_cache->buckets[ bucket_index ] != NULL )
+		{
+			string_cache_entry = string_cache->buckets[ bucket_index ];
+
+			string_cache->buckets[ bucket_index ] = string_cache_entry->next_entry;
+
+			new_bucket_index = (int) ( string_cache_entry->hash % (uint32_t) number_of_buckets );
+
+			string_cache_entry->next_entry = buckets[ new_bucket_index ];
+			buckets[ new_bucket_index ]    = string_cache_entry;
+		}
+	}
+	memory_free(
+	 string_cache->buckets );
+
+	string_cache->buckets           = buckets;
+	string_cache->number_of_buckets = number_of_buckets;
+
+	return( 1 );
+}
+
+/* Retrieves the value of a specific key
+ * The value is NULL if the key was stored without a corresponding value
+ * The value remains owned by the string cache
+ * Returns 1 if successful, 0 if the key is not in the cache or -1 on error
+ */
+int string_cache_get_value(
+     string_cache_t *string_cache,
+     const system_character_t *first_key,
+     size_t first_key_length,
+     const system_character_t *second_key,
+     size_t second_key_length,
+     const system_character_t **value,
+     size_t *value_size,
+     libcerror_error_t **error )
+{
+	string_cache_entry_t *string_cache_entry = NULL;
+	static char *function                    = "string_cache_get_value";
+	uint32_t hash                            = 0;
+
+	if( string_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value size.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_cache_calculate_hash(
+	     first_key,
+	     first_key_length,
+	     second_key,
+	     second_key_length,
+	     &hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate hash.",
+		 function );
+
+		return( -1 );
+	}
+	string_cache_entry = string_cache->buckets[ hash % (uint32_t) string_cache->number_of_buckets ];
+
+	while( string_cache_entry != NULL )
+	{
+		if( ( string_cache_entry->hash == hash )
+		 && ( string_cache_entry->first_key_length == first_key_length )
+		 && ( string_cache_entry->second_key_length == second_key_length ) )
+		{
+			if( ( ( first_key_length == 0 )
+			  ||  ( memory_compare(
+			         string_cache_entry->key,
+			         first_key,
+			         sizeof( system_character_t ) * first_key_length ) == 0 ) )
+			 && ( ( second_key_length == 0 )
+			  ||  ( memory_compare(
+			         &( string_cache_entry->key[ first_key_length + 1 ] ),
+			         second_key,
+			         sizeof( system_character_t ) * second_key_length ) == 0 ) ) )
+			{
+				*value      = string_cache_entry->value;
+				*value_size = string_cache_entry->value_size;
+
+				return( 1 );
+			}
+		}
+		string_cache_entry = string_cache_entry->next_entry;
+	}
+	return( 0 );
+}
+
+/* Sets the value of a specific key
+ * A NULL value is stored to indicate the key has no corresponding value
+ * If the key is already in the cache its value is replaced
+ * Returns 1 if successful or -1 on error
+ */
+int string_cache_set_value(
+     string_cache_t *string_cache,
+     const system_character_t *first_key,
+     size_t first_key_length,
+     const system_character_t *second_key,
+     size_t second_key_length,
+     const system_character_t *value,
+     size_t value_size,
+     libcerror_error_t **error )
+{
+	string_cache_entry_t *string_cache_entry = NULL;
+	system_character_t *safe_value           = NULL;
+	static char *function                    = "string_cache_set_value";
+	size_t key_size                          = 0;
+	uint32_t hash                            = 0;
+	int bucket_index                         = 0;
+
+	if( string_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_key_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( sizeof( system_character_t ) * 2 ) ) )
+	 || ( second_key_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( sizeof( system_character_t ) * 2 ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( value != NULL )
+	{
+		if( ( value_size == 0 )
+		 || ( value_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid value size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		value_size = 0;
+	}
+	if( string_cache_calculate_hash(
+	     first_key,
+	     first_key_length,
+	     second_key,
+	     second_key_length,
+	     &hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( value != NULL )
+	{
+		safe_value = system_string_allocate(
+		              value_size );
+
+		if( safe_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     safe_value,
+		     value,
+		     sizeof( system_character_t ) * value_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value.",
+			 function );
+
+			goto on_error;
+		}
+		safe_value[ value_size - 1 ] = 0;
+	}
+	bucket_index = (int) ( hash % (uint32_t) string_cache->number_of_buckets );
+
+	string_cache_entry = string_cache->buckets[ bucket_index ];
+
+	while( string_cache_entry != NULL )
+	{
+		if( ( string_cache_entry->hash == hash )
+		 && ( string_cache_entry->first_key_length == first_key_length )
+		 && ( string_cache_entry->second_key_length == second_key_length ) )
+		{
+			if( ( ( first_key_length == 0 )
+			  ||  ( memory_compare(
+			         string_cache_entry->key,
+			         first_key,
+			         sizeof( system_character_t ) * first_key_length ) == 0 ) )
+			 && ( ( second_key_length == 0 )
+			  ||  ( memory_compare(
+			         &( string_cache_entry->key[ first_key_length + 1 ] ),
+			         second_key,
+			         sizeof( system_character_t ) * second_key_length ) == 0 ) ) )
+			{
+				break;
+			}
+		}
+		string_cache_entry = string_cache_entry->next_entry;
+	}
+	if( string_cache_entry != NULL )
+	{
+		if( string_cache_entry->value != NULL )
+		{
+			memory_free(
+			 string_cache_entry->value );
+		}
+		string_cache_entry->value      = safe_value;
+		string_cache_entry->value_size = value_size;
+
+		return( 1 );
+	}
+	string_cache_entry = memory_allocate_structure(
+	                      string_cache_entry_t );
+
+	if( string_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     string_cache_entry,
+	     0,
+	     sizeof( string_cache_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entry.",
+		 function );
+
+		memory_free(
+		 string_cache_entry );
+
+		string_cache_entry = NULL;
+
+		goto on_error;
+	}
+	key_size = first_key_length + second_key_length + 2;
+
+	string_cache_entry->key = system_string_allocate(
+	                           key_size );
+
+	if( string_cache_entry->key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key.",
+		 function );
+
+		goto on_error;
+	}
+	if( first_key_length > 0 )
+	{
+		if( memory_copy(
+		     string_cache_entry->key,
+		     first_key,
+		     sizeof( system_character_t ) * first_key_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy first key.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	string_cache_entry->key[ first_key_length ] = 0;
+
+	if( second_key_length > 0 )
+	{
+		if( memory_copy(
+		     &( string_cache_entry->key[ first_key_length + 1 ] ),
+		     second_key,
+		     sizeof( system_character_t ) * second_key_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy second key.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	string_cache_entry->key[ key_size - 1 ] = 0;
+
+	string_cache_entry->hash              = hash;
+	string_cache_entry->first_key_length  = first_key_length;
+	string_cache_entry->second_key_length = second_key_length;
+	string_cache_entry->value             = safe_value;
+	string_cache_entry->value_size        = value_size;
+
+	safe_value = NULL;
+
+	/* Keep the average number of entries per bucket below 2
+	 */
+	if( ( ( string_cache->number_of_entries / 2 ) >= string_cache->number_of_buckets )
+	 && ( string_cache->number_of_buckets < STRING_CACHE_MAXIMUM_NUMBER_OF_BUCKETS ) )
+	{
+		if( string_cache_resize(
+		     string_cache,
+		     string_cache->number_of_buckets * 2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize string cache.",
+			 function );
+
+			goto on_error;
+		}
+		bucket_index = (int) ( hash % (uint32_t) string_cache->number_of_buckets );
+	}
+	string_cache_entry->next_entry        = string_cache->buckets[ bucket_index ];
+	string_cache->buckets[ bucket_index ] = string_cache_entry;
+
+	string_cache->number_of_entries += 1;
+
+	return( 1 );
+
+on_error:
+	if( string_cache_entry != NULL )
+	{
+		string_cache_entry_free(
+		 &string_cache_entry,
+		 NULL );
+	}
+	if( safe_value != NULL )
+	{
+		memory_free(
+		 safe_value );
+	}
+	return( -1 );
+}
+
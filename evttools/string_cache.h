@@ -0,0 +1,148 @@
+/*
+ * String cache
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _STRING_CACHE_H )
+#define _STRING_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evttools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default number of buckets of a string cache
+ */
+#define STRING_CACHE_DEFAULT_NUMBER_OF_BUCKETS	64
+
+/* The maximum number of buckets the string cache grows to
+ */
+#define STRING_CACHE_MAXIMUM_NUMBER_OF_BUCKETS	65536
+
+typedef struct string_cache_entry string_cache_entry_t;
+
+struct string_cache_entry
+{
+	/* The next entry in the same bucket
+	 */
+	string_cache_entry_t *next_entry;
+
+	/* The hash of the key
+	 */
+	uint32_t hash;
+
+	/* The key, contains the first and second key string
+	 * each terminated by an end-of-string character
+	 */
+	system_character_t *key;
+
+	/* The first key string length
+	 */
+	size_t first_key_length;
+
+	/* The second key string length
+	 */
+	size_t second_key_length;
+
+	/* The value string, NULL if the key has no corresponding value
+	 */
+	system_character_t *value;
+
+	/* The value string size
+	 */
+	size_t value_size;
+};
+
+typedef struct string_cache string_cache_t;
+
+struct string_cache
+{
+	/* The buckets
+	 */
+	string_cache_entry_t **buckets;
+
+	/* The number of buckets
+	 */
+	int number_of_buckets;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+};
+
+int string_cache_entry_free(
+     string_cache_entry_t **string_cache_entry,
+     libcerror_error_t **error );
+
+int string_cache_calculate_hash(
+     const system_character_t *first_key,
+     size_t first_key_length,
+     const system_character_t *second_key,
+     size_t second_key_length,
+     uint32_t *hash,
+     libcerror_error_t **error );
+
+int string_cache_initialize(
+     string_cache_t **string_cache,
+     int number_of_buckets,
+     libcerror_error_t **error );
+
+int string_cache_free(
+     string_cache_t **string_cache,
+     libcerror_error_t **error );
+
+int string_cache_empty(
+     string_cache_t *string_cache,
+     libcerror_error_t **error );
+
+int string_cache_resize(
+     string_cache_t *string_cache,
+     int number_of_buckets,
+     libcerror_error_t **error );
+
+int string_cache_get_value(
+     string_cache_t *string_cache,
+     const system_character_t *first_key,
+     size_t first_key_length,
+     const system_character_t *second_key,
+     size_t second_key_length,
+     const system_character_t **value,
+     size_t *value_size,
+     libcerror_error_t **error );
+
+int string_cache_set_value(
+     string_cache_t *string_cache,
+     const system_character_t *first_key,
+     size_t first_key_length,
+     const system_character_t *second_key,
+     size_t second_key_length,
+     const system_character_t *value,
+     size_t value_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _STRING_CACHE_H ) */
+
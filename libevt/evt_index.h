@@ -0,0 +1,98 @@
+/*
+ * Records index of the Windows Event Log (EVT) format
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EVT_INDEX_H )
+#define _EVT_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The records index is not part of the EVT format, it is stored in a separate
+ * file by libevt to skip reading and recovering the records on open
+ */
+typedef struct evt_index_header evt_index_header_t;
+
+struct evt_index_header
+{
+	/* Signature
+	 * Consists of 8 bytes
+	 * "EVTINDEX"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* Format version
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* Flags
+	 */
+	uint8_t flags[ 4 ];
+
+	/* File size
+	 */
+	uint8_t file_size[ 8 ];
+
+	/* Number of records
+	 */
+	uint8_t number_of_records[ 4 ];
+
+	/* Number of recovered records
+	 */
+	uint8_t number_of_recovered_records[ 4 ];
+
+	/* Number of duplicate recovered records
+	 */
+	uint8_t number_of_duplicate_recovered_records[ 4 ];
+
+	/* File header data
+	 * Contains a copy of the file header
+	 */
+	uint8_t file_header_data[ 48 ];
+
+	/* End of file record data
+	 * Contains a copy of the data at the end of file record offset
+	 */
+	uint8_t end_of_file_record_data[ 40 ];
+};
+
+typedef struct evt_index_entry evt_index_entry_t;
+
+struct evt_index_entry
+{
+	/* Record offset
+	 */
+	uint8_t record_offset[ 8 ];
+
+	/* Record size
+	 */
+	uint8_t record_size[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EVT_INDEX_H ) */
+
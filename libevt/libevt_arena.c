@@ -0,0 +1,499 @@
+/*
+ * Arena functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevt_arena.h"
+#include "libevt_definitions.h"
+#include "libevt_libcerror.h"
+#include "libevt_libcthreads.h"
+#include "libevt_memory.h"
+
+/* The size of the block header, the block data is stored directly after it
+ */
+#define LIBEVT_ARENA_BLOCK_HEADER_SIZE \
+	( ( sizeof( libevt_arena_block_t ) + ( LIBEVT_ARENA_ALIGNMENT - 1 ) ) & ~( (size_t) LIBEVT_ARENA_ALIGNMENT - 1 ) )
+
+/* Creates an arena
+ * Make sure the value arena is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_arena_initialize(
+     libevt_arena_t **arena,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_arena_initialize";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid arena value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size < (size_t) LIBEVT_ARENA_MINIMUM_BLOCK_SIZE )
+	 || ( block_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*arena = memory_allocate_structure(
+	          libevt_arena_t );
+
+	if( *arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *arena,
+	     0,
+	     sizeof( libevt_arena_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear arena.",
+		 function );
+
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+
+		return( -1 );
+	}
+	( *arena )->block_size = block_size;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *arena )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *arena != NULL )
+	{
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an arena
+ * All the buffers carved from the arena are released
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_arena_free(
+     libevt_arena_t **arena,
+     libcerror_error_t **error )
+{
+	libevt_arena_block_t *arena_block = NULL;
+	static char *function             = "libevt_arena_free";
+	int result                        = 1;
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *arena )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		while( ( *arena )->blocks != NULL )
+		{
+			arena_block        = ( *arena )->blocks;
+			( *arena )->blocks = arena_block->next_block;
+
+			libevt_memory_free(
+			 arena_block );
+		}
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+	}
+	return( result );
+}
+
+/* Allocates a buffer
+ * The buffer is carved from the arena or, if arena is NULL, allocated with the allocator
+ * Buffers larger than a quarter of the block size are stored in a block of their own
+ * Returns a pointer to the buffer or NULL on error
+ */
+void *libevt_arena_allocate_buffer(
+       libevt_arena_t *arena,
+       size_t size )
+{
+	libevt_arena_block_t *arena_block = NULL;
+	void *buffer                      = NULL;
+	size_t aligned_size               = 0;
+	size_t block_size                 = 0;
+
+	if( arena == NULL )
+	{
+		return( libevt_memory_allocate(
+		         size ) );
+	}
+	if( size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		return( NULL );
+	}
+	aligned_size = ( size + ( LIBEVT_ARENA_ALIGNMENT - 1 ) ) & ~( (size_t) LIBEVT_ARENA_ALIGNMENT - 1 );
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     arena->mutex,
+	     NULL ) != 1 )
+	{
+		return( NULL );
+	}
+#endif
+	arena_block = arena->blocks;
+
+	if( ( arena_block == NULL )
+	 || ( aligned_size > ( arena_block->size - arena_block->used_size ) ) )
+	{
+		block_size = arena->block_size;
+
+		if( aligned_size > ( arena->block_size / 4 ) )
+		{
+			block_size = aligned_size;
+		}
+		arena_block = (libevt_arena_block_t *) libevt_memory_allocate(
+		                                        LIBEVT_ARENA_BLOCK_HEADER_SIZE + block_size );
+
+		if( arena_block != NULL )
+		{
+			arena_block->size      = block_size;
+			arena_block->used_size = 0;
+
+			/* A block of its own is kept behind the first block so that the
+			 * remaining space of the first block can still be used
+			 */
+			if( ( block_size != arena->block_size )
+			 && ( arena->blocks != NULL ) )
+			{
+				arena_block->next_block   = arena->blocks->next_block;
+				arena->blocks->next_block = arena_block;
+			}
+			else
+			{
+				arena_block->next_block = arena->blocks;
+				arena->blocks           = arena_block;
+			}
+			arena->number_of_blocks += 1;
+			arena->allocated_size   += (size64_t) LIBEVT_ARENA_BLOCK_HEADER_SIZE + block_size;
+		}
+	}
+	if( arena_block != NULL )
+	{
+		buffer = &( ( (uint8_t *) arena_block )[ LIBEVT_ARENA_BLOCK_HEADER_SIZE + arena_block->used_size ] );
+
+		arena_block->used_size += aligned_size;
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     arena->mutex,
+	     NULL ) != 1 )
+	{
+		return( NULL );
+	}
+#endif
+	return( buffer );
+}
+
+/* Frees a buffer
+ * A buffer carved from the arena is only released when the last user of the arena
+ * is removed or when the arena is freed,
+ * if arena is NULL the buffer is freed with the allocator
+ */
+void libevt_arena_free_buffer(
+      libevt_arena_t *arena,
+      void *buffer )
+{
+	if( arena == NULL )
+	{
+		libevt_memory_free(
+		 buffer );
+	}
+}
+
+/* Adds a user of the arena
+ * Every user must be removed with libevt_arena_remove_user
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_arena_add_user(
+     libevt_arena_t *arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_arena_add_user";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     arena->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	arena->number_of_users += 1;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     arena->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Removes a user of the arena
+ * When the last user is removed the buffers carved from the arena are no longer
+ * in use and the blocks are released
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_arena_remove_user(
+     libevt_arena_t *arena,
+     libcerror_error_t **error )
+{
+	libevt_arena_block_t *arena_block = NULL;
+	static char *function             = "libevt_arena_remove_user";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     arena->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( arena->number_of_users > 0 )
+	{
+		arena->number_of_users -= 1;
+	}
+	if( arena->number_of_users == 0 )
+	{
+		while( arena->blocks != NULL )
+		{
+			arena_block   = arena->blocks;
+			arena->blocks = arena_block->next_block;
+
+			libevt_memory_free(
+			 arena_block );
+		}
+		arena->number_of_blocks = 0;
+		arena->allocated_size   = 0;
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     arena->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the size of the memory allocated by the arena
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_arena_get_allocated_size(
+     libevt_arena_t *arena,
+     size64_t *allocated_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_arena_get_allocated_size";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocated_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocated size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     arena->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*allocated_size = arena->allocated_size;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     arena->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
@@ -0,0 +1,118 @@
+/*
+ * Arena functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVT_ARENA_H )
+#define _LIBEVT_ARENA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevt_libcerror.h"
+#include "libevt_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevt_arena_block libevt_arena_block_t;
+
+struct libevt_arena_block
+{
+	/* The next block
+	 */
+	libevt_arena_block_t *next_block;
+
+	/* The size of the block data
+	 */
+	size_t size;
+
+	/* The size of the block data that is in use
+	 */
+	size_t used_size;
+};
+
+typedef struct libevt_arena libevt_arena_t;
+
+struct libevt_arena
+{
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The blocks, the first block is the one allocations are carved from
+	 */
+	libevt_arena_block_t *blocks;
+
+	/* The number of blocks
+	 */
+	int number_of_blocks;
+
+	/* The allocated size
+	 */
+	size64_t allocated_size;
+
+	/* The number of users
+	 */
+	int number_of_users;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libevt_arena_initialize(
+     libevt_arena_t **arena,
+     size_t block_size,
+     libcerror_error_t **error );
+
+int libevt_arena_free(
+     libevt_arena_t **arena,
+     libcerror_error_t **error );
+
+void *libevt_arena_allocate_buffer(
+       libevt_arena_t *arena,
+       size_t size );
+
+void libevt_arena_free_buffer(
+      libevt_arena_t *arena,
+      void *buffer );
+
+int libevt_arena_add_user(
+     libevt_arena_t *arena,
+     libcerror_error_t **error );
+
+int libevt_arena_remove_user(
+     libevt_arena_t *arena,
+     libcerror_error_t **error );
+
+int libevt_arena_get_allocated_size(
+     libevt_arena_t *arena,
+     size64_t *allocated_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVT_ARENA_H ) */
+
@@ -0,0 +1,543 @@
+/*
+ * Records cache index functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevt_cache_index.h"
+#include "libevt_definitions.h"
+#include "libevt_libcerror.h"
+
+/* Creates a cache index
+ * Make sure the value cache_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_cache_index_initialize(
+     libevt_cache_index_t **cache_index,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function      = "libevt_cache_index_initialize";
+	int number_of_hash_buckets = 2;
+
+	if( cache_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cache index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries <= 0 )
+	 || ( number_of_entries > LIBEVT_MAXIMUM_CACHE_ENTRIES_RECORDS_LIMIT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Use at least as many hash buckets as entries
+	 */
+	while( number_of_hash_buckets < number_of_entries )
+	{
+		number_of_hash_buckets <<= 1;
+	}
+	*cache_index = memory_allocate_structure(
+	                libevt_cache_index_t );
+
+	if( *cache_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *cache_index,
+	     0,
+	     sizeof( libevt_cache_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cache index.",
+		 function );
+
+		memory_free(
+		 *cache_index );
+
+		*cache_index = NULL;
+
+		return( -1 );
+	}
+	( *cache_index )->entries = (libevt_cache_index_entry_t *) memory_allocate(
+	                                                            sizeof( libevt_cache_index_entry_t ) * number_of_entries );
+
+	if( ( *cache_index )->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	( *cache_index )->hash_buckets = (int *) memory_allocate(
+	                                          sizeof( int ) * number_of_hash_buckets );
+
+	if( ( *cache_index )->hash_buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash buckets.",
+		 function );
+
+		goto on_error;
+	}
+	( *cache_index )->number_of_entries      = number_of_entries;
+	( *cache_index )->number_of_hash_buckets = number_of_hash_buckets;
+
+	if( libevt_cache_index_empty(
+	     *cache_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to empty cache index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *cache_index != NULL )
+	{
+		if( ( *cache_index )->hash_buckets != NULL )
+		{
+			memory_free(
+			 ( *cache_index )->hash_buckets );
+		}
+		if( ( *cache_index )->entries != NULL )
+		{
+			memory_free(
+			 ( *cache_index )->entries );
+		}
+		memory_free(
+		 *cache_index );
+
+		*cache_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a cache index
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_cache_index_free(
+     libevt_cache_index_t **cache_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_cache_index_free";
+
+	if( cache_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache_index != NULL )
+	{
+		if( ( *cache_index )->hash_buckets != NULL )
+		{
+			memory_free(
+			 ( *cache_index )->hash_buckets );
+		}
+		if( ( *cache_index )->entries != NULL )
+		{
+			memory_free(
+			 ( *cache_index )->entries );
+		}
+		memory_free(
+		 *cache_index );
+
+		*cache_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Empties a cache index
+ * All entries are marked as not used, ordered from the first to the last entry
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_cache_index_empty(
+     libevt_cache_index_t *cache_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_cache_index_empty";
+	int bucket_index      = 0;
+	int entry_index       = 0;
+
+	if( cache_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( cache_index->entries == NULL )
+	 || ( cache_index->hash_buckets == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cache index - missing entries or hash buckets.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < cache_index->number_of_entries;
+	     entry_index++ )
+	{
+		cache_index->entries[ entry_index ].records_list_index    = -1;
+		cache_index->entries[ entry_index ].record_offset         = 0;
+		cache_index->entries[ entry_index ].previous_entry_index  = entry_index - 1;
+		cache_index->entries[ entry_index ].next_entry_index      = entry_index + 1;
+		cache_index->entries[ entry_index ].next_hash_entry_index = -1;
+	}
+	cache_index->entries[ cache_index->number_of_entries - 1 ].next_entry_index = -1;
+
+	for( bucket_index = 0;
+	     bucket_index < cache_index->number_of_hash_buckets;
+	     bucket_index++ )
+	{
+		cache_index->hash_buckets[ bucket_index ] = -1;
+	}
+	cache_index->least_recently_used_entry_index = 0;
+	cache_index->most_recently_used_entry_index  = cache_index->number_of_entries - 1;
+
+	return( 1 );
+}
+
+/* Calculates the hash of a record
+ * Returns the hash
+ */
+uint32_t libevt_cache_index_calculate_hash(
+          int records_list_index,
+          off64_t record_offset )
+{
+	uint32_t hash = 0;
+
+	/* Records are stored 32-bit aligned
+	 */
+	hash  = (uint32_t) ( record_offset >> 2 ) ^ ( (uint32_t) records_list_index << 31 );
+	hash *= (uint32_t) 2654435761UL;
+	hash ^= hash >> 16;
+
+	return( hash );
+}
+
+/* Marks an entry as the most recently used entry
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_cache_index_set_most_recently_used(
+     libevt_cache_index_t *cache_index,
+     int entry_index,
+     libcerror_error_t **error )
+{
+	libevt_cache_index_entry_t *entry = NULL;
+	static char *function             = "libevt_cache_index_set_most_recently_used";
+
+	if( cache_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= cache_index->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == cache_index->most_recently_used_entry_index )
+	{
+		return( 1 );
+	}
+	entry = &( cache_index->entries[ entry_index ] );
+
+	/* Unlink the entry, it has a next entry since it is not the most recently used
+	 */
+	if( entry->previous_entry_index == -1 )
+	{
+		cache_index->least_recently_used_entry_index = entry->next_entry_index;
+	}
+	else
+	{
+		cache_index->entries[ entry->previous_entry_index ].next_entry_index = entry->next_entry_index;
+	}
+	cache_index->entries[ entry->next_entry_index ].previous_entry_index = entry->previous_entry_index;
+
+	entry->previous_entry_index = cache_index->most_recently_used_entry_index;
+	entry->next_entry_index     = -1;
+
+	cache_index->entries[ cache_index->most_recently_used_entry_index ].next_entry_index = entry_index;
+
+	cache_index->most_recently_used_entry_index = entry_index;
+
+	return( 1 );
+}
+
+/* Retrieves the entry of a specific record
+ * If the record is found the entry is marked as the most recently used entry,
+ * otherwise entry_index is set to the least recently used entry, which is
+ * the entry to reuse for the record
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libevt_cache_index_get_entry_by_record(
+     libevt_cache_index_t *cache_index,
+     int records_list_index,
+     off64_t record_offset,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	libevt_cache_index_entry_t *entry = NULL;
+	static char *function             = "libevt_cache_index_get_entry_by_record";
+	uint32_t hash                     = 0;
+	int safe_entry_index              = 0;
+
+	if( cache_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache index.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	hash = libevt_cache_index_calculate_hash(
+	        records_list_index,
+	        record_offset );
+
+	safe_entry_index = cache_index->hash_buckets[ hash & (uint32_t) ( cache_index->number_of_hash_buckets - 1 ) ];
+
+	while( safe_entry_index != -1 )
+	{
+		entry = &( cache_index->entries[ safe_entry_index ] );
+
+		if( ( entry->records_list_index == records_list_index )
+		 && ( entry->record_offset == record_offset ) )
+		{
+			if( libevt_cache_index_set_most_recently_used(
+			     cache_index,
+			     safe_entry_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set entry: %d as most recently used.",
+				 function,
+				 safe_entry_index );
+
+				return( -1 );
+			}
+			*entry_index = safe_entry_index;
+
+			return( 1 );
+		}
+		safe_entry_index = entry->next_hash_entry_index;
+	}
+	*entry_index = cache_index->least_recently_used_entry_index;
+
+	return( 0 );
+}
+
+/* Sets the record of a specific entry
+ * The entry is marked as the most recently used entry
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_cache_index_set_entry(
+     libevt_cache_index_t *cache_index,
+     int entry_index,
+     int records_list_index,
+     off64_t record_offset,
+     libcerror_error_t **error )
+{
+	libevt_cache_index_entry_t *entry = NULL;
+	static char *function             = "libevt_cache_index_set_entry";
+	uint32_t hash                     = 0;
+	int *hash_entry_index             = NULL;
+	int bucket_index                  = 0;
+
+	if( cache_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= cache_index->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( records_list_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid records list index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	entry = &( cache_index->entries[ entry_index ] );
+
+	/* Remove the record previously stored in the entry from its hash bucket
+	 */
+	if( entry->records_list_index != -1 )
+	{
+		hash = libevt_cache_index_calculate_hash(
+		        entry->records_list_index,
+		        entry->record_offset );
+
+		hash_entry_index = &( cache_index->hash_buckets[ hash & (uint32_t) ( cache_index->number_of_hash_buckets - 1 ) ] );
+
+		while( *hash_entry_index != -1 )
+		{
+			if( *hash_entry_index == entry_index )
+			{
+				*hash_entry_index = entry->next_hash_entry_index;
+
+				break;
+			}
+			hash_entry_index = &( cache_index->entries[ *hash_entry_index ].next_hash_entry_index );
+		}
+	}
+	hash = libevt_cache_index_calculate_hash(
+	        records_list_index,
+	        record_offset );
+
+	bucket_index = (int) ( hash & (uint32_t) ( cache_index->number_of_hash_buckets - 1 ) );
+
+	entry->records_list_index    = records_list_index;
+	entry->record_offset         = record_offset;
+	entry->next_hash_entry_index = cache_index->hash_buckets[ bucket_index ];
+
+	cache_index->hash_buckets[ bucket_index ] = entry_index;
+
+	if( libevt_cache_index_set_most_recently_used(
+	     cache_index,
+	     entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set entry: %d as most recently used.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
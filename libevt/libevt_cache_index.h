@@ -0,0 +1,130 @@
+/*
+ * Records cache index functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVT_CACHE_INDEX_H )
+#define _LIBEVT_CACHE_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevt_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevt_cache_index_entry libevt_cache_index_entry_t;
+
+struct libevt_cache_index_entry
+{
+	/* The index of the records list, 0 for the records and 1 for the recovered records
+	 * or -1 if the cache entry is not used
+	 */
+	int records_list_index;
+
+	/* The record offset
+	 */
+	off64_t record_offset;
+
+	/* The index of the entry that was used less recently or -1 if not set
+	 */
+	int previous_entry_index;
+
+	/* The index of the entry that was used more recently or -1 if not set
+	 */
+	int next_entry_index;
+
+	/* The index of the next entry in the same hash bucket or -1 if not set
+	 */
+	int next_hash_entry_index;
+};
+
+typedef struct libevt_cache_index libevt_cache_index_t;
+
+struct libevt_cache_index
+{
+	/* The entries, one for every records cache entry
+	 */
+	libevt_cache_index_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The hash buckets, which contain the index of the first entry in the bucket or -1 if empty
+	 */
+	int *hash_buckets;
+
+	/* The number of hash buckets, which is a power of 2
+	 */
+	int number_of_hash_buckets;
+
+	/* The index of the least recently used entry
+	 */
+	int least_recently_used_entry_index;
+
+	/* The index of the most recently used entry
+	 */
+	int most_recently_used_entry_index;
+};
+
+int libevt_cache_index_initialize(
+     libevt_cache_index_t **cache_index,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+int libevt_cache_index_free(
+     libevt_cache_index_t **cache_index,
+     libcerror_error_t **error );
+
+int libevt_cache_index_empty(
+     libevt_cache_index_t *cache_index,
+     libcerror_error_t **error );
+
+uint32_t libevt_cache_index_calculate_hash(
+          int records_list_index,
+          off64_t record_offset );
+
+int libevt_cache_index_set_most_recently_used(
+     libevt_cache_index_t *cache_index,
+     int entry_index,
+     libcerror_error_t **error );
+
+int libevt_cache_index_get_entry_by_record(
+     libevt_cache_index_t *cache_index,
+     int records_list_index,
+     off64_t record_offset,
+     int *entry_index,
+     libcerror_error_t **error );
+
+int libevt_cache_index_set_entry(
+     libevt_cache_index_t *cache_index,
+     int entry_index,
+     int records_list_index,
+     off64_t record_offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVT_CACHE_INDEX_H ) */
+
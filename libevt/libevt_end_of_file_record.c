@@ -367,6 +367,14 @@ int libevt_end_of_file_record_read_data(
 
 		return( -1 );
 	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evt_end_of_file_record_t *) data )->first_record_offset,
+	 end_of_file_record->first_record_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evt_end_of_file_record_t *) data )->end_of_file_record_offset,
+	 end_of_file_record->end_of_file_record_offset );
+
 	return( 1 );
 }
 
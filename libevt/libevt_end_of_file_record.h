@@ -35,9 +35,13 @@ typedef struct libevt_end_of_file_record libevt_end_of_file_record_t;
 
 struct libevt_end_of_file_record
 {
-	/* Dummy
+	/* First (oldest) record offset
 	 */
-	int dummy;
+	uint32_t first_record_offset;
+
+	/* End of file record offset
+	 */
+	uint32_t end_of_file_record_offset;
 };
 
 int libevt_end_of_file_record_initialize(
@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libevt_arena.h"
 #include "libevt_debug.h"
 #include "libevt_event_record.h"
 #include "libevt_libcerror.h"
@@ -31,6 +32,7 @@
 #include "libevt_libfdatetime.h"
 #include "libevt_libfwnt.h"
 #include "libevt_libuna.h"
+#include "libevt_memory.h"
 #include "libevt_strings_array.h"
 
 #include "evt_event_record.h"
@@ -67,8 +69,8 @@ int libevt_event_record_initialize(
 
 		return( -1 );
 	}
-	*event_record = memory_allocate_structure(
-	                 libevt_event_record_t );
+	*event_record = (libevt_event_record_t *) libevt_memory_allocate(
+	                                           sizeof( libevt_event_record_t ) );
 
 	if( *event_record == NULL )
 	{
@@ -100,7 +102,7 @@ int libevt_event_record_initialize(
 on_error:
 	if( *event_record != NULL )
 	{
-		memory_free(
+		libevt_memory_free(
 		 *event_record );
 
 		*event_record = NULL;
@@ -133,12 +135,14 @@ int libevt_event_record_free(
 	{
 		if( ( *event_record )->source_name != NULL )
 		{
-			memory_free(
+			libevt_arena_free_buffer(
+			 ( *event_record )->arena,
 			 ( *event_record )->source_name );
 		}
 		if( ( *event_record )->computer_name != NULL )
 		{
-			memory_free(
+			libevt_arena_free_buffer(
+			 ( *event_record )->arena,
 			 ( *event_record )->computer_name );
 		}
 		if( ( *event_record )->user_security_identifier != NULL )
@@ -175,10 +179,11 @@ int libevt_event_record_free(
 		}
 		if( ( *event_record )->data != NULL )
 		{
-			memory_free(
+			libevt_arena_free_buffer(
+			 ( *event_record )->arena,
 			 ( *event_record )->data );
 		}
-		memory_free(
+		libevt_memory_free(
 		 *event_record );
 
 		*event_record = NULL;
@@ -553,7 +558,8 @@ int libevt_event_record_read_data(
 
 			goto on_error;
 		}
-		event_record->source_name = (uint8_t *) memory_allocate(
+		event_record->source_name = (uint8_t *) libevt_arena_allocate_buffer(
+		                                         event_record->arena,
 		                                         sizeof( uint8_t ) * source_name_size );
 
 		if( event_record->source_name == NULL )
@@ -635,7 +641,8 @@ int libevt_event_record_read_data(
 
 			goto on_error;
 		}
-		event_record->computer_name = (uint8_t *) memory_allocate(
+		event_record->computer_name = (uint8_t *) libevt_arena_allocate_buffer(
+		                                           event_record->arena,
 		                                           sizeof( uint8_t ) * computer_name_size );
 
 		if( event_record->computer_name == NULL )
@@ -801,6 +808,8 @@ int libevt_event_record_read_data(
 
 			goto on_error;
 		}
+		event_record->strings->arena = event_record->arena;
+
 		if( libevt_strings_array_read_data(
 		     event_record->strings,
 		     event_strings,
@@ -870,7 +879,8 @@ int libevt_event_record_read_data(
 
 			goto on_error;
 		}
-		event_record->data = (uint8_t *) memory_allocate(
+		event_record->data = (uint8_t *) libevt_arena_allocate_buffer(
+		                                  event_record->arena,
 		                                  sizeof( uint8_t ) * event_data_size );
 
 		if( event_record->data == NULL )
@@ -942,7 +952,8 @@ int libevt_event_record_read_data(
 on_error:
 	if( event_record->data != NULL )
 	{
-		memory_free(
+		libevt_arena_free_buffer(
+		 event_record->arena,
 		 event_record->data );
 
 		event_record->data = NULL;
@@ -963,7 +974,8 @@ on_error:
 	}
 	if( event_record->computer_name != NULL )
 	{
-		memory_free(
+		libevt_arena_free_buffer(
+		 event_record->arena,
 		 event_record->computer_name );
 
 		event_record->computer_name = NULL;
@@ -972,7 +984,8 @@ on_error:
 
 	if( event_record->source_name != NULL )
 	{
-		memory_free(
+		libevt_arena_free_buffer(
+		 event_record->arena,
 		 event_record->source_name );
 
 		event_record->source_name = NULL;
@@ -982,6 +995,145 @@ on_error:
 	return( -1 );
 }
 
+/* Checks if data could contain an event record
+ * This function does not allocate memory and does not set an error if the data
+ * does not contain an event record, which makes it suitable to quickly discard
+ * false positive signature matches
+ * The data can be smaller than the record size, in which case only the values
+ * stored in the data are checked
+ * Returns 1 if the data could contain an event record, 0 if not or -1 on error
+ */
+int libevt_event_record_check_data(
+     const uint8_t *data,
+     size_t data_size,
+     size_t maximum_record_size,
+     libcerror_error_t **error )
+{
+	static char *function                    = "libevt_event_record_check_data";
+	size_t maximum_data_size                 = 0;
+	uint32_t copy_of_record_size             = 0;
+	uint32_t event_data_offset               = 0;
+	uint32_t event_data_size                 = 0;
+	uint32_t event_strings_offset            = 0;
+	uint32_t record_size                     = 0;
+	uint32_t user_security_identifier_offset = 0;
+	uint32_t user_security_identifier_size   = 0;
+	uint16_t number_of_event_strings         = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 8 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     ( (evt_event_record_t *) data )->signature,
+	     "LfLe",
+	     4 ) != 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evt_event_record_t *) data )->size,
+	 record_size );
+
+	if( ( (size_t) record_size < sizeof( evt_event_record_t ) )
+	 || ( (size_t) record_size > maximum_record_size )
+	 || ( (size_t) record_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		return( 0 );
+	}
+	if( (size_t) record_size <= data_size )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ record_size - 4 ] ),
+		 copy_of_record_size );
+
+		if( copy_of_record_size != record_size )
+		{
+			return( 0 );
+		}
+	}
+	if( data_size < sizeof( evt_event_record_t ) )
+	{
+		return( 1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (evt_event_record_t *) data )->number_of_strings,
+	 number_of_event_strings );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evt_event_record_t *) data )->event_strings_offset,
+	 event_strings_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evt_event_record_t *) data )->user_security_identifier_size,
+	 user_security_identifier_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evt_event_record_t *) data )->user_security_identifier_offset,
+	 user_security_identifier_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evt_event_record_t *) data )->event_data_size,
+	 event_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evt_event_record_t *) data )->event_data_offset,
+	 event_data_offset );
+
+	/* The checks below mirror the bounds checks in libevt_event_record_read_data
+	 */
+	maximum_data_size = (size_t) record_size - 4;
+
+	if( user_security_identifier_size != 0 )
+	{
+		if( ( (size_t) user_security_identifier_offset < sizeof( evt_event_record_t ) )
+		 || ( (size_t) user_security_identifier_offset >= maximum_data_size )
+		 || ( (size_t) user_security_identifier_size > maximum_data_size )
+		 || ( (size_t) user_security_identifier_offset >= ( maximum_data_size - user_security_identifier_size ) ) )
+		{
+			return( 0 );
+		}
+	}
+	if( number_of_event_strings != 0 )
+	{
+		if( ( (size_t) event_strings_offset < sizeof( evt_event_record_t ) )
+		 || ( (size_t) event_strings_offset >= maximum_data_size ) )
+		{
+			return( 0 );
+		}
+	}
+	if( event_data_size != 0 )
+	{
+		if( ( (size_t) event_data_offset < sizeof( evt_event_record_t ) )
+		 || ( (size_t) event_data_offset >= maximum_data_size )
+		 || ( (size_t) event_data_size > maximum_data_size )
+		 || ( (size_t) event_data_offset > ( maximum_data_size - event_data_size ) ) )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
 /* Retrieves the record number
  * Returns 1 if successful or -1 on error
  */
@@ -25,6 +25,8 @@
 #include <common.h>
 #include <types.h>
 
+#include "libevt_arena.h"
+#include "libevt_arena.h"
 #include "libevt_libcerror.h"
 #include "libevt_libfwnt.h"
 #include "libevt_strings_array.h"
@@ -100,6 +102,10 @@ struct libevt_event_record
 	/* Copy of record size
 	 */
 	uint32_t copy_of_record_size;
+
+	/* The arena the names, strings and data are carved from, NULL if not used
+	 */
+	libevt_arena_t *arena;
 };
 
 int libevt_event_record_initialize(
@@ -116,6 +122,12 @@ int libevt_event_record_read_data(
      size_t data_size,
      libcerror_error_t **error );
 
+int libevt_event_record_check_data(
+     const uint8_t *data,
+     size_t data_size,
+     size_t maximum_record_size,
+     libcerror_error_t **error );
+
 int libevt_event_record_get_record_number(
      libevt_event_record_t *event_record,
      uint32_t *record_number,
@@ -20,17 +20,25 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <narrow_string.h>
 #include <types.h>
 #include <wide_string.h>
 
+#include "libevt_arena.h"
+#include "libevt_cache_index.h"
 #include "libevt_codepage.h"
 #include "libevt_debug.h"
 #include "libevt_definitions.h"
+#include "libevt_end_of_file_record.h"
 #include "libevt_io_handle.h"
 #include "libevt_file.h"
+#include "libevt_file_data.h"
 #include "libevt_file_header.h"
+#include "libevt_filter.h"
+#include "libevt_identifier_map.h"
+#include "libevt_index.h"
 #include "libevt_libbfio.h"
 #include "libevt_libcerror.h"
 #include "libevt_libcnotify.h"
@@ -38,8 +46,13 @@
 #include "libevt_libfcache.h"
 #include "libevt_libfdata.h"
 #include "libevt_record.h"
+#include "libevt_record_map.h"
 #include "libevt_record_values.h"
+#include "libevt_record_view.h"
+#include "libevt_time_index.h"
 
+#include "evt_end_of_file_record.h"
+#include "evt_event_record.h"
 #include "evt_file_header.h"
 
 /* Creates a file
@@ -171,6 +184,23 @@ int libevt_file_initialize(
 
 		goto on_error;
 	}
+	if( libevt_cache_index_initialize(
+	     &( internal_file->records_cache_index ),
+	     LIBEVT_MAXIMUM_CACHE_ENTRIES_RECORDS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create records cache index.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->cache_policy          = LIBEVT_CACHE_POLICY_DIRECT_MAPPED;
+	internal_file->maximum_cache_entries = LIBEVT_MAXIMUM_CACHE_ENTRIES_RECORDS;
+
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_initialize(
 	     &( internal_file->read_write_lock ),
@@ -185,6 +215,45 @@ int libevt_file_initialize(
 
 		goto on_error;
 	}
+	if( libcthreads_mutex_initialize(
+	     &( internal_file->records_cache_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize records cache mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( internal_file->identifier_map_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize identifier map mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( internal_file->time_index_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize time index mutex.",
+		 function );
+
+		goto on_error;
+	}
 #endif
 	*file = (libevt_file_t *) internal_file;
 
@@ -193,6 +262,38 @@ int libevt_file_initialize(
 on_error:
 	if( internal_file != NULL )
 	{
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+		if( internal_file->identifier_map_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( internal_file->identifier_map_mutex ),
+			 NULL );
+		}
+		if( internal_file->records_cache_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( internal_file->records_cache_mutex ),
+			 NULL );
+		}
+		if( internal_file->read_write_lock != NULL )
+		{
+			libcthreads_read_write_lock_free(
+			 &( internal_file->read_write_lock ),
+			 NULL );
+		}
+#endif
+		if( internal_file->records_cache_index != NULL )
+		{
+			libevt_cache_index_free(
+			 &( internal_file->records_cache_index ),
+			 NULL );
+		}
+		if( internal_file->records_cache != NULL )
+		{
+			libfcache_cache_free(
+			 &( internal_file->records_cache ),
+			 NULL );
+		}
 		if( internal_file->recovered_records_list != NULL )
 		{
 			libfdata_list_free(
@@ -275,6 +376,45 @@ int libevt_file_free(
 
 			result = -1;
 		}
+		if( libcthreads_mutex_free(
+		     &( internal_file->records_cache_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free records cache mutex.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( internal_file->identifier_map_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free identifier map mutex.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( internal_file->time_index_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free time index mutex.",
+			 function );
+
+			result = -1;
+		}
 #endif
 		if( libfcache_cache_free(
 		     &( internal_file->records_cache ),
@@ -289,6 +429,19 @@ int libevt_file_free(
 
 			result = -1;
 		}
+		if( libevt_cache_index_free(
+		     &( internal_file->records_cache_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free records cache index.",
+			 function );
+
+			result = -1;
+		}
 		if( libfdata_list_free(
 		     &( internal_file->recovered_records_list ),
 		     error ) != 1 )
@@ -717,20 +870,24 @@ on_error:
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
-/* Opens a file using a Basic File IO (bfio) handle
+/* Opens a file using a records index
+ * The records are read from the records index instead of the file if the index
+ * matches the file, otherwise the records are read and recovered from the file
  * Returns 1 if successful or -1 on error
  */
-int libevt_file_open_file_io_handle(
+int libevt_file_open_with_index(
      libevt_file_t *file,
-     libbfio_handle_t *file_io_handle,
+     const char *filename,
+     const char *index_filename,
      int access_flags,
      libcerror_error_t **error )
 {
-	libevt_internal_file_t *internal_file    = NULL;
-	static char *function                    = "libevt_file_open_file_io_handle";
-	uint8_t file_io_handle_opened_in_library = 0;
-	int bfio_access_flags                    = 0;
-	int file_io_handle_is_open               = 0;
+	libbfio_handle_t *file_io_handle       = NULL;
+	libbfio_handle_t *index_file_io_handle = NULL;
+	libevt_internal_file_t *internal_file  = NULL;
+	static char *function                  = "libevt_file_open_with_index";
+	size_t filename_length                 = 0;
+	size_t index_filename_length           = 0;
 
 	if( file == NULL )
 	{
@@ -745,24 +902,24 @@ int libevt_file_open_file_io_handle(
 	}
 	internal_file = (libevt_internal_file_t *) file;
 
-	if( internal_file->file_io_handle != NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - file IO handle already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( file_io_handle == NULL )
+	if( index_filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file IO handle.",
+		 "%s: invalid index filename.",
 		 function );
 
 		return( -1 );
@@ -790,53 +947,111 @@ int libevt_file_open_file_io_handle(
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBEVT_ACCESS_FLAG_READ ) != 0 )
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
 	{
-		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
 	}
-	file_io_handle_is_open = libbfio_handle_is_open(
-	                          file_io_handle,
-	                          error );
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libbfio_handle_set_track_offsets_read(
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set track offsets read in file IO handle.",
+                 function );
 
-	if( file_io_handle_is_open == -1 )
+		goto on_error;
+	}
+#endif
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_initialize(
+	     &index_file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to determine if file IO handle is open.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file IO handle.",
 		 function );
 
 		goto on_error;
 	}
-	else if( file_io_handle_is_open == 0 )
+	index_filename_length = narrow_string_length(
+	                         index_filename );
+
+	if( libbfio_file_set_name(
+	     index_file_io_handle,
+	     index_filename,
+	     index_filename_length + 1,
+	     error ) != 1 )
 	{
-		if( libbfio_handle_open(
-		     file_io_handle,
-		     bfio_access_flags,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to open file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in index file IO handle.",
+		 function );
 
-			goto on_error;
-		}
-		file_io_handle_opened_in_library = 1;
+		goto on_error;
 	}
-	if( libevt_file_open_read(
-	     internal_file,
+	if( libevt_file_open_file_io_handle_with_index(
+	     file,
 	     file_io_handle,
+	     index_file_io_handle,
+	     access_flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from file handle.",
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %s with index: %s.",
+		 function,
+		 filename,
+		 index_filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index file IO handle.",
 		 function );
 
 		goto on_error;
@@ -856,8 +1071,7 @@ int libevt_file_open_file_io_handle(
 		goto on_error;
 	}
 #endif
-	internal_file->file_io_handle                   = file_io_handle;
-	internal_file->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+	internal_file->file_io_handle_created_in_library = 1;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -871,8 +1085,7 @@ int libevt_file_open_file_io_handle(
 		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		internal_file->file_io_handle                   = NULL;
-		internal_file->file_io_handle_opened_in_library = 0;
+		internal_file->file_io_handle_created_in_library = 0;
 
 		goto on_error;
 	}
@@ -880,25 +1093,41 @@ int libevt_file_open_file_io_handle(
 	return( 1 );
 
 on_error:
-	if( file_io_handle_opened_in_library != 0 )
+	if( index_file_io_handle != NULL )
 	{
-		libbfio_handle_close(
-		 file_io_handle,
-		 error );
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
 	}
 	return( -1 );
 }
 
-/* Closes a file
- * Returns 0 if successful or -1 on error
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens a file using a records index
+ * The records are read from the records index instead of the file if the index
+ * matches the file, otherwise the records are read and recovered from the file
+ * Returns 1 if successful or -1 on error
  */
-int libevt_file_close(
+int libevt_file_open_with_index_wide(
      libevt_file_t *file,
+     const wchar_t *filename,
+     const wchar_t *index_filename,
+     int access_flags,
      libcerror_error_t **error )
 {
-	libevt_internal_file_t *internal_file = NULL;
-	static char *function                 = "libevt_file_close";
-	int result                            = 0;
+	libbfio_handle_t *file_io_handle       = NULL;
+	libbfio_handle_t *index_file_io_handle = NULL;
+	libevt_internal_file_t *internal_file  = NULL;
+	static char *function                  = "libevt_file_open_with_index_wide";
+	size_t filename_length                 = 0;
+	size_t index_filename_length           = 0;
 
 	if( file == NULL )
 	{
@@ -913,154 +1142,177 @@ int libevt_file_close(
 	}
 	internal_file = (libevt_internal_file_t *) file;
 
-	if( internal_file->file_io_handle == NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_file->read_write_lock,
-	     error ) != 1 )
+	if( index_filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index filename.",
+		 function );
 
 		return( -1 );
 	}
-#endif
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( ( ( access_flags & LIBEVT_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBEVT_ACCESS_FLAG_WRITE ) == 0 ) )
 	{
-		if( internal_file->file_io_handle_created_in_library != 0 )
-		{
-			if( libevt_debug_print_read_offsets(
-			     internal_file->file_io_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print the read offsets.",
-				 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
 
-				result = -1;
-			}
-		}
+		return( -1 );
 	}
-#endif
-	if( internal_file->file_io_handle_opened_in_library != 0 )
+	if( ( access_flags & LIBEVT_ACCESS_FLAG_WRITE ) != 0 )
 	{
-		if( libbfio_handle_close(
-		     internal_file->file_io_handle,
-		     error ) != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
 
-			result = -1;
-		}
-		internal_file->file_io_handle_opened_in_library = 0;
+		return( -1 );
 	}
-	if( internal_file->file_io_handle_created_in_library != 0 )
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
 	{
-		if( libbfio_handle_free(
-		     &( internal_file->file_io_handle ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
 
-			result = -1;
-		}
-		internal_file->file_io_handle_created_in_library = 0;
+		goto on_error;
 	}
-	internal_file->file_io_handle = NULL;
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libbfio_handle_set_track_offsets_read(
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set track offsets read in file IO handle.",
+                 function );
 
-	if( libevt_io_handle_clear(
-	     internal_file->io_handle,
+		goto on_error;
+	}
+#endif
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_initialize(
+	     &index_file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to clear IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file IO handle.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-	if( libevt_file_header_free(
-	     &( internal_file->file_header ),
+	index_filename_length = wide_string_length(
+	                         index_filename );
+
+	if( libbfio_file_set_name_wide(
+	     index_file_io_handle,
+	     index_filename,
+	     index_filename_length + 1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free file header.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in index file IO handle.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-	if( libfdata_list_empty(
-	     internal_file->records_list,
+	if( libevt_file_open_file_io_handle_with_index(
+	     file,
+	     file_io_handle,
+	     index_file_io_handle,
+	     access_flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty records list.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %ls with index: %ls.",
+		 function,
+		 filename,
+		 index_filename );
 
-		result = -1;
+		goto on_error;
 	}
-	if( libfdata_list_empty(
-	     internal_file->recovered_records_list,
+	if( libbfio_handle_free(
+	     &index_file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty recovered records list.",
+		 "%s: unable to free index file IO handle.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-	if( libfcache_cache_empty(
-	     internal_file->records_cache,
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty records cache.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
+#endif
+	internal_file->file_io_handle_created_in_library = 1;
+
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_file->read_write_lock,
@@ -1073,27 +1325,47 @@ int libevt_file_close(
 		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		return( -1 );
+		internal_file->file_io_handle_created_in_library = 0;
+
+		goto on_error;
 	}
 #endif
-	return( result );
+	return( 1 );
+
+on_error:
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Opens a file for reading
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Opens a file from a memory buffer
+ * The buffer is not copied and must remain available until the file is closed
  * Returns 1 if successful or -1 on error
  */
-int libevt_file_open_read(
-     libevt_internal_file_t *internal_file,
-     libbfio_handle_t *file_io_handle,
+int libevt_file_open_memory(
+     libevt_file_t *file,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     int access_flags,
      libcerror_error_t **error )
 {
-	static char *function      = "libevt_file_open_read";
-	off64_t last_record_offset = 0;
-	uint32_t header_size       = 0;
-	int result_record_read     = 0;
-	int result_record_recovery = 0;
+	libbfio_handle_t *file_io_handle      = NULL;
+	libevt_internal_file_t *internal_file = NULL;
+	static char *function                 = "libevt_file_open_memory";
 
-	if( internal_file == NULL )
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1104,6 +1376,8 @@ int libevt_file_open_read(
 
 		return( -1 );
 	}
+	internal_file = (libevt_internal_file_t *) file;
+
 	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
@@ -1115,217 +1389,4262 @@ int libevt_file_open_read(
 
 		return( -1 );
 	}
-	if( internal_file->file_header != NULL )
+	if( internal_file->file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - file header already set.",
+		 "%s: invalid file - file IO handle already set.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file->io_handle->abort = 0;
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
 
-	if( libbfio_handle_get_size(
-	     file_io_handle,
-	     &( internal_file->io_handle->file_size ),
-	     error ) != 1 )
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( ( ( access_flags & LIBEVT_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBEVT_ACCESS_FLAG_WRITE ) == 0 ) )
 	{
-		libcnotify_printf(
-		 "Reading file header:\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
 	}
-#endif
-	if( libevt_file_header_initialize(
-	     &( internal_file->file_header ),
+	if( ( access_flags & LIBEVT_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_memory_range_initialize(
+	     &file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file header.",
+		 "%s: unable to create file IO handle.",
 		 function );
 
 		goto on_error;
 	}
-	if( libevt_file_header_read_file_io_handle(
-	     internal_file->file_header,
+	if( libbfio_memory_range_set(
 	     file_io_handle,
-	     0,
+	     (uint8_t *) buffer,
+	     buffer_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read file header.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory range in file IO handle.",
 		 function );
 
 		goto on_error;
 	}
-	header_size = internal_file->file_header->size;
+	/* Records are parsed directly from the buffer instead of reading them
+	 * into a copy first
+	 */
+	if( libevt_io_handle_set_file_data(
+	     internal_file->io_handle,
+	     buffer,
+	     buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set file data in IO handle.",
+		 function );
 
-	if( header_size != internal_file->file_header->copy_of_size )
+		goto on_error;
+	}
+	if( libevt_file_open_file_io_handle(
+	     file,
+	     file_io_handle,
+	     access_flags & ~( LIBEVT_ACCESS_FLAG_IN_MEMORY ),
+	     error ) != 1 )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file from memory.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_file->file_io_handle_created_in_library = 1;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		internal_file->file_io_handle_created_in_library = 0;
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( ( internal_file->file_io_handle == NULL )
+	 && ( internal_file->io_handle->file_data == buffer )
+	 && ( internal_file->io_handle->managed_file_data == NULL ) )
+	{
+		internal_file->io_handle->file_data = NULL;
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens a file using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_open_file_io_handle(
+     libevt_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_file_open_file_io_handle";
+
+	if( libevt_file_open_file_io_handle_with_index(
+	     file,
+	     file_io_handle,
+	     NULL,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens a file using a Basic File IO (bfio) handle and a records index
+ * The records are read from the records index instead of the file if the index
+ * matches the file, otherwise the records are read and recovered from the file
+ * The index file IO handle is optional and can be NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_open_file_io_handle_with_index(
+     libevt_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     libbfio_handle_t *index_file_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file          = NULL;
+	static char *function                          = "libevt_file_open_file_io_handle_with_index";
+	uint8_t file_io_handle_opened_in_library       = 0;
+	uint8_t index_file_io_handle_opened_in_library = 0;
+	int bfio_access_flags                          = 0;
+	int file_io_handle_is_open                     = 0;
+	int index_file_io_handle_is_open               = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBEVT_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBEVT_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBEVT_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBEVT_ACCESS_FLAG_READ ) != 0 )
+	{
+		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     bfio_access_flags,
+		     error ) != 1 )
 		{
-			libcnotify_printf(
-			 "%s: value mismatch for size and copy of size ( %" PRIu32 " != %" PRIu32 " ).\n",
-			 function,
-			 header_size,
-			 internal_file->file_header->copy_of_size );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
 		}
-#endif
-		/* If the size does not match the header size assume size copy contains
-		 * the correct value for the next validation check
-		 */
-		if( header_size != sizeof( evt_file_header_t ) )
+		file_io_handle_opened_in_library = 1;
+	}
+	if( index_file_io_handle != NULL )
+	{
+		index_file_io_handle_is_open = libbfio_handle_is_open(
+		                                index_file_io_handle,
+		                                error );
+
+		if( index_file_io_handle_is_open == -1 )
 		{
-			header_size = internal_file->file_header->copy_of_size;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to determine if index file IO handle is open.",
+			 function );
+
+			goto on_error;
 		}
-		internal_file->io_handle->flags |= LIBEVT_IO_HANDLE_FLAG_IS_CORRUPTED;
+		else if( index_file_io_handle_is_open == 0 )
+		{
+			if( libbfio_handle_open(
+			     index_file_io_handle,
+			     LIBBFIO_OPEN_READ,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open index file IO handle.",
+				 function );
+
+				goto on_error;
+			}
+			index_file_io_handle_opened_in_library = 1;
+		}
+	}
+	if( ( access_flags & LIBEVT_ACCESS_FLAG_IN_MEMORY ) != 0 )
+	{
+		if( libevt_io_handle_read_file_data(
+		     internal_file->io_handle,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file data into memory.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libevt_file_open_read(
+	     internal_file,
+	     file_io_handle,
+	     index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( index_file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     index_file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close index file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		index_file_io_handle_opened_in_library = 0;
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_file->file_io_handle                   = file_io_handle;
+	internal_file->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		internal_file->file_io_handle                   = NULL;
+		internal_file->file_io_handle_opened_in_library = 0;
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( internal_file->io_handle->managed_file_data != NULL )
+	{
+		libevt_file_data_free(
+		 &( internal_file->io_handle->managed_file_data ),
+		 NULL );
+	}
+	internal_file->io_handle->file_data = NULL;
+	if( index_file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 index_file_io_handle,
+		 NULL );
+	}
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 error );
+	}
+	return( -1 );
+}
+
+/* Closes a file
+ * Returns 0 if successful or -1 on error
+ */
+int libevt_file_close(
+     libevt_file_t *file,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	static char *function                 = "libevt_file_close";
+	int result                            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( internal_file->file_io_handle_created_in_library != 0 )
+		{
+			if( libevt_debug_print_read_offsets(
+			     internal_file->file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print the read offsets.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#endif
+	if( internal_file->file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     internal_file->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_file->file_io_handle_opened_in_library = 0;
+	}
+	if( internal_file->file_io_handle_created_in_library != 0 )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_file->file_io_handle_created_in_library = 0;
+	}
+	internal_file->file_io_handle = NULL;
+
+	if( libevt_io_handle_clear(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
+
+		result = -1;
+	}
+	if( libevt_file_header_free(
+	     &( internal_file->file_header ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file header.",
+		 function );
+
+		result = -1;
+	}
+	if( libfdata_list_empty(
+	     internal_file->records_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty records list.",
+		 function );
+
+		result = -1;
+	}
+	if( libfdata_list_empty(
+	     internal_file->recovered_records_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty recovered records list.",
+		 function );
+
+		result = -1;
+	}
+	if( libfcache_cache_empty(
+	     internal_file->records_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty records cache.",
+		 function );
+
+		result = -1;
+	}
+	if( libevt_cache_index_empty(
+	     internal_file->records_cache_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty records cache index.",
+		 function );
+
+		result = -1;
+	}
+	internal_file->number_of_cache_hits   = 0;
+	internal_file->number_of_cache_misses = 0;
+
+	if( internal_file->identifier_map != NULL )
+	{
+		if( libevt_identifier_map_free(
+		     &( internal_file->identifier_map ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free identifier map.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->time_index != NULL )
+	{
+		if( libevt_time_index_free(
+		     &( internal_file->time_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free time index.",
+			 function );
+
+			result = -1;
+		}
+	}
+	/* The arena is freed after the records cache was emptied
+	 */
+	if( internal_file->arena != NULL )
+	{
+		if( libevt_arena_free(
+		     &( internal_file->arena ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free arena.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Opens a file for reading
+ * The index file IO handle is optional and can be NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_open_read(
+     libevt_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libbfio_handle_t *index_file_io_handle,
+     libcerror_error_t **error )
+{
+	libevt_record_map_t *record_map = NULL;
+	static char *function           = "libevt_file_open_read";
+	off64_t last_record_offset      = 0;
+	uint32_t header_size            = 0;
+	int result_index_read           = 0;
+	int result_record_read          = 0;
+	int result_record_recovery      = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_header != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file header already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->io_handle->abort = 0;
+
+	if( internal_file->arena_block_size != 0 )
+	{
+		if( libevt_arena_initialize(
+		     &( internal_file->arena ),
+		     internal_file->arena_block_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create arena.",
+			 function );
+
+			goto on_error;
+		}
+		internal_file->io_handle->arena = internal_file->arena;
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &( internal_file->io_handle->file_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading file header:\n" );
+	}
+#endif
+	if( libevt_file_header_initialize(
+	     &( internal_file->file_header ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_file_header_read_file_io_handle(
+	     internal_file->file_header,
+	     file_io_handle,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	header_size = internal_file->file_header->size;
+
+	if( header_size != internal_file->file_header->copy_of_size )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: value mismatch for size and copy of size ( %" PRIu32 " != %" PRIu32 " ).\n",
+			 function,
+			 header_size,
+			 internal_file->file_header->copy_of_size );
+		}
+#endif
+		/* If the size does not match the header size assume size copy contains
+		 * the correct value for the next validation check
+		 */
+		if( header_size != sizeof( evt_file_header_t ) )
+		{
+			header_size = internal_file->file_header->copy_of_size;
+		}
+		internal_file->io_handle->flags |= LIBEVT_IO_HANDLE_FLAG_IS_CORRUPTED;
+	}
+	if( (size_t) header_size != sizeof( evt_file_header_t ) )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: header size: %" PRIu32 " does not match known value.\n",
+			 function,
+			 header_size );
+		}
+#endif
+		internal_file->io_handle->flags |= LIBEVT_IO_HANDLE_FLAG_IS_CORRUPTED;
+	}
+	if( index_file_io_handle != NULL )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading records index:\n" );
+		}
+#endif
+		result_index_read = libevt_index_read_file_io_handle(
+		                     internal_file->io_handle,
+		                     file_io_handle,
+		                     internal_file->records_list,
+		                     internal_file->recovered_records_list,
+		                     index_file_io_handle,
+		                     error );
+
+		if( result_index_read == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read records index.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result_index_read != 0 )
+		{
+			return( 1 );
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: records index does not match file.\n",
+			 function );
+		}
+#endif
+	}
+	/* The record map is used to skip recovered records that overlap or duplicate a record
+	 */
+	if( libevt_record_map_initialize(
+	     &record_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record map.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading records:\n" );
+	}
+#endif
+	result_record_read = libevt_io_handle_read_records(
+	                      internal_file->io_handle,
+	                      file_io_handle,
+	                      internal_file->file_header->first_record_offset,
+	                      internal_file->file_header->end_of_file_record_offset,
+	                      internal_file->records_list,
+	                      record_map,
+	                      &last_record_offset,
+	                      error );
+
+	if( result_record_read != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read records.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+		}
+#endif
+	}
+	if( internal_file->io_handle->abort == 0 )
+	{
+		result_record_recovery = libevt_io_handle_recover_records(
+		                          internal_file->io_handle,
+		                          file_io_handle,
+		                          internal_file->file_header->first_record_offset,
+		                          internal_file->file_header->end_of_file_record_offset,
+		                          last_record_offset,
+		                          internal_file->records_list,
+		                          internal_file->recovered_records_list,
+		                          record_map,
+		                          error );
+
+		if( result_record_recovery != 1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( result_record_read != 1 )
+			{
+				libcerror_error_free(
+				 error );
+			}
+#endif
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to recover records.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+		}
+	}
+	if( ( result_record_read != 1 )
+	 && ( result_record_recovery != 1 ) )
+	{
+		goto on_error;
+	}
+	if( ( error != NULL )
+	 && ( *error != NULL ) )
+	{
+		libcerror_error_free(
+		 error );
+	}
+	if( libevt_record_map_free(
+	     &record_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record map.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->io_handle->abort = 0;
+
+	return( 1 );
+
+on_error:
+	if( record_map != NULL )
+	{
+		libevt_record_map_free(
+		 &record_map,
+		 NULL );
+	}
+	if( internal_file->file_header != NULL )
+	{
+		libevt_file_header_free(
+		 &( internal_file->file_header ),
+		 NULL );
+	}
+	if( internal_file->arena != NULL )
+	{
+		internal_file->io_handle->arena = NULL;
+
+		libevt_arena_free(
+		 &( internal_file->arena ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the offset directly after the last record in the records list
+ * The offset wraps around to the end of the file header like the record data
+ * Returns 1 if successful, 0 if the records list is empty or -1 on error
+ */
+int libevt_file_get_records_end_offset(
+     libevt_internal_file_t *internal_file,
+     off64_t *end_offset,
+     libcerror_error_t **error )
+{
+	static char *function   = "libevt_file_get_records_end_offset";
+	size64_t element_size   = 0;
+	off64_t element_offset  = 0;
+	off64_t safe_end_offset = 0;
+	uint32_t element_flags  = 0;
+	int element_file_index  = 0;
+	int number_of_records   = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->file_size <= (size64_t) sizeof( evt_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file - file size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid end offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_get_number_of_elements(
+	     internal_file->records_list,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records == 0 )
+	{
+		return( 0 );
+	}
+	if( libfdata_list_get_element_by_index(
+	     internal_file->records_list,
+	     number_of_records - 1,
+	     &element_file_index,
+	     &element_offset,
+	     &element_size,
+	     &element_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record: %d.",
+		 function,
+		 number_of_records - 1 );
+
+		return( -1 );
+	}
+	safe_end_offset = element_offset + (off64_t) element_size;
+
+	if( (size64_t) safe_end_offset >= internal_file->io_handle->file_size )
+	{
+		safe_end_offset -= (off64_t) ( internal_file->io_handle->file_size - sizeof( evt_file_header_t ) );
+	}
+	*end_offset = safe_end_offset;
+
+	return( 1 );
+}
+
+/* Refreshes an open file
+ * Re-reads the file header and reads the records written since the file was opened
+ * or last refreshed, starting directly after the last known record, without recovery.
+ * Records overwritten since, when the record data wrapped, are removed from the start
+ * of the records list, which changes the record indexes. The records are only read
+ * again from the first record if the file size changed after the record data had
+ * wrapped or if the first record is no longer part of the records list.
+ * The recovered records are not refreshed.
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_refresh(
+     libevt_file_t *file,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	static char *function                 = "libevt_file_refresh";
+	int result                            = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libevt_file_refresh_read(
+	     internal_file,
+	     internal_file->file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to refresh file.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Removes the records before a specific record from the start of the records list
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_remove_records_before(
+     libevt_internal_file_t *internal_file,
+     int first_record_index,
+     libcerror_error_t **error )
+{
+	off64_t *record_offsets      = NULL;
+	size64_t *record_sizes       = NULL;
+	static char *function        = "libevt_file_remove_records_before";
+	uint32_t element_flags       = 0;
+	int element_file_index       = 0;
+	int element_index            = 0;
+	int number_of_kept_records   = 0;
+	int number_of_records        = 0;
+	int record_index             = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_get_number_of_elements(
+	     internal_file->records_list,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( first_record_index < 0 )
+	 || ( first_record_index > number_of_records ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first record index value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_kept_records = number_of_records - first_record_index;
+
+	if( number_of_kept_records > 0 )
+	{
+		if( (size_t) number_of_kept_records > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( off64_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of kept records value exceeds maximum allocation size.",
+			 function );
+
+			goto on_error;
+		}
+		record_offsets = (off64_t *) memory_allocate(
+		                              sizeof( off64_t ) * number_of_kept_records );
+
+		if( record_offsets == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create record offsets.",
+			 function );
+
+			goto on_error;
+		}
+		record_sizes = (size64_t *) memory_allocate(
+		                             sizeof( size64_t ) * number_of_kept_records );
+
+		if( record_sizes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create record sizes.",
+			 function );
+
+			goto on_error;
+		}
+		for( record_index = 0;
+		     record_index < number_of_kept_records;
+		     record_index++ )
+		{
+			if( libfdata_list_get_element_by_index(
+			     internal_file->records_list,
+			     first_record_index + record_index,
+			     &element_file_index,
+			     &( record_offsets[ record_index ] ),
+			     &( record_sizes[ record_index ] ),
+			     &element_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record: %d.",
+				 function,
+				 first_record_index + record_index );
+
+				goto on_error;
+			}
+		}
+	}
+	if( libfdata_list_empty(
+	     internal_file->records_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty records list.",
+		 function );
+
+		goto on_error;
+	}
+	for( record_index = 0;
+	     record_index < number_of_kept_records;
+	     record_index++ )
+	{
+		if( libfdata_list_append_element(
+		     internal_file->records_list,
+		     &element_index,
+		     0,
+		     record_offsets[ record_index ],
+		     record_sizes[ record_index ],
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append record: %d to records list.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+	}
+	if( record_sizes != NULL )
+	{
+		memory_free(
+		 record_sizes );
+	}
+	if( record_offsets != NULL )
+	{
+		memory_free(
+		 record_offsets );
+	}
+	return( 1 );
+
+on_error:
+	if( record_sizes != NULL )
+	{
+		memory_free(
+		 record_sizes );
+	}
+	if( record_offsets != NULL )
+	{
+		memory_free(
+		 record_offsets );
+	}
+	return( -1 );
+}
+
+/* Removes the recovered records that overlap or duplicate a record
+ * This is used after a refresh, when new records can have overwritten recovered records
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_remove_overlapping_recovered_records(
+     libevt_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t record_key_data[ 8 ];
+
+	libevt_record_map_t *record_map = NULL;
+	off64_t *record_offsets         = NULL;
+	size64_t *record_sizes          = NULL;
+	static char *function           = "libevt_file_remove_overlapping_recovered_records";
+	size64_t element_size           = 0;
+	off64_t element_offset          = 0;
+	uint32_t creation_time          = 0;
+	uint32_t element_flags          = 0;
+	uint32_t record_number          = 0;
+	int element_file_index          = 0;
+	int element_index               = 0;
+	int number_of_kept_records      = 0;
+	int number_of_records           = 0;
+	int number_of_recovered_records = 0;
+	int record_index                = 0;
+	int result                      = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_get_number_of_elements(
+	     internal_file->recovered_records_list,
+	     &number_of_recovered_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of recovered records.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_recovered_records == 0 )
+	{
+		return( 1 );
+	}
+	if( (size_t) number_of_recovered_records > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( off64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of recovered records value exceeds maximum allocation size.",
+		 function );
+
+		goto on_error;
+	}
+	/* The record map is created from the records as they are after the refresh
+	 */
+	if( libevt_record_map_initialize(
+	     &record_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record map.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdata_list_get_number_of_elements(
+	     internal_file->records_list,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		goto on_error;
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( libfdata_list_get_element_by_index(
+		     internal_file->records_list,
+		     record_index,
+		     &element_file_index,
+		     &element_offset,
+		     &element_size,
+		     &element_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		/* The record number and creation time directly follow the signature
+		 */
+		if( libevt_io_handle_read_record_data(
+		     internal_file->io_handle,
+		     file_io_handle,
+		     element_offset,
+		     8,
+		     record_key_data,
+		     8,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record: %d number and creation time.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( record_key_data[ 0 ] ),
+		 record_number );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( record_key_data[ 4 ] ),
+		 creation_time );
+
+		if( libevt_record_map_append_record(
+		     record_map,
+		     element_offset,
+		     element_size,
+		     internal_file->io_handle->file_size,
+		     record_number,
+		     creation_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append record: %d to record map.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+	}
+	record_offsets = (off64_t *) memory_allocate(
+	                              sizeof( off64_t ) * number_of_recovered_records );
+
+	if( record_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record offsets.",
+		 function );
+
+		goto on_error;
+	}
+	record_sizes = (size64_t *) memory_allocate(
+	                             sizeof( size64_t ) * number_of_recovered_records );
+
+	if( record_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record sizes.",
+		 function );
+
+		goto on_error;
+	}
+	for( record_index = 0;
+	     record_index < number_of_recovered_records;
+	     record_index++ )
+	{
+		if( libfdata_list_get_element_by_index(
+		     internal_file->recovered_records_list,
+		     record_index,
+		     &element_file_index,
+		     &element_offset,
+		     &element_size,
+		     &element_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve recovered record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		/* A recovered record that no longer fits in the file was overwritten
+		 */
+		if( ( element_offset < (off64_t) sizeof( evt_file_header_t ) )
+		 || ( (size64_t) element_offset >= internal_file->io_handle->file_size )
+		 || ( element_size == 0 )
+		 || ( element_size > ( internal_file->io_handle->file_size - sizeof( evt_file_header_t ) ) ) )
+		{
+			continue;
+		}
+		if( libevt_io_handle_read_record_data(
+		     internal_file->io_handle,
+		     file_io_handle,
+		     element_offset,
+		     8,
+		     record_key_data,
+		     8,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read recovered record: %d number and creation time.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( record_key_data[ 0 ] ),
+		 record_number );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( record_key_data[ 4 ] ),
+		 creation_time );
+
+		result = libevt_record_map_check_record(
+		          record_map,
+		          element_offset,
+		          element_size,
+		          internal_file->io_handle->file_size,
+		          record_number,
+		          creation_time,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to check recovered record: %d in record map.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: removing recovered record: %" PRIu32 " that overlaps or duplicates a record.\n",
+				 function,
+				 record_number );
+			}
+#endif
+			continue;
+		}
+		record_offsets[ number_of_kept_records ] = element_offset;
+		record_sizes[ number_of_kept_records ]   = element_size;
+
+		number_of_kept_records++;
+	}
+	if( number_of_kept_records != number_of_recovered_records )
+	{
+		if( libfdata_list_empty(
+		     internal_file->recovered_records_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty recovered records list.",
+			 function );
+
+			goto on_error;
+		}
+		for( record_index = 0;
+		     record_index < number_of_kept_records;
+		     record_index++ )
+		{
+			if( libfdata_list_append_element(
+			     internal_file->recovered_records_list,
+			     &element_index,
+			     0,
+			     record_offsets[ record_index ],
+			     record_sizes[ record_index ],
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append recovered record: %d to recovered records list.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+		}
+	}
+	memory_free(
+	 record_sizes );
+
+	memory_free(
+	 record_offsets );
+
+	if( libevt_record_map_free(
+	     &record_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record map.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( record_sizes != NULL )
+	{
+		memory_free(
+		 record_sizes );
+	}
+	if( record_offsets != NULL )
+	{
+		memory_free(
+		 record_offsets );
+	}
+	if( record_map != NULL )
+	{
+		libevt_record_map_free(
+		 &record_map,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the changes of an open file
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_refresh_read(
+     libevt_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t end_of_file_record_data[ sizeof( evt_end_of_file_record_t ) ];
+
+	libevt_end_of_file_record_t *end_of_file_record = NULL;
+	libevt_file_header_t *file_header               = NULL;
+	static char *function                           = "libevt_file_refresh_read";
+	size64_t element_size                           = 0;
+	size64_t file_size                              = 0;
+	size64_t previous_file_size                     = 0;
+	size64_t range_size                             = 0;
+	off64_t element_offset                          = 0;
+	off64_t last_record_offset                      = 0;
+	off64_t previous_records_end_offset             = 0;
+	off64_t records_end_offset                      = 0;
+	uint32_t element_flags                          = 0;
+	uint32_t first_record_offset                    = 0;
+	uint8_t file_data_detached                      = 0;
+	uint8_t has_wrapped                             = 0;
+	uint8_t records_changed                         = 0;
+	uint8_t records_removed                         = 0;
+	int element_file_index                          = 0;
+	int first_record_index                          = -1;
+	int number_of_records                           = 0;
+	int previous_number_of_records                  = 0;
+	int record_index                                = 0;
+	int result                                      = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->io_handle->abort = 0;
+
+	previous_file_size = internal_file->io_handle->file_size;
+
+	/* File data provided by the caller is used as-is. File data read into memory
+	 * is read again completely when the file size changed. Otherwise the changes
+	 * are read from the file and only the changed ranges of the file data are read
+	 * again afterwards, hence the file data is not used until then
+	 */
+	if( internal_file->io_handle->managed_file_data != NULL )
+	{
+		if( libbfio_handle_get_size(
+		     file_io_handle,
+		     &file_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file size.",
+			 function );
+
+			goto on_error;
+		}
+		if( file_size != previous_file_size )
+		{
+			if( libevt_io_handle_reread_file_data(
+			     internal_file->io_handle,
+			     file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read file data into memory.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			internal_file->io_handle->file_data = NULL;
+
+			file_data_detached = 1;
+		}
+	}
+	else if( internal_file->io_handle->file_data == NULL )
+	{
+		if( libbfio_handle_get_size(
+		     file_io_handle,
+		     &( internal_file->io_handle->file_size ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file size.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libevt_file_header_initialize(
+	     &file_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_file_header_read_file_io_handle(
+	     file_header,
+	     file_io_handle,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdata_list_get_number_of_elements(
+	     internal_file->records_list,
+	     &previous_number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		goto on_error;
+	}
+	/* When the file size changed after the record data wrapped the offsets
+	 * of the known records can no longer be relied on
+	 */
+	if( ( internal_file->io_handle->file_size != previous_file_size )
+	 && ( internal_file->io_handle->has_wrapped != 0 ) )
+	{
+		result = 0;
+	}
+	else
+	{
+		result = libevt_file_get_records_end_offset(
+		          internal_file,
+		          &records_end_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve records end offset.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result != 0 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading new records:\n" );
+		}
+#endif
+		previous_records_end_offset = records_end_offset;
+
+		/* The new records can wrap independently of the known records
+		 */
+		has_wrapped = internal_file->io_handle->has_wrapped;
+
+		internal_file->io_handle->has_wrapped = 0;
+
+		result = libevt_io_handle_read_records(
+		          internal_file->io_handle,
+		          file_io_handle,
+		          (uint32_t) records_end_offset,
+		          file_header->end_of_file_record_offset,
+		          internal_file->records_list,
+		          NULL,
+		          &last_record_offset,
+		          error );
+
+		internal_file->io_handle->has_wrapped |= has_wrapped;
+
+		/* A record that is still being written cannot be read yet, it is read
+		 * by the next refresh
+		 */
+		if( result != 1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcerror_error_free(
+				 error );
+			}
+		}
+		/* The end-of-file record directly follows the last record and is updated
+		 * while the file is in use, unlike the file header
+		 */
+		first_record_offset = file_header->first_record_offset;
+
+		result = libevt_file_get_records_end_offset(
+		          internal_file,
+		          &records_end_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve records end offset.",
+			 function );
+
+			goto on_error;
+		}
+		if( libevt_io_handle_read_record_data(
+		     internal_file->io_handle,
+		     file_io_handle,
+		     records_end_offset,
+		     0,
+		     end_of_file_record_data,
+		     sizeof( evt_end_of_file_record_t ),
+		     error ) == 1 )
+		{
+			if( libevt_end_of_file_record_initialize(
+			     &end_of_file_record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create end-of-file record.",
+				 function );
+
+				goto on_error;
+			}
+			result = libevt_end_of_file_record_read_data(
+			          end_of_file_record,
+			          end_of_file_record_data,
+			          sizeof( evt_end_of_file_record_t ),
+			          error );
+
+			if( result == 1 )
+			{
+				first_record_offset = end_of_file_record->first_record_offset;
+			}
+			if( libevt_end_of_file_record_free(
+			     &end_of_file_record,
+			     NULL ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free end-of-file record.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcerror_error_free(
+			 error );
+		}
+		/* Find the first (oldest) record, the records before it were overwritten
+		 */
+		if( libfdata_list_get_number_of_elements(
+		     internal_file->records_list,
+		     &number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of records.",
+			 function );
+
+			goto on_error;
+		}
+		for( record_index = 0;
+		     record_index < number_of_records;
+		     record_index++ )
+		{
+			if( libfdata_list_get_element_by_index(
+			     internal_file->records_list,
+			     record_index,
+			     &element_file_index,
+			     &element_offset,
+			     &element_size,
+			     &element_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record: %d.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+			if( element_offset == (off64_t) first_record_offset )
+			{
+				first_record_index = record_index;
+
+				break;
+			}
+		}
+		if( first_record_index > 0 )
+		{
+			if( libevt_file_remove_records_before(
+			     internal_file,
+			     first_record_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove overwritten records.",
+				 function );
+
+				goto on_error;
+			}
+			records_removed = 1;
+		}
+		if( number_of_records != previous_number_of_records )
+		{
+			records_changed = 1;
+		}
+	}
+	if( first_record_index < 0 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading records:\n" );
+		}
+#endif
+		if( libfdata_list_empty(
+		     internal_file->records_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty records list.",
+			 function );
+
+			goto on_error;
+		}
+		internal_file->io_handle->has_wrapped = 0;
+
+		if( libevt_io_handle_read_records(
+		     internal_file->io_handle,
+		     file_io_handle,
+		     file_header->first_record_offset,
+		     file_header->end_of_file_record_offset,
+		     internal_file->records_list,
+		     NULL,
+		     &last_record_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read records.",
+			 function );
+
+			goto on_error;
+		}
+		records_removed = 1;
+	}
+	if( file_data_detached != 0 )
+	{
+		internal_file->io_handle->file_data = internal_file->io_handle->managed_file_data->data;
+
+		file_data_detached = 0;
+
+		if( first_record_index < 0 )
+		{
+			if( libevt_io_handle_reread_file_data(
+			     internal_file->io_handle,
+			     file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read file data into memory.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			if( libevt_io_handle_read_file_data_range(
+			     internal_file->io_handle,
+			     file_io_handle,
+			     0,
+			     (size64_t) sizeof( evt_file_header_t ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read file header data into memory.",
+				 function );
+
+				goto on_error;
+			}
+			/* The new records and the end-of-file record are written from where
+			 * the previous end-of-file record was stored
+			 */
+			if( records_end_offset >= previous_records_end_offset )
+			{
+				range_size = (size64_t) ( records_end_offset - previous_records_end_offset );
+			}
+			else
+			{
+				range_size = ( file_size - previous_records_end_offset )
+				           + ( records_end_offset - sizeof( evt_file_header_t ) );
+			}
+			range_size += sizeof( evt_end_of_file_record_t );
+
+			if( libevt_io_handle_read_file_data_range(
+			     internal_file->io_handle,
+			     file_io_handle,
+			     previous_records_end_offset,
+			     range_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read record data into memory.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	/* New records can overwrite the data of recovered records
+	 */
+	if( ( records_changed != 0 )
+	 || ( records_removed != 0 ) )
+	{
+		if( libevt_file_remove_overlapping_recovered_records(
+		     internal_file,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove overlapping recovered records.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The records cache is keyed by record offset, the data at the offsets
+	 * of removed records has been overwritten
+	 */
+	if( records_removed != 0 )
+	{
+		if( libfcache_cache_empty(
+		     internal_file->records_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty records cache.",
+			 function );
+
+			goto on_error;
+		}
+		if( libevt_cache_index_empty(
+		     internal_file->records_cache_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty records cache index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The identifier map and time index are created again on first use
+	 */
+	if( ( records_changed != 0 )
+	 || ( records_removed != 0 ) )
+	{
+		if( internal_file->identifier_map != NULL )
+		{
+			if( libevt_identifier_map_free(
+			     &( internal_file->identifier_map ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free identifier map.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( internal_file->time_index != NULL )
+		{
+			if( libevt_time_index_free(
+			     &( internal_file->time_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free time index.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( libevt_file_header_free(
+	     &( internal_file->file_header ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file header.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->file_header = file_header;
+
+	return( 1 );
+
+on_error:
+	if( file_data_detached != 0 )
+	{
+		internal_file->io_handle->file_data = internal_file->io_handle->managed_file_data->data;
+	}
+	if( end_of_file_record != NULL )
+	{
+		libevt_end_of_file_record_free(
+		 &end_of_file_record,
+		 NULL );
+	}
+	if( file_header != NULL )
+	{
+		libevt_file_header_free(
+		 &file_header,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes the records index of the file
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_write_index(
+     libevt_file_t *file,
+     const char *index_filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *index_file_io_handle = NULL;
+	static char *function                  = "libevt_file_write_index";
+	size_t index_filename_length           = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	index_filename_length = narrow_string_length(
+	                         index_filename );
+
+	if( libbfio_file_set_name(
+	     index_file_io_handle,
+	     index_filename,
+	     index_filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_file_write_index_file_io_handle(
+	     file,
+	     index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index: %s.",
+		 function,
+		 index_filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Writes the records index of the file
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_write_index_wide(
+     libevt_file_t *file,
+     const wchar_t *index_filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *index_file_io_handle = NULL;
+	static char *function                  = "libevt_file_write_index_wide";
+	size_t index_filename_length           = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	index_filename_length = wide_string_length(
+	                         index_filename );
+
+	if( libbfio_file_set_name_wide(
+	     index_file_io_handle,
+	     index_filename,
+	     index_filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_file_write_index_file_io_handle(
+	     file,
+	     index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index: %ls.",
+		 function,
+		 index_filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Writes the records index of the file using a Basic File IO (bfio) handle
+ * The records index contains the offsets and sizes of the records and recovered records
+ * and can be used by libevt_file_open_with_index to skip reading and recovering the records
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_write_index_file_io_handle(
+     libevt_file_t *file,
+     libbfio_handle_t *index_file_io_handle,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file          = NULL;
+	static char *function                          = "libevt_file_write_index_file_io_handle";
+	uint8_t index_file_io_handle_opened_in_library = 0;
+	int index_file_io_handle_is_open               = 0;
+	int result                                     = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	index_file_io_handle_is_open = libbfio_handle_is_open(
+	                                index_file_io_handle,
+	                                error );
+
+	if( index_file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if index file IO handle is open.",
+		 function );
+
+		result = -1;
+	}
+	else if( index_file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     index_file_io_handle,
+		     LIBBFIO_OPEN_WRITE_TRUNCATE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open index file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			index_file_io_handle_opened_in_library = 1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libevt_index_write_file_io_handle(
+		     internal_file->io_handle,
+		     internal_file->file_io_handle,
+		     internal_file->records_list,
+		     internal_file->recovered_records_list,
+		     index_file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write records index.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( index_file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     index_file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close index file IO handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Determine if the file corrupted
+ * Returns 1 if corrupted, 0 if not or -1 on error
+ */
+int libevt_file_is_corrupted(
+     libevt_file_t *file,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	static char *function                 = "libevt_file_is_corrupted";
+	int result                            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_file->io_handle->flags & LIBEVT_IO_HANDLE_FLAG_IS_CORRUPTED ) != 0 )
+	{
+		result = 1;
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the file ASCII codepage
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_get_ascii_codepage(
+     libevt_file_t *file,
+     int *ascii_codepage,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	static char *function                 = "libevt_file_get_ascii_codepage";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ascii_codepage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*ascii_codepage = internal_file->io_handle->ascii_codepage;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the file ASCII codepage
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_set_ascii_codepage(
+     libevt_file_t *file,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	static char *function                 = "libevt_file_set_ascii_codepage";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ascii_codepage != LIBEVT_CODEPAGE_ASCII )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_874 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_932 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_936 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_949 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_950 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1250 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1251 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1252 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1253 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1254 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1255 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1256 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1257 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1258 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_file->io_handle->ascii_codepage = ascii_codepage;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the maximum number of records cache entries
+ * The records cache can only be resized when the file is not open
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_set_maximum_cache_entries(
+     libevt_file_t *file,
+     int maximum_cache_entries,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	libevt_cache_index_t *cache_index     = NULL;
+	libfcache_cache_t *records_cache      = NULL;
+	static char *function                 = "libevt_file_set_maximum_cache_entries";
+	int result                            = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_cache_entries <= 0 )
+	 || ( maximum_cache_entries > LIBEVT_MAXIMUM_CACHE_ENTRIES_RECORDS_LIMIT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum cache entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_cache_initialize(
+	     &records_cache,
+	     maximum_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create records cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_cache_index_initialize(
+	     &cache_index,
+	     maximum_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create records cache index.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libfcache_cache_free(
+	     &( internal_file->records_cache ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free records cache.",
+		 function );
+
+		result = -1;
+	}
+	if( libevt_cache_index_free(
+	     &( internal_file->records_cache_index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free records cache index.",
+		 function );
+
+		result = -1;
+	}
+	internal_file->records_cache         = records_cache;
+	internal_file->records_cache_index   = cache_index;
+	internal_file->maximum_cache_entries = maximum_cache_entries;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+	if( cache_index != NULL )
+	{
+		libevt_cache_index_free(
+		 &cache_index,
+		 NULL );
+	}
+	if( records_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &records_cache,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets the records cache policy
+ * The records cache policy can only be changed when the file is not open
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_set_cache_policy(
+     libevt_file_t *file,
+     int cache_policy,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	static char *function                 = "libevt_file_set_cache_policy";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( cache_policy != LIBEVT_CACHE_POLICY_DIRECT_MAPPED )
+	 && ( cache_policy != LIBEVT_CACHE_POLICY_LEAST_RECENTLY_USED )
+	 && ( cache_policy != LIBEVT_CACHE_POLICY_DISABLED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported cache policy.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_file->cache_policy = cache_policy;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the size of the blocks of the arena
+ * When set the names, strings and data of the event records passed to the callback
+ * functions of libevt_file_parse_records_parallel and libevt_file_parse_records_with_filter
+ * are carved from an arena. The records are freed after the callback function returns
+ * and the arena memory is released in bulk when no more records are being parsed.
+ * Records retrieved by index, identifier or time and records stored in the records cache
+ * do not use the arena.
+ * A block size of 0 represents no arena is used, which is the default
+ * The block size can only be set when the file is not open
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_set_arena_block_size(
+     libevt_file_t *file,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	static char *function                 = "libevt_file_set_arena_block_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size != 0 )
+	 && ( ( block_size < (size_t) LIBEVT_ARENA_MINIMUM_BLOCK_SIZE )
+	  ||  ( block_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_file->arena_block_size = block_size;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the records cache statistics
+ * The statistics are reset when the file is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_get_cache_statistics(
+     libevt_file_t *file,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	static char *function                 = "libevt_file_get_cache_statistics";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_file->records_cache_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab records cache mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_hits   = internal_file->number_of_cache_hits;
+	*number_of_misses = internal_file->number_of_cache_misses;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_file->records_cache_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release records cache mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the format version
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_get_format_version(
+     libevt_file_t *file,
+     uint32_t *major_format_version,
+     uint32_t *minor_format_version,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	static char *function                 = "libevt_file_get_format_version";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( major_format_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid major format version.",
+		 function );
+
+		return( -1 );
+	}
+	if( minor_format_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid minor format version.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*major_format_version = internal_file->file_header->major_format_version;
+	*minor_format_version = internal_file->file_header->minor_format_version;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the version
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_get_version(
+     libevt_file_t *file,
+     uint32_t *major_version,
+     uint32_t *minor_version,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	static char *function                 = "libevt_file_get_version";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( major_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid major version.",
+		 function );
+
+		return( -1 );
+	}
+	if( minor_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid minor version.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*major_version = internal_file->file_header->major_format_version;
+	*minor_version = internal_file->file_header->minor_format_version;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the flags
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_get_flags(
+     libevt_file_t *file,
+     uint32_t *flags,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	static char *function                 = "libevt_file_get_flags";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flags.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*flags = internal_file->file_header->file_flags;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of records
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_get_number_of_records(
+     libevt_file_t *file,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	static char *function                 = "libevt_file_get_number_of_records";
+	int result                            = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfdata_list_get_number_of_elements(
+	     internal_file->records_list,
+	     number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements from records list.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific record
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_get_record(
+     libevt_file_t *file,
+     int record_index,
+     libevt_record_t **record,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	libevt_record_values_t *record_values = NULL;
+	static char *function                 = "libevt_file_get_record";
+	int result                            = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libevt_file_get_record_values_by_index(
+	     internal_file,
+	     internal_file->records_list,
+	     record_index,
+	     &record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record values: %d.",
+		 function,
+		 record_index );
+
+		result = -1;
+	}
+	else if( libevt_record_initialize(
+	          record,
+	          internal_file->io_handle,
+	          internal_file->file_io_handle,
+	          record_values,
+	          LIBEVT_RECORD_FLAG_MANAGED_RECORD_VALUES,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
+		 function );
+
+		libevt_record_values_free(
+		 &record_values,
+		 NULL );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific record
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_get_record_by_index(
+     libevt_file_t *file,
+     int record_index,
+     libevt_record_t **record,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	libevt_record_values_t *record_values = NULL;
+	static char *function                 = "libevt_file_get_record_by_index";
+	int result                            = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
 	}
-	if( (size_t) header_size != sizeof( evt_file_header_t ) )
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: header size: %" PRIu32 " does not match known value.\n",
-			 function,
-			 header_size );
-		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
 #endif
-		internal_file->io_handle->flags |= LIBEVT_IO_HANDLE_FLAG_IS_CORRUPTED;
+	if( libevt_file_get_record_values_by_index(
+	     internal_file,
+	     internal_file->records_list,
+	     record_index,
+	     &record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record values: %d.",
+		 function,
+		 record_index );
+
+		result = -1;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	else if( libevt_record_initialize(
+	          record,
+	          internal_file->io_handle,
+	          internal_file->file_io_handle,
+	          record_values,
+	          LIBEVT_RECORD_FLAG_MANAGED_RECORD_VALUES,
+	          error ) != 1 )
 	{
-		libcnotify_printf(
-		 "Reading records:\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
+		 function );
+
+		libevt_record_values_free(
+		 &record_values,
+		 NULL );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
 	}
 #endif
-	result_record_read = libevt_io_handle_read_records(
-	                      internal_file->io_handle,
-	                      file_io_handle,
-	                      internal_file->file_header->first_record_offset,
-	                      internal_file->file_header->end_of_file_record_offset,
-	                      internal_file->records_list,
-	                      &last_record_offset,
-	                      error );
+	return( result );
+}
 
-	if( result_record_read != 1 )
+/* Retrieves the number of recovered records
+ * Recovered records that overlap or duplicate a record are not included
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_get_number_of_recovered_records(
+     libevt_file_t *file,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	static char *function                 = "libevt_file_get_number_of_recovered_records";
+	int result                            = 1;
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read records.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
-			{
-				libcnotify_print_error_backtrace(
-				 *error );
-			}
-		}
-#endif
+		return( -1 );
 	}
-	if( internal_file->io_handle->abort == 0 )
+	internal_file = (libevt_internal_file_t *) file;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
-		result_record_recovery = libevt_io_handle_recover_records(
-		                          internal_file->io_handle,
-		                          file_io_handle,
-		                          internal_file->file_header->first_record_offset,
-		                          internal_file->file_header->end_of_file_record_offset,
-		                          last_record_offset,
-		                          internal_file->records_list,
-		                          internal_file->recovered_records_list,
-		                          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
 
-		if( result_record_recovery != 1 )
-		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( result_record_read != 1 )
-			{
-				libcerror_error_free(
-				 error );
-			}
+		return( -1 );
+	}
 #endif
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to recover records.",
-			 function );
+	if( libfdata_list_get_number_of_elements(
+	     internal_file->recovered_records_list,
+	     number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements from recovered records list.",
+		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				if( ( error != NULL )
-				 && ( *error != NULL ) )
-				{
-					libcnotify_print_error_backtrace(
-					 *error );
-				}
-			}
+		result = -1;
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
 #endif
-		}
+	return( result );
+}
+
+/* Retrieves the number of recovered records that were skipped
+ * Recovered records are skipped when they overlap or duplicate a record
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_get_number_of_duplicate_recovered_records(
+     libevt_file_t *file,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	static char *function                 = "libevt_file_get_number_of_duplicate_recovered_records";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
 	}
-	if( ( result_record_read != 1 )
-	 && ( result_record_recovery != 1 ) )
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
 	{
-		goto on_error;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
 	}
-	if( ( error != NULL )
-	 && ( *error != NULL ) )
+	if( number_of_records == NULL )
 	{
-		libcerror_error_free(
-		 error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
 	}
-	internal_file->io_handle->abort = 0;
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
 
-	return( 1 );
+		return( -1 );
+	}
+#endif
+	*number_of_records = internal_file->io_handle->number_of_duplicate_recovered_records;
 
-on_error:
-	if( internal_file->file_header != NULL )
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
-		libevt_file_header_free(
-		 &( internal_file->file_header ),
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
+#endif
+	return( 1 );
 }
 
-/* Determine if the file corrupted
- * Returns 1 if corrupted, 0 if not or -1 on error
+/* Retrieves a specific recovered record
+ * Returns 1 if successful or -1 on error
  */
-int libevt_file_is_corrupted(
+int libevt_file_get_recovered_record(
      libevt_file_t *file,
+     int record_index,
+     libevt_record_t **record,
      libcerror_error_t **error )
 {
 	libevt_internal_file_t *internal_file = NULL;
-	static char *function                 = "libevt_file_is_corrupted";
-	int result                            = 0;
+	libevt_record_values_t *record_values = NULL;
+	static char *function                 = "libevt_file_get_recovered_record";
+	int result                            = 1;
 
 	if( file == NULL )
 	{
@@ -1340,13 +5659,24 @@ int libevt_file_is_corrupted(
 	}
 	internal_file = (libevt_internal_file_t *) file;
 
-	if( internal_file->io_handle == NULL )
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
 		 function );
 
 		return( -1 );
@@ -1366,9 +5696,43 @@ int libevt_file_is_corrupted(
 		return( -1 );
 	}
 #endif
-	if( ( internal_file->io_handle->flags & LIBEVT_IO_HANDLE_FLAG_IS_CORRUPTED ) != 0 )
+	if( libevt_file_get_record_values_by_index(
+	     internal_file,
+	     internal_file->recovered_records_list,
+	     record_index,
+	     &record_values,
+	     error ) != 1 )
 	{
-		result = 1;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve recovered record values: %d.",
+		 function,
+		 record_index );
+
+		result = -1;
+	}
+	else if( libevt_record_initialize(
+	          record,
+	          internal_file->io_handle,
+	          internal_file->file_io_handle,
+	          record_values,
+	          LIBEVT_RECORD_FLAG_MANAGED_RECORD_VALUES,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
+		 function );
+
+		libevt_record_values_free(
+		 &record_values,
+		 NULL );
+
+		result = -1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
@@ -1388,16 +5752,19 @@ int libevt_file_is_corrupted(
 	return( result );
 }
 
-/* Retrieves the file ASCII codepage
+/* Retrieves a specific recovered record
  * Returns 1 if successful or -1 on error
  */
-int libevt_file_get_ascii_codepage(
+int libevt_file_get_recovered_record_by_index(
      libevt_file_t *file,
-     int *ascii_codepage,
+     int record_index,
+     libevt_record_t **record,
      libcerror_error_t **error )
 {
 	libevt_internal_file_t *internal_file = NULL;
-	static char *function                 = "libevt_file_get_ascii_codepage";
+	libevt_record_values_t *record_values = NULL;
+	static char *function                 = "libevt_file_get_recovered_record_by_index";
+	int result                            = 1;
 
 	if( file == NULL )
 	{
@@ -1412,24 +5779,13 @@ int libevt_file_get_ascii_codepage(
 	}
 	internal_file = (libevt_internal_file_t *) file;
 
-	if( internal_file->io_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
-		 function );
-
-		return( -1 );
-	}
-	if( ascii_codepage == NULL )
+	if( record == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid ASCII codepage.",
+		 "%s: invalid record.",
 		 function );
 
 		return( -1 );
@@ -1449,8 +5805,44 @@ int libevt_file_get_ascii_codepage(
 		return( -1 );
 	}
 #endif
-	*ascii_codepage = internal_file->io_handle->ascii_codepage;
+	if( libevt_file_get_record_values_by_index(
+	     internal_file,
+	     internal_file->recovered_records_list,
+	     record_index,
+	     &record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve recovered record values: %d.",
+		 function,
+		 record_index );
+
+		result = -1;
+	}
+	else if( libevt_record_initialize(
+	          record,
+	          internal_file->io_handle,
+	          internal_file->file_io_handle,
+	          record_values,
+	          LIBEVT_RECORD_FLAG_MANAGED_RECORD_VALUES,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
+		 function );
+
+		libevt_record_values_free(
+		 &record_values,
+		 NULL );
 
+		result = -1;
+	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file->read_write_lock,
@@ -1466,19 +5858,27 @@ int libevt_file_get_ascii_codepage(
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
-/* Sets the file ASCII codepage
- * Returns 1 if successful or -1 on error
+/* Retrieves a specific record by its identifier (record number)
+ * Records are preferred over recovered records that use the same identifier
+ * The identifier map is created on first use
+ * Returns 1 if successful, 0 if no such record or -1 on error
  */
-int libevt_file_set_ascii_codepage(
+int libevt_file_get_record_by_identifier(
      libevt_file_t *file,
-     int ascii_codepage,
+     uint32_t record_identifier,
+     libevt_record_t **record,
      libcerror_error_t **error )
 {
 	libevt_internal_file_t *internal_file = NULL;
-	static char *function                 = "libevt_file_set_ascii_codepage";
+	libevt_record_values_t *record_values = NULL;
+	libfdata_list_t *records_list         = NULL;
+	static char *function                 = "libevt_file_get_record_by_identifier";
+	int record_index                      = 0;
+	int records_list_index                = 0;
+	int result                            = 0;
 
 	if( file == NULL )
 	{
@@ -1493,44 +5893,30 @@ int libevt_file_set_ascii_codepage(
 	}
 	internal_file = (libevt_internal_file_t *) file;
 
-	if( internal_file->io_handle == NULL )
+	if( internal_file->file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 "%s: invalid file - missing file IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ascii_codepage != LIBEVT_CODEPAGE_ASCII )
-	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_874 )
-	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_932 )
-	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_936 )
-	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_949 )
-	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_950 )
-	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1250 )
-	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1251 )
-	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1252 )
-	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1253 )
-	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1254 )
-	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1255 )
-	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1256 )
-	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1257 )
-	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1258 ) )
+	if( record == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported ASCII codepage.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1538,16 +5924,156 @@ int libevt_file_set_ascii_codepage(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_file->identifier_map_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab identifier map mutex.",
+		 function );
+
+		libcthreads_read_write_lock_release_for_read(
+		 internal_file->read_write_lock,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->identifier_map == NULL )
+	{
+		if( libevt_identifier_map_initialize(
+		     &( internal_file->identifier_map ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create identifier map.",
+			 function );
+
+			result = -1;
+		}
+		else if( libevt_identifier_map_read_records(
+		          internal_file->identifier_map,
+		          internal_file->io_handle,
+		          internal_file->file_io_handle,
+		          internal_file->records_list,
+		          internal_file->recovered_records_list,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read identifier map.",
+			 function );
+
+			libevt_identifier_map_free(
+			 &( internal_file->identifier_map ),
+			 NULL );
+
+			result = -1;
+		}
+	}
+	if( result == 0 )
+	{
+		result = libevt_identifier_map_get_record_index_by_identifier(
+		          internal_file->identifier_map,
+		          record_identifier,
+		          &records_list_index,
+		          &record_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record index of identifier: %" PRIu32 ".",
+			 function,
+			 record_identifier );
+		}
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_file->identifier_map_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release identifier map mutex.",
 		 function );
 
-		return( -1 );
+		libcthreads_read_write_lock_release_for_read(
+		 internal_file->read_write_lock,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		if( records_list_index == 0 )
+		{
+			records_list = internal_file->records_list;
+		}
+		else
+		{
+			records_list = internal_file->recovered_records_list;
+		}
+		if( libevt_file_get_record_values_by_index(
+		     internal_file,
+		     records_list,
+		     record_index,
+		     &record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record values: %d.",
+			 function,
+			 record_index );
+
+			result = -1;
+		}
+		else if( libevt_record_initialize(
+		          record,
+		          internal_file->io_handle,
+		          internal_file->file_io_handle,
+		          record_values,
+		          LIBEVT_RECORD_FLAG_MANAGED_RECORD_VALUES,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record.",
+			 function );
+
+			libevt_record_values_free(
+			 &record_values,
+			 NULL );
+
+			result = -1;
+		}
 	}
-#endif
-	internal_file->io_handle->ascii_codepage = ascii_codepage;
-
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1555,28 +6081,28 @@ int libevt_file_set_ascii_codepage(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves the format version
+/* Reads the written time index if not already read
+ * The caller must hold the read/write lock of the file, the time index is
+ * not changed afterwards until the file is refreshed or closed
  * Returns 1 if successful or -1 on error
  */
-int libevt_file_get_format_version(
-     libevt_file_t *file,
-     uint32_t *major_format_version,
-     uint32_t *minor_format_version,
+int libevt_file_read_time_index(
+     libevt_internal_file_t *internal_file,
      libcerror_error_t **error )
 {
-	libevt_internal_file_t *internal_file = NULL;
-	static char *function                 = "libevt_file_get_format_version";
+	static char *function = "libevt_file_read_time_index";
+	int result            = 1;
 
-	if( file == NULL )
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1587,88 +6113,115 @@ int libevt_file_get_format_version(
 
 		return( -1 );
 	}
-	internal_file = (libevt_internal_file_t *) file;
-
-	if( internal_file->file_header == NULL )
+	if( internal_file->file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing file header.",
-		 function );
-
-		return( -1 );
-	}
-	if( major_format_version == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid major format version.",
-		 function );
-
-		return( -1 );
-	}
-	if( minor_format_version == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid minor format version.",
+		 "%s: invalid file - missing file IO handle.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( libcthreads_mutex_grab(
+	     internal_file->time_index_mutex,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab time index mutex.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	*major_format_version = internal_file->file_header->major_format_version;
-	*minor_format_version = internal_file->file_header->minor_format_version;
+	if( internal_file->time_index == NULL )
+	{
+		if( libevt_time_index_initialize(
+		     &( internal_file->time_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create time index.",
+			 function );
+
+			result = -1;
+		}
+		else if( libevt_time_index_read_records(
+		          internal_file->time_index,
+		          internal_file->io_handle,
+		          internal_file->file_io_handle,
+		          internal_file->records_list,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read time index.",
+			 function );
 
+			libevt_time_index_free(
+			 &( internal_file->time_index ),
+			 NULL );
+
+			result = -1;
+		}
+	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( libcthreads_mutex_release(
+	     internal_file->time_index_mutex,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release time index mutex.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves the version
+/* Retrieves the records with a last written time within a specific range
+ * The start and end time are POSIX timestamps and are both inclusive
+ * The callback function is called for every matching record in record index
+ * order and returns 1 to continue, 0 to stop or -1 on error. The record is
+ * freed after the callback function returns.
+ * The written time index is created on first use
  * Returns 1 if successful or -1 on error
  */
-int libevt_file_get_version(
+int libevt_file_get_records_in_time_range(
      libevt_file_t *file,
-     uint32_t *major_version,
-     uint32_t *minor_version,
+     uint32_t start_time,
+     uint32_t end_time,
+     int (*callback_function)(
+            libevt_record_t *record,
+            int record_index,
+            void *user_data,
+            libcerror_error_t **error ),
+     void *user_data,
      libcerror_error_t **error )
 {
 	libevt_internal_file_t *internal_file = NULL;
-	static char *function                 = "libevt_file_get_version";
+	libevt_record_t *record               = NULL;
+	libevt_record_values_t *record_values = NULL;
+	int *record_indexes                   = NULL;
+	static char *function                 = "libevt_file_get_records_in_time_range";
+	int callback_result                   = 0;
+	int index                             = 0;
+	int number_of_record_indexes          = 0;
+	int result                            = 1;
 
 	if( file == NULL )
 	{
@@ -1683,35 +6236,35 @@ int libevt_file_get_version(
 	}
 	internal_file = (libevt_internal_file_t *) file;
 
-	if( internal_file->file_header == NULL )
+	if( internal_file->file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing file header.",
+		 "%s: invalid file - missing file IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( major_version == NULL )
+	if( start_time > end_time )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid major version.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid start time value exceeds end time.",
 		 function );
 
 		return( -1 );
 	}
-	if( minor_version == NULL )
+	if( callback_function == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid minor version.",
+		 "%s: invalid callback function.",
 		 function );
 
 		return( -1 );
@@ -1731,9 +6284,132 @@ int libevt_file_get_version(
 		return( -1 );
 	}
 #endif
-	*major_version = internal_file->file_header->major_format_version;
-	*minor_version = internal_file->file_header->minor_format_version;
+	if( libevt_file_read_time_index(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read time index.",
+		 function );
+
+		result = -1;
+	}
+	else if( libevt_time_index_get_record_indexes(
+	          internal_file->time_index,
+	          start_time,
+	          end_time,
+	          &record_indexes,
+	          &number_of_record_indexes,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record indexes.",
+		 function );
+
+		result = -1;
+	}
+	if( result == 1 )
+	{
+		for( index = 0;
+		     index < number_of_record_indexes;
+		     index++ )
+		{
+			if( libevt_file_get_record_values_by_index(
+			     internal_file,
+			     internal_file->records_list,
+			     record_indexes[ index ],
+			     &record_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record values: %d.",
+				 function,
+				 record_indexes[ index ] );
+
+				result = -1;
+
+				break;
+			}
+			if( libevt_record_initialize(
+			     &record,
+			     internal_file->io_handle,
+			     internal_file->file_io_handle,
+			     record_values,
+			     LIBEVT_RECORD_FLAG_MANAGED_RECORD_VALUES,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create record.",
+				 function );
+
+				libevt_record_values_free(
+				 &record_values,
+				 NULL );
+
+				result = -1;
+
+				break;
+			}
+			record_values = NULL;
+
+			callback_result = callback_function(
+			                   record,
+			                   record_indexes[ index ],
+			                   user_data,
+			                   error );
+
+			if( libevt_record_free(
+			     &record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+			if( callback_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: callback function failed for record: %d.",
+				 function,
+				 record_indexes[ index ] );
+
+				result = -1;
 
+				break;
+			}
+			else if( callback_result == 0 )
+			{
+				break;
+			}
+		}
+	}
+	if( record_indexes != NULL )
+	{
+		memory_free(
+		 record_indexes );
+	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file->read_write_lock,
@@ -1749,19 +6425,40 @@ int libevt_file_get_version(
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves the flags
+/* Retrieves the fixed-size values of a range of records into arrays
+ * Every array, when not NULL, must contain at least number_of_records values.
+ * Only the fixed-size part of the event records is read, values of records
+ * that are too small to be an event record are set to 0
  * Returns 1 if successful or -1 on error
  */
-int libevt_file_get_flags(
+int libevt_file_get_record_columns(
      libevt_file_t *file,
-     uint32_t *flags,
+     int first_record_index,
+     int number_of_records,
+     uint32_t *record_numbers,
+     uint32_t *creation_times,
+     uint32_t *written_times,
+     uint32_t *event_identifiers,
+     uint16_t *event_types,
+     uint16_t *event_categories,
+     off64_t *record_offsets,
      libcerror_error_t **error )
 {
+	uint8_t record_data[ sizeof( evt_event_record_t ) ];
+
+	evt_event_record_t *event_record      = NULL;
 	libevt_internal_file_t *internal_file = NULL;
-	static char *function                 = "libevt_file_get_flags";
+	static char *function                 = "libevt_file_get_record_columns";
+	size64_t element_size                 = 0;
+	off64_t element_offset                = 0;
+	uint32_t element_flags                = 0;
+	int element_file_index                = 0;
+	int index                             = 0;
+	int result                            = 1;
+	int total_number_of_records           = 0;
 
 	if( file == NULL )
 	{
@@ -1776,28 +6473,41 @@ int libevt_file_get_flags(
 	}
 	internal_file = (libevt_internal_file_t *) file;
 
-	if( internal_file->file_header == NULL )
+	if( internal_file->file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing file header.",
+		 "%s: invalid file - missing file IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( flags == NULL )
+	if( first_record_index < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid flags.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid first record index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of records value less than zero.",
 		 function );
 
 		return( -1 );
 	}
+	event_record = (evt_event_record_t *) record_data;
+
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file->read_write_lock,
@@ -1812,9 +6522,142 @@ int libevt_file_get_flags(
 
 		return( -1 );
 	}
-#endif
-	*flags = internal_file->file_header->file_flags;
-
+#endif
+	if( libfdata_list_get_number_of_elements(
+	     internal_file->records_list,
+	     &total_number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements from records list.",
+		 function );
+
+		result = -1;
+	}
+	else if( ( first_record_index > total_number_of_records )
+	      || ( number_of_records > ( total_number_of_records - first_record_index ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	if( result == 1 )
+	{
+		for( index = 0;
+		     index < number_of_records;
+		     index++ )
+		{
+			if( libfdata_list_get_element_by_index(
+			     internal_file->records_list,
+			     first_record_index + index,
+			     &element_file_index,
+			     &element_offset,
+			     &element_size,
+			     &element_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve element: %d from records list.",
+				 function,
+				 first_record_index + index );
+
+				result = -1;
+
+				break;
+			}
+			if( element_size < (size64_t) sizeof( evt_event_record_t ) )
+			{
+				if( memory_set(
+				     record_data,
+				     0,
+				     sizeof( evt_event_record_t ) ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+					 "%s: unable to clear record data.",
+					 function );
+
+					result = -1;
+
+					break;
+				}
+			}
+			else if( libevt_io_handle_read_record_data(
+			          internal_file->io_handle,
+			          internal_file->file_io_handle,
+			          element_offset,
+			          0,
+			          record_data,
+			          sizeof( evt_event_record_t ),
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read record: %d data.",
+				 function,
+				 first_record_index + index );
+
+				result = -1;
+
+				break;
+			}
+			if( record_numbers != NULL )
+			{
+				byte_stream_copy_to_uint32_little_endian(
+				 event_record->record_number,
+				 record_numbers[ index ] );
+			}
+			if( creation_times != NULL )
+			{
+				byte_stream_copy_to_uint32_little_endian(
+				 event_record->creation_time,
+				 creation_times[ index ] );
+			}
+			if( written_times != NULL )
+			{
+				byte_stream_copy_to_uint32_little_endian(
+				 event_record->last_written_time,
+				 written_times[ index ] );
+			}
+			if( event_identifiers != NULL )
+			{
+				byte_stream_copy_to_uint32_little_endian(
+				 event_record->event_identifier,
+				 event_identifiers[ index ] );
+			}
+			if( event_types != NULL )
+			{
+				byte_stream_copy_to_uint16_little_endian(
+				 event_record->event_type,
+				 event_types[ index ] );
+			}
+			if( event_categories != NULL )
+			{
+				byte_stream_copy_to_uint16_little_endian(
+				 event_record->event_category,
+				 event_categories[ index ] );
+			}
+			if( record_offsets != NULL )
+			{
+				record_offsets[ index ] = element_offset;
+			}
+		}
+	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file->read_write_lock,
@@ -1830,22 +6673,33 @@ int libevt_file_get_flags(
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves the number of records
- * Returns 1 if successful or -1 on error
+/* Retrieves specific record values from the records cache
+ * The records cache mutex must be held by the caller
+ * On return cache_entry_index contains the cache entry of the record values
+ * if available, otherwise the cache entry to store the record values in
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libevt_file_get_number_of_records(
-     libevt_file_t *file,
-     int *number_of_records,
+int libevt_file_get_cached_record_values(
+     libevt_internal_file_t *internal_file,
+     int records_list_index,
+     int record_index,
+     off64_t record_offset,
+     libevt_record_values_t **record_values,
+     int *cache_entry_index,
      libcerror_error_t **error )
 {
-	libevt_internal_file_t *internal_file = NULL;
-	static char *function                 = "libevt_file_get_number_of_records";
-	int result                            = 1;
+	libfcache_cache_value_t *cache_value = NULL;
+	static char *function                = "libevt_file_get_cached_record_values";
+	off64_t cache_value_offset           = 0;
+	int64_t cache_value_timestamp        = 0;
+	int cache_value_file_index           = 0;
+	int entry_index                      = 0;
+	int result                           = 0;
 
-	if( file == NULL )
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1856,70 +6710,164 @@ int libevt_file_get_number_of_records(
 
 		return( -1 );
 	}
-	internal_file = (libevt_internal_file_t *) file;
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
 
-#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_file->read_write_lock,
+		return( -1 );
+	}
+	if( cache_entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->cache_policy == LIBEVT_CACHE_POLICY_DISABLED )
+	{
+		*cache_entry_index = -1;
+
+		return( 0 );
+	}
+	/* The least recently used cache policy looks up the cache entry in the records
+	 * cache index, the direct mapped cache policy maps the record to a single cache entry
+	 */
+	if( internal_file->cache_policy == LIBEVT_CACHE_POLICY_LEAST_RECENTLY_USED )
+	{
+		result = libevt_cache_index_get_entry_by_record(
+		          internal_file->records_cache_index,
+		          records_list_index,
+		          record_offset,
+		          &entry_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve records cache index entry.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			*cache_entry_index = entry_index;
+
+			return( 0 );
+		}
+	}
+	else
+	{
+		entry_index = record_index % internal_file->maximum_cache_entries;
+	}
+	if( libfcache_cache_get_value_by_index(
+	     internal_file->records_cache,
+	     entry_index,
+	     &cache_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value: %d.",
+		 function,
+		 entry_index );
 
 		return( -1 );
 	}
-#endif
-	if( libfdata_list_get_number_of_elements(
-	     internal_file->records_list,
-	     number_of_records,
+	*cache_entry_index = entry_index;
+
+	if( cache_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfcache_cache_value_get_identifier(
+	     cache_value,
+	     &cache_value_file_index,
+	     &cache_value_offset,
+	     &cache_value_timestamp,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements from records list.",
-		 function );
+		 "%s: unable to retrieve cache value: %d identifier.",
+		 function,
+		 entry_index );
 
-		result = -1;
+		return( -1 );
 	}
-#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_file->read_write_lock,
+	if( ( cache_value_file_index != records_list_index )
+	 || ( cache_value_offset != record_offset ) )
+	{
+		return( 0 );
+	}
+	if( libfcache_cache_value_get_value(
+	     cache_value,
+	     (intptr_t **) record_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record values from cache value: %d.",
+		 function,
+		 entry_index );
 
 		return( -1 );
 	}
-#endif
-	return( result );
+	return( 1 );
 }
 
-/* Retrieves a specific record
+/* Retrieves the record values of a specific record of a records list
+ * The records cache is used according to the cache policy of the file
+ * The caller receives a reference to the record values that must be released
+ * with libevt_record_values_free, the records cache keeps its own reference
+ * The records are read outside the records cache mutex, this function is safe
+ * to call from multiple threads that hold the file read lock
  * Returns 1 if successful or -1 on error
  */
-int libevt_file_get_record(
-     libevt_file_t *file,
+int libevt_file_get_record_values_by_index(
+     libevt_internal_file_t *internal_file,
+     libfdata_list_t *records_list,
      int record_index,
-     libevt_record_t **record,
+     libevt_record_values_t **record_values,
      libcerror_error_t **error )
 {
-	libevt_internal_file_t *internal_file = NULL;
-	libevt_record_values_t *record_values = NULL;
-	static char *function                 = "libevt_file_get_record";
-	int result                            = 1;
+	libevt_record_values_t *cached_record_values = NULL;
+	libevt_record_values_t *safe_record_values   = NULL;
+	static char *function                        = "libevt_file_get_record_values_by_index";
+	off64_t element_offset                       = 0;
+	off64_t file_offset                          = 0;
+	size64_t element_size                        = 0;
+	ssize_t read_count                           = 0;
+	uint32_t element_flags                       = 0;
+	uint8_t has_wrapped                          = 0;
+	int cache_entry_index                        = -1;
+	int element_file_index                       = 0;
+	int records_list_index                       = 0;
+	int result                                   = 0;
 
-	if( file == NULL )
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	uint8_t has_mutex                            = 0;
+#endif
+
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1930,113 +6878,330 @@ int libevt_file_get_record(
 
 		return( -1 );
 	}
-	internal_file = (libevt_internal_file_t *) file;
-
-	if( record == NULL )
+	if( record_values == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 "%s: invalid record values.",
 		 function );
 
 		return( -1 );
 	}
-	if( *record != NULL )
+	if( libfdata_list_get_element_by_index(
+	     records_list,
+	     record_index,
+	     &element_file_index,
+	     &element_offset,
+	     &element_size,
+	     &element_flags,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid record value already set.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record: %d.",
+		 function,
+		 record_index );
 
-		return( -1 );
+		goto on_error;
+	}
+	/* The records and recovered records share the records cache
+	 * the cache value file index is used to distinguish between them
+	 */
+	if( records_list == internal_file->recovered_records_list )
+	{
+		records_list_index = 1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_file->read_write_lock,
+	if( libcthreads_mutex_grab(
+	     internal_file->records_cache_mutex,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab records cache mutex.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
+	has_mutex = 1;
 #endif
-	if( libfdata_list_get_element_value_by_index(
-	     internal_file->records_list,
-	     (intptr_t *) internal_file->file_io_handle,
-	     (libfdata_cache_t *) internal_file->records_cache,
-	     record_index,
-	     (intptr_t **) &record_values,
-	     0,
-	     error ) != 1 )
+	result = libevt_file_get_cached_record_values(
+	          internal_file,
+	          records_list_index,
+	          record_index,
+	          element_offset,
+	          &cached_record_values,
+	          &cache_entry_index,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve record values: %d.",
+		 "%s: unable to retrieve cached record values: %d.",
 		 function,
 		 record_index );
 
-		result = -1;
+		goto on_error;
 	}
-	else if( libevt_record_initialize(
-	          record,
-	          internal_file->io_handle,
-	          internal_file->file_io_handle,
-	          record_values,
-	          error ) != 1 )
+	else if( result != 0 )
+	{
+		if( libevt_record_values_add_reference(
+		     cached_record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add reference to record values.",
+			 function );
+
+			goto on_error;
+		}
+		internal_file->number_of_cache_hits += 1;
+	}
+	else
+	{
+		internal_file->number_of_cache_misses += 1;
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	has_mutex = 0;
+
+	if( libcthreads_mutex_release(
+	     internal_file->records_cache_mutex,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create record.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release records cache mutex.",
 		 function );
 
-		result = -1;
+		if( result != 0 )
+		{
+			libevt_record_values_free(
+			 &cached_record_values,
+			 NULL );
+		}
+		goto on_error;
 	}
-#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_file->read_write_lock,
+#endif
+	if( result != 0 )
+	{
+		*record_values = cached_record_values;
+
+		return( 1 );
+	}
+	if( libevt_record_values_initialize(
+	     &safe_record_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record values.",
 		 function );
 
-		return( -1 );
+		goto on_error;
+	}
+	file_offset = element_offset;
+
+	read_count = libevt_record_values_read_file_io_handle(
+	              safe_record_values,
+	              internal_file->file_io_handle,
+	              internal_file->io_handle,
+	              &file_offset,
+	              &has_wrapped,
+	              0,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 element_offset,
+		 element_offset );
+
+		goto on_error;
+	}
+	if( cache_entry_index != -1 )
+	{
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     internal_file->records_cache_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab records cache mutex.",
+			 function );
+
+			goto on_error;
+		}
+		has_mutex = 1;
+#endif
+		/* Another thread could have stored the record values in the records cache
+		 * in the meantime, in which case the record values read are not cached
+		 */
+		result = libevt_file_get_cached_record_values(
+		          internal_file,
+		          records_list_index,
+		          record_index,
+		          element_offset,
+		          &cached_record_values,
+		          &cache_entry_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cached record values: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libfcache_cache_set_value_by_index(
+			     internal_file->records_cache,
+			     cache_entry_index,
+			     records_list_index,
+			     element_offset,
+			     0,
+			     (intptr_t *) safe_record_values,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libevt_record_values_free,
+			     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set record values in cache entry: %d.",
+				 function,
+				 cache_entry_index );
+
+				goto on_error;
+			}
+			/* The records cache now owns the initial reference
+			 */
+			cached_record_values = safe_record_values;
+			safe_record_values   = NULL;
+
+			if( libevt_record_values_add_reference(
+			     cached_record_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to add reference to record values.",
+				 function );
+
+				goto on_error;
+			}
+			safe_record_values = cached_record_values;
+
+			if( internal_file->cache_policy == LIBEVT_CACHE_POLICY_LEAST_RECENTLY_USED )
+			{
+				if( libevt_cache_index_set_entry(
+				     internal_file->records_cache_index,
+				     cache_entry_index,
+				     records_list_index,
+				     element_offset,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set record in records cache index entry: %d.",
+					 function,
+					 cache_entry_index );
+
+					goto on_error;
+				}
+			}
+		}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+		has_mutex = 0;
+
+		if( libcthreads_mutex_release(
+		     internal_file->records_cache_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release records cache mutex.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+	}
+	*record_values = safe_record_values;
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( has_mutex != 0 )
+	{
+		libcthreads_mutex_release(
+		 internal_file->records_cache_mutex,
+		 NULL );
+	}
+#endif
+	if( safe_record_values != NULL )
+	{
+		libevt_record_values_free(
+		 &safe_record_values,
+		 NULL );
 	}
-#endif
-	return( result );
+	return( -1 );
 }
 
-/* Retrieves a specific record
+/* Reads a specific record of a records list into a record view
  * Returns 1 if successful or -1 on error
  */
-int libevt_file_get_record_by_index(
-     libevt_file_t *file,
+int libevt_file_read_record_view(
+     libevt_internal_file_t *internal_file,
+     libfdata_list_t *records_list,
      int record_index,
-     libevt_record_t **record,
+     libevt_internal_record_view_t *internal_record_view,
      libcerror_error_t **error )
 {
-	libevt_internal_file_t *internal_file = NULL;
-	libevt_record_values_t *record_values = NULL;
-	static char *function                 = "libevt_file_get_record_by_index";
-	int result                            = 1;
+	static char *function = "libevt_file_read_record_view";
+	off64_t record_offset = 0;
+	size64_t record_size  = 0;
+	uint32_t record_flags = 0;
+	int file_index        = 0;
 
-	if( file == NULL )
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -2047,108 +7212,58 @@ int libevt_file_get_record_by_index(
 
 		return( -1 );
 	}
-	internal_file = (libevt_internal_file_t *) file;
-
-	if( record == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
-		 function );
-
-		return( -1 );
-	}
-	if( *record != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid record value already set.",
-		 function );
-
-		return( -1 );
-	}
-#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_file->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
-		 function );
-
-		return( -1 );
-	}
-#endif
-	if( libfdata_list_get_element_value_by_index(
-	     internal_file->records_list,
-	     (intptr_t *) internal_file->file_io_handle,
-	     (libfdata_cache_t *) internal_file->records_cache,
+	if( libfdata_list_get_element_by_index(
+	     records_list,
 	     record_index,
-	     (intptr_t **) &record_values,
-	     0,
+	     &file_index,
+	     &record_offset,
+	     &record_size,
+	     &record_flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve record values: %d.",
+		 "%s: unable to retrieve record: %d.",
 		 function,
 		 record_index );
 
-		result = -1;
-	}
-	else if( libevt_record_initialize(
-	          record,
-	          internal_file->io_handle,
-	          internal_file->file_io_handle,
-	          record_values,
-	          error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create record.",
-		 function );
-
-		result = -1;
+		return( -1 );
 	}
-#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_file->read_write_lock,
+	if( libevt_record_view_read_file_io_handle(
+	     internal_record_view,
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     record_offset,
+	     record_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record view: %d.",
+		 function,
+		 record_index );
 
 		return( -1 );
 	}
-#endif
-	return( result );
+	return( 1 );
 }
 
-/* Retrieves the number of recovered records
+/* Retrieves a specific record as a record view
+ * The record view is overwritten on every call and can be reused for multiple records
  * Returns 1 if successful or -1 on error
  */
-int libevt_file_get_number_of_recovered_records(
+int libevt_file_get_record_view_by_index(
      libevt_file_t *file,
-     int *number_of_records,
+     int record_index,
+     libevt_record_view_t *record_view,
      libcerror_error_t **error )
 {
 	libevt_internal_file_t *internal_file = NULL;
-	static char *function                 = "libevt_file_get_number_of_recovered_records";
+	static char *function                 = "libevt_file_get_record_view_by_index";
 	int result                            = 1;
 
 	if( file == NULL )
@@ -2164,8 +7279,19 @@ int libevt_file_get_number_of_recovered_records(
 	}
 	internal_file = (libevt_internal_file_t *) file;
 
+	if( record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2173,28 +7299,31 @@ int libevt_file_get_number_of_recovered_records(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( libfdata_list_get_number_of_elements(
-	     internal_file->recovered_records_list,
-	     number_of_records,
+	if( libevt_file_read_record_view(
+	     internal_file,
+	     internal_file->records_list,
+	     record_index,
+	     (libevt_internal_record_view_t *) record_view,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements from recovered records list.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record view: %d.",
+		 function,
+		 record_index );
 
 		result = -1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2202,7 +7331,7 @@ int libevt_file_get_number_of_recovered_records(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -2211,18 +7340,18 @@ int libevt_file_get_number_of_recovered_records(
 	return( result );
 }
 
-/* Retrieves a specific recovered record
+/* Retrieves a specific recovered record as a record view
+ * The record view is overwritten on every call and can be reused for multiple records
  * Returns 1 if successful or -1 on error
  */
-int libevt_file_get_recovered_record(
+int libevt_file_get_recovered_record_view_by_index(
      libevt_file_t *file,
      int record_index,
-     libevt_record_t **record,
+     libevt_record_view_t *record_view,
      libcerror_error_t **error )
 {
 	libevt_internal_file_t *internal_file = NULL;
-	libevt_record_values_t *record_values = NULL;
-	static char *function                 = "libevt_file_get_recovered_record";
+	static char *function                 = "libevt_file_get_recovered_record_view_by_index";
 	int result                            = 1;
 
 	if( file == NULL )
@@ -2238,30 +7367,19 @@ int libevt_file_get_recovered_record(
 	}
 	internal_file = (libevt_internal_file_t *) file;
 
-	if( record == NULL )
+	if( record_view == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
-		 function );
-
-		return( -1 );
-	}
-	if( *record != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid record value already set.",
+		 "%s: invalid record view.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2269,78 +7387,124 @@ int libevt_file_get_recovered_record(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( libfdata_list_get_element_value_by_index(
+	if( libevt_file_read_record_view(
+	     internal_file,
 	     internal_file->recovered_records_list,
-	     (intptr_t *) internal_file->file_io_handle,
-	     (libfdata_cache_t *) internal_file->records_cache,
 	     record_index,
-	     (intptr_t **) &record_values,
-	     0,
+	     (libevt_internal_record_view_t *) record_view,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve recovered record values: %d.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read recovered record view: %d.",
 		 function,
 		 record_index );
 
 		result = -1;
 	}
-	else if( libevt_record_initialize(
-	          record,
-	          internal_file->io_handle,
-	          internal_file->file_io_handle,
-	          record_values,
-	          error ) != 1 )
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create record.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_file->read_write_lock,
+#endif
+	return( result );
+}
+
+/* Parses the records using multiple threads
+ * The callback function is called for every record and returns 1 to continue,
+ * 0 to stop parsing or -1 on error. The record is freed after the callback
+ * function returns.
+ * If LIBEVT_PARSE_RECORDS_FLAG_PRESERVE_ORDER is set the callback function is
+ * called by one thread at a time in record index order, otherwise it can be
+ * called concurrently from multiple threads in any order
+ * The read lock is held while the callback function is called, hence the callback
+ * function must not call functions of the same file
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_parse_records_parallel(
+     libevt_file_t *file,
+     int number_of_threads,
+     int (*callback_function)(
+            libevt_record_t *record,
+            int record_index,
+            void *user_data,
+            libcerror_error_t **error ),
+     void *user_data,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_file_parse_records_parallel";
+
+	if( libevt_file_parse_records_with_filter(
+	     file,
+	     NULL,
+	     number_of_threads,
+	     callback_function,
+	     user_data,
+	     flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to parse records.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( result );
+	return( 1 );
 }
 
-/* Retrieves a specific recovered record
+/* Parses the records that match a filter using multiple threads
+ * The filter is evaluated on the fixed-size part of the event record and
+ * the source name, before the rest of the record is read. If filter is NULL
+ * all records are parsed.
+ * The callback function is called for every matching record and returns 1 to continue,
+ * 0 to stop parsing or -1 on error. The record is freed after the callback
+ * function returns.
+ * If LIBEVT_PARSE_RECORDS_FLAG_PRESERVE_ORDER is set the callback function is
+ * called by one thread at a time in record index order, otherwise it can be
+ * called concurrently from multiple threads in any order
+ * The read lock is held while the callback function is called, hence the callback
+ * function must not call functions of the same file
  * Returns 1 if successful or -1 on error
  */
-int libevt_file_get_recovered_record_by_index(
+int libevt_file_parse_records_with_filter(
      libevt_file_t *file,
-     int record_index,
-     libevt_record_t **record,
+     libevt_filter_t *filter,
+     int number_of_threads,
+     int (*callback_function)(
+            libevt_record_t *record,
+            int record_index,
+            void *user_data,
+            libcerror_error_t **error ),
+     void *user_data,
+     uint8_t flags,
      libcerror_error_t **error )
 {
-	libevt_internal_file_t *internal_file = NULL;
-	libevt_record_values_t *record_values = NULL;
-	static char *function                 = "libevt_file_get_recovered_record_by_index";
-	int result                            = 1;
+	libevt_internal_file_t *internal_file   = NULL;
+	libevt_records_parser_t *records_parser = NULL;
+	static char *function                   = "libevt_file_parse_records_with_filter";
+	int result                              = 1;
 
 	if( file == NULL )
 	{
@@ -2355,19 +7519,19 @@ int libevt_file_get_recovered_record_by_index(
 	}
 	internal_file = (libevt_internal_file_t *) file;
 
-	if( record == NULL )
+	if( internal_file->file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2375,49 +7539,64 @@ int libevt_file_get_recovered_record_by_index(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( libfdata_list_get_element_value_by_index(
-	     internal_file->recovered_records_list,
-	     (intptr_t *) internal_file->file_io_handle,
-	     (libfdata_cache_t *) internal_file->records_cache,
-	     record_index,
-	     (intptr_t **) &record_values,
-	     0,
+	if( libevt_records_parser_initialize(
+	     &records_parser,
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     internal_file->records_list,
+	     (libevt_internal_filter_t *) filter,
+	     number_of_threads,
+	     callback_function,
+	     user_data,
+	     flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve recovered record values: %d.",
-		 function,
-		 record_index );
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create records parser.",
+		 function );
 
 		result = -1;
 	}
-	else if( libevt_record_initialize(
-	          record,
-	          internal_file->io_handle,
-	          internal_file->file_io_handle,
-	          record_values,
-	          error ) != 1 )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create record.",
-		 function );
+		if( libevt_records_parser_parse(
+		     records_parser,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse records.",
+			 function );
 
-		result = -1;
+			result = -1;
+		}
+		if( libevt_records_parser_free(
+		     &records_parser,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free records parser.",
+			 function );
+
+			result = -1;
+		}
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2425,7 +7604,7 @@ int libevt_file_get_recovered_record_by_index(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -25,14 +25,21 @@
 #include <common.h>
 #include <types.h>
 
+#include "libevt_arena.h"
+#include "libevt_cache_index.h"
 #include "libevt_extern.h"
 #include "libevt_file_header.h"
+#include "libevt_identifier_map.h"
 #include "libevt_io_handle.h"
 #include "libevt_libbfio.h"
 #include "libevt_libcerror.h"
 #include "libevt_libcthreads.h"
 #include "libevt_libfcache.h"
 #include "libevt_libfdata.h"
+#include "libevt_record_values.h"
+#include "libevt_record_view.h"
+#include "libevt_records_parser.h"
+#include "libevt_time_index.h"
 #include "libevt_types.h"
 
 #if defined( __cplusplus )
@@ -75,6 +82,56 @@ struct libevt_internal_file
 	 */
 	libfcache_cache_t *records_cache;
 
+	/* The records cache policy
+	 */
+	int cache_policy;
+
+	/* The maximum number of records cache entries
+	 */
+	int maximum_cache_entries;
+
+	/* The records cache index, used by the least recently used cache policy
+	 */
+	libevt_cache_index_t *records_cache_index;
+
+	/* The number of records cache hits
+	 */
+	uint64_t number_of_cache_hits;
+
+	/* The number of records cache misses
+	 */
+	uint64_t number_of_cache_misses;
+
+	/* The record identifier map, created on first use
+	 */
+	libevt_identifier_map_t *identifier_map;
+
+	/* The written time index, created on first use
+	 */
+	libevt_time_index_t *time_index;
+
+	/* The size of the blocks of the arena, 0 if no arena is used
+	 */
+	size_t arena_block_size;
+
+	/* The arena the event record data is carved from while the file is open
+	 */
+	libevt_arena_t *arena;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	/* The records cache mutex
+	 */
+	libcthreads_mutex_t *records_cache_mutex;
+
+	/* The record identifier map mutex
+	 */
+	libcthreads_mutex_t *identifier_map_mutex;
+
+	/* The written time index mutex
+	 */
+	libcthreads_mutex_t *time_index_mutex;
+#endif
+
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
@@ -115,6 +172,34 @@ int libevt_file_open_wide(
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+LIBEVT_EXTERN \
+int libevt_file_open_with_index(
+     libevt_file_t *file,
+     const char *filename,
+     const char *index_filename,
+     int access_flags,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBEVT_EXTERN \
+int libevt_file_open_with_index_wide(
+     libevt_file_t *file,
+     const wchar_t *filename,
+     const wchar_t *index_filename,
+     int access_flags,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBEVT_EXTERN \
+int libevt_file_open_memory(
+     libevt_file_t *file,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     int access_flags,
+     libcerror_error_t **error );
+
 LIBEVT_EXTERN \
 int libevt_file_open_file_io_handle(
      libevt_file_t *file,
@@ -122,6 +207,14 @@ int libevt_file_open_file_io_handle(
      int access_flags,
      libcerror_error_t **error );
 
+LIBEVT_EXTERN \
+int libevt_file_open_file_io_handle_with_index(
+     libevt_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     libbfio_handle_t *index_file_io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
 LIBEVT_EXTERN \
 int libevt_file_close(
      libevt_file_t *file,
@@ -130,6 +223,54 @@ int libevt_file_close(
 int libevt_file_open_read(
      libevt_internal_file_t *internal_file,
      libbfio_handle_t *file_io_handle,
+     libbfio_handle_t *index_file_io_handle,
+     libcerror_error_t **error );
+
+int libevt_file_get_records_end_offset(
+     libevt_internal_file_t *internal_file,
+     off64_t *end_offset,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_file_refresh(
+     libevt_file_t *file,
+     libcerror_error_t **error );
+
+int libevt_file_remove_records_before(
+     libevt_internal_file_t *internal_file,
+     int first_record_index,
+     libcerror_error_t **error );
+
+int libevt_file_remove_overlapping_recovered_records(
+     libevt_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libevt_file_refresh_read(
+     libevt_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_file_write_index(
+     libevt_file_t *file,
+     const char *index_filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBEVT_EXTERN \
+int libevt_file_write_index_wide(
+     libevt_file_t *file,
+     const wchar_t *index_filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBEVT_EXTERN \
+int libevt_file_write_index_file_io_handle(
+     libevt_file_t *file,
+     libbfio_handle_t *index_file_io_handle,
      libcerror_error_t **error );
 
 LIBEVT_EXTERN \
@@ -149,6 +290,31 @@ int libevt_file_set_ascii_codepage(
      int ascii_codepage,
      libcerror_error_t **error );
 
+LIBEVT_EXTERN \
+int libevt_file_set_maximum_cache_entries(
+     libevt_file_t *file,
+     int maximum_cache_entries,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_file_set_cache_policy(
+     libevt_file_t *file,
+     int cache_policy,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_file_set_arena_block_size(
+     libevt_file_t *file,
+     size_t block_size,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_file_get_cache_statistics(
+     libevt_file_t *file,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error );
+
 LIBEVT_EXTERN \
 int libevt_file_get_format_version(
      libevt_file_t *file,
@@ -195,6 +361,12 @@ int libevt_file_get_number_of_recovered_records(
      int *number_of_records,
      libcerror_error_t **error );
 
+LIBEVT_EXTERN \
+int libevt_file_get_number_of_duplicate_recovered_records(
+     libevt_file_t *file,
+     int *number_of_records,
+     libcerror_error_t **error );
+
 LIBEVT_EXTERN \
 int libevt_file_get_recovered_record(
      libevt_file_t *file,
@@ -209,6 +381,108 @@ int libevt_file_get_recovered_record_by_index(
      libevt_record_t **record,
      libcerror_error_t **error );
 
+LIBEVT_EXTERN \
+int libevt_file_get_record_by_identifier(
+     libevt_file_t *file,
+     uint32_t record_identifier,
+     libevt_record_t **record,
+     libcerror_error_t **error );
+
+int libevt_file_read_time_index(
+     libevt_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_file_get_records_in_time_range(
+     libevt_file_t *file,
+     uint32_t start_time,
+     uint32_t end_time,
+     int (*callback_function)(
+            libevt_record_t *record,
+            int record_index,
+            void *user_data,
+            libcerror_error_t **error ),
+     void *user_data,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_file_get_record_columns(
+     libevt_file_t *file,
+     int first_record_index,
+     int number_of_records,
+     uint32_t *record_numbers,
+     uint32_t *creation_times,
+     uint32_t *written_times,
+     uint32_t *event_identifiers,
+     uint16_t *event_types,
+     uint16_t *event_categories,
+     off64_t *record_offsets,
+     libcerror_error_t **error );
+
+int libevt_file_get_cached_record_values(
+     libevt_internal_file_t *internal_file,
+     int records_list_index,
+     int record_index,
+     off64_t record_offset,
+     libevt_record_values_t **record_values,
+     int *cache_entry_index,
+     libcerror_error_t **error );
+
+int libevt_file_get_record_values_by_index(
+     libevt_internal_file_t *internal_file,
+     libfdata_list_t *records_list,
+     int record_index,
+     libevt_record_values_t **record_values,
+     libcerror_error_t **error );
+
+int libevt_file_read_record_view(
+     libevt_internal_file_t *internal_file,
+     libfdata_list_t *records_list,
+     int record_index,
+     libevt_internal_record_view_t *internal_record_view,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_file_get_record_view_by_index(
+     libevt_file_t *file,
+     int record_index,
+     libevt_record_view_t *record_view,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_file_get_recovered_record_view_by_index(
+     libevt_file_t *file,
+     int record_index,
+     libevt_record_view_t *record_view,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_file_parse_records_parallel(
+     libevt_file_t *file,
+     int number_of_threads,
+     int (*callback_function)(
+            libevt_record_t *record,
+            int record_index,
+            void *user_data,
+            libcerror_error_t **error ),
+     void *user_data,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_file_parse_records_with_filter(
+     libevt_file_t *file,
+     libevt_filter_t *filter,
+     int number_of_threads,
+     int (*callback_function)(
+            libevt_record_t *record,
+            int record_index,
+            void *user_data,
+            libcerror_error_t **error ),
+     void *user_data,
+     uint8_t flags,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
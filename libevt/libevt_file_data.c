@@ -0,0 +1,377 @@
+/*
+ * File data functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevt_file_data.h"
+#include "libevt_libcerror.h"
+#include "libevt_libcthreads.h"
+
+/* Creates file data
+ * Make sure the value file_data is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_data_initialize(
+     libevt_file_data_t **file_data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_file_data_initialize";
+
+	if( file_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*file_data = memory_allocate_structure(
+	              libevt_file_data_t );
+
+	if( *file_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *file_data,
+	     0,
+	     sizeof( libevt_file_data_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file data.",
+		 function );
+
+		memory_free(
+		 *file_data );
+
+		*file_data = NULL;
+
+		return( -1 );
+	}
+	( *file_data )->data = (uint8_t *) memory_allocate(
+	                                    sizeof( uint8_t ) * data_size );
+
+	if( ( *file_data )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	( *file_data )->data_size            = data_size;
+	( *file_data )->number_of_references = 1;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *file_data )->references_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize references mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *file_data != NULL )
+	{
+		if( ( *file_data )->data != NULL )
+		{
+			memory_free(
+			 ( *file_data )->data );
+		}
+		memory_free(
+		 *file_data );
+
+		*file_data = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees file data
+ * The file data is shared by reference, the file data is only freed
+ * when the last reference is released
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_data_free(
+     libevt_file_data_t **file_data,
+     libcerror_error_t **error )
+{
+	libevt_file_data_t *safe_file_data = NULL;
+	static char *function              = "libevt_file_data_free";
+	int number_of_references           = 0;
+	int result                         = 1;
+
+	if( file_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_data != NULL )
+	{
+		safe_file_data = *file_data;
+		*file_data     = NULL;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     safe_file_data->references_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab references mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		safe_file_data->number_of_references -= 1;
+
+		number_of_references = safe_file_data->number_of_references;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     safe_file_data->references_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release references mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( number_of_references > 0 )
+		{
+			return( 1 );
+		}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+		if( safe_file_data->references_mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( safe_file_data->references_mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free references mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		if( safe_file_data->data != NULL )
+		{
+			memory_free(
+			 safe_file_data->data );
+		}
+		memory_free(
+		 safe_file_data );
+	}
+	return( result );
+}
+
+/* Adds a reference to the file data
+ * Every reference must be released with libevt_file_data_free
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_data_add_reference(
+     libevt_file_data_t *file_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_file_data_add_reference";
+
+	if( file_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file data.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     file_data->references_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab references mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	file_data->number_of_references += 1;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     file_data->references_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release references mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of references to the file data
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_data_get_number_of_references(
+     libevt_file_data_t *file_data,
+     int *number_of_references,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_file_data_get_number_of_references";
+
+	if( file_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file data.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_references == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of references.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     file_data->references_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab references mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_references = file_data->number_of_references;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     file_data->references_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release references mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
@@ -0,0 +1,81 @@
+/*
+ * File data functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVT_FILE_DATA_H )
+#define _LIBEVT_FILE_DATA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevt_libcerror.h"
+#include "libevt_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevt_file_data libevt_file_data_t;
+
+struct libevt_file_data
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The number of references
+	 */
+	int number_of_references;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	/* The references mutex
+	 */
+	libcthreads_mutex_t *references_mutex;
+#endif
+};
+
+int libevt_file_data_initialize(
+     libevt_file_data_t **file_data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libevt_file_data_free(
+     libevt_file_data_t **file_data,
+     libcerror_error_t **error );
+
+int libevt_file_data_add_reference(
+     libevt_file_data_t *file_data,
+     libcerror_error_t **error );
+
+int libevt_file_data_get_number_of_references(
+     libevt_file_data_t *file_data,
+     int *number_of_references,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVT_FILE_DATA_H ) */
+
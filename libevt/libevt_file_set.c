@@ -0,0 +1,1568 @@
+/*
+ * File set functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevt_definitions.h"
+#include "libevt_event_record.h"
+#include "libevt_file.h"
+#include "libevt_file_set.h"
+#include "libevt_libcerror.h"
+#include "libevt_libcthreads.h"
+#include "libevt_record.h"
+#include "libevt_record_values.h"
+#include "libevt_time_index.h"
+
+/* Creates a file set
+ * Make sure the value file_set is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_set_initialize(
+     libevt_file_set_t **file_set,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_set_t *internal_file_set = NULL;
+	static char *function                         = "libevt_file_set_initialize";
+
+	if( file_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file set.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_set != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file set value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_set = memory_allocate_structure(
+	                     libevt_internal_file_set_t );
+
+	if( internal_file_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file set.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_file_set,
+	     0,
+	     sizeof( libevt_internal_file_set_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file set.",
+		 function );
+
+		memory_free(
+		 internal_file_set );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_file_set->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*file_set = (libevt_file_set_t *) internal_file_set;
+
+	return( 1 );
+
+on_error:
+	if( internal_file_set != NULL )
+	{
+		memory_free(
+		 internal_file_set );
+	}
+	return( -1 );
+}
+
+/* Frees a file set
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_set_free(
+     libevt_file_set_t **file_set,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_set_t *internal_file_set = NULL;
+	static char *function                         = "libevt_file_set_free";
+	int result                                    = 1;
+
+	if( file_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file set.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_set != NULL )
+	{
+		internal_file_set = (libevt_internal_file_set_t *) *file_set;
+
+		if( internal_file_set->files != NULL )
+		{
+			if( libevt_file_set_close(
+			     *file_set,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file set.",
+				 function );
+
+				result = -1;
+			}
+		}
+		*file_set = NULL;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_file_set->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 internal_file_set );
+	}
+	return( result );
+}
+
+/* Frees an array of files
+ * The files are closed if open
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_set_free_files(
+     libevt_file_t ***files,
+     int number_of_files,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_file_set_free_files";
+	int file_index        = 0;
+	int result            = 1;
+
+	if( files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid files.",
+		 function );
+
+		return( -1 );
+	}
+	if( *files != NULL )
+	{
+		for( file_index = 0;
+		     file_index < number_of_files;
+		     file_index++ )
+		{
+			if( ( *files )[ file_index ] == NULL )
+			{
+				continue;
+			}
+			if( libevt_file_free(
+			     &( ( *files )[ file_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file: %d.",
+				 function,
+				 file_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *files );
+
+		*files = NULL;
+	}
+	return( result );
+}
+
+/* Opens a set of files
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_set_open(
+     libevt_file_set_t *file_set,
+     char * const filenames[],
+     int number_of_filenames,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libevt_file_t **files                         = NULL;
+	libevt_internal_file_set_t *internal_file_set = NULL;
+	static char *function                         = "libevt_file_set_open";
+	int file_index                                = 0;
+
+	if( file_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_set = (libevt_internal_file_set_t *) file_set;
+
+	if( internal_file_set->files != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file set - files value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filenames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filenames.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_filenames <= 0 )
+	 || ( (size_t) number_of_filenames > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libevt_file_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of filenames value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	files = (libevt_file_t **) memory_allocate(
+	                            sizeof( libevt_file_t * ) * (size_t) number_of_filenames );
+
+	if( files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create files.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     files,
+	     0,
+	     sizeof( libevt_file_t * ) * (size_t) number_of_filenames ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear files.",
+		 function );
+
+		goto on_error;
+	}
+	for( file_index = 0;
+	     file_index < number_of_filenames;
+	     file_index++ )
+	{
+		if( libevt_file_initialize(
+		     &( files[ file_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file: %d.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		if( libevt_file_open(
+		     files[ file_index ],
+		     filenames[ file_index ],
+		     access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file: %d.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_file_set->files           = files;
+	internal_file_set->number_of_files = number_of_filenames;
+
+	if( libevt_file_set_open_read(
+	     internal_file_set,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file set.",
+		 function );
+
+		internal_file_set->files           = NULL;
+		internal_file_set->number_of_files = 0;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+		libcthreads_read_write_lock_release_for_write(
+		 internal_file_set->read_write_lock,
+		 NULL );
+#endif
+		goto on_error;
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		internal_file_set->files           = NULL;
+		internal_file_set->number_of_files = 0;
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( files != NULL )
+	{
+		libevt_file_set_free_files(
+		 &files,
+		 number_of_filenames,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens a set of files
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_set_open_wide(
+     libevt_file_set_t *file_set,
+     wchar_t * const filenames[],
+     int number_of_filenames,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libevt_file_t **files                         = NULL;
+	libevt_internal_file_set_t *internal_file_set = NULL;
+	static char *function                         = "libevt_file_set_open_wide";
+	int file_index                                = 0;
+
+	if( file_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_set = (libevt_internal_file_set_t *) file_set;
+
+	if( internal_file_set->files != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file set - files value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filenames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filenames.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_filenames <= 0 )
+	 || ( (size_t) number_of_filenames > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libevt_file_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of filenames value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	files = (libevt_file_t **) memory_allocate(
+	                            sizeof( libevt_file_t * ) * (size_t) number_of_filenames );
+
+	if( files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create files.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     files,
+	     0,
+	     sizeof( libevt_file_t * ) * (size_t) number_of_filenames ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear files.",
+		 function );
+
+		goto on_error;
+	}
+	for( file_index = 0;
+	     file_index < number_of_filenames;
+	     file_index++ )
+	{
+		if( libevt_file_initialize(
+		     &( files[ file_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file: %d.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		if( libevt_file_open_wide(
+		     files[ file_index ],
+		     filenames[ file_index ],
+		     access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file: %d.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_file_set->files           = files;
+	internal_file_set->number_of_files = number_of_filenames;
+
+	if( libevt_file_set_open_read(
+	     internal_file_set,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file set.",
+		 function );
+
+		internal_file_set->files           = NULL;
+		internal_file_set->number_of_files = 0;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+		libcthreads_read_write_lock_release_for_write(
+		 internal_file_set->read_write_lock,
+		 NULL );
+#endif
+		goto on_error;
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		internal_file_set->files           = NULL;
+		internal_file_set->number_of_files = 0;
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( files != NULL )
+	{
+		libevt_file_set_free_files(
+		 &files,
+		 number_of_filenames,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Reads the written time indexes of the files and builds the heap of runs
+ * Every run of records with non-decreasing written times in a file is merged
+ * as a separate sorted sequence, hence the records are returned in written
+ * time order even if the clock of the system was set back
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_set_open_read(
+     libevt_internal_file_set_t *internal_file_set,
+     libcerror_error_t **error )
+{
+	libevt_file_set_heap_entry_t *heap    = NULL;
+	libevt_internal_file_t *internal_file = NULL;
+	libevt_time_index_t *time_index       = NULL;
+	static char *function                 = "libevt_file_set_open_read";
+	int file_index                        = 0;
+	int heap_index                        = 0;
+	int number_of_heap_entries            = 0;
+	int run_index                         = 0;
+
+	if( internal_file_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_set->heap != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file set - heap value already set.",
+		 function );
+
+		return( -1 );
+	}
+	for( file_index = 0;
+	     file_index < internal_file_set->number_of_files;
+	     file_index++ )
+	{
+		internal_file = (libevt_internal_file_t *) internal_file_set->files[ file_index ];
+
+		/* The files are only accessible by the file set hence
+		 * the read/write lock of the file is not needed
+		 */
+		if( libevt_file_read_time_index(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read time index of file: %d.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		if( (size_t) internal_file->time_index->number_of_runs > ( ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libevt_file_set_heap_entry_t ) ) - (size_t) number_of_heap_entries ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of heap entries value exceeds maximum allocation size.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_heap_entries += internal_file->time_index->number_of_runs;
+	}
+	if( number_of_heap_entries > 0 )
+	{
+		heap = (libevt_file_set_heap_entry_t *) memory_allocate(
+		                                         sizeof( libevt_file_set_heap_entry_t ) * (size_t) number_of_heap_entries );
+
+		if( heap == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create heap.",
+			 function );
+
+			goto on_error;
+		}
+		for( file_index = 0;
+		     file_index < internal_file_set->number_of_files;
+		     file_index++ )
+		{
+			internal_file = (libevt_internal_file_t *) internal_file_set->files[ file_index ];
+			time_index    = internal_file->time_index;
+
+			for( run_index = 0;
+			     run_index < time_index->number_of_runs;
+			     run_index++ )
+			{
+				heap[ heap_index ].file_index  = file_index;
+				heap[ heap_index ].entry_index = time_index->run_start_indexes[ run_index ];
+
+				if( ( run_index + 1 ) < time_index->number_of_runs )
+				{
+					heap[ heap_index ].end_entry_index = time_index->run_start_indexes[ run_index + 1 ];
+				}
+				else
+				{
+					heap[ heap_index ].end_entry_index = time_index->number_of_entries;
+				}
+				heap[ heap_index ].written_time = time_index->entries[ heap[ heap_index ].entry_index ].written_time;
+
+				heap_index++;
+			}
+		}
+		for( heap_index = ( number_of_heap_entries / 2 ) - 1;
+		     heap_index >= 0;
+		     heap_index-- )
+		{
+			if( libevt_file_set_heap_sift_down(
+			     heap,
+			     number_of_heap_entries,
+			     heap_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to sift down heap entry: %d.",
+				 function,
+				 heap_index );
+
+				goto on_error;
+			}
+		}
+	}
+	internal_file_set->heap                        = heap;
+	internal_file_set->number_of_heap_entries      = number_of_heap_entries;
+	internal_file_set->number_of_record_keys       = 0;
+	internal_file_set->source_names_size           = 0;
+	internal_file_set->number_of_duplicate_records = 0;
+
+	return( 1 );
+
+on_error:
+	if( heap != NULL )
+	{
+		memory_free(
+		 heap );
+	}
+	return( -1 );
+}
+
+/* Closes a file set
+ * Returns 0 if successful or -1 on error
+ */
+int libevt_file_set_close(
+     libevt_file_set_t *file_set,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_set_t *internal_file_set = NULL;
+	static char *function                         = "libevt_file_set_close";
+	int result                                    = 0;
+
+	if( file_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_set = (libevt_internal_file_set_t *) file_set;
+
+	if( internal_file_set->files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file set - missing files.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libevt_file_set_free_files(
+	     &( internal_file_set->files ),
+	     internal_file_set->number_of_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free files.",
+		 function );
+
+		result = -1;
+	}
+	internal_file_set->number_of_files = 0;
+
+	if( internal_file_set->heap != NULL )
+	{
+		memory_free(
+		 internal_file_set->heap );
+
+		internal_file_set->heap = NULL;
+	}
+	internal_file_set->number_of_heap_entries = 0;
+
+	if( internal_file_set->record_keys != NULL )
+	{
+		memory_free(
+		 internal_file_set->record_keys );
+
+		internal_file_set->record_keys = NULL;
+	}
+	internal_file_set->number_of_record_keys         = 0;
+	internal_file_set->maximum_number_of_record_keys = 0;
+
+	if( internal_file_set->source_names != NULL )
+	{
+		memory_free(
+		 internal_file_set->source_names );
+
+		internal_file_set->source_names = NULL;
+	}
+	internal_file_set->source_names_size           = 0;
+	internal_file_set->maximum_source_names_size   = 0;
+	internal_file_set->number_of_duplicate_records = 0;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Moves a heap entry down until it is not after any of its children
+ * The heap entries are ordered by written time, then by file index and
+ * then by entry index, so that records with the same written time are
+ * returned in a deterministic order
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_set_heap_sift_down(
+     libevt_file_set_heap_entry_t *heap,
+     int number_of_heap_entries,
+     int heap_index,
+     libcerror_error_t **error )
+{
+	libevt_file_set_heap_entry_t heap_entry;
+
+	static char *function = "libevt_file_set_heap_sift_down";
+	int child_index       = 0;
+
+	if( heap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid heap.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( heap_index < 0 )
+	 || ( heap_index >= number_of_heap_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid heap index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	heap_entry = heap[ heap_index ];
+
+	while( heap_index < ( number_of_heap_entries / 2 ) )
+	{
+		child_index = ( 2 * heap_index ) + 1;
+
+		if( ( ( child_index + 1 ) < number_of_heap_entries )
+		 && ( ( heap[ child_index + 1 ].written_time < heap[ child_index ].written_time )
+		  || ( ( heap[ child_index + 1 ].written_time == heap[ child_index ].written_time )
+		   && ( ( heap[ child_index + 1 ].file_index < heap[ child_index ].file_index )
+		    || ( ( heap[ child_index + 1 ].file_index == heap[ child_index ].file_index )
+		     && ( heap[ child_index + 1 ].entry_index < heap[ child_index ].entry_index ) ) ) ) ) )
+		{
+			child_index += 1;
+		}
+		if( ( heap_entry.written_time < heap[ child_index ].written_time )
+		 || ( ( heap_entry.written_time == heap[ child_index ].written_time )
+		  && ( ( heap_entry.file_index < heap[ child_index ].file_index )
+		   || ( ( heap_entry.file_index == heap[ child_index ].file_index )
+		    && ( heap_entry.entry_index < heap[ child_index ].entry_index ) ) ) ) )
+		{
+			break;
+		}
+		heap[ heap_index ] = heap[ child_index ];
+
+		heap_index = child_index;
+	}
+	heap[ heap_index ] = heap_entry;
+
+	return( 1 );
+}
+
+/* Determines if a record duplicates a record that was previously returned
+ * A record is a duplicate if its source name, record number and written time
+ * match those of a previously returned record. Since the records are returned
+ * in written time order only the keys of the records with the same written
+ * time need to be retained. The key of a record that is not a duplicate is
+ * added to the record keys.
+ * Returns 1 if the record is a duplicate, 0 if not or -1 on error
+ */
+int libevt_file_set_is_duplicate_record(
+     libevt_internal_file_set_t *internal_file_set,
+     uint32_t written_time,
+     libevt_record_values_t *record_values,
+     libcerror_error_t **error )
+{
+	libevt_file_set_record_key_t *record_keys = NULL;
+	uint8_t *source_name                      = NULL;
+	uint8_t *source_names                     = NULL;
+	static char *function                     = "libevt_file_set_is_duplicate_record";
+	size_t maximum_source_names_size          = 0;
+	size_t source_name_size                   = 0;
+	uint32_t record_number                    = 0;
+	int key_index                             = 0;
+	int maximum_number_of_record_keys         = 0;
+
+	if( internal_file_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevt_record_values_get_number(
+	     record_values,
+	     &record_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record number.",
+		 function );
+
+		return( -1 );
+	}
+	source_name      = record_values->event_record->source_name;
+	source_name_size = record_values->event_record->source_name_size;
+
+	if( source_name == NULL )
+	{
+		source_name_size = 0;
+	}
+	if( ( internal_file_set->number_of_record_keys == 0 )
+	 || ( internal_file_set->record_keys_written_time != written_time ) )
+	{
+		internal_file_set->record_keys_written_time = written_time;
+		internal_file_set->number_of_record_keys    = 0;
+		internal_file_set->source_names_size        = 0;
+	}
+	for( key_index = 0;
+	     key_index < internal_file_set->number_of_record_keys;
+	     key_index++ )
+	{
+		if( ( internal_file_set->record_keys[ key_index ].record_number == record_number )
+		 && ( internal_file_set->record_keys[ key_index ].source_name_size == source_name_size ) )
+		{
+			if( source_name_size == 0 )
+			{
+				return( 1 );
+			}
+			if( memory_compare(
+			     &( internal_file_set->source_names[ internal_file_set->record_keys[ key_index ].source_name_offset ] ),
+			     source_name,
+			     source_name_size ) == 0 )
+			{
+				return( 1 );
+			}
+		}
+	}
+	if( internal_file_set->number_of_record_keys >= internal_file_set->maximum_number_of_record_keys )
+	{
+		if( internal_file_set->maximum_number_of_record_keys == 0 )
+		{
+			maximum_number_of_record_keys = 16;
+		}
+		else if( (size_t) internal_file_set->maximum_number_of_record_keys >= ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( libevt_file_set_record_key_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid file set - maximum number of record keys value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			maximum_number_of_record_keys = 2 * internal_file_set->maximum_number_of_record_keys;
+		}
+		record_keys = (libevt_file_set_record_key_t *) memory_reallocate(
+		                                                internal_file_set->record_keys,
+		                                                sizeof( libevt_file_set_record_key_t ) * (size_t) maximum_number_of_record_keys );
+
+		if( record_keys == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize record keys.",
+			 function );
+
+			return( -1 );
+		}
+		internal_file_set->record_keys                   = record_keys;
+		internal_file_set->maximum_number_of_record_keys = maximum_number_of_record_keys;
+	}
+	if( source_name_size > ( internal_file_set->maximum_source_names_size - internal_file_set->source_names_size ) )
+	{
+		maximum_source_names_size = internal_file_set->source_names_size + source_name_size;
+
+		if( maximum_source_names_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid source names size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		maximum_source_names_size *= 2;
+
+		source_names = (uint8_t *) memory_reallocate(
+		                            internal_file_set->source_names,
+		                            sizeof( uint8_t ) * maximum_source_names_size );
+
+		if( source_names == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize source names.",
+			 function );
+
+			return( -1 );
+		}
+		internal_file_set->source_names              = source_names;
+		internal_file_set->maximum_source_names_size = maximum_source_names_size;
+	}
+	if( source_name_size > 0 )
+	{
+		if( memory_copy(
+		     &( internal_file_set->source_names[ internal_file_set->source_names_size ] ),
+		     source_name,
+		     source_name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy source name.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	key_index = internal_file_set->number_of_record_keys;
+
+	internal_file_set->record_keys[ key_index ].record_number      = record_number;
+	internal_file_set->record_keys[ key_index ].source_name_offset = internal_file_set->source_names_size;
+	internal_file_set->record_keys[ key_index ].source_name_size   = source_name_size;
+
+	internal_file_set->source_names_size     += source_name_size;
+	internal_file_set->number_of_record_keys += 1;
+
+	return( 0 );
+}
+
+/* Retrieves the number of files
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_set_get_number_of_files(
+     libevt_file_set_t *file_set,
+     int *number_of_files,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_set_t *internal_file_set = NULL;
+	static char *function                         = "libevt_file_set_get_number_of_files";
+
+	if( file_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_set = (libevt_internal_file_set_t *) file_set;
+
+	if( number_of_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of files.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_files = internal_file_set->number_of_files;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of duplicate records that were skipped
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_set_get_number_of_duplicate_records(
+     libevt_file_set_t *file_set,
+     int *number_of_duplicate_records,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_set_t *internal_file_set = NULL;
+	static char *function                         = "libevt_file_set_get_number_of_duplicate_records";
+
+	if( file_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_set = (libevt_internal_file_set_t *) file_set;
+
+	if( number_of_duplicate_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of duplicate records.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_duplicate_records = internal_file_set->number_of_duplicate_records;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the next record of the file set
+ * The records of all files are returned in order of their last written time,
+ * records that duplicate a previously returned record are skipped
+ * Returns 1 if successful, 0 if no more records are available or -1 on error
+ */
+int libevt_file_set_get_next_record(
+     libevt_file_set_t *file_set,
+     int *file_index,
+     libevt_record_t **record,
+     libcerror_error_t **error )
+{
+	libevt_file_set_heap_entry_t *heap_entry      = NULL;
+	libevt_internal_file_t *internal_file         = NULL;
+	libevt_internal_file_set_t *internal_file_set = NULL;
+	libevt_record_values_t *record_values         = NULL;
+	libevt_time_index_entry_t *time_index_entry   = NULL;
+	static char *function                         = "libevt_file_set_get_next_record";
+	uint32_t written_time                         = 0;
+	int record_index                              = 0;
+	int result                                    = 0;
+	int safe_file_index                           = 0;
+
+	if( file_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_set = (libevt_internal_file_set_t *) file_set;
+
+	if( internal_file_set->files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file set - missing files.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file index.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	while( internal_file_set->number_of_heap_entries > 0 )
+	{
+		heap_entry       = &( internal_file_set->heap[ 0 ] );
+		safe_file_index  = heap_entry->file_index;
+		internal_file    = (libevt_internal_file_t *) internal_file_set->files[ safe_file_index ];
+		time_index_entry = &( internal_file->time_index->entries[ heap_entry->entry_index ] );
+		written_time     = time_index_entry->written_time;
+		record_index     = time_index_entry->record_index;
+
+		heap_entry->entry_index += 1;
+
+		if( heap_entry->entry_index < heap_entry->end_entry_index )
+		{
+			heap_entry->written_time = internal_file->time_index->entries[ heap_entry->entry_index ].written_time;
+		}
+		else
+		{
+			internal_file_set->number_of_heap_entries -= 1;
+
+			internal_file_set->heap[ 0 ] = internal_file_set->heap[ internal_file_set->number_of_heap_entries ];
+		}
+		if( internal_file_set->number_of_heap_entries > 0 )
+		{
+			if( libevt_file_set_heap_sift_down(
+			     internal_file_set->heap,
+			     internal_file_set->number_of_heap_entries,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to sift down heap entry: 0.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+		}
+		if( libevt_file_get_record_values_by_index(
+		     internal_file,
+		     internal_file->records_list,
+		     record_index,
+		     &record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record values: %d of file: %d.",
+			 function,
+			 record_index,
+			 safe_file_index );
+
+			result = -1;
+
+			break;
+		}
+		result = libevt_file_set_is_duplicate_record(
+		          internal_file_set,
+		          written_time,
+		          record_values,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if record: %d of file: %d is a duplicate.",
+			 function,
+			 record_index,
+			 safe_file_index );
+
+			libevt_record_values_free(
+			 &record_values,
+			 NULL );
+
+			break;
+		}
+		else if( result != 0 )
+		{
+			internal_file_set->number_of_duplicate_records += 1;
+
+			if( libevt_record_values_free(
+			     &record_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record values.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+			result = 0;
+
+			continue;
+		}
+		if( libevt_record_initialize(
+		     record,
+		     internal_file->io_handle,
+		     internal_file->file_io_handle,
+		     record_values,
+		     LIBEVT_RECORD_FLAG_MANAGED_RECORD_VALUES,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record.",
+			 function );
+
+			libevt_record_values_free(
+			 &record_values,
+			 NULL );
+
+			result = -1;
+
+			break;
+		}
+		*file_index = safe_file_index;
+
+		result = 1;
+
+		break;
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_set->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		if( *record != NULL )
+		{
+			libevt_record_free(
+			 record,
+			 NULL );
+		}
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
@@ -0,0 +1,215 @@
+/*
+ * File set functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVT_FILE_SET_H )
+#define _LIBEVT_FILE_SET_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevt_extern.h"
+#include "libevt_libcerror.h"
+#include "libevt_libcthreads.h"
+#include "libevt_record_values.h"
+#include "libevt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevt_file_set_heap_entry libevt_file_set_heap_entry_t;
+
+struct libevt_file_set_heap_entry
+{
+	/* The last written time of the current entry
+	 */
+	uint32_t written_time;
+
+	/* The file index
+	 */
+	int file_index;
+
+	/* The current time index entry index
+	 */
+	int entry_index;
+
+	/* The time index entry index at which the run ends
+	 */
+	int end_entry_index;
+};
+
+typedef struct libevt_file_set_record_key libevt_file_set_record_key_t;
+
+struct libevt_file_set_record_key
+{
+	/* The record number
+	 */
+	uint32_t record_number;
+
+	/* The offset of the source name in the source names buffer
+	 */
+	size_t source_name_offset;
+
+	/* The source name size
+	 */
+	size_t source_name_size;
+};
+
+typedef struct libevt_internal_file_set libevt_internal_file_set_t;
+
+struct libevt_internal_file_set
+{
+	/* The files
+	 */
+	libevt_file_t **files;
+
+	/* The number of files
+	 */
+	int number_of_files;
+
+	/* The heap of runs, ordered by the written time of their current entry
+	 */
+	libevt_file_set_heap_entry_t *heap;
+
+	/* The number of heap entries
+	 */
+	int number_of_heap_entries;
+
+	/* The last written time of the record keys
+	 */
+	uint32_t record_keys_written_time;
+
+	/* The keys of the records returned with the same last written time
+	 */
+	libevt_file_set_record_key_t *record_keys;
+
+	/* The number of record keys
+	 */
+	int number_of_record_keys;
+
+	/* The maximum number of record keys
+	 */
+	int maximum_number_of_record_keys;
+
+	/* The source names of the record keys
+	 */
+	uint8_t *source_names;
+
+	/* The source names size
+	 */
+	size_t source_names_size;
+
+	/* The maximum source names size
+	 */
+	size_t maximum_source_names_size;
+
+	/* The number of duplicate records
+	 */
+	int number_of_duplicate_records;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+LIBEVT_EXTERN \
+int libevt_file_set_initialize(
+     libevt_file_set_t **file_set,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_file_set_free(
+     libevt_file_set_t **file_set,
+     libcerror_error_t **error );
+
+int libevt_file_set_free_files(
+     libevt_file_t ***files,
+     int number_of_files,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_file_set_open(
+     libevt_file_set_t *file_set,
+     char * const filenames[],
+     int number_of_filenames,
+     int access_flags,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBEVT_EXTERN \
+int libevt_file_set_open_wide(
+     libevt_file_set_t *file_set,
+     wchar_t * const filenames[],
+     int number_of_filenames,
+     int access_flags,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+int libevt_file_set_open_read(
+     libevt_internal_file_set_t *internal_file_set,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_file_set_close(
+     libevt_file_set_t *file_set,
+     libcerror_error_t **error );
+
+int libevt_file_set_heap_sift_down(
+     libevt_file_set_heap_entry_t *heap,
+     int number_of_heap_entries,
+     int heap_index,
+     libcerror_error_t **error );
+
+int libevt_file_set_is_duplicate_record(
+     libevt_internal_file_set_t *internal_file_set,
+     uint32_t written_time,
+     libevt_record_values_t *record_values,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_file_set_get_number_of_files(
+     libevt_file_set_t *file_set,
+     int *number_of_files,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_file_set_get_number_of_duplicate_records(
+     libevt_file_set_t *file_set,
+     int *number_of_duplicate_records,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_file_set_get_next_record(
+     libevt_file_set_t *file_set,
+     int *file_index,
+     libevt_record_t **record,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVT_FILE_SET_H ) */
+
@@ -0,0 +1,873 @@
+/*
+ * Record filter functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevt_definitions.h"
+#include "libevt_filter.h"
+#include "libevt_io_handle.h"
+#include "libevt_libbfio.h"
+#include "libevt_libcerror.h"
+#include "libevt_libuna.h"
+#include "libevt_types.h"
+
+#include "evt_event_record.h"
+
+/* Creates a filter
+ * Make sure the value filter is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_filter_initialize(
+     libevt_filter_t **filter,
+     libcerror_error_t **error )
+{
+	libevt_internal_filter_t *internal_filter = NULL;
+	static char *function                     = "libevt_filter_initialize";
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid filter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter = memory_allocate_structure(
+	                   libevt_internal_filter_t );
+
+	if( internal_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_filter,
+	     0,
+	     sizeof( libevt_internal_filter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear filter.",
+		 function );
+
+		goto on_error;
+	}
+	*filter = (libevt_filter_t *) internal_filter;
+
+	return( 1 );
+
+on_error:
+	if( internal_filter != NULL )
+	{
+		memory_free(
+		 internal_filter );
+	}
+	return( -1 );
+}
+
+/* Frees a filter
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_filter_free(
+     libevt_filter_t **filter,
+     libcerror_error_t **error )
+{
+	libevt_internal_filter_t *internal_filter = NULL;
+	static char *function                     = "libevt_filter_free";
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filter != NULL )
+	{
+		internal_filter = (libevt_internal_filter_t *) *filter;
+		*filter         = NULL;
+
+		if( internal_filter->source_name != NULL )
+		{
+			memory_free(
+			 internal_filter->source_name );
+		}
+		if( internal_filter->event_identifiers != NULL )
+		{
+			memory_free(
+			 internal_filter->event_identifiers );
+		}
+		memory_free(
+		 internal_filter );
+	}
+	return( 1 );
+}
+
+/* Adds an event identifier to the filter
+ * A record matches if its event identifier or event code, the lower 16 bits
+ * of the event identifier, equals one of the event identifiers of the filter
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_filter_add_event_identifier(
+     libevt_filter_t *filter,
+     uint32_t event_identifier,
+     libcerror_error_t **error )
+{
+	libevt_internal_filter_t *internal_filter = NULL;
+	uint32_t *event_identifiers               = NULL;
+	static char *function                     = "libevt_filter_add_event_identifier";
+	int entry_index                           = 0;
+	int insert_index                          = 0;
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter = (libevt_internal_filter_t *) filter;
+
+	if( libevt_filter_has_event_identifier(
+	     internal_filter,
+	     event_identifier ) != 0 )
+	{
+		return( 1 );
+	}
+	if( ( internal_filter->number_of_event_identifiers < 0 )
+	 || ( (size_t) internal_filter->number_of_event_identifiers >= ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint32_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filter - number of event identifiers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	event_identifiers = (uint32_t *) memory_reallocate(
+	                                  internal_filter->event_identifiers,
+	                                  sizeof( uint32_t ) * ( internal_filter->number_of_event_identifiers + 1 ) );
+
+	if( event_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize event identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter->event_identifiers = event_identifiers;
+
+	/* Keep the event identifiers sorted so they can be searched with a binary search
+	 */
+	insert_index = internal_filter->number_of_event_identifiers;
+
+	while( ( insert_index > 0 )
+	    && ( event_identifiers[ insert_index - 1 ] > event_identifier ) )
+	{
+		insert_index--;
+	}
+	for( entry_index = internal_filter->number_of_event_identifiers;
+	     entry_index > insert_index;
+	     entry_index-- )
+	{
+		event_identifiers[ entry_index ] = event_identifiers[ entry_index - 1 ];
+	}
+	event_identifiers[ insert_index ] = event_identifier;
+
+	internal_filter->number_of_event_identifiers += 1;
+
+	return( 1 );
+}
+
+/* Sets the event types of the filter
+ * A record matches if its event type is one of the event types, where
+ * event_types is a combination of the LIBEVT_EVENT_TYPES values
+ * Use LIBEVT_EVENT_TYPE_SUCCESS to match records with event type 0
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_filter_set_event_types(
+     libevt_filter_t *filter,
+     uint16_t event_types,
+     libcerror_error_t **error )
+{
+	libevt_internal_filter_t *internal_filter = NULL;
+	static char *function                     = "libevt_filter_set_event_types";
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter = (libevt_internal_filter_t *) filter;
+
+	internal_filter->event_types = event_types;
+	internal_filter->flags      |= LIBEVT_FILTER_FLAG_HAS_EVENT_TYPES;
+
+	return( 1 );
+}
+
+/* Sets the event category of the filter
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_filter_set_event_category(
+     libevt_filter_t *filter,
+     uint16_t event_category,
+     libcerror_error_t **error )
+{
+	libevt_internal_filter_t *internal_filter = NULL;
+	static char *function                     = "libevt_filter_set_event_category";
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter = (libevt_internal_filter_t *) filter;
+
+	internal_filter->event_category = event_category;
+	internal_filter->flags         |= LIBEVT_FILTER_FLAG_HAS_EVENT_CATEGORY;
+
+	return( 1 );
+}
+
+/* Sets the source name of the filter
+ * The source name is compared case-insensitive for the US-ASCII characters
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_filter_set_utf8_source_name(
+     libevt_filter_t *filter,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	libevt_internal_filter_t *internal_filter = NULL;
+	libuna_utf16_character_t *source_name     = NULL;
+	static char *function                     = "libevt_filter_set_utf8_source_name";
+	size_t source_name_length                 = 0;
+	size_t source_name_size                   = 0;
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter = (libevt_internal_filter_t *) filter;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_length == 0 )
+	 || ( utf8_string_length > (size_t) ( LIBEVT_FILTER_MAXIMUM_SOURCE_NAME_LENGTH * 4 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libuna_utf16_string_size_from_utf8(
+	     (libuna_utf8_character_t *) utf8_string,
+	     utf8_string_length,
+	     &source_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine source name size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( source_name_size == 0 )
+	 || ( source_name_size > (size_t) ( LIBEVT_FILTER_MAXIMUM_SOURCE_NAME_LENGTH + 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source name size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	source_name = (libuna_utf16_character_t *) memory_allocate(
+	                                            sizeof( libuna_utf16_character_t ) * source_name_size );
+
+	if( source_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create source name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libuna_utf16_string_copy_from_utf8(
+	     source_name,
+	     source_name_size,
+	     (libuna_utf8_character_t *) utf8_string,
+	     utf8_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy source name.",
+		 function );
+
+		goto on_error;
+	}
+	while( ( source_name_length < source_name_size )
+	    && ( source_name[ source_name_length ] != 0 ) )
+	{
+		source_name_length++;
+	}
+	if( source_name_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source name length value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_filter->source_name != NULL )
+	{
+		memory_free(
+		 internal_filter->source_name );
+	}
+	internal_filter->source_name        = source_name;
+	internal_filter->source_name_length = source_name_length;
+	internal_filter->flags             |= LIBEVT_FILTER_FLAG_HAS_SOURCE_NAME;
+
+	return( 1 );
+
+on_error:
+	if( source_name != NULL )
+	{
+		memory_free(
+		 source_name );
+	}
+	return( -1 );
+}
+
+/* Sets the source name of the filter
+ * The source name is compared case-insensitive for the US-ASCII characters
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_filter_set_utf16_source_name(
+     libevt_filter_t *filter,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error )
+{
+	libevt_internal_filter_t *internal_filter = NULL;
+	libuna_utf16_character_t *source_name     = NULL;
+	static char *function                     = "libevt_filter_set_utf16_source_name";
+	size_t source_name_length                 = 0;
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter = (libevt_internal_filter_t *) filter;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( source_name_length < utf16_string_length )
+	    && ( utf16_string[ source_name_length ] != 0 ) )
+	{
+		source_name_length++;
+	}
+	if( ( source_name_length == 0 )
+	 || ( source_name_length > (size_t) LIBEVT_FILTER_MAXIMUM_SOURCE_NAME_LENGTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	source_name = (libuna_utf16_character_t *) memory_allocate(
+	                                            sizeof( libuna_utf16_character_t ) * ( source_name_length + 1 ) );
+
+	if( source_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create source name.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     source_name,
+	     utf16_string,
+	     sizeof( libuna_utf16_character_t ) * source_name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source name.",
+		 function );
+
+		memory_free(
+		 source_name );
+
+		return( -1 );
+	}
+	source_name[ source_name_length ] = 0;
+
+	if( internal_filter->source_name != NULL )
+	{
+		memory_free(
+		 internal_filter->source_name );
+	}
+	internal_filter->source_name        = source_name;
+	internal_filter->source_name_length = source_name_length;
+	internal_filter->flags             |= LIBEVT_FILTER_FLAG_HAS_SOURCE_NAME;
+
+	return( 1 );
+}
+
+/* Sets the written time range of the filter
+ * The start and end time are POSIX timestamps and are both inclusive
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_filter_set_time_range(
+     libevt_filter_t *filter,
+     uint32_t start_time,
+     uint32_t end_time,
+     libcerror_error_t **error )
+{
+	libevt_internal_filter_t *internal_filter = NULL;
+	static char *function                     = "libevt_filter_set_time_range";
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter = (libevt_internal_filter_t *) filter;
+
+	if( start_time > end_time )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid start time value exceeds end time.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter->start_time = start_time;
+	internal_filter->end_time   = end_time;
+	internal_filter->flags     |= LIBEVT_FILTER_FLAG_HAS_TIME_RANGE;
+
+	return( 1 );
+}
+
+/* Determines if the filter contains a specific event identifier
+ * Returns 1 if the filter contains the event identifier or 0 if not
+ */
+int libevt_filter_has_event_identifier(
+     libevt_internal_filter_t *internal_filter,
+     uint32_t event_identifier )
+{
+	int entry_index = 0;
+	int lower_index = 0;
+	int upper_index = 0;
+
+	if( internal_filter == NULL )
+	{
+		return( 0 );
+	}
+	upper_index = internal_filter->number_of_event_identifiers;
+
+	while( lower_index < upper_index )
+	{
+		entry_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( internal_filter->event_identifiers[ entry_index ] == event_identifier )
+		{
+			return( 1 );
+		}
+		else if( internal_filter->event_identifiers[ entry_index ] < event_identifier )
+		{
+			lower_index = entry_index + 1;
+		}
+		else
+		{
+			upper_index = entry_index;
+		}
+	}
+	return( 0 );
+}
+
+/* Determines if event record data matches the filter
+ * The record data must contain the fixed-size part of the event record and,
+ * if the filter has a source name, the data of the source name that follows
+ * Only the fixed-size part and the source name are used, the rest of the
+ * record data is not parsed
+ * Returns 1 if the record data matches, 0 if not or -1 on error
+ */
+int libevt_filter_match_record_data(
+     libevt_internal_filter_t *internal_filter,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libevt_filter_match_record_data";
+	size_t record_data_offset = 0;
+	size_t source_name_index  = 0;
+	uint32_t event_identifier = 0;
+	uint32_t written_time     = 0;
+	uint16_t event_category   = 0;
+	uint16_t event_type       = 0;
+	uint16_t filter_character = 0;
+	uint16_t record_character = 0;
+
+	if( internal_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid record data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Records that are too small to be an event record never match
+	 */
+	if( record_data_size < sizeof( evt_event_record_t ) )
+	{
+		return( 0 );
+	}
+	if( internal_filter->number_of_event_identifiers > 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (evt_event_record_t *) record_data )->event_identifier,
+		 event_identifier );
+
+		if( ( libevt_filter_has_event_identifier(
+		       internal_filter,
+		       event_identifier ) == 0 )
+		 && ( ( ( event_identifier & 0xffff0000UL ) == 0 )
+		  ||  ( libevt_filter_has_event_identifier(
+		         internal_filter,
+		         event_identifier & 0x0000ffffUL ) == 0 ) ) )
+		{
+			return( 0 );
+		}
+	}
+	if( ( internal_filter->flags & LIBEVT_FILTER_FLAG_HAS_EVENT_TYPES ) != 0 )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (evt_event_record_t *) record_data )->event_type,
+		 event_type );
+
+		/* The success event type is 0 and is represented by its own flag
+		 */
+		if( event_type == 0 )
+		{
+			event_type = LIBEVT_EVENT_TYPE_SUCCESS;
+		}
+		if( ( event_type & internal_filter->event_types ) == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( ( internal_filter->flags & LIBEVT_FILTER_FLAG_HAS_EVENT_CATEGORY ) != 0 )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (evt_event_record_t *) record_data )->event_category,
+		 event_category );
+
+		if( event_category != internal_filter->event_category )
+		{
+			return( 0 );
+		}
+	}
+	if( ( internal_filter->flags & LIBEVT_FILTER_FLAG_HAS_TIME_RANGE ) != 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (evt_event_record_t *) record_data )->last_written_time,
+		 written_time );
+
+		if( ( written_time < internal_filter->start_time )
+		 || ( written_time > internal_filter->end_time ) )
+		{
+			return( 0 );
+		}
+	}
+	if( ( internal_filter->flags & LIBEVT_FILTER_FLAG_HAS_SOURCE_NAME ) != 0 )
+	{
+		/* The source name directly follows the fixed-size part of the event record
+		 */
+		record_data_offset = sizeof( evt_event_record_t );
+
+		if( ( internal_filter->source_name_length + 1 ) > ( ( record_data_size - record_data_offset ) / 2 ) )
+		{
+			return( 0 );
+		}
+		for( source_name_index = 0;
+		     source_name_index <= internal_filter->source_name_length;
+		     source_name_index++ )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( record_data[ record_data_offset ] ),
+			 record_character );
+
+			filter_character = internal_filter->source_name[ source_name_index ];
+
+			if( ( record_character >= (uint16_t) 'A' )
+			 && ( record_character <= (uint16_t) 'Z' ) )
+			{
+				record_character += (uint16_t) ( 'a' - 'A' );
+			}
+			if( ( filter_character >= (uint16_t) 'A' )
+			 && ( filter_character <= (uint16_t) 'Z' ) )
+			{
+				filter_character += (uint16_t) ( 'a' - 'A' );
+			}
+			if( record_character != filter_character )
+			{
+				return( 0 );
+			}
+			record_data_offset += 2;
+		}
+	}
+	return( 1 );
+}
+
+/* Determines if a record matches the filter
+ * Only the fixed-size part of the event record and the source name are read
+ * Returns 1 if the record matches, 0 if not or -1 on error
+ */
+int libevt_filter_match_record(
+     libevt_internal_filter_t *internal_filter,
+     libevt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t record_offset,
+     size64_t record_size,
+     libcerror_error_t **error )
+{
+	uint8_t record_data[ sizeof( evt_event_record_t ) + ( ( LIBEVT_FILTER_MAXIMUM_SOURCE_NAME_LENGTH + 1 ) * 2 ) ];
+
+	static char *function   = "libevt_filter_match_record";
+	size_t record_data_size = 0;
+	int result              = 0;
+
+	if( internal_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	/* The last 4 bytes of the record contain a copy of the record size
+	 */
+	if( record_size < (size64_t) ( sizeof( evt_event_record_t ) + 4 ) )
+	{
+		return( 0 );
+	}
+	record_data_size = sizeof( evt_event_record_t );
+
+	if( ( internal_filter->flags & LIBEVT_FILTER_FLAG_HAS_SOURCE_NAME ) != 0 )
+	{
+		record_data_size += ( internal_filter->source_name_length + 1 ) * 2;
+
+		if( (size64_t) record_data_size > ( record_size - 4 ) )
+		{
+			return( 0 );
+		}
+	}
+	if( libevt_io_handle_read_record_data(
+	     io_handle,
+	     file_io_handle,
+	     record_offset,
+	     0,
+	     record_data,
+	     record_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 record_offset,
+		 record_offset );
+
+		return( -1 );
+	}
+	result = libevt_filter_match_record_data(
+	          internal_filter,
+	          record_data,
+	          record_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to match record data.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
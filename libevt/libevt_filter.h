@@ -0,0 +1,152 @@
+/*
+ * Record filter functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVT_FILTER_H )
+#define _LIBEVT_FILTER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevt_extern.h"
+#include "libevt_io_handle.h"
+#include "libevt_libbfio.h"
+#include "libevt_libcerror.h"
+#include "libevt_libuna.h"
+#include "libevt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevt_internal_filter libevt_internal_filter_t;
+
+struct libevt_internal_filter
+{
+	/* The event identifiers, sorted in increasing order
+	 */
+	uint32_t *event_identifiers;
+
+	/* The number of event identifiers
+	 */
+	int number_of_event_identifiers;
+
+	/* The event types mask
+	 */
+	uint16_t event_types;
+
+	/* The event category
+	 */
+	uint16_t event_category;
+
+	/* The source name
+	 */
+	libuna_utf16_character_t *source_name;
+
+	/* The source name length, without the end-of-string character
+	 */
+	size_t source_name_length;
+
+	/* The start of the written time range
+	 */
+	uint32_t start_time;
+
+	/* The end of the written time range
+	 */
+	uint32_t end_time;
+
+	/* The filter flags
+	 */
+	uint8_t flags;
+};
+
+LIBEVT_EXTERN \
+int libevt_filter_initialize(
+     libevt_filter_t **filter,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_filter_free(
+     libevt_filter_t **filter,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_filter_add_event_identifier(
+     libevt_filter_t *filter,
+     uint32_t event_identifier,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_filter_set_event_types(
+     libevt_filter_t *filter,
+     uint16_t event_types,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_filter_set_event_category(
+     libevt_filter_t *filter,
+     uint16_t event_category,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_filter_set_utf8_source_name(
+     libevt_filter_t *filter,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_filter_set_utf16_source_name(
+     libevt_filter_t *filter,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_filter_set_time_range(
+     libevt_filter_t *filter,
+     uint32_t start_time,
+     uint32_t end_time,
+     libcerror_error_t **error );
+
+int libevt_filter_has_event_identifier(
+     libevt_internal_filter_t *internal_filter,
+     uint32_t event_identifier );
+
+int libevt_filter_match_record_data(
+     libevt_internal_filter_t *internal_filter,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     libcerror_error_t **error );
+
+int libevt_filter_match_record(
+     libevt_internal_filter_t *internal_filter,
+     libevt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t record_offset,
+     size64_t record_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVT_FILTER_H ) */
+
@@ -0,0 +1,492 @@
+/*
+ * Record identifier map functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libevt_identifier_map.h"
+#include "libevt_io_handle.h"
+#include "libevt_libbfio.h"
+#include "libevt_libcerror.h"
+#include "libevt_libfdata.h"
+
+#include "evt_event_record.h"
+
+/* Creates an identifier map
+ * Make sure the value identifier_map is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_identifier_map_initialize(
+     libevt_identifier_map_t **identifier_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_identifier_map_initialize";
+
+	if( identifier_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *identifier_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid identifier map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*identifier_map = memory_allocate_structure(
+	                   libevt_identifier_map_t );
+
+	if( *identifier_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create identifier map.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *identifier_map,
+	     0,
+	     sizeof( libevt_identifier_map_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear identifier map.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *identifier_map != NULL )
+	{
+		memory_free(
+		 *identifier_map );
+
+		*identifier_map = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an identifier map
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_identifier_map_free(
+     libevt_identifier_map_t **identifier_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_identifier_map_free";
+
+	if( identifier_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *identifier_map != NULL )
+	{
+		if( ( *identifier_map )->entries != NULL )
+		{
+			memory_free(
+			 ( *identifier_map )->entries );
+		}
+		memory_free(
+		 *identifier_map );
+
+		*identifier_map = NULL;
+	}
+	return( 1 );
+}
+
+/* Compares two identifier map entries
+ * Entries are ordered by identifier, records before recovered records and then by record index
+ * Returns -1 if the first entry is less than the second, 0 if equal or 1 if greater
+ */
+int libevt_identifier_map_entry_compare(
+     const void *first_entry,
+     const void *second_entry )
+{
+	const libevt_identifier_map_entry_t *first_map_entry  = (const libevt_identifier_map_entry_t *) first_entry;
+	const libevt_identifier_map_entry_t *second_map_entry = (const libevt_identifier_map_entry_t *) second_entry;
+
+	if( first_map_entry->identifier < second_map_entry->identifier )
+	{
+		return( -1 );
+	}
+	else if( first_map_entry->identifier > second_map_entry->identifier )
+	{
+		return( 1 );
+	}
+	if( first_map_entry->records_list_index < second_map_entry->records_list_index )
+	{
+		return( -1 );
+	}
+	else if( first_map_entry->records_list_index > second_map_entry->records_list_index )
+	{
+		return( 1 );
+	}
+	if( first_map_entry->record_index < second_map_entry->record_index )
+	{
+		return( -1 );
+	}
+	else if( first_map_entry->record_index > second_map_entry->record_index )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Reads the identifiers of the records and recovered records into the identifier map
+ * Only the identifier is read from the record data
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_identifier_map_read_records(
+     libevt_identifier_map_t *identifier_map,
+     libevt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfdata_list_t *records_list,
+     libfdata_list_t *recovered_records_list,
+     libcerror_error_t **error )
+{
+	uint8_t identifier_data[ 4 ];
+
+	libevt_identifier_map_entry_t *entries = NULL;
+	libfdata_list_t *list                  = NULL;
+	static char *function                  = "libevt_identifier_map_read_records";
+	size64_t element_size                  = 0;
+	size_t entries_size                    = 0;
+	off64_t element_offset                 = 0;
+	uint32_t element_flags                 = 0;
+	int element_file_index                 = 0;
+	int entry_index                        = 0;
+	int is_sorted                          = 1;
+	int number_of_elements                 = 0;
+	int number_of_recovered_records        = 0;
+	int number_of_records                  = 0;
+	int record_index                       = 0;
+	int records_list_index                 = 0;
+
+	if( identifier_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier map.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier_map->entries != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid identifier map - entries value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_get_number_of_elements(
+	     records_list,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdata_list_get_number_of_elements(
+	     recovered_records_list,
+	     &number_of_recovered_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of recovered records.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_records < 0 )
+	 || ( number_of_recovered_records < 0 )
+	 || ( number_of_recovered_records > ( INT32_MAX - number_of_records ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_records + number_of_recovered_records ) == 0 )
+	{
+		return( 1 );
+	}
+	entries_size = sizeof( libevt_identifier_map_entry_t ) * (size_t) ( number_of_records + number_of_recovered_records );
+
+	if( ( (size_t) ( number_of_records + number_of_recovered_records ) > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libevt_identifier_map_entry_t ) ) )
+	 || ( entries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid entries size value exceeds maximum allocation size.",
+		 function );
+
+		goto on_error;
+	}
+	entries = (libevt_identifier_map_entry_t *) memory_allocate(
+	                                             entries_size );
+
+	if( entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	for( records_list_index = 0;
+	     records_list_index < 2;
+	     records_list_index++ )
+	{
+		if( records_list_index == 0 )
+		{
+			list               = records_list;
+			number_of_elements = number_of_records;
+		}
+		else
+		{
+			list               = recovered_records_list;
+			number_of_elements = number_of_recovered_records;
+		}
+		for( record_index = 0;
+		     record_index < number_of_elements;
+		     record_index++ )
+		{
+			if( libfdata_list_get_element_by_index(
+			     list,
+			     record_index,
+			     &element_file_index,
+			     &element_offset,
+			     &element_size,
+			     &element_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve element: %d from records list: %d.",
+				 function,
+				 record_index,
+				 records_list_index );
+
+				goto on_error;
+			}
+			/* Only event records contain an identifier
+			 */
+			if( element_size < (size64_t) sizeof( evt_event_record_t ) )
+			{
+				continue;
+			}
+			if( libevt_io_handle_read_record_data(
+			     io_handle,
+			     file_io_handle,
+			     element_offset,
+			     8,
+			     identifier_data,
+			     4,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read identifier of record: %d from records list: %d.",
+				 function,
+				 record_index,
+				 records_list_index );
+
+				goto on_error;
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 identifier_data,
+			 entries[ entry_index ].identifier );
+
+			entries[ entry_index ].records_list_index = records_list_index;
+			entries[ entry_index ].record_index       = record_index;
+
+			/* Record identifiers are mostly increasing hence sorting can typically be skipped
+			 */
+			if( ( entry_index > 0 )
+			 && ( libevt_identifier_map_entry_compare(
+			       &( entries[ entry_index - 1 ] ),
+			       &( entries[ entry_index ] ) ) > 0 ) )
+			{
+				is_sorted = 0;
+			}
+			entry_index++;
+		}
+	}
+	if( is_sorted == 0 )
+	{
+		qsort(
+		 entries,
+		 (size_t) entry_index,
+		 sizeof( libevt_identifier_map_entry_t ),
+		 &libevt_identifier_map_entry_compare );
+	}
+	identifier_map->entries           = entries;
+	identifier_map->number_of_entries = entry_index;
+
+	return( 1 );
+
+on_error:
+	if( entries != NULL )
+	{
+		memory_free(
+		 entries );
+	}
+	return( -1 );
+}
+
+/* Retrieves the records list index and record index of a specific identifier
+ * If the identifier is used by multiple records, records are preferred over
+ * recovered records, otherwise the record with the lowest index is returned
+ * Returns 1 if successful, 0 if no such identifier or -1 on error
+ */
+int libevt_identifier_map_get_record_index_by_identifier(
+     libevt_identifier_map_t *identifier_map,
+     uint32_t identifier,
+     int *records_list_index,
+     int *record_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_identifier_map_get_record_index_by_identifier";
+	int entry_index       = 0;
+	int lower_index       = 0;
+	int upper_index       = 0;
+
+	if( identifier_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier map.",
+		 function );
+
+		return( -1 );
+	}
+	if( records_list_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records list index.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	/* Find the first entry with an identifier that is equal or greater
+	 */
+	upper_index = identifier_map->number_of_entries;
+
+	while( lower_index < upper_index )
+	{
+		entry_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( identifier_map->entries[ entry_index ].identifier < identifier )
+		{
+			lower_index = entry_index + 1;
+		}
+		else
+		{
+			upper_index = entry_index;
+		}
+	}
+	if( ( lower_index >= identifier_map->number_of_entries )
+	 || ( identifier_map->entries[ lower_index ].identifier != identifier ) )
+	{
+		return( 0 );
+	}
+	*records_list_index = identifier_map->entries[ lower_index ].records_list_index;
+	*record_index       = identifier_map->entries[ lower_index ].record_index;
+
+	return( 1 );
+}
+
@@ -0,0 +1,99 @@
+/*
+ * Record identifier map functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVT_IDENTIFIER_MAP_H )
+#define _LIBEVT_IDENTIFIER_MAP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevt_io_handle.h"
+#include "libevt_libbfio.h"
+#include "libevt_libcerror.h"
+#include "libevt_libfdata.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevt_identifier_map_entry libevt_identifier_map_entry_t;
+
+struct libevt_identifier_map_entry
+{
+	/* The record identifier
+	 */
+	uint32_t identifier;
+
+	/* The index of the records list, 0 for the records and 1 for the recovered records
+	 */
+	int records_list_index;
+
+	/* The record index
+	 */
+	int record_index;
+};
+
+typedef struct libevt_identifier_map libevt_identifier_map_t;
+
+struct libevt_identifier_map
+{
+	/* The entries sorted by identifier
+	 */
+	libevt_identifier_map_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+};
+
+int libevt_identifier_map_initialize(
+     libevt_identifier_map_t **identifier_map,
+     libcerror_error_t **error );
+
+int libevt_identifier_map_free(
+     libevt_identifier_map_t **identifier_map,
+     libcerror_error_t **error );
+
+int libevt_identifier_map_entry_compare(
+     const void *first_entry,
+     const void *second_entry );
+
+int libevt_identifier_map_read_records(
+     libevt_identifier_map_t *identifier_map,
+     libevt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfdata_list_t *records_list,
+     libfdata_list_t *recovered_records_list,
+     libcerror_error_t **error );
+
+int libevt_identifier_map_get_record_index_by_identifier(
+     libevt_identifier_map_t *identifier_map,
+     uint32_t identifier,
+     int *records_list_index,
+     int *record_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVT_IDENTIFIER_MAP_H ) */
+
@@ -0,0 +1,895 @@
+/*
+ * Records index functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevt_definitions.h"
+#include "libevt_index.h"
+#include "libevt_io_handle.h"
+#include "libevt_libbfio.h"
+#include "libevt_libcerror.h"
+#include "libevt_libcnotify.h"
+#include "libevt_libfdata.h"
+
+#include "evt_end_of_file_record.h"
+#include "evt_file_header.h"
+#include "evt_index.h"
+
+const uint8_t evt_index_signature[ 8 ] = { 'E', 'V', 'T', 'I', 'N', 'D', 'E', 'X' };
+
+/* Reads the data used to determine if a records index matches the file
+ * This is a copy of the file header and of the data at the end of file record offset
+ * stored in the file header
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_index_read_fingerprint_data(
+     libevt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *file_header_data,
+     size_t file_header_data_size,
+     uint8_t *end_of_file_record_data,
+     size_t end_of_file_record_data_size,
+     libcerror_error_t **error )
+{
+	static char *function              = "libevt_index_read_fingerprint_data";
+	ssize_t read_count                 = 0;
+	uint32_t end_of_file_record_offset = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_header_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file header data.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_header_data_size != sizeof( evt_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file header data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_of_file_record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid end of file record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_of_file_record_data_size != sizeof( evt_end_of_file_record_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid end of file record data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_size < (size64_t) sizeof( evt_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - file size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_data != NULL )
+	{
+		if( memory_copy(
+		     file_header_data,
+		     io_handle->file_data,
+		     sizeof( evt_file_header_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy file header data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              file_header_data,
+		              sizeof( evt_file_header_t ),
+		              0,
+		              error );
+
+		if( read_count != (ssize_t) sizeof( evt_file_header_t ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file header data at offset: 0 (0x00000000).",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( memory_set(
+	     end_of_file_record_data,
+	     0,
+	     sizeof( evt_end_of_file_record_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear end of file record data.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evt_file_header_t *) file_header_data )->end_of_file_record_offset,
+	 end_of_file_record_offset );
+
+	/* The end of file record is stored in the ring buffer and can wrap
+	 */
+	if( ( (size64_t) end_of_file_record_offset >= sizeof( evt_file_header_t ) )
+	 && ( (size64_t) end_of_file_record_offset < io_handle->file_size )
+	 && ( ( io_handle->file_size - sizeof( evt_file_header_t ) ) >= sizeof( evt_end_of_file_record_t ) ) )
+	{
+		if( libevt_io_handle_read_record_data(
+		     io_handle,
+		     file_io_handle,
+		     (off64_t) end_of_file_record_offset,
+		     0,
+		     end_of_file_record_data,
+		     sizeof( evt_end_of_file_record_t ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read end of file record data at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 end_of_file_record_offset,
+			 end_of_file_record_offset );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Writes the records index
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_index_write_file_io_handle(
+     libevt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfdata_list_t *records_list,
+     libfdata_list_t *recovered_records_list,
+     libbfio_handle_t *index_file_io_handle,
+     libcerror_error_t **error )
+{
+	libfdata_list_t *list           = NULL;
+	uint8_t *index_data             = NULL;
+	static char *function           = "libevt_index_write_file_io_handle";
+	size64_t element_size           = 0;
+	size_t index_data_offset        = 0;
+	size_t index_data_size          = 0;
+	ssize_t write_count             = 0;
+	off64_t element_offset          = 0;
+	uint32_t element_flags          = 0;
+	uint32_t index_flags            = 0;
+	int element_file_index          = 0;
+	int element_index               = 0;
+	int list_index                  = 0;
+	int number_of_elements          = 0;
+	int number_of_recovered_records = 0;
+	int number_of_records           = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_get_number_of_elements(
+	     records_list,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdata_list_get_number_of_elements(
+	     recovered_records_list,
+	     &number_of_recovered_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of recovered records.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_records < 0 )
+	 || ( number_of_recovered_records < 0 )
+	 || ( (size_t) number_of_records > ( ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - sizeof( evt_index_header_t ) ) / sizeof( evt_index_entry_t ) ) )
+	 || ( (size_t) number_of_recovered_records > ( ( ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - sizeof( evt_index_header_t ) ) / sizeof( evt_index_entry_t ) ) - number_of_records ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	index_data_size = sizeof( evt_index_header_t )
+	                + ( ( (size_t) number_of_records + (size_t) number_of_recovered_records ) * sizeof( evt_index_entry_t ) );
+
+	index_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * index_data_size );
+
+	if( index_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     index_data,
+	     0,
+	     sizeof( evt_index_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index header data.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( io_handle->flags & LIBEVT_IO_HANDLE_FLAG_IS_CORRUPTED ) != 0 )
+	{
+		index_flags |= LIBEVT_INDEX_FLAG_IS_CORRUPTED;
+	}
+	if( io_handle->has_wrapped != 0 )
+	{
+		index_flags |= LIBEVT_INDEX_FLAG_HAS_WRAPPED;
+	}
+	if( memory_copy(
+	     ( (evt_index_header_t *) index_data )->signature,
+	     evt_index_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (evt_index_header_t *) index_data )->format_version,
+	 LIBEVT_INDEX_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (evt_index_header_t *) index_data )->flags,
+	 index_flags );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (evt_index_header_t *) index_data )->file_size,
+	 io_handle->file_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (evt_index_header_t *) index_data )->number_of_records,
+	 (uint32_t) number_of_records );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (evt_index_header_t *) index_data )->number_of_recovered_records,
+	 (uint32_t) number_of_recovered_records );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (evt_index_header_t *) index_data )->number_of_duplicate_recovered_records,
+	 (uint32_t) io_handle->number_of_duplicate_recovered_records );
+
+	if( libevt_index_read_fingerprint_data(
+	     io_handle,
+	     file_io_handle,
+	     ( (evt_index_header_t *) index_data )->file_header_data,
+	     sizeof( evt_file_header_t ),
+	     ( (evt_index_header_t *) index_data )->end_of_file_record_data,
+	     sizeof( evt_end_of_file_record_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read fingerprint data.",
+		 function );
+
+		goto on_error;
+	}
+	index_data_offset = sizeof( evt_index_header_t );
+
+	for( list_index = 0;
+	     list_index < 2;
+	     list_index++ )
+	{
+		if( list_index == 0 )
+		{
+			list               = records_list;
+			number_of_elements = number_of_records;
+		}
+		else
+		{
+			list               = recovered_records_list;
+			number_of_elements = number_of_recovered_records;
+		}
+		for( element_index = 0;
+		     element_index < number_of_elements;
+		     element_index++ )
+		{
+			if( libfdata_list_get_element_by_index(
+			     list,
+			     element_index,
+			     &element_file_index,
+			     &element_offset,
+			     &element_size,
+			     &element_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve element: %d from list: %d.",
+				 function,
+				 element_index,
+				 list_index );
+
+				goto on_error;
+			}
+			if( ( element_offset < 0 )
+			 || ( element_size > (size64_t) UINT32_MAX ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid element: %d in list: %d value out of bounds.",
+				 function,
+				 element_index,
+				 list_index );
+
+				goto on_error;
+			}
+			byte_stream_copy_from_uint64_little_endian(
+			 ( (evt_index_entry_t *) &( index_data[ index_data_offset ] ) )->record_offset,
+			 (uint64_t) element_offset );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (evt_index_entry_t *) &( index_data[ index_data_offset ] ) )->record_size,
+			 (uint32_t) element_size );
+
+			index_data_offset += sizeof( evt_index_entry_t );
+		}
+	}
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               index_file_io_handle,
+	               index_data,
+	               index_data_size,
+	               0,
+	               error );
+
+	if( write_count != (ssize_t) index_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 index_data );
+
+	return( 1 );
+
+on_error:
+	if( index_data != NULL )
+	{
+		memory_free(
+		 index_data );
+	}
+	return( -1 );
+}
+
+/* Reads the records index
+ * The records are only added to the records lists if the index matches the file
+ * Returns 1 if successful, 0 if the index does not match the file or -1 on error
+ */
+int libevt_index_read_file_io_handle(
+     libevt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfdata_list_t *records_list,
+     libfdata_list_t *recovered_records_list,
+     libbfio_handle_t *index_file_io_handle,
+     libcerror_error_t **error )
+{
+	evt_index_header_t index_header;
+
+	uint8_t end_of_file_record_data[ sizeof( evt_end_of_file_record_t ) ];
+	uint8_t file_header_data[ sizeof( evt_file_header_t ) ];
+
+	libfdata_list_t *list                = NULL;
+	uint8_t *entries_data                = NULL;
+	static char *function                = "libevt_index_read_file_io_handle";
+	size64_t index_file_size                       = 0;
+	size_t entries_data_offset                     = 0;
+	size_t entries_data_size                       = 0;
+	ssize_t read_count                             = 0;
+	uint64_t file_size                             = 0;
+	uint64_t record_offset                         = 0;
+	uint32_t format_version                        = 0;
+	uint32_t index_flags                           = 0;
+	uint32_t number_of_duplicate_recovered_records = 0;
+	uint32_t number_of_recovered_records           = 0;
+	uint32_t number_of_records                     = 0;
+	uint32_t record_size                           = 0;
+	int element_index                              = 0;
+	int entry_index                                = 0;
+	int number_of_entries                          = 0;
+	int result                                     = 1;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     index_file_io_handle,
+	     &index_file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( index_file_size < (size64_t) sizeof( evt_index_header_t ) )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: index file size value too small.\n",
+			 function );
+		}
+#endif
+		return( 0 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              index_file_io_handle,
+	              (uint8_t *) &index_header,
+	              sizeof( evt_index_header_t ),
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( evt_index_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index header data at offset: 0 (0x00000000).",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_compare(
+	     index_header.signature,
+	     evt_index_signature,
+	     8 ) != 0 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unsupported index signature.\n",
+			 function );
+		}
+#endif
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 index_header.format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 index_header.flags,
+	 index_flags );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 index_header.file_size,
+	 file_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 index_header.number_of_records,
+	 number_of_records );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 index_header.number_of_recovered_records,
+	 number_of_recovered_records );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 index_header.number_of_duplicate_recovered_records,
+	 number_of_duplicate_recovered_records );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: format version\t\t\t: %" PRIu32 "\n",
+		 function,
+		 format_version );
+
+		libcnotify_printf(
+		 "%s: flags\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 index_flags );
+
+		libcnotify_printf(
+		 "%s: file size\t\t\t\t: %" PRIu64 "\n",
+		 function,
+		 file_size );
+
+		libcnotify_printf(
+		 "%s: number of records\t\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_records );
+
+		libcnotify_printf(
+		 "%s: number of recovered records\t: %" PRIu32 "\n",
+		 function,
+		 number_of_recovered_records );
+
+		libcnotify_printf(
+		 "%s: number of duplicate recovered records\t: %" PRIu32 "\n",
+		 function,
+		 number_of_duplicate_recovered_records );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( format_version != LIBEVT_INDEX_FORMAT_VERSION )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unsupported index format version: %" PRIu32 ".\n",
+			 function,
+			 format_version );
+		}
+#endif
+		return( 0 );
+	}
+	if( file_size != (uint64_t) io_handle->file_size )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: mismatch in file size.\n",
+			 function );
+		}
+#endif
+		return( 0 );
+	}
+	if( libevt_index_read_fingerprint_data(
+	     io_handle,
+	     file_io_handle,
+	     file_header_data,
+	     sizeof( evt_file_header_t ),
+	     end_of_file_record_data,
+	     sizeof( evt_end_of_file_record_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read fingerprint data.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( memory_compare(
+	       index_header.file_header_data,
+	       file_header_data,
+	       sizeof( evt_file_header_t ) ) != 0 )
+	 || ( memory_compare(
+	       index_header.end_of_file_record_data,
+	       end_of_file_record_data,
+	       sizeof( evt_end_of_file_record_t ) ) != 0 ) )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: mismatch in fingerprint data.\n",
+			 function );
+		}
+#endif
+		return( 0 );
+	}
+	if( ( number_of_records > (uint32_t) INT32_MAX )
+	 || ( number_of_recovered_records > ( (uint32_t) INT32_MAX - number_of_records ) )
+	 || ( number_of_duplicate_recovered_records > (uint32_t) INT32_MAX ) )
+	{
+		return( 0 );
+	}
+	number_of_entries = (int) ( number_of_records + number_of_recovered_records );
+
+	if( (size64_t) number_of_entries > ( ( index_file_size - sizeof( evt_index_header_t ) ) / sizeof( evt_index_entry_t ) ) )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: index file is truncated.\n",
+			 function );
+		}
+#endif
+		return( 0 );
+	}
+	entries_data_size = (size_t) number_of_entries * sizeof( evt_index_entry_t );
+
+	if( entries_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid entries data size value exceeds maximum allocation size.",
+		 function );
+
+		goto on_error;
+	}
+	if( entries_data_size > 0 )
+	{
+		entries_data = (uint8_t *) memory_allocate(
+		                            sizeof( uint8_t ) * entries_data_size );
+
+		if( entries_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entries data.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              index_file_io_handle,
+		              entries_data,
+		              entries_data_size,
+		              (off64_t) sizeof( evt_index_header_t ),
+		              error );
+
+		if( read_count != (ssize_t) entries_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read index entries data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* Check all the entries before adding any of them to the records lists
+	 */
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (evt_index_entry_t *) &( entries_data[ entries_data_offset ] ) )->record_offset,
+		 record_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (evt_index_entry_t *) &( entries_data[ entries_data_offset ] ) )->record_size,
+		 record_size );
+
+		if( ( record_offset < (uint64_t) sizeof( evt_file_header_t ) )
+		 || ( record_offset >= (uint64_t) io_handle->file_size )
+		 || ( record_size < 8 )
+		 || ( (size64_t) record_size > ( io_handle->file_size - sizeof( evt_file_header_t ) ) ) )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: invalid index entry: %d value out of bounds.\n",
+				 function,
+				 entry_index );
+			}
+#endif
+			result = 0;
+
+			break;
+		}
+		entries_data_offset += sizeof( evt_index_entry_t );
+	}
+	if( result == 1 )
+	{
+		entries_data_offset = 0;
+
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			if( entry_index < (int) number_of_records )
+			{
+				list = records_list;
+			}
+			else
+			{
+				list = recovered_records_list;
+			}
+			byte_stream_copy_to_uint64_little_endian(
+			 ( (evt_index_entry_t *) &( entries_data[ entries_data_offset ] ) )->record_offset,
+			 record_offset );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (evt_index_entry_t *) &( entries_data[ entries_data_offset ] ) )->record_size,
+			 record_size );
+
+			if( libfdata_list_append_element(
+			     list,
+			     &element_index,
+			     0,
+			     (off64_t) record_offset,
+			     (size64_t) record_size,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append index entry: %d to records list.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			entries_data_offset += sizeof( evt_index_entry_t );
+		}
+		if( ( index_flags & LIBEVT_INDEX_FLAG_IS_CORRUPTED ) != 0 )
+		{
+			io_handle->flags |= LIBEVT_IO_HANDLE_FLAG_IS_CORRUPTED;
+		}
+		if( ( index_flags & LIBEVT_INDEX_FLAG_HAS_WRAPPED ) != 0 )
+		{
+			io_handle->has_wrapped = 1;
+		}
+		io_handle->number_of_duplicate_recovered_records = (int) number_of_duplicate_recovered_records;
+	}
+	if( entries_data != NULL )
+	{
+		memory_free(
+		 entries_data );
+	}
+	return( result );
+
+on_error:
+	if( entries_data != NULL )
+	{
+		memory_free(
+		 entries_data );
+	}
+	libfdata_list_empty(
+	 records_list,
+	 NULL );
+
+	libfdata_list_empty(
+	 recovered_records_list,
+	 NULL );
+
+	return( -1 );
+}
+
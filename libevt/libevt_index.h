@@ -0,0 +1,69 @@
+/*
+ * Records index functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVT_INDEX_H )
+#define _LIBEVT_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevt_io_handle.h"
+#include "libevt_libbfio.h"
+#include "libevt_libcerror.h"
+#include "libevt_libfdata.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+extern const uint8_t evt_index_signature[ 8 ];
+
+int libevt_index_read_fingerprint_data(
+     libevt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *file_header_data,
+     size_t file_header_data_size,
+     uint8_t *end_of_file_record_data,
+     size_t end_of_file_record_data_size,
+     libcerror_error_t **error );
+
+int libevt_index_write_file_io_handle(
+     libevt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfdata_list_t *records_list,
+     libfdata_list_t *recovered_records_list,
+     libbfio_handle_t *index_file_io_handle,
+     libcerror_error_t **error );
+
+int libevt_index_read_file_io_handle(
+     libevt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfdata_list_t *records_list,
+     libfdata_list_t *recovered_records_list,
+     libbfio_handle_t *index_file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVT_INDEX_H ) */
+
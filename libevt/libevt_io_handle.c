@@ -27,14 +27,19 @@
 #include "libevt_debug.h"
 #include "libevt_codepage.h"
 #include "libevt_definitions.h"
+#include "libevt_event_record.h"
 #include "libevt_io_handle.h"
 #include "libevt_libbfio.h"
 #include "libevt_libcdata.h"
 #include "libevt_libcerror.h"
 #include "libevt_libcnotify.h"
+#include "libevt_record_map.h"
 #include "libevt_record_values.h"
+#include "libevt_signature_scanner.h"
 #include "libevt_unused.h"
 
+#include "evt_end_of_file_record.h"
+#include "evt_event_record.h"
 #include "evt_file_header.h"
 
 const uint8_t evt_end_of_file_record_signature1[ 4 ] = { 0x11, 0x11, 0x11, 0x11 };
@@ -126,6 +131,7 @@ int libevt_io_handle_free(
      libcerror_error_t **error )
 {
 	static char *function = "libevt_io_handle_free";
+	int result            = 1;
 
 	if( io_handle == NULL )
 	{
@@ -140,22 +146,779 @@ int libevt_io_handle_free(
 	}
 	if( *io_handle != NULL )
 	{
+		if( ( *io_handle )->managed_file_data != NULL )
+		{
+			if( libevt_file_data_free(
+			     &( ( *io_handle )->managed_file_data ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free managed file data.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *io_handle );
 
-		*io_handle = NULL;
+		*io_handle = NULL;
+	}
+	return( result );
+}
+
+/* Clears the IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_io_handle_clear(
+     libevt_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_io_handle_clear";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The record views that still reference the managed file data keep it available
+	 */
+	if( io_handle->managed_file_data != NULL )
+	{
+		if( libevt_file_data_free(
+		     &( io_handle->managed_file_data ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free managed file data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( memory_set(
+	     io_handle,
+	     0,
+	     sizeof( libevt_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->ascii_codepage = LIBEVT_CODEPAGE_WINDOWS_1252;
+
+	return( 1 );
+}
+
+/* Reads the file data into memory
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_io_handle_read_file_data(
+     libevt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_io_handle_read_file_data";
+	size64_t file_size    = 0;
+	ssize_t read_count    = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->file_data != NULL )
+	 || ( io_handle->managed_file_data != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO handle - file data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_size <= (size64_t) sizeof( evt_file_header_t ) )
+	 || ( file_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_file_data_initialize(
+	     &( io_handle->managed_file_data ),
+	     (size_t) file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create managed file data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              io_handle->managed_file_data->data,
+	              (size_t) file_size,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) file_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file data.",
+		 function );
+
+		goto on_error;
+	}
+	io_handle->file_data = io_handle->managed_file_data->data;
+	io_handle->file_size = file_size;
+
+	return( 1 );
+
+on_error:
+	if( io_handle->managed_file_data != NULL )
+	{
+		libevt_file_data_free(
+		 &( io_handle->managed_file_data ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the file data into memory again, e.g. after the file has changed
+ * The file data is read into the current managed file data if the file size did not
+ * change and no record view references it, otherwise into new managed file data.
+ * The previous managed file data remains available to the record views that
+ * reference it and is freed when the last of these is released.
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_io_handle_reread_file_data(
+     libevt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libevt_file_data_t *file_data = NULL;
+	static char *function         = "libevt_io_handle_reread_file_data";
+	size64_t file_size            = 0;
+	ssize_t read_count            = 0;
+	int number_of_references      = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->managed_file_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing managed file data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_size <= (size64_t) sizeof( evt_file_header_t ) )
+	 || ( file_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_file_data_get_number_of_references(
+	     io_handle->managed_file_data,
+	     &number_of_references,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of references of managed file data.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( (size64_t) io_handle->managed_file_data->data_size == file_size )
+	 && ( number_of_references == 1 ) )
+	{
+		file_data = io_handle->managed_file_data;
+	}
+	else if( libevt_file_data_initialize(
+	          &file_data,
+	          (size_t) file_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create managed file data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              file_data->data,
+	              (size_t) file_size,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) file_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file data.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_data != io_handle->managed_file_data )
+	{
+		if( libevt_file_data_free(
+		     &( io_handle->managed_file_data ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free managed file data.",
+			 function );
+
+			goto on_error;
+		}
+		io_handle->managed_file_data = file_data;
+	}
+	io_handle->file_data = file_data->data;
+	io_handle->file_size = file_size;
+
+	return( 1 );
+
+on_error:
+	if( ( file_data != NULL )
+	 && ( file_data != io_handle->managed_file_data ) )
+	{
+		libevt_file_data_free(
+		 &file_data,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads a range of the file data into memory again, e.g. the records written since a refresh
+ * A range that exceeds the end of the file continues directly after the file header,
+ * as the record data does. The file size is expected not to have changed.
+ * If a record view references the current managed file data, the data is first copied
+ * into new managed file data so that the record view remains unchanged.
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_io_handle_read_file_data_range(
+     libevt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t range_offset,
+     size64_t range_size,
+     libcerror_error_t **error )
+{
+	libevt_file_data_t *file_data = NULL;
+	static char *function         = "libevt_io_handle_read_file_data_range";
+	size64_t safe_range_size      = 0;
+	size_t read_size              = 0;
+	ssize_t read_count            = 0;
+	off64_t file_offset           = 0;
+	int number_of_references      = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->managed_file_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing managed file data.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) io_handle->managed_file_data->data_size != io_handle->file_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - managed file data size does not match file size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( range_offset < 0 )
+	 || ( (size64_t) range_offset >= io_handle->file_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The file header is not part of the record data and does not wrap
+	 */
+	safe_range_size = range_size;
+
+	if( (size64_t) range_offset < sizeof( evt_file_header_t ) )
+	{
+		if( safe_range_size > ( io_handle->file_size - range_offset ) )
+		{
+			safe_range_size = io_handle->file_size - range_offset;
+		}
+	}
+	else if( safe_range_size > ( io_handle->file_size - sizeof( evt_file_header_t ) ) )
+	{
+		safe_range_size = io_handle->file_size - sizeof( evt_file_header_t );
+	}
+	if( libevt_file_data_get_number_of_references(
+	     io_handle->managed_file_data,
+	     &number_of_references,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of references of managed file data.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_references > 1 )
+	{
+		if( libevt_file_data_initialize(
+		     &file_data,
+		     io_handle->managed_file_data->data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create managed file data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     file_data->data,
+		     io_handle->managed_file_data->data,
+		     file_data->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy managed file data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libevt_file_data_free(
+		     &( io_handle->managed_file_data ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free managed file data.",
+			 function );
+
+			goto on_error;
+		}
+		io_handle->managed_file_data = file_data;
+		file_data                    = NULL;
+	}
+	io_handle->file_data = io_handle->managed_file_data->data;
+
+	file_offset = range_offset;
+
+	while( safe_range_size > 0 )
+	{
+		read_size = (size_t) safe_range_size;
+
+		if( (size64_t) read_size > ( io_handle->file_size - file_offset ) )
+		{
+			read_size = (size_t) ( io_handle->file_size - file_offset );
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              &( io_handle->file_data[ file_offset ] ),
+		              read_size,
+		              file_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		safe_range_size -= read_size;
+
+		file_offset = (off64_t) sizeof( evt_file_header_t );
+	}
+	return( 1 );
+
+on_error:
+	if( file_data != NULL )
+	{
+		libevt_file_data_free(
+		 &file_data,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets the file data
+ * The file data is not copied and must remain available until the IO handle is cleared
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_io_handle_set_file_data(
+     libevt_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_io_handle_set_file_data";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO handle - file data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size <= sizeof( evt_file_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->file_data = (uint8_t *) data;
+	io_handle->file_size = (size64_t) data_size;
+
+	return( 1 );
+}
+
+/* Reads data of a record at a specific offset relative to the start of the record
+ * The record data is stored in a ring buffer that wraps around to the end of the file header
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_io_handle_read_record_data(
+     libevt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t record_offset,
+     size_t relative_offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_io_handle_read_record_data";
+	size_t data_offset    = 0;
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+	off64_t file_offset   = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_size <= (size64_t) sizeof( evt_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - file size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_offset < (off64_t) sizeof( evt_file_header_t ) )
+	 || ( (size64_t) record_offset >= io_handle->file_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( relative_offset > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid relative offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > ( io_handle->file_size - sizeof( evt_file_header_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file_offset = record_offset + relative_offset;
+
+	if( (size64_t) file_offset >= io_handle->file_size )
+	{
+		file_offset -= (off64_t) ( io_handle->file_size - sizeof( evt_file_header_t ) );
+
+		if( (size64_t) file_offset >= io_handle->file_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid relative offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	while( data_offset < data_size )
+	{
+		read_size = data_size - data_offset;
+
+		if( read_size > (size_t) ( io_handle->file_size - file_offset ) )
+		{
+			read_size = (size_t) ( io_handle->file_size - file_offset );
+		}
+		if( io_handle->file_data != NULL )
+		{
+			if( memory_copy(
+			     &( data[ data_offset ] ),
+			     &( io_handle->file_data[ file_offset ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy record data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              file_io_handle,
+			              &( data[ data_offset ] ),
+			              read_size,
+			              file_offset,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read record data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_offset,
+				 file_offset );
+
+				return( -1 );
+			}
+		}
+		data_offset += read_size;
+		file_offset  = (off64_t) sizeof( evt_file_header_t );
 	}
 	return( 1 );
 }
 
-/* Clears the IO handle
+/* Reads the size and type of a record without reading the record data
+ * Only the record size, the signature and the copy of the record size are read
  * Returns 1 if successful or -1 on error
  */
-int libevt_io_handle_clear(
+int libevt_io_handle_read_record_size(
      libevt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t *file_offset,
+     uint8_t *has_wrapped,
+     uint32_t *record_size,
+     uint8_t *record_type,
      libcerror_error_t **error )
 {
-	static char *function = "libevt_io_handle_clear";
+	uint8_t end_of_file_record_data[ sizeof( evt_end_of_file_record_t ) ];
+	uint8_t record_header_data[ 8 ];
+	uint8_t record_size_data[ 4 ];
+
+	static char *function     = "libevt_io_handle_read_record_size";
+	off64_t safe_file_offset  = 0;
+	uint32_t copy_of_size     = 0;
+	uint32_t safe_record_size = 0;
+	uint8_t safe_record_type  = 0;
 
 	if( io_handle == NULL )
 	{
@@ -168,26 +931,270 @@ int libevt_io_handle_clear(
 
 		return( -1 );
 	}
-	if( memory_set(
+	if( io_handle->file_size <= (size64_t) sizeof( evt_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - file size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( has_wrapped == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid has wrapped.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record size.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record type.",
+		 function );
+
+		return( -1 );
+	}
+	safe_file_offset = *file_offset;
+
+	if( libevt_io_handle_read_record_data(
 	     io_handle,
+	     file_io_handle,
+	     safe_file_offset,
 	     0,
-	     sizeof( libevt_io_handle_t ) ) == NULL )
+	     record_header_data,
+	     8,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record header data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 safe_file_offset,
+		 safe_file_offset );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 record_header_data,
+	 safe_record_size );
+
+	if( ( safe_record_size < 8 )
+	 || ( safe_record_size > (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	 || ( (size64_t) safe_record_size > ( io_handle->file_size - sizeof( evt_file_header_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: record data size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	io_handle->ascii_codepage = LIBEVT_CODEPAGE_WINDOWS_1252;
+	if( memory_compare(
+	     &( record_header_data[ 4 ] ),
+	     evt_file_signature,
+	     4 ) == 0 )
+	{
+		safe_record_type = LIBEVT_RECORD_TYPE_EVENT;
+	}
+	else if( memory_compare(
+	          &( record_header_data[ 4 ] ),
+	          evt_end_of_file_record_signature1,
+	          4 ) == 0 )
+	{
+		safe_record_type = LIBEVT_RECORD_TYPE_END_OF_FILE;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported record signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_record_type == LIBEVT_RECORD_TYPE_EVENT )
+	{
+		if( (size_t) safe_record_size < ( sizeof( evt_event_record_t ) + 4 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: event record size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( libevt_io_handle_read_record_data(
+		     io_handle,
+		     file_io_handle,
+		     safe_file_offset,
+		     (size_t) safe_record_size - 4,
+		     record_size_data,
+		     4,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read copy of record size data.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 record_size_data,
+		 copy_of_size );
+	}
+	else if( safe_record_type == LIBEVT_RECORD_TYPE_END_OF_FILE )
+	{
+		if( (size_t) safe_record_size != sizeof( evt_end_of_file_record_t ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: end-of-file record size: %" PRIu32 " does not match known value.",
+			 function,
+			 safe_record_size );
+
+			return( -1 );
+		}
+		if( libevt_io_handle_read_record_data(
+		     io_handle,
+		     file_io_handle,
+		     safe_file_offset,
+		     0,
+		     end_of_file_record_data,
+		     sizeof( evt_end_of_file_record_t ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read end-of-file record data.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( memory_compare(
+		       ( (evt_end_of_file_record_t *) end_of_file_record_data )->signature2,
+		       evt_end_of_file_record_signature2,
+		       4 ) != 0 )
+		 || ( memory_compare(
+		       ( (evt_end_of_file_record_t *) end_of_file_record_data )->signature3,
+		       evt_end_of_file_record_signature3,
+		       4 ) != 0 )
+		 || ( memory_compare(
+		       ( (evt_end_of_file_record_t *) end_of_file_record_data )->signature4,
+		       evt_end_of_file_record_signature4,
+		       4 ) != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported end-of-file record signature.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (evt_end_of_file_record_t *) end_of_file_record_data )->copy_of_size,
+		 copy_of_size );
+	}
+	if( safe_record_size != copy_of_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: value mismatch for record size and copy of record size ( %" PRIu32 " != %" PRIu32 " ).",
+		 function,
+		 safe_record_size,
+		 copy_of_size );
+
+		return( -1 );
+	}
+	safe_file_offset += (off64_t) safe_record_size;
+
+	if( (size64_t) safe_file_offset > io_handle->file_size )
+	{
+		if( *has_wrapped != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid IO handle - record data has already wrapped.",
+			 function );
+
+			return( -1 );
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: record data wrapped at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+			 function,
+			 io_handle->file_size,
+			 io_handle->file_size );
+		}
+#endif
+		*has_wrapped = 1;
+
+		safe_file_offset -= (off64_t) ( io_handle->file_size - sizeof( evt_file_header_t ) );
+	}
+	*file_offset = safe_file_offset;
+	*record_size = safe_record_size;
+	*record_type = safe_record_type;
 
 	return( 1 );
 }
 
-/* Reads the records into the records array
+/* Reads the records into the records list
+ * The records list is filled with the offset and size of the records, the record data is read on demand
+ * If a record map is provided the offset, size, record number and creation time of the records are added to it
  * Returns 1 if successful or -1 on error
  */
 int libevt_io_handle_read_records(
@@ -196,17 +1203,21 @@ int libevt_io_handle_read_records(
      uint32_t first_record_offset,
      uint32_t end_of_file_record_offset,
      libfdata_list_t *records_list,
+     libevt_record_map_t *record_map,
      off64_t *last_record_offset,
      libcerror_error_t **error )
 {
-	libevt_record_values_t *record_values = NULL;
-	static char *function                 = "libevt_io_handle_read_records";
-	ssize_t read_count                    = 0;
-	off64_t file_offset                   = 0;
-	off64_t safe_last_record_offset       = 0;
-	uint32_t record_iterator              = 0;
-	uint8_t record_type                   = 0;
-	int element_index                     = 0;
+	uint8_t record_key_data[ 8 ];
+
+	static char *function           = "libevt_io_handle_read_records";
+	off64_t file_offset             = 0;
+	off64_t safe_last_record_offset = 0;
+	uint32_t creation_time          = 0;
+	uint32_t record_iterator        = 0;
+	uint32_t record_number          = 0;
+	uint32_t record_size            = 0;
+	uint8_t record_type             = 0;
+	int element_index               = 0;
 
 	if( io_handle == NULL )
 	{
@@ -257,31 +1268,16 @@ int libevt_io_handle_read_records(
 			 file_offset );
 		}
 #endif
-		if( libevt_record_values_initialize(
-		     &record_values,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create record values.",
-			 function );
-
-			goto on_error;
-		}
 		safe_last_record_offset = file_offset;
 
-		read_count = libevt_record_values_read_file_io_handle(
-		              record_values,
-		              file_io_handle,
-		              io_handle,
-		              &file_offset,
-		              &( io_handle->has_wrapped ),
-		              1,
-		              error );
-
-		if( read_count == -1 )
+		if( libevt_io_handle_read_record_size(
+		     io_handle,
+		     file_io_handle,
+		     &file_offset,
+		     &( io_handle->has_wrapped ),
+		     &record_size,
+		     &record_type,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -295,8 +1291,6 @@ int libevt_io_handle_read_records(
 
 			goto on_error;
 		}
-		record_type = record_values->type;
-
 		if( record_type == LIBEVT_RECORD_TYPE_EVENT )
 		{
 			if( libfdata_list_append_element(
@@ -304,7 +1298,7 @@ int libevt_io_handle_read_records(
 			     &element_index,
 			     0,
 			     safe_last_record_offset,
-			     (size64_t) read_count,
+			     (size64_t) record_size,
 			     0,
 			     error ) != 1 )
 			{
@@ -317,19 +1311,57 @@ int libevt_io_handle_read_records(
 
 				goto on_error;
 			}
-		}
-		if( libevt_record_values_free(
-		     &record_values,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free record values.",
-			 function );
+			if( record_map != NULL )
+			{
+				/* The record number and creation time directly follow the signature
+				 */
+				if( libevt_io_handle_read_record_data(
+				     io_handle,
+				     file_io_handle,
+				     safe_last_record_offset,
+				     8,
+				     record_key_data,
+				     8,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read record: %" PRIu32 " number and creation time.",
+					 function,
+					 record_iterator );
 
-			goto on_error;
+					goto on_error;
+				}
+				byte_stream_copy_to_uint32_little_endian(
+				 &( record_key_data[ 0 ] ),
+				 record_number );
+
+				byte_stream_copy_to_uint32_little_endian(
+				 &( record_key_data[ 4 ] ),
+				 creation_time );
+
+				if( libevt_record_map_append_record(
+				     record_map,
+				     safe_last_record_offset,
+				     (size64_t) record_size,
+				     io_handle->file_size,
+				     record_number,
+				     creation_time,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append record: %" PRIu32 " to record map.",
+					 function,
+					 record_iterator );
+
+					goto on_error;
+				}
+			}
 		}
 		if( record_type == LIBEVT_RECORD_TYPE_END_OF_FILE )
 		{
@@ -345,7 +1377,7 @@ int libevt_io_handle_read_records(
 			break;
 		}
 		if( ( file_offset > (off64_t) end_of_file_record_offset )
-		 && ( file_offset < (off64_t) ( end_of_file_record_offset + read_count ) ) )
+		 && ( file_offset < (off64_t) ( end_of_file_record_offset + record_size ) ) )
 		{
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
@@ -379,7 +1411,7 @@ int libevt_io_handle_read_records(
 #endif
 			io_handle->flags |= LIBEVT_IO_HANDLE_FLAG_IS_CORRUPTED;
 		}
-		safe_last_record_offset += read_count;
+		safe_last_record_offset += record_size;
 	}
 	if( ( io_handle->has_wrapped != 0 )
 	 && ( ( io_handle->flags & LIBEVT_FILE_FLAG_HAS_WRAPPED ) == 0 ) )
@@ -399,14 +1431,74 @@ int libevt_io_handle_read_records(
 	return( 1 );
 
 on_error:
-	if( record_values != NULL )
+	*last_record_offset = safe_last_record_offset;
+
+	return( -1 );
+}
+
+/* Creates a signature scanner for the recover scans
+ * The signature indexes correspond to LIBEVT_RECOVER_SCAN_SIGNATURES
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_io_handle_initialize_recover_scan_signature_scanner(
+     libevt_signature_scanner_t **signature_scanner,
+     libcerror_error_t **error )
+{
+	const uint8_t *signatures[ 5 ] = {
+		evt_file_signature,
+		evt_end_of_file_record_signature1,
+		evt_end_of_file_record_signature2,
+		evt_end_of_file_record_signature3,
+		evt_end_of_file_record_signature4 };
+
+	static char *function          = "libevt_io_handle_initialize_recover_scan_signature_scanner";
+	int signature_index            = 0;
+	int safe_signature_index       = 0;
+
+	if( libevt_signature_scanner_initialize(
+	     signature_scanner,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create signature scanner.",
+		 function );
+
+		goto on_error;
+	}
+	for( signature_index = 0;
+	     signature_index < 5;
+	     signature_index++ )
+	{
+		if( libevt_signature_scanner_add_signature(
+		     *signature_scanner,
+		     signatures[ signature_index ],
+		     4,
+		     &safe_signature_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to add signature: %d.",
+			 function,
+			 signature_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *signature_scanner != NULL )
 	{
-		libevt_record_values_free(
-		 &record_values,
+		libevt_signature_scanner_free(
+		 signature_scanner,
 		 NULL );
 	}
-	*last_record_offset = safe_last_record_offset;
-
 	return( -1 );
 }
 
@@ -420,16 +1512,22 @@ int libevt_io_handle_end_of_file_record_scan(
      uint32_t *end_of_file_record_offset,
      libcerror_error_t **error )
 {
-	uint8_t *scan_block         = NULL;
-	static char *function       = "libevt_io_handle_end_of_file_record_scan";
-	off64_t file_offset         = 0;
-	off64_t initial_file_offset = 0;
-	size_t read_size            = 0;
-	size_t scan_block_offset    = 0;
-	size_t scan_block_size      = 8192;
-	ssize_t read_count          = 0;
-	uint8_t scan_state          = LIBEVT_RECOVER_SCAN_STATE_START;
-	uint8_t scan_has_wrapped    = 0;
+	libevt_signature_scanner_t *signature_scanner = NULL;
+	const uint8_t *scan_data                      = NULL;
+	uint8_t *scan_block                           = NULL;
+	static char *function                         = "libevt_io_handle_end_of_file_record_scan";
+	off64_t file_offset                           = 0;
+	off64_t initial_file_offset                   = 0;
+	off64_t last_signature_offset                 = 0;
+	off64_t signature_offset                      = 0;
+	size_t read_size                              = 0;
+	size_t scan_block_offset                      = 0;
+	size_t scan_block_size                        = 8192;
+	ssize_t read_count                            = 0;
+	uint8_t scan_state                            = LIBEVT_RECOVER_SCAN_STATE_START;
+	uint8_t scan_has_wrapped                      = 0;
+	int result                                    = 0;
+	int signature_index                           = 0;
 
 	if( io_handle == NULL )
 	{
@@ -464,20 +1562,36 @@ int libevt_io_handle_end_of_file_record_scan(
 
 		return( -1 );
 	}
-	scan_block = (uint8_t *) memory_allocate(
-				  sizeof( uint8_t ) * scan_block_size );
-
-	if( scan_block == NULL )
+	if( libevt_io_handle_initialize_recover_scan_signature_scanner(
+	     &signature_scanner,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create scan block.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create signature scanner.",
 		 function );
 
 		goto on_error;
 	}
+	if( io_handle->file_data == NULL )
+	{
+		scan_block = (uint8_t *) memory_allocate(
+					  sizeof( uint8_t ) * scan_block_size );
+
+		if( scan_block == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create scan block.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	/* If the file has wrapped start looking for the end-of-file record after the end-of-file record offset
 	 */
 	file_offset = (off64_t) *end_of_file_record_offset;
@@ -499,103 +1613,145 @@ int libevt_io_handle_end_of_file_record_scan(
 		{
 			read_size = scan_block_size;
 		}
-		read_count = libbfio_handle_read_buffer_at_offset(
-			      file_io_handle,
-			      scan_block,
-			      read_size,
-			      file_offset,
-			      error );
+		if( io_handle->file_data != NULL )
+		{
+			if( ( (size64_t) file_offset > io_handle->file_size )
+			 || ( (size64_t) read_size > ( io_handle->file_size - file_offset ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid scan block offset: %" PRIi64 " (0x%08" PRIx64 ") value out of bounds.",
+				 function,
+				 file_offset,
+				 file_offset );
 
-		if( read_count != (ssize_t) read_size )
+				goto on_error;
+			}
+			scan_data  = &( io_handle->file_data[ file_offset ] );
+			read_count = (ssize_t) read_size;
+		}
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read scan block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-			 function,
-			 file_offset,
-			 file_offset );
+			read_count = libbfio_handle_read_buffer_at_offset(
+				      file_io_handle,
+				      scan_block,
+				      read_size,
+				      file_offset,
+				      error );
 
-			goto on_error;
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read scan block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_offset,
+				 file_offset );
+
+				goto on_error;
+			}
+			scan_data = scan_block;
 		}
 		file_offset += read_count;
 
-		if( read_size >= 4 )
+		scan_block_offset = 0;
+
+		/* Only the offsets that contain one of the signatures drive the scan state
+		 * the end-of-file record signatures must be stored in consecutive values
+		 */
+		while( scan_block_offset < read_size )
 		{
-			for( scan_block_offset = 0;
-			     scan_block_offset < ( read_size - 4 );
-			     scan_block_offset += 4 )
+			result = libevt_signature_scanner_scan_buffer(
+			          signature_scanner,
+			          scan_data,
+			          read_size,
+			          &scan_block_offset,
+			          &signature_index,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to scan block for signatures.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			signature_offset = file_offset - read_count + scan_block_offset;
+
+			if( ( scan_state != LIBEVT_RECOVER_SCAN_STATE_START )
+			 && ( scan_state != LIBEVT_RECOVER_SCAN_STATE_FOUND_EOF_SIGNATURE4 )
+			 && ( signature_offset != ( last_signature_offset + 4 ) ) )
 			{
-				if( scan_state == LIBEVT_RECOVER_SCAN_STATE_START )
+				scan_state = LIBEVT_RECOVER_SCAN_STATE_START;
+			}
+			if( scan_state == LIBEVT_RECOVER_SCAN_STATE_START )
+			{
+				if( signature_index == LIBEVT_RECOVER_SCAN_SIGNATURE_EOF_SIGNATURE1 )
 				{
-					if( memory_compare(
-					     &( scan_block[ scan_block_offset ] ),
-					     evt_end_of_file_record_signature1,
-					     4 ) == 0 )
-					{
-						scan_state = LIBEVT_RECOVER_SCAN_STATE_FOUND_EOF_SIGNATURE1;
-					}
+					scan_state = LIBEVT_RECOVER_SCAN_STATE_FOUND_EOF_SIGNATURE1;
 				}
-				else if( scan_state == LIBEVT_RECOVER_SCAN_STATE_FOUND_EOF_SIGNATURE1 )
+			}
+			else if( scan_state == LIBEVT_RECOVER_SCAN_STATE_FOUND_EOF_SIGNATURE1 )
+			{
+				if( signature_index == LIBEVT_RECOVER_SCAN_SIGNATURE_EOF_SIGNATURE2 )
 				{
-					if( memory_compare(
-					     &( scan_block[ scan_block_offset ] ),
-					     evt_end_of_file_record_signature2,
-					     4 ) == 0 )
-					{
-						scan_state = LIBEVT_RECOVER_SCAN_STATE_FOUND_EOF_SIGNATURE2;
-					}
-					else
-					{
-						scan_state = LIBEVT_RECOVER_SCAN_STATE_START;
-					}
+					scan_state = LIBEVT_RECOVER_SCAN_STATE_FOUND_EOF_SIGNATURE2;
 				}
-				else if( scan_state == LIBEVT_RECOVER_SCAN_STATE_FOUND_EOF_SIGNATURE2 )
+				else
 				{
-					if( memory_compare(
-					     &( scan_block[ scan_block_offset ] ),
-					     evt_end_of_file_record_signature3,
-					     4 ) == 0 )
-					{
-						scan_state = LIBEVT_RECOVER_SCAN_STATE_FOUND_EOF_SIGNATURE3;
-					}
-					else
-					{
-						scan_state = LIBEVT_RECOVER_SCAN_STATE_START;
-					}
+					scan_state = LIBEVT_RECOVER_SCAN_STATE_START;
+				}
+			}
+			else if( scan_state == LIBEVT_RECOVER_SCAN_STATE_FOUND_EOF_SIGNATURE2 )
+			{
+				if( signature_index == LIBEVT_RECOVER_SCAN_SIGNATURE_EOF_SIGNATURE3 )
+				{
+					scan_state = LIBEVT_RECOVER_SCAN_STATE_FOUND_EOF_SIGNATURE3;
 				}
-				else if( scan_state == LIBEVT_RECOVER_SCAN_STATE_FOUND_EOF_SIGNATURE3 )
+				else
 				{
-					if( memory_compare(
-					     &( scan_block[ scan_block_offset ] ),
-					     evt_end_of_file_record_signature4,
-					     4 ) == 0 )
-					{
-						*end_of_file_record_offset = (uint32_t) ( file_offset - read_count + scan_block_offset - 16 );
+					scan_state = LIBEVT_RECOVER_SCAN_STATE_START;
+				}
+			}
+			else if( scan_state == LIBEVT_RECOVER_SCAN_STATE_FOUND_EOF_SIGNATURE3 )
+			{
+				if( signature_index == LIBEVT_RECOVER_SCAN_SIGNATURE_EOF_SIGNATURE4 )
+				{
+					*end_of_file_record_offset = (uint32_t) ( signature_offset - 16 );
 
-						scan_state = LIBEVT_RECOVER_SCAN_STATE_FOUND_EOF_SIGNATURE4;
-					}
-					else
-					{
-						scan_state = LIBEVT_RECOVER_SCAN_STATE_START;
-					}
+					scan_state = LIBEVT_RECOVER_SCAN_STATE_FOUND_EOF_SIGNATURE4;
 				}
-				else if( scan_state == LIBEVT_RECOVER_SCAN_STATE_FOUND_EOF_SIGNATURE4 )
+				else
 				{
-					if( memory_compare(
-					     &( scan_block[ scan_block_offset ] ),
-					     evt_file_signature,
-					     4 ) == 0 )
-					{
-						*first_record_offset = (uint32_t) ( file_offset - read_count + scan_block_offset - 4 );
+					scan_state = LIBEVT_RECOVER_SCAN_STATE_START;
+				}
+			}
+			else if( scan_state == LIBEVT_RECOVER_SCAN_STATE_FOUND_EOF_SIGNATURE4 )
+			{
+				if( signature_index == LIBEVT_RECOVER_SCAN_SIGNATURE_EVENT_RECORD )
+				{
+					*first_record_offset = (uint32_t) ( signature_offset - 4 );
 
-						scan_state = LIBEVT_RECOVER_SCAN_STATE_FOUND_RECORD_SIGNATURE;
+					scan_state = LIBEVT_RECOVER_SCAN_STATE_FOUND_RECORD_SIGNATURE;
 
-						break;
-					}
+					break;
 				}
 			}
+			last_signature_offset = signature_offset;
+
+			scan_block_offset += 4;
 		}
 		if( scan_state == LIBEVT_RECOVER_SCAN_STATE_FOUND_RECORD_SIGNATURE )
 		{
@@ -612,11 +1768,26 @@ int libevt_io_handle_end_of_file_record_scan(
 	while( ( scan_has_wrapped == 0 )
 	    || ( file_offset < initial_file_offset ) );
 
-	memory_free(
-	 scan_block );
+	if( scan_block != NULL )
+	{
+		memory_free(
+		 scan_block );
 
-	scan_block = NULL;
+		scan_block = NULL;
+	}
+	if( libevt_signature_scanner_free(
+	     &signature_scanner,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free signature scanner.",
+		 function );
 
+		goto on_error;
+	}
 	if( scan_state == LIBEVT_RECOVER_SCAN_STATE_FOUND_RECORD_SIGNATURE )
 	{
 		return( 1 );
@@ -629,10 +1800,17 @@ on_error:
 		memory_free(
 		 scan_block );
 	}
+	if( signature_scanner != NULL )
+	{
+		libevt_signature_scanner_free(
+		 &signature_scanner,
+		 NULL );
+	}
 	return( -1 );
 }
 
 /* Scans for the event record and adds them to the recovered records array
+ * If a record map is provided records that overlap or duplicate a record in the map are skipped
  * Returns 1 if successful, 0 if not or -1 on error
  */
 int libevt_io_handle_event_record_scan(
@@ -640,18 +1818,26 @@ int libevt_io_handle_event_record_scan(
      libbfio_handle_t *file_io_handle,
      off64_t file_offset,
      size64_t size,
+     libevt_record_map_t *record_map,
      libfdata_list_t *recovered_records_list,
      libcerror_error_t **error )
 {
-	libevt_record_values_t *record_values = NULL;
-	uint8_t *scan_block                   = NULL;
-	static char *function                 = "libevt_io_handle_event_record_scan";
-	off64_t record_offset                 = 0;
-	size_t read_size                      = 0;
-	size_t scan_block_offset              = 0;
-	size_t scan_block_size                = 8192;
-	ssize_t read_count                    = 0;
-	int element_index                     = 0;
+	libevt_record_values_t *record_values         = NULL;
+	libevt_signature_scanner_t *signature_scanner = NULL;
+	const uint8_t *scan_data                      = NULL;
+	uint8_t *scan_block                           = NULL;
+	static char *function                         = "libevt_io_handle_event_record_scan";
+	off64_t record_offset                         = 0;
+	size_t maximum_record_size                    = 0;
+	size_t read_size                              = 0;
+	size_t scan_block_offset                      = 0;
+	size_t scan_block_size                        = 8192;
+	ssize_t read_count                            = 0;
+	uint32_t creation_time                        = 0;
+	uint32_t record_number                        = 0;
+	int element_index                             = 0;
+	int result                                    = 0;
+	int signature_index                           = 0;
 
 	if( io_handle == NULL )
 	{
@@ -686,20 +1872,49 @@ int libevt_io_handle_event_record_scan(
 
 		return( -1 );
 	}
-	scan_block = (uint8_t *) memory_allocate(
-				  sizeof( uint8_t ) * scan_block_size );
-
-	if( scan_block == NULL )
+	/* A record cannot be larger than the data area of the file
+	 */
+	if( io_handle->file_size > (size64_t) sizeof( evt_file_header_t ) )
+	{
+		if( ( io_handle->file_size - sizeof( evt_file_header_t ) ) > (size64_t) SSIZE_MAX )
+		{
+			maximum_record_size = (size_t) SSIZE_MAX;
+		}
+		else
+		{
+			maximum_record_size = (size_t) ( io_handle->file_size - sizeof( evt_file_header_t ) );
+		}
+	}
+	if( libevt_io_handle_initialize_recover_scan_signature_scanner(
+	     &signature_scanner,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create scan block.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create signature scanner.",
 		 function );
 
 		goto on_error;
 	}
+	if( io_handle->file_data == NULL )
+	{
+		scan_block = (uint8_t *) memory_allocate(
+					  sizeof( uint8_t ) * scan_block_size );
+
+		if( scan_block == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create scan block.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	while( size >= 4 )
 	{
 		if( scan_block_size > size )
@@ -710,34 +1925,77 @@ int libevt_io_handle_event_record_scan(
 		{
 			read_size = scan_block_size;
 		}
-		read_count = libbfio_handle_read_buffer_at_offset(
-			      file_io_handle,
-			      scan_block,
-			      read_size,
-			      file_offset,
-			      error );
+		if( io_handle->file_data != NULL )
+		{
+			if( ( (size64_t) file_offset > io_handle->file_size )
+			 || ( (size64_t) read_size > ( io_handle->file_size - file_offset ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid scan block offset: %" PRIi64 " (0x%08" PRIx64 ") value out of bounds.",
+				 function,
+				 file_offset,
+				 file_offset );
 
-		if( read_count != (ssize_t) read_size )
+				goto on_error;
+			}
+			scan_data  = &( io_handle->file_data[ file_offset ] );
+			read_count = (ssize_t) read_size;
+		}
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read scan block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-			 function,
-			 file_offset,
-			 file_offset );
+			read_count = libbfio_handle_read_buffer_at_offset(
+				      file_io_handle,
+				      scan_block,
+				      read_size,
+				      file_offset,
+				      error );
 
-			goto on_error;
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read scan block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_offset,
+				 file_offset );
+
+				goto on_error;
+			}
+			scan_data = scan_block;
 		}
 		scan_block_offset = 0;
 
 		while( scan_block_offset <= ( read_size - 4 ) )
 		{
-			if( memory_compare(
-			     &( scan_block[ scan_block_offset ] ),
-			     evt_file_signature,
-			     4 ) != 0 )
+			result = libevt_signature_scanner_scan_buffer(
+			          signature_scanner,
+			          scan_data,
+			          read_size,
+			          &scan_block_offset,
+			          &signature_index,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to scan block for signatures.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			if( signature_index != LIBEVT_RECOVER_SCAN_SIGNATURE_EVENT_RECORD )
 			{
 				scan_block_offset += 4;
 
@@ -745,6 +2003,36 @@ int libevt_io_handle_event_record_scan(
 			}
 			record_offset = file_offset + scan_block_offset - 4;
 
+			/* Discard false positive matches using the data in the scan block
+			 * before reading the record
+			 */
+			if( scan_block_offset >= 4 )
+			{
+				result = libevt_event_record_check_data(
+				          &( scan_data[ scan_block_offset - 4 ] ),
+				          read_size - ( scan_block_offset - 4 ),
+				          maximum_record_size,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to check event record data at offset: %" PRIi64 ".",
+					 function,
+					 record_offset );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					scan_block_offset += 4;
+
+					continue;
+				}
+			}
 			if( record_values == NULL )
 			{
 				if( libevt_record_values_initialize(
@@ -808,7 +2096,75 @@ int libevt_io_handle_event_record_scan(
 
 				continue;
 			}
-			if( record_values->type == LIBEVT_RECORD_TYPE_EVENT )
+			result = 0;
+
+			if( ( record_values->type == LIBEVT_RECORD_TYPE_EVENT )
+			 && ( record_map != NULL ) )
+			{
+				if( libevt_record_values_get_number(
+				     record_values,
+				     &record_number,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve number of recovered record.",
+					 function );
+
+					goto on_error;
+				}
+				if( libevt_record_values_get_creation_time(
+				     record_values,
+				     &creation_time,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve creation time of recovered record.",
+					 function );
+
+					goto on_error;
+				}
+				result = libevt_record_map_check_record(
+				          record_map,
+				          file_offset + scan_block_offset - 4,
+				          (size64_t) read_count,
+				          io_handle->file_size,
+				          record_number,
+				          creation_time,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to check recovered record in record map.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result != 0 )
+				{
+#if defined( HAVE_DEBUG_OUTPUT )
+					if( libcnotify_verbose != 0 )
+					{
+						libcnotify_printf(
+						 "%s: skipping recovered record: %" PRIu32 " that overlaps or duplicates a record.\n",
+						 function,
+						 record_number );
+					}
+#endif
+					io_handle->number_of_duplicate_recovered_records += 1;
+				}
+			}
+			if( ( record_values->type == LIBEVT_RECORD_TYPE_EVENT )
+			 && ( result == 0 ) )
 			{
 				if( libfdata_list_append_element(
 				     recovered_records_list,
@@ -863,11 +2219,26 @@ int libevt_io_handle_event_record_scan(
 			goto on_error;
 		}
 	}
-	memory_free(
-	 scan_block );
+	if( scan_block != NULL )
+	{
+		memory_free(
+		 scan_block );
 
-	scan_block = NULL;
+		scan_block = NULL;
+	}
+	if( libevt_signature_scanner_free(
+	     &signature_scanner,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free signature scanner.",
+		 function );
 
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
@@ -882,10 +2253,17 @@ on_error:
 		memory_free(
 		 scan_block );
 	}
+	if( signature_scanner != NULL )
+	{
+		libevt_signature_scanner_free(
+		 &signature_scanner,
+		 NULL );
+	}
 	return( -1 );
 }
 
 /* Tries to recover records
+ * If a record map is provided recovered records that overlap or duplicate a record are skipped
  * Returns 1 if successful or -1 on error
  */
 int libevt_io_handle_recover_records(
@@ -896,6 +2274,7 @@ int libevt_io_handle_recover_records(
      off64_t last_record_offset,
      libfdata_list_t *records_list,
      libfdata_list_t *recovered_records_list,
+     libevt_record_map_t *record_map,
      libcerror_error_t **error )
 {
 	static char *function  = "libevt_io_handle_recover_records";
@@ -959,6 +2338,7 @@ int libevt_io_handle_recover_records(
 			          first_record_offset,
 			          end_of_file_record_offset,
 			          records_list,
+			          record_map,
 			          &last_record_offset,
 			          error );
 
@@ -1022,6 +2402,7 @@ int libevt_io_handle_recover_records(
 			     file_io_handle,
 			     (off64_t) sizeof( evt_file_header_t ),
 			     (size64_t) ( first_record_offset - sizeof( evt_file_header_t ) ),
+			     record_map,
 			     recovered_records_list,
 			     error ) != 1 )
 			{
@@ -1086,6 +2467,7 @@ int libevt_io_handle_recover_records(
 			     file_io_handle,
 			     last_record_offset,
 			     io_handle->file_size - last_record_offset,
+			     record_map,
 			     recovered_records_list,
 			     error ) != 1 )
 			{
@@ -1142,6 +2524,7 @@ int libevt_io_handle_recover_records(
 			     file_io_handle,
 			     last_record_offset,
 			     (size64_t) first_record_offset - last_record_offset,
+			     record_map,
 			     recovered_records_list,
 			     error ) != 1 )
 			{
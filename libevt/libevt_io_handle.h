@@ -25,10 +25,14 @@
 #include <common.h>
 #include <types.h>
 
+#include "libevt_arena.h"
+#include "libevt_file_data.h"
 #include "libevt_libbfio.h"
 #include "libevt_libcerror.h"
 #include "libevt_libfcache.h"
 #include "libevt_libfdata.h"
+#include "libevt_record_map.h"
+#include "libevt_signature_scanner.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -45,6 +49,16 @@ struct libevt_io_handle
 	 */
 	size64_t file_size;
 
+	/* The file data, when the file was read into memory
+	 */
+	uint8_t *file_data;
+
+	/* The file data read into memory by the IO handle, NULL when the file data
+	 * is provided by the caller. The file data is shared by reference with
+	 * the record views that use it
+	 */
+	libevt_file_data_t *managed_file_data;
+
 	/* Value to indicate the record data has wrapped
 	 */
 	uint8_t has_wrapped;
@@ -57,6 +71,14 @@ struct libevt_io_handle
 	 */
 	int ascii_codepage;
 
+	/* The number of recovered records that were skipped because they overlap or duplicate a record
+	 */
+	int number_of_duplicate_recovered_records;
+
+	/* The arena the event record data of parsed records is carved from, owned by the file, NULL if not used
+	 */
+	libevt_arena_t *arena;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -74,15 +96,61 @@ int libevt_io_handle_clear(
      libevt_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+int libevt_io_handle_read_file_data(
+     libevt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libevt_io_handle_reread_file_data(
+     libevt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libevt_io_handle_read_file_data_range(
+     libevt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t range_offset,
+     size64_t range_size,
+     libcerror_error_t **error );
+
+int libevt_io_handle_set_file_data(
+     libevt_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libevt_io_handle_read_record_data(
+     libevt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t record_offset,
+     size_t relative_offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libevt_io_handle_read_record_size(
+     libevt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t *file_offset,
+     uint8_t *has_wrapped,
+     uint32_t *record_size,
+     uint8_t *record_type,
+     libcerror_error_t **error );
+
 int libevt_io_handle_read_records(
      libevt_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      uint32_t first_record_offset,
      uint32_t end_of_file_record_offset,
      libfdata_list_t *records_list,
+     libevt_record_map_t *record_map,
      off64_t *last_record_offset,
      libcerror_error_t **error );
 
+int libevt_io_handle_initialize_recover_scan_signature_scanner(
+     libevt_signature_scanner_t **signature_scanner,
+     libcerror_error_t **error );
+
 int libevt_io_handle_end_of_file_record_scan(
      libevt_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
@@ -95,6 +163,7 @@ int libevt_io_handle_event_record_scan(
      libbfio_handle_t *file_io_handle,
      off64_t file_offset,
      size64_t size,
+     libevt_record_map_t *record_map,
      libfdata_list_t *recovered_records_list,
      libcerror_error_t **error );
 
@@ -106,6 +175,7 @@ int libevt_io_handle_recover_records(
      off64_t last_record_offset,
      libfdata_list_t *records_list,
      libfdata_list_t *recovered_records_list,
+     libevt_record_map_t *record_map,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
@@ -0,0 +1,127 @@
+/*
+ * Memory functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevt_libcerror.h"
+#include "libevt_memory.h"
+
+/* The allocator functions, if NULL the system allocator is used
+ */
+static void *(*libevt_memory_allocate_function)( size_t size )                 = NULL;
+static void *(*libevt_memory_reallocate_function)( void *buffer, size_t size ) = NULL;
+static void (*libevt_memory_free_function)( void *buffer )                     = NULL;
+
+/* Allocates memory using the allocator
+ * Returns a pointer to the allocated memory or NULL on error
+ */
+void *libevt_memory_allocate(
+       size_t size )
+{
+	if( libevt_memory_allocate_function != NULL )
+	{
+		return( libevt_memory_allocate_function(
+		         size ) );
+	}
+	return( memory_allocate(
+	         size ) );
+}
+
+/* Reallocates memory using the allocator
+ * Returns a pointer to the reallocated memory or NULL on error
+ */
+void *libevt_memory_reallocate(
+       void *buffer,
+       size_t size )
+{
+	if( libevt_memory_reallocate_function != NULL )
+	{
+		return( libevt_memory_reallocate_function(
+		         buffer,
+		         size ) );
+	}
+	return( memory_reallocate(
+	         buffer,
+	         size ) );
+}
+
+/* Frees memory using the allocator
+ */
+void libevt_memory_free(
+      void *buffer )
+{
+	if( libevt_memory_free_function != NULL )
+	{
+		libevt_memory_free_function(
+		 buffer );
+	}
+	else
+	{
+		memory_free(
+		 buffer );
+	}
+}
+
+/* Sets the allocator functions
+ * The allocator is used for the record values, event records and strings arrays
+ * created while parsing, and for the blocks of file arenas
+ * Either all functions are set or all are NULL, which restores the system allocator
+ * The allocator should be set before any file is opened, memory allocated with
+ * one allocator must not be freed by another
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_set_allocator(
+     void *(*allocate_function)(
+              size_t size ),
+     void *(*reallocate_function)(
+              void *buffer,
+              size_t size ),
+     void (*free_function)(
+            void *buffer ),
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_set_allocator";
+
+	if( ( ( allocate_function == NULL )
+	  &&  ( ( reallocate_function != NULL )
+	   ||   ( free_function != NULL ) ) )
+	 || ( ( allocate_function != NULL )
+	  &&  ( ( reallocate_function == NULL )
+	   ||   ( free_function == NULL ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocator functions - all or none must be set.",
+		 function );
+
+		return( -1 );
+	}
+	libevt_memory_allocate_function   = allocate_function;
+	libevt_memory_reallocate_function = reallocate_function;
+	libevt_memory_free_function       = free_function;
+
+	return( 1 );
+}
+
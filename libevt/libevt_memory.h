@@ -0,0 +1,61 @@
+/*
+ * Memory functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVT_MEMORY_H )
+#define _LIBEVT_MEMORY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevt_extern.h"
+#include "libevt_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+void *libevt_memory_allocate(
+       size_t size );
+
+void *libevt_memory_reallocate(
+       void *buffer,
+       size_t size );
+
+void libevt_memory_free(
+      void *buffer );
+
+LIBEVT_EXTERN \
+int libevt_set_allocator(
+     void *(*allocate_function)(
+              size_t size ),
+     void *(*reallocate_function)(
+              void *buffer,
+              size_t size ),
+     void (*free_function)(
+            void *buffer ),
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVT_MEMORY_H ) */
+
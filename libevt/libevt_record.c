@@ -40,6 +40,7 @@ int libevt_record_initialize(
      libevt_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libevt_record_values_t *record_values,
+     uint8_t flags,
      libcerror_error_t **error )
 {
 	libevt_internal_record_t *internal_record = NULL;
@@ -78,6 +79,18 @@ int libevt_record_initialize(
 
 		return( -1 );
 	}
+	if( ( flags & ~( LIBEVT_RECORD_FLAG_MANAGED_RECORD_VALUES ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
 	internal_record = memory_allocate_structure(
 	                   libevt_internal_record_t );
 
@@ -127,6 +140,7 @@ int libevt_record_initialize(
 	internal_record->file_io_handle = file_io_handle;
 	internal_record->io_handle      = io_handle;
 	internal_record->record_values  = record_values;
+	internal_record->flags          = flags;
 
 	*record = (libevt_record_t *) internal_record;
 
@@ -183,7 +197,24 @@ int libevt_record_free(
 			result = -1;
 		}
 #endif
-		/* The file_io_handle, io_handle and record_values references are freed elsewhere
+		if( ( internal_record->flags & LIBEVT_RECORD_FLAG_MANAGED_RECORD_VALUES ) != 0 )
+		{
+			if( libevt_record_values_free(
+			     &( internal_record->record_values ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record values.",
+				 function );
+
+				result = -1;
+			}
+		}
+		/* The file_io_handle and io_handle references are freed elsewhere
+		 * the record_values reference is freed elsewhere unless managed by the record
 		 */
 		memory_free(
 		 internal_record );
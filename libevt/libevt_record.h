@@ -53,6 +53,10 @@ struct libevt_internal_record
 	 */
 	libevt_record_values_t *record_values;
 
+	/* The flags
+	 */
+	uint8_t flags;
+
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
@@ -65,6 +69,7 @@ int libevt_record_initialize(
      libevt_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libevt_record_values_t *record_values,
+     uint8_t flags,
      libcerror_error_t **error );
 
 LIBEVT_EXTERN \
@@ -0,0 +1,644 @@
+/*
+ * Allocated record map functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libevt_libcerror.h"
+#include "libevt_record_map.h"
+
+#include "evt_file_header.h"
+
+/* Creates a record map
+ * Make sure the value record_map is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_map_initialize(
+     libevt_record_map_t **record_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_record_map_initialize";
+
+	if( record_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*record_map = memory_allocate_structure(
+	               libevt_record_map_t );
+
+	if( *record_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record map.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *record_map,
+	     0,
+	     sizeof( libevt_record_map_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record map.",
+		 function );
+
+		goto on_error;
+	}
+	( *record_map )->is_sorted = 1;
+
+	return( 1 );
+
+on_error:
+	if( *record_map != NULL )
+	{
+		memory_free(
+		 *record_map );
+
+		*record_map = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a record map
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_map_free(
+     libevt_record_map_t **record_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_record_map_free";
+
+	if( record_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_map != NULL )
+	{
+		if( ( *record_map )->keys != NULL )
+		{
+			memory_free(
+			 ( *record_map )->keys );
+		}
+		if( ( *record_map )->ranges != NULL )
+		{
+			memory_free(
+			 ( *record_map )->ranges );
+		}
+		memory_free(
+		 *record_map );
+
+		*record_map = NULL;
+	}
+	return( 1 );
+}
+
+/* Compares two record map ranges
+ * Ranges are ordered by start offset
+ * Returns -1 if the first range is less than the second, 0 if equal or 1 if greater
+ */
+int libevt_record_map_range_compare(
+     const void *first_range,
+     const void *second_range )
+{
+	const libevt_record_map_range_t *first_map_range  = (const libevt_record_map_range_t *) first_range;
+	const libevt_record_map_range_t *second_map_range = (const libevt_record_map_range_t *) second_range;
+
+	if( first_map_range->start_offset < second_map_range->start_offset )
+	{
+		return( -1 );
+	}
+	else if( first_map_range->start_offset > second_map_range->start_offset )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Compares two record map keys
+ * Keys are ordered by record number and then by creation time
+ * Returns -1 if the first key is less than the second, 0 if equal or 1 if greater
+ */
+int libevt_record_map_key_compare(
+     const void *first_key,
+     const void *second_key )
+{
+	const libevt_record_map_key_t *first_map_key  = (const libevt_record_map_key_t *) first_key;
+	const libevt_record_map_key_t *second_map_key = (const libevt_record_map_key_t *) second_key;
+
+	if( first_map_key->record_number < second_map_key->record_number )
+	{
+		return( -1 );
+	}
+	else if( first_map_key->record_number > second_map_key->record_number )
+	{
+		return( 1 );
+	}
+	if( first_map_key->creation_time < second_map_key->creation_time )
+	{
+		return( -1 );
+	}
+	else if( first_map_key->creation_time > second_map_key->creation_time )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Appends a range of record data to the record map
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_map_append_range(
+     libevt_record_map_t *record_map,
+     off64_t start_offset,
+     off64_t end_offset,
+     libcerror_error_t **error )
+{
+	libevt_record_map_range_t *ranges = NULL;
+	static char *function             = "libevt_record_map_append_range";
+	int maximum_number_of_ranges      = 0;
+	int range_index                   = 0;
+
+	if( record_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record map.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( start_offset < 0 )
+	 || ( end_offset <= start_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_map->number_of_ranges >= record_map->maximum_number_of_ranges )
+	{
+		if( record_map->maximum_number_of_ranges == 0 )
+		{
+			maximum_number_of_ranges = 256;
+		}
+		else if( (size_t) record_map->maximum_number_of_ranges >= ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( libevt_record_map_range_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid record map - maximum number of ranges value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			maximum_number_of_ranges = 2 * record_map->maximum_number_of_ranges;
+		}
+		ranges = (libevt_record_map_range_t *) memory_reallocate(
+		                                        record_map->ranges,
+		                                        sizeof( libevt_record_map_range_t ) * (size_t) maximum_number_of_ranges );
+
+		if( ranges == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize ranges.",
+			 function );
+
+			return( -1 );
+		}
+		record_map->ranges                   = ranges;
+		record_map->maximum_number_of_ranges = maximum_number_of_ranges;
+	}
+	range_index = record_map->number_of_ranges;
+
+	record_map->ranges[ range_index ].start_offset = start_offset;
+	record_map->ranges[ range_index ].end_offset   = end_offset;
+
+	/* Records are appended in ring order hence sorting is only needed after the record data has wrapped
+	 */
+	if( ( range_index > 0 )
+	 && ( libevt_record_map_range_compare(
+	       &( record_map->ranges[ range_index - 1 ] ),
+	       &( record_map->ranges[ range_index ] ) ) > 0 ) )
+	{
+		record_map->is_sorted = 0;
+	}
+	record_map->number_of_ranges += 1;
+
+	return( 1 );
+}
+
+/* Appends a record to the record map
+ * Record data that wraps at the end of the file is stored as 2 ranges
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_map_append_record(
+     libevt_record_map_t *record_map,
+     off64_t record_offset,
+     size64_t record_size,
+     size64_t file_size,
+     uint32_t record_number,
+     uint32_t creation_time,
+     libcerror_error_t **error )
+{
+	libevt_record_map_key_t *keys = NULL;
+	static char *function         = "libevt_record_map_append_record";
+	size64_t remaining_size       = 0;
+	int key_index                 = 0;
+	int maximum_number_of_keys    = 0;
+
+	if( record_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record map.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_offset < (off64_t) sizeof( evt_file_header_t ) )
+	 || ( (size64_t) record_offset >= file_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_size == 0 )
+	 || ( record_size > ( file_size - sizeof( evt_file_header_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	remaining_size = file_size - (size64_t) record_offset;
+
+	if( record_size <= remaining_size )
+	{
+		remaining_size = record_size;
+	}
+	if( libevt_record_map_append_range(
+	     record_map,
+	     record_offset,
+	     record_offset + (off64_t) remaining_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append range.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_size > remaining_size )
+	{
+		if( libevt_record_map_append_range(
+		     record_map,
+		     (off64_t) sizeof( evt_file_header_t ),
+		     (off64_t) ( sizeof( evt_file_header_t ) + ( record_size - remaining_size ) ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append wrapped range.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( record_map->number_of_keys >= record_map->maximum_number_of_keys )
+	{
+		if( record_map->maximum_number_of_keys == 0 )
+		{
+			maximum_number_of_keys = 256;
+		}
+		else if( (size_t) record_map->maximum_number_of_keys >= ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( libevt_record_map_key_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid record map - maximum number of keys value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			maximum_number_of_keys = 2 * record_map->maximum_number_of_keys;
+		}
+		keys = (libevt_record_map_key_t *) memory_reallocate(
+		                                    record_map->keys,
+		                                    sizeof( libevt_record_map_key_t ) * (size_t) maximum_number_of_keys );
+
+		if( keys == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize keys.",
+			 function );
+
+			return( -1 );
+		}
+		record_map->keys                   = keys;
+		record_map->maximum_number_of_keys = maximum_number_of_keys;
+	}
+	key_index = record_map->number_of_keys;
+
+	record_map->keys[ key_index ].record_number = record_number;
+	record_map->keys[ key_index ].creation_time = creation_time;
+
+	/* Record numbers are mostly increasing hence sorting can typically be skipped
+	 */
+	if( ( key_index > 0 )
+	 && ( libevt_record_map_key_compare(
+	       &( record_map->keys[ key_index - 1 ] ),
+	       &( record_map->keys[ key_index ] ) ) > 0 ) )
+	{
+		record_map->is_sorted = 0;
+	}
+	record_map->number_of_keys += 1;
+
+	return( 1 );
+}
+
+/* Sorts the ranges and keys of the record map
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_map_sort(
+     libevt_record_map_t *record_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_record_map_sort";
+
+	if( record_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record map.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_map->is_sorted == 0 )
+	{
+		if( record_map->number_of_ranges > 1 )
+		{
+			qsort(
+			 record_map->ranges,
+			 (size_t) record_map->number_of_ranges,
+			 sizeof( libevt_record_map_range_t ),
+			 &libevt_record_map_range_compare );
+		}
+		if( record_map->number_of_keys > 1 )
+		{
+			qsort(
+			 record_map->keys,
+			 (size_t) record_map->number_of_keys,
+			 sizeof( libevt_record_map_key_t ),
+			 &libevt_record_map_key_compare );
+		}
+		record_map->is_sorted = 1;
+	}
+	return( 1 );
+}
+
+/* Determines if a range overlaps with the record data in the record map
+ * The ranges in the record map must be sorted and cannot overlap each other
+ * Returns 1 if the range overlaps or 0 if not
+ */
+int libevt_record_map_overlaps_range(
+     libevt_record_map_t *record_map,
+     off64_t start_offset,
+     off64_t end_offset )
+{
+	int lower_index = 0;
+	int range_index = 0;
+	int upper_index = 0;
+
+	if( record_map == NULL )
+	{
+		return( 0 );
+	}
+	/* Find the last range that starts before the end offset, since the ranges
+	 * do not overlap it is the only range that can overlap the start offset
+	 */
+	upper_index = record_map->number_of_ranges;
+
+	while( lower_index < upper_index )
+	{
+		range_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( record_map->ranges[ range_index ].start_offset < end_offset )
+		{
+			lower_index = range_index + 1;
+		}
+		else
+		{
+			upper_index = range_index;
+		}
+	}
+	if( lower_index == 0 )
+	{
+		return( 0 );
+	}
+	if( record_map->ranges[ lower_index - 1 ].end_offset > start_offset )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Determines if a (recovered) record overlaps with or duplicates a record in the record map
+ * A record is considered a duplicate if the record number and creation time are equal
+ * Returns 1 if the record overlaps or duplicates, 0 if not or -1 on error
+ */
+int libevt_record_map_check_record(
+     libevt_record_map_t *record_map,
+     off64_t record_offset,
+     size64_t record_size,
+     size64_t file_size,
+     uint32_t record_number,
+     uint32_t creation_time,
+     libcerror_error_t **error )
+{
+	libevt_record_map_key_t key;
+
+	static char *function   = "libevt_record_map_check_record";
+	size64_t remaining_size = 0;
+
+	if( record_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record map.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_offset < (off64_t) sizeof( evt_file_header_t ) )
+	 || ( (size64_t) record_offset >= file_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_size == 0 )
+	 || ( record_size > ( file_size - sizeof( evt_file_header_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevt_record_map_sort(
+	     record_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to sort record map.",
+		 function );
+
+		return( -1 );
+	}
+	remaining_size = file_size - (size64_t) record_offset;
+
+	if( record_size <= remaining_size )
+	{
+		remaining_size = record_size;
+	}
+	if( libevt_record_map_overlaps_range(
+	     record_map,
+	     record_offset,
+	     record_offset + (off64_t) remaining_size ) != 0 )
+	{
+		return( 1 );
+	}
+	if( record_size > remaining_size )
+	{
+		if( libevt_record_map_overlaps_range(
+		     record_map,
+		     (off64_t) sizeof( evt_file_header_t ),
+		     (off64_t) ( sizeof( evt_file_header_t ) + ( record_size - remaining_size ) ) ) != 0 )
+		{
+			return( 1 );
+		}
+	}
+	if( record_map->number_of_keys == 0 )
+	{
+		return( 0 );
+	}
+	key.record_number = record_number;
+	key.creation_time = creation_time;
+
+	if( bsearch(
+	     &key,
+	     record_map->keys,
+	     (size_t) record_map->number_of_keys,
+	     sizeof( libevt_record_map_key_t ),
+	     &libevt_record_map_key_compare ) != NULL )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
@@ -0,0 +1,147 @@
+/*
+ * Allocated record map functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVT_RECORD_MAP_H )
+#define _LIBEVT_RECORD_MAP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevt_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevt_record_map_range libevt_record_map_range_t;
+
+struct libevt_record_map_range
+{
+	/* The start offset
+	 */
+	off64_t start_offset;
+
+	/* The end offset
+	 */
+	off64_t end_offset;
+};
+
+typedef struct libevt_record_map_key libevt_record_map_key_t;
+
+struct libevt_record_map_key
+{
+	/* The record number
+	 */
+	uint32_t record_number;
+
+	/* The creation time
+	 */
+	uint32_t creation_time;
+};
+
+typedef struct libevt_record_map libevt_record_map_t;
+
+struct libevt_record_map
+{
+	/* The ranges of the record data
+	 */
+	libevt_record_map_range_t *ranges;
+
+	/* The number of ranges
+	 */
+	int number_of_ranges;
+
+	/* The maximum number of ranges
+	 */
+	int maximum_number_of_ranges;
+
+	/* The keys of the records
+	 */
+	libevt_record_map_key_t *keys;
+
+	/* The number of keys
+	 */
+	int number_of_keys;
+
+	/* The maximum number of keys
+	 */
+	int maximum_number_of_keys;
+
+	/* Value to indicate the ranges and keys are sorted
+	 */
+	uint8_t is_sorted;
+};
+
+int libevt_record_map_initialize(
+     libevt_record_map_t **record_map,
+     libcerror_error_t **error );
+
+int libevt_record_map_free(
+     libevt_record_map_t **record_map,
+     libcerror_error_t **error );
+
+int libevt_record_map_range_compare(
+     const void *first_range,
+     const void *second_range );
+
+int libevt_record_map_key_compare(
+     const void *first_key,
+     const void *second_key );
+
+int libevt_record_map_append_range(
+     libevt_record_map_t *record_map,
+     off64_t start_offset,
+     off64_t end_offset,
+     libcerror_error_t **error );
+
+int libevt_record_map_append_record(
+     libevt_record_map_t *record_map,
+     off64_t record_offset,
+     size64_t record_size,
+     size64_t file_size,
+     uint32_t record_number,
+     uint32_t creation_time,
+     libcerror_error_t **error );
+
+int libevt_record_map_sort(
+     libevt_record_map_t *record_map,
+     libcerror_error_t **error );
+
+int libevt_record_map_overlaps_range(
+     libevt_record_map_t *record_map,
+     off64_t start_offset,
+     off64_t end_offset );
+
+int libevt_record_map_check_record(
+     libevt_record_map_t *record_map,
+     off64_t record_offset,
+     size64_t record_size,
+     size64_t file_size,
+     uint32_t record_number,
+     uint32_t creation_time,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVT_RECORD_MAP_H ) */
+
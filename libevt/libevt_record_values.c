@@ -25,6 +25,7 @@
 #include <system_string.h>
 #include <types.h>
 
+#include "libevt_arena.h"
 #include "libevt_debug.h"
 #include "libevt_end_of_file_record.h"
 #include "libevt_event_record.h"
@@ -32,8 +33,10 @@
 #include "libevt_libbfio.h"
 #include "libevt_libcerror.h"
 #include "libevt_libcnotify.h"
+#include "libevt_libcthreads.h"
 #include "libevt_libfdatetime.h"
 #include "libevt_libfwnt.h"
+#include "libevt_memory.h"
 #include "libevt_record_values.h"
 #include "libevt_unused.h"
 
@@ -72,8 +75,8 @@ int libevt_record_values_initialize(
 
 		return( -1 );
 	}
-	*record_values = memory_allocate_structure(
-	                  libevt_record_values_t );
+	*record_values = (libevt_record_values_t *) libevt_memory_allocate(
+	                                             sizeof( libevt_record_values_t ) );
 
 	if( *record_values == NULL )
 	{
@@ -100,12 +103,29 @@ int libevt_record_values_initialize(
 
 		goto on_error;
 	}
+	( *record_values )->number_of_references = 1;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *record_values )->references_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize references mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	return( 1 );
 
 on_error:
 	if( *record_values != NULL )
 	{
-		memory_free(
+		libevt_memory_free(
 		 *record_values );
 
 		*record_values = NULL;
@@ -114,14 +134,18 @@ on_error:
 }
 
 /* Frees record values
+ * The record values are shared by reference, the record values are only freed
+ * when the last reference is released
  * Returns 1 if successful or -1 on error
  */
 int libevt_record_values_free(
      libevt_record_values_t **record_values,
      libcerror_error_t **error )
 {
-	static char *function = "libevt_record_values_free";
-	int result            = 1;
+	libevt_record_values_t *safe_record_values = NULL;
+	static char *function                      = "libevt_record_values_free";
+	int number_of_references                   = 0;
+	int result                                 = 1;
 
 	if( record_values == NULL )
 	{
@@ -136,10 +160,51 @@ int libevt_record_values_free(
 	}
 	if( *record_values != NULL )
 	{
-		if( ( *record_values )->event_record != NULL )
+		safe_record_values = *record_values;
+		*record_values     = NULL;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     safe_record_values->references_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab references mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		safe_record_values->number_of_references -= 1;
+
+		number_of_references = safe_record_values->number_of_references;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     safe_record_values->references_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release references mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( number_of_references > 0 )
+		{
+			return( 1 );
+		}
+		if( safe_record_values->event_record != NULL )
 		{
 			if( libevt_event_record_free(
-			     &( ( *record_values )->event_record ),
+			     &( safe_record_values->event_record ),
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -152,14 +217,86 @@ int libevt_record_values_free(
 				result = -1;
 			}
 		}
-		memory_free(
-		 *record_values );
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+		if( safe_record_values->references_mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( safe_record_values->references_mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free references mutex.",
+				 function );
 
-		*record_values = NULL;
+				result = -1;
+			}
+		}
+#endif
+		libevt_memory_free(
+		 safe_record_values );
 	}
 	return( result );
 }
 
+/* Adds a reference to the record values
+ * Every reference must be released with libevt_record_values_free
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_values_add_reference(
+     libevt_record_values_t *record_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_record_values_add_reference";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     record_values->references_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab references mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	record_values->number_of_references += 1;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     record_values->references_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release references mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
 /* Reads a record_values
  * Returns the number of bytes read if successful or -1 on error
  */
@@ -174,15 +311,12 @@ ssize_t libevt_record_values_read_file_io_handle(
 {
 	uint8_t record_size_data[ 4 ];
 
-	libevt_end_of_file_record_t *end_of_file_record = NULL;
-	uint8_t *record_data                            = NULL;
-	static char *function                           = "libevt_record_values_read_file_io_handle";
-	size_t read_size                                = 0;
-	size_t record_data_offset                       = 0;
-	ssize_t read_count                              = 0;
-	ssize_t total_read_count                        = 0;
-	off64_t safe_file_offset                        = 0;
-	uint32_t record_data_size                       = 0;
+	const uint8_t *record_data  = NULL;
+	uint8_t *record_data_buffer = NULL;
+	static char *function       = "libevt_record_values_read_file_io_handle";
+	ssize_t read_count          = 0;
+	off64_t safe_file_offset    = 0;
+	uint32_t record_data_size   = 0;
 
 	if( record_values == NULL )
 	{
@@ -230,34 +364,52 @@ ssize_t libevt_record_values_read_file_io_handle(
 	}
 	safe_file_offset = *file_offset;
 
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              record_size_data,
-	              sizeof( uint32_t ),
-	              safe_file_offset,
-	              error );
-
-	if( read_count != (ssize_t) sizeof( uint32_t ) )
+	if( io_handle->file_data != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read record size data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 safe_file_offset,
-		 safe_file_offset );
+		if( ( safe_file_offset < 0 )
+		 || ( (size64_t) safe_file_offset >= io_handle->file_size )
+		 || ( ( io_handle->file_size - safe_file_offset ) < 4 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid file offset value out of bounds.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( io_handle->file_data[ safe_file_offset ] ),
+		 record_data_size );
 	}
-	record_values->offset = safe_file_offset;
+	else
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              record_size_data,
+		              sizeof( uint32_t ),
+		              safe_file_offset,
+		              error );
 
-	safe_file_offset += read_count;
-	total_read_count  = read_count;
+		if( read_count != (ssize_t) sizeof( uint32_t ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record size data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 safe_file_offset,
+			 safe_file_offset );
 
-	byte_stream_copy_to_uint32_little_endian(
-	 record_size_data,
-	 record_data_size );
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 record_size_data,
+		 record_data_size );
+	}
+	record_values->offset = safe_file_offset;
 
 	if( ( record_data_size < 8 )
 	 || ( record_data_size > (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
@@ -271,108 +423,172 @@ ssize_t libevt_record_values_read_file_io_handle(
 
 		goto on_error;
 	}
-	/* Allocating record data as 4 bytes and then using realloc here
-	 * corrupts the memory
-	 */
-	record_data = (uint8_t *) memory_allocate(
-	                           sizeof( uint8_t ) * record_data_size );
-
-	if( record_data == NULL )
+	if( ( io_handle->file_data != NULL )
+	 && ( (size64_t) record_data_size <= ( io_handle->file_size - safe_file_offset ) ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create record data.",
-		 function );
+		/* The record data is contiguous in the file data and can be used directly
+		 */
+		record_data = &( io_handle->file_data[ safe_file_offset ] );
 
-		goto on_error;
+		safe_file_offset += record_data_size;
 	}
-	byte_stream_copy_from_uint32_little_endian(
-	 record_data,
-	 record_data_size );
+	else
+	{
+		/* Allocating record data as 4 bytes and then using realloc here
+		 * corrupts the memory
+		 */
+		record_data_buffer = (uint8_t *) libevt_memory_allocate(
+		                                  sizeof( uint8_t ) * record_data_size );
 
-	record_data_offset = 4;
+		if( record_data_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create record data.",
+			 function );
 
-	read_size = record_data_size - record_data_offset;
+			goto on_error;
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 record_data_buffer,
+		 record_data_size );
 
-	if( ( (size64_t) safe_file_offset > io_handle->file_size )
-	 || ( read_size > ( io_handle->file_size - safe_file_offset ) ) )
-	{
-		read_size = (size_t) ( io_handle->file_size - safe_file_offset );
-	}
-	read_count = libbfio_handle_read_buffer(
-	              file_io_handle,
-	              &( record_data[ record_data_offset ] ),
-	              read_size,
-	              error );
+		if( ( (size64_t) safe_file_offset > io_handle->file_size )
+		 || ( (size64_t) record_data_size > ( io_handle->file_size - safe_file_offset ) ) )
+		{
+			if( *has_wrapped != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid IO handle - record data has already wrapped.",
+				 function );
+
+				goto on_error;
+			}
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: record data wrapped at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+				 function,
+				 io_handle->file_size,
+				 io_handle->file_size );
+			}
+#endif
+			*has_wrapped = 1;
+		}
+		if( libevt_io_handle_read_record_data(
+		     io_handle,
+		     file_io_handle,
+		     safe_file_offset,
+		     4,
+		     &( record_data_buffer[ 4 ] ),
+		     (size_t) record_data_size - 4,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record data.",
+			 function );
+
+			goto on_error;
+		}
+		safe_file_offset += record_data_size;
 
-	if( read_count != (ssize_t) read_size )
+		if( (size64_t) safe_file_offset > io_handle->file_size )
+		{
+			safe_file_offset -= (off64_t) ( io_handle->file_size - sizeof( evt_file_header_t ) );
+		}
+		record_data = record_data_buffer;
+	}
+	if( libevt_record_values_read_data(
+	     record_values,
+	     record_data,
+	     (size_t) record_data_size,
+	     strict_mode,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read record data.",
+		 "%s: unable to read record values.",
 		 function );
 
 		goto on_error;
 	}
-	safe_file_offset   += read_count;
-	record_data_offset += read_count;
-	total_read_count   += read_count;
+	if( record_data_buffer != NULL )
+	{
+		libevt_memory_free(
+		 record_data_buffer );
+	}
+	*file_offset = safe_file_offset;
 
-	if( record_data_offset < (size_t) record_data_size )
+	return( (ssize_t) record_data_size );
+
+on_error:
+	if( record_data_buffer != NULL )
 	{
-		if( *has_wrapped != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid IO handle - record data has already wrapped.",
-			 function );
+		libevt_memory_free(
+		 record_data_buffer );
+	}
+	*file_offset = safe_file_offset;
 
-			goto on_error;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: record data wrapped at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
-			 function,
-			 safe_file_offset,
-			 safe_file_offset );
-		}
-#endif
-		*has_wrapped = 1;
+	return( -1 );
+}
 
-		safe_file_offset = (off64_t) sizeof( evt_file_header_t );
+/* Reads the record values from the record data
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_values_read_data(
+     libevt_record_values_t *record_values,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     uint8_t strict_mode,
+     libcerror_error_t **error )
+{
+	libevt_end_of_file_record_t *end_of_file_record = NULL;
+	static char *function                           = "libevt_record_values_read_data";
 
-		read_size = (size_t) record_data_size - record_data_offset;
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
 
-		read_count = libbfio_handle_read_buffer_at_offset(
-		              file_io_handle,
-		              &( record_data[ record_data_offset ] ),
-		              read_size,
-		              safe_file_offset,
-		              error );
+		return( -1 );
+	}
+	if( record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record data.",
+		 function );
 
-		if( read_count != (ssize_t) read_size )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read record data at offset: %" PRIzd " (0x%08" PRIzx ").",
-			 function,
-			 safe_file_offset,
-			 safe_file_offset );
+		return( -1 );
+	}
+	if( ( record_data_size < 8 )
+	 || ( record_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record data size value out of bounds.",
+		 function );
 
-			goto on_error;
-		}
-		safe_file_offset += read_count;
-		total_read_count += read_count;
+		return( -1 );
 	}
 	if( memory_compare(
 	     &( record_data[ 4 ] ),
@@ -398,7 +614,7 @@ ssize_t libevt_record_values_read_file_io_handle(
 			 function );
 			libcnotify_print_data(
 			 record_data,
-			 (size_t) record_data_size,
+			 record_data_size,
 			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 		}
 #endif
@@ -416,7 +632,7 @@ ssize_t libevt_record_values_read_file_io_handle(
 		if( libevt_record_values_read_event(
 		     record_values,
 		     record_data,
-		     (size_t) record_data_size,
+		     record_data_size,
 		     strict_mode,
 		     error ) != 1 )
 		{
@@ -448,7 +664,7 @@ ssize_t libevt_record_values_read_file_io_handle(
 		if( libevt_end_of_file_record_read_data(
 		     end_of_file_record,
 		     record_data,
-		     (size_t) record_data_size,
+		     record_data_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -474,12 +690,7 @@ ssize_t libevt_record_values_read_file_io_handle(
 			goto on_error;
 		}
 	}
-	memory_free(
-	 record_data );
-
-	*file_offset = safe_file_offset;
-
-	return( total_read_count );
+	return( 1 );
 
 on_error:
 	if( end_of_file_record != NULL )
@@ -488,13 +699,6 @@ on_error:
 		 &end_of_file_record,
 		 NULL );
 	}
-	if( record_data != NULL )
-	{
-		memory_free(
-		 record_data );
-	}
-	*file_offset = safe_file_offset;
-
 	return( -1 );
 }
 
@@ -503,7 +707,7 @@ on_error:
  */
 int libevt_record_values_read_event(
      libevt_record_values_t *record_values,
-     uint8_t *record_data,
+     const uint8_t *record_data,
      size_t record_data_size,
      uint8_t strict_mode,
      libcerror_error_t **error )
@@ -535,6 +739,8 @@ int libevt_record_values_read_event(
 
 		goto on_error;
 	}
+	event_record->arena = record_values->arena;
+
 	if( libevt_event_record_read_data(
 	     event_record,
 	     record_data,
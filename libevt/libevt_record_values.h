@@ -25,10 +25,12 @@
 #include <common.h>
 #include <types.h>
 
+#include "libevt_arena.h"
 #include "libevt_event_record.h"
 #include "libevt_io_handle.h"
 #include "libevt_libbfio.h"
 #include "libevt_libcerror.h"
+#include "libevt_libcthreads.h"
 #include "libevt_libfcache.h"
 #include "libevt_libfdata.h"
 
@@ -61,6 +63,20 @@ struct libevt_record_values
 	/* The event record
 	 */
 	libevt_event_record_t *event_record;
+
+	/* The arena the event record data is carved from, NULL if not used
+	 */
+	libevt_arena_t *arena;
+
+	/* The number of references
+	 */
+	int number_of_references;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	/* The references mutex
+	 */
+	libcthreads_mutex_t *references_mutex;
+#endif
 };
 
 int libevt_record_values_initialize(
@@ -71,6 +87,10 @@ int libevt_record_values_free(
      libevt_record_values_t **record_values,
      libcerror_error_t **error );
 
+int libevt_record_values_add_reference(
+     libevt_record_values_t *record_values,
+     libcerror_error_t **error );
+
 ssize_t libevt_record_values_read_file_io_handle(
          libevt_record_values_t *record_values,
          libbfio_handle_t *file_io_handle,
@@ -80,9 +100,16 @@ ssize_t libevt_record_values_read_file_io_handle(
          uint8_t strict_mode,
          libcerror_error_t **error );
 
+int libevt_record_values_read_data(
+     libevt_record_values_t *record_values,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     uint8_t strict_mode,
+     libcerror_error_t **error );
+
 int libevt_record_values_read_event(
      libevt_record_values_t *record_values,
-     uint8_t *record_values_data,
+     const uint8_t *record_values_data,
      size_t record_values_data_size,
      uint8_t strict_mode,
      libcerror_error_t **error );
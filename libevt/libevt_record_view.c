@@ -0,0 +1,2388 @@
+/*
+ * Record view functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevt_io_handle.h"
+#include "libevt_libbfio.h"
+#include "libevt_libcerror.h"
+#include "libevt_libfwnt.h"
+#include "libevt_libuna.h"
+#include "libevt_record_view.h"
+
+#include "evt_event_record.h"
+
+/* Creates a record view
+ * Make sure the value record_view is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_view_initialize(
+     libevt_record_view_t **record_view,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_view_t *internal_record_view = NULL;
+	static char *function                               = "libevt_record_view_initialize";
+
+	if( record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_view != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record view value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_view = memory_allocate_structure(
+	                        libevt_internal_record_view_t );
+
+	if( internal_record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record view.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_record_view,
+	     0,
+	     sizeof( libevt_internal_record_view_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record view.",
+		 function );
+
+		goto on_error;
+	}
+	*record_view = (libevt_record_view_t *) internal_record_view;
+
+	return( 1 );
+
+on_error:
+	if( internal_record_view != NULL )
+	{
+		memory_free(
+		 internal_record_view );
+	}
+	return( -1 );
+}
+
+/* Frees a record view
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_view_free(
+     libevt_record_view_t **record_view,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_view_t *internal_record_view = NULL;
+	static char *function                               = "libevt_record_view_free";
+	int result                                          = 1;
+
+	if( record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_view != NULL )
+	{
+		internal_record_view = (libevt_internal_record_view_t *) *record_view;
+		*record_view         = NULL;
+
+		if( internal_record_view->user_security_identifier != NULL )
+		{
+			if( libfwnt_security_identifier_free(
+			     &( internal_record_view->user_security_identifier ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free user security identifier.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_record_view->file_data != NULL )
+		{
+			if( libevt_file_data_free(
+			     &( internal_record_view->file_data ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file data.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_record_view->data_buffer != NULL )
+		{
+			memory_free(
+			 internal_record_view->data_buffer );
+		}
+		/* The data is either stored in the data buffer, the managed file data
+		 * or in file data provided by the caller
+		 */
+		memory_free(
+		 internal_record_view );
+	}
+	return( result );
+}
+
+/* Sets the record view to point to the event record data
+ * The data is not copied and must remain available while the record view is used
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_view_set_data(
+     libevt_internal_record_view_t *internal_record_view,
+     off64_t record_offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function                    = "libevt_record_view_set_data";
+	size_t data_offset                       = 0;
+	size_t maximum_data_size                 = 0;
+	size_t maximum_strings_data_size         = 0;
+	uint32_t event_data_offset               = 0;
+	uint32_t event_data_size                 = 0;
+	uint32_t event_strings_offset            = 0;
+	uint32_t user_security_identifier_offset = 0;
+	uint32_t user_security_identifier_size   = 0;
+	uint16_t number_of_event_strings         = 0;
+
+	if( internal_record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( evt_event_record_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_view->data                            = NULL;
+	internal_record_view->data_size                       = 0;
+	internal_record_view->source_name_size                = 0;
+	internal_record_view->computer_name_size              = 0;
+	internal_record_view->user_security_identifier_size   = 0;
+	internal_record_view->strings_size                    = 0;
+	internal_record_view->event_data_size                 = 0;
+
+	if( memory_compare(
+	     ( (evt_event_record_t *) data )->signature,
+	     "LfLe",
+	     4 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported event record signature.",
+		 function );
+
+		return( -1 );
+	}
+	maximum_data_size = data_size - 4;
+
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (evt_event_record_t *) data )->number_of_strings,
+	 number_of_event_strings );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evt_event_record_t *) data )->event_strings_offset,
+	 event_strings_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evt_event_record_t *) data )->user_security_identifier_size,
+	 user_security_identifier_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evt_event_record_t *) data )->user_security_identifier_offset,
+	 user_security_identifier_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evt_event_record_t *) data )->event_data_size,
+	 event_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evt_event_record_t *) data )->event_data_offset,
+	 event_data_offset );
+
+	data_offset = sizeof( evt_event_record_t );
+
+	internal_record_view->source_name_offset = data_offset;
+
+	while( ( data_offset + 1 ) < maximum_data_size )
+	{
+		internal_record_view->source_name_size += 2;
+
+		if( ( data[ data_offset ] == 0 )
+		 && ( data[ data_offset + 1 ] == 0 ) )
+		{
+			break;
+		}
+		data_offset += 2;
+	}
+	data_offset += 2;
+
+	internal_record_view->computer_name_offset = data_offset;
+
+	while( ( data_offset + 1 ) < maximum_data_size )
+	{
+		internal_record_view->computer_name_size += 2;
+
+		if( ( data[ data_offset ] == 0 )
+		 && ( data[ data_offset + 1 ] == 0 ) )
+		{
+			break;
+		}
+		data_offset += 2;
+	}
+	data_offset += 2;
+
+	if( user_security_identifier_size != 0 )
+	{
+		if( ( (size_t) user_security_identifier_offset < data_offset )
+		 || ( (size_t) user_security_identifier_offset >= maximum_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: user security identifier offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( (size_t) user_security_identifier_size > maximum_data_size )
+		 || ( (size_t) user_security_identifier_offset >= ( maximum_data_size - user_security_identifier_size ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: user security identifier size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		internal_record_view->user_security_identifier_offset = (size_t) user_security_identifier_offset;
+		internal_record_view->user_security_identifier_size   = (size_t) user_security_identifier_size;
+
+		data_offset += user_security_identifier_size;
+	}
+	if( number_of_event_strings != 0 )
+	{
+		maximum_strings_data_size = event_data_offset;
+
+		if( ( maximum_strings_data_size == 0 )
+		 || ( maximum_strings_data_size >= maximum_data_size ) )
+		{
+			maximum_strings_data_size = maximum_data_size;
+		}
+		if( ( event_strings_offset < data_offset )
+		 || ( (size_t) event_strings_offset >= maximum_strings_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: event strings offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		internal_record_view->strings_offset = (size_t) event_strings_offset;
+		internal_record_view->strings_size   = maximum_strings_data_size - event_strings_offset;
+
+		if( ( internal_record_view->strings_size < 2 )
+		 || ( ( internal_record_view->strings_size % 2 ) != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported event strings size.",
+			 function );
+
+			internal_record_view->strings_size = 0;
+
+			return( -1 );
+		}
+		data_offset += internal_record_view->strings_size;
+	}
+	if( event_data_size != 0 )
+	{
+		if( ( event_data_offset < data_offset )
+		 || ( (size_t) event_data_offset >= maximum_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: event data offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( (size_t) event_data_size > maximum_data_size )
+		 || ( (size_t) event_data_offset > ( maximum_data_size - event_data_size ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: event data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		/* The event data is read from the end of the strings, as libevt_event_record_read_data does
+		 */
+		internal_record_view->event_data_offset = data_offset;
+		internal_record_view->event_data_size   = (size_t) event_data_size;
+	}
+	internal_record_view->offset    = record_offset;
+	internal_record_view->data      = data;
+	internal_record_view->data_size = data_size;
+
+	return( 1 );
+}
+
+/* Reads the record view from a record in a file IO handle
+ * The record data is used directly when the file data is available in memory,
+ * otherwise it is read into the data buffer of the record view that is reused between records
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_view_read_file_io_handle(
+     libevt_internal_record_view_t *internal_record_view,
+     libevt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t record_offset,
+     size64_t record_size,
+     libcerror_error_t **error )
+{
+	libevt_file_data_t *file_data = NULL;
+	const uint8_t *record_data    = NULL;
+	uint8_t *data_buffer          = NULL;
+	static char *function         = "libevt_record_view_read_file_io_handle";
+
+	if( internal_record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_size < (size64_t) sizeof( evt_event_record_t ) )
+	 || ( record_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->file_data != NULL )
+	 && ( record_offset >= 0 )
+	 && ( (size64_t) record_offset < io_handle->file_size )
+	 && ( record_size <= ( io_handle->file_size - record_offset ) ) )
+	{
+		record_data = &( io_handle->file_data[ record_offset ] );
+
+		file_data = io_handle->managed_file_data;
+	}
+	else
+	{
+		if( (size_t) record_size > internal_record_view->data_buffer_size )
+		{
+			data_buffer = (uint8_t *) memory_reallocate(
+			                           internal_record_view->data_buffer,
+			                           sizeof( uint8_t ) * (size_t) record_size );
+
+			if( data_buffer == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize data buffer.",
+				 function );
+
+				return( -1 );
+			}
+			internal_record_view->data_buffer      = data_buffer;
+			internal_record_view->data_buffer_size = (size_t) record_size;
+		}
+		if( libevt_io_handle_read_record_data(
+		     io_handle,
+		     file_io_handle,
+		     record_offset,
+		     0,
+		     internal_record_view->data_buffer,
+		     (size_t) record_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 record_offset,
+			 record_offset );
+
+			internal_record_view->data = NULL;
+
+			return( -1 );
+		}
+		record_data = internal_record_view->data_buffer;
+	}
+	/* Hold a reference to the managed file data the record data is stored in
+	 */
+	if( file_data != internal_record_view->file_data )
+	{
+		if( internal_record_view->file_data != NULL )
+		{
+			if( libevt_file_data_free(
+			     &( internal_record_view->file_data ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file data.",
+				 function );
+
+				internal_record_view->data = NULL;
+
+				return( -1 );
+			}
+		}
+		if( file_data != NULL )
+		{
+			if( libevt_file_data_add_reference(
+			     file_data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to add reference to file data.",
+				 function );
+
+				internal_record_view->data = NULL;
+
+				return( -1 );
+			}
+			internal_record_view->file_data = file_data;
+		}
+	}
+	if( libevt_record_view_set_data(
+	     internal_record_view,
+	     record_offset,
+	     record_data,
+	     (size_t) record_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set record view data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the data of a specific string
+ * The string data includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_view_get_string_data(
+     libevt_internal_record_view_t *internal_record_view,
+     int string_index,
+     const uint8_t **string_data,
+     size_t *string_data_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *strings_data = NULL;
+	static char *function       = "libevt_record_view_get_string_data";
+	size_t data_offset          = 0;
+	size_t string_offset        = 0;
+	int safe_string_index       = 0;
+
+	if( internal_record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_view->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string data.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string data size.",
+		 function );
+
+		return( -1 );
+	}
+	strings_data = &( internal_record_view->data[ internal_record_view->strings_offset ] );
+
+	for( data_offset = 0;
+	     data_offset < internal_record_view->strings_size;
+	     data_offset += 2 )
+	{
+		if( ( strings_data[ data_offset ] == 0 )
+		 && ( strings_data[ data_offset + 1 ] == 0 ) )
+		{
+			if( safe_string_index == string_index )
+			{
+				*string_data      = &( strings_data[ string_offset ] );
+				*string_data_size = ( data_offset + 2 ) - string_offset;
+
+				return( 1 );
+			}
+			string_offset = data_offset + 2;
+
+			safe_string_index++;
+		}
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+	 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+	 "%s: invalid string index value out of bounds.",
+	 function );
+
+	return( -1 );
+}
+
+/* Retrieves the offset
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_view_get_offset(
+     libevt_record_view_t *record_view,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_view_t *internal_record_view = NULL;
+	static char *function                               = "libevt_record_view_get_offset";
+
+	if( record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_view = (libevt_internal_record_view_t *) record_view;
+
+	if( internal_record_view->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	*offset = internal_record_view->offset;
+
+	return( 1 );
+}
+
+/* Retrieves the identifier (record number)
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_view_get_identifier(
+     libevt_record_view_t *record_view,
+     uint32_t *identifier,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_view_t *internal_record_view = NULL;
+	static char *function                               = "libevt_record_view_get_identifier";
+
+	if( record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_view = (libevt_internal_record_view_t *) record_view;
+
+	if( internal_record_view->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evt_event_record_t *) internal_record_view->data )->record_number,
+	 *identifier );
+
+	return( 1 );
+}
+
+/* Retrieves the creation time
+ * The timestamp is a signed 32-bit POSIX date and time value in number of seconds
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_view_get_creation_time(
+     libevt_record_view_t *record_view,
+     uint32_t *posix_time,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_view_t *internal_record_view = NULL;
+	static char *function                               = "libevt_record_view_get_creation_time";
+
+	if( record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_view = (libevt_internal_record_view_t *) record_view;
+
+	if( internal_record_view->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evt_event_record_t *) internal_record_view->data )->creation_time,
+	 *posix_time );
+
+	return( 1 );
+}
+
+/* Retrieves the written time
+ * The timestamp is a signed 32-bit POSIX date and time value in number of seconds
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_view_get_written_time(
+     libevt_record_view_t *record_view,
+     uint32_t *posix_time,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_view_t *internal_record_view = NULL;
+	static char *function                               = "libevt_record_view_get_written_time";
+
+	if( record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_view = (libevt_internal_record_view_t *) record_view;
+
+	if( internal_record_view->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evt_event_record_t *) internal_record_view->data )->last_written_time,
+	 *posix_time );
+
+	return( 1 );
+}
+
+/* Retrieves the event identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_view_get_event_identifier(
+     libevt_record_view_t *record_view,
+     uint32_t *event_identifier,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_view_t *internal_record_view = NULL;
+	static char *function                               = "libevt_record_view_get_event_identifier";
+
+	if( record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_view = (libevt_internal_record_view_t *) record_view;
+
+	if( internal_record_view->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( event_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid event identifier.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evt_event_record_t *) internal_record_view->data )->event_identifier,
+	 *event_identifier );
+
+	return( 1 );
+}
+
+/* Retrieves the event type
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_view_get_event_type(
+     libevt_record_view_t *record_view,
+     uint16_t *event_type,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_view_t *internal_record_view = NULL;
+	static char *function                               = "libevt_record_view_get_event_type";
+
+	if( record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_view = (libevt_internal_record_view_t *) record_view;
+
+	if( internal_record_view->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( event_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid event type.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (evt_event_record_t *) internal_record_view->data )->event_type,
+	 *event_type );
+
+	return( 1 );
+}
+
+/* Retrieves the event category
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_view_get_event_category(
+     libevt_record_view_t *record_view,
+     uint16_t *event_category,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_view_t *internal_record_view = NULL;
+	static char *function                               = "libevt_record_view_get_event_category";
+
+	if( record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_view = (libevt_internal_record_view_t *) record_view;
+
+	if( internal_record_view->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( event_category == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid event category.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (evt_event_record_t *) internal_record_view->data )->event_category,
+	 *event_category );
+
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded source name
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevt_record_view_get_utf8_source_name_size(
+     libevt_record_view_t *record_view,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_view_t *internal_record_view = NULL;
+	static char *function                               = "libevt_record_view_get_utf8_source_name_size";
+
+	if( record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_view = (libevt_internal_record_view_t *) record_view;
+
+	if( internal_record_view->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_view->source_name_size == 0 )
+	{
+		return( 0 );
+	}
+	if( libuna_utf8_string_size_from_utf16_stream(
+	     &( internal_record_view->data[ internal_record_view->source_name_offset ] ),
+	     internal_record_view->source_name_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded source name
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevt_record_view_get_utf8_source_name(
+     libevt_record_view_t *record_view,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_view_t *internal_record_view = NULL;
+	static char *function                               = "libevt_record_view_get_utf8_source_name";
+
+	if( record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_view = (libevt_internal_record_view_t *) record_view;
+
+	if( internal_record_view->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_view->source_name_size == 0 )
+	{
+		return( 0 );
+	}
+	if( libuna_utf8_string_copy_from_utf16_stream(
+	     (libuna_utf8_character_t *) utf8_string,
+	     utf8_string_size,
+	     &( internal_record_view->data[ internal_record_view->source_name_offset ] ),
+	     internal_record_view->source_name_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-16 encoded source name
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevt_record_view_get_utf16_source_name_size(
+     libevt_record_view_t *record_view,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_view_t *internal_record_view = NULL;
+	static char *function                               = "libevt_record_view_get_utf16_source_name_size";
+
+	if( record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_view = (libevt_internal_record_view_t *) record_view;
+
+	if( internal_record_view->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_view->source_name_size == 0 )
+	{
+		return( 0 );
+	}
+	if( libuna_utf16_string_size_from_utf16_stream(
+	     &( internal_record_view->data[ internal_record_view->source_name_offset ] ),
+	     internal_record_view->source_name_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 encoded source name
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevt_record_view_get_utf16_source_name(
+     libevt_record_view_t *record_view,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_view_t *internal_record_view = NULL;
+	static char *function                               = "libevt_record_view_get_utf16_source_name";
+
+	if( record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_view = (libevt_internal_record_view_t *) record_view;
+
+	if( internal_record_view->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_view->source_name_size == 0 )
+	{
+		return( 0 );
+	}
+	if( libuna_utf16_string_copy_from_utf16_stream(
+	     (libuna_utf16_character_t *) utf16_string,
+	     utf16_string_size,
+	     &( internal_record_view->data[ internal_record_view->source_name_offset ] ),
+	     internal_record_view->source_name_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded computer name
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevt_record_view_get_utf8_computer_name_size(
+     libevt_record_view_t *record_view,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_view_t *internal_record_view = NULL;
+	static char *function                               = "libevt_record_view_get_utf8_computer_name_size";
+
+	if( record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_view = (libevt_internal_record_view_t *) record_view;
+
+	if( internal_record_view->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_view->computer_name_size == 0 )
+	{
+		return( 0 );
+	}
+	if( libuna_utf8_string_size_from_utf16_stream(
+	     &( internal_record_view->data[ internal_record_view->computer_name_offset ] ),
+	     internal_record_view->computer_name_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded computer name
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevt_record_view_get_utf8_computer_name(
+     libevt_record_view_t *record_view,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_view_t *internal_record_view = NULL;
+	static char *function                               = "libevt_record_view_get_utf8_computer_name";
+
+	if( record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_view = (libevt_internal_record_view_t *) record_view;
+
+	if( internal_record_view->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_view->computer_name_size == 0 )
+	{
+		return( 0 );
+	}
+	if( libuna_utf8_string_copy_from_utf16_stream(
+	     (libuna_utf8_character_t *) utf8_string,
+	     utf8_string_size,
+	     &( internal_record_view->data[ internal_record_view->computer_name_offset ] ),
+	     internal_record_view->computer_name_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-16 encoded computer name
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevt_record_view_get_utf16_computer_name_size(
+     libevt_record_view_t *record_view,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_view_t *internal_record_view = NULL;
+	static char *function                               = "libevt_record_view_get_utf16_computer_name_size";
+
+	if( record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_view = (libevt_internal_record_view_t *) record_view;
+
+	if( internal_record_view->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_view->computer_name_size == 0 )
+	{
+		return( 0 );
+	}
+	if( libuna_utf16_string_size_from_utf16_stream(
+	     &( internal_record_view->data[ internal_record_view->computer_name_offset ] ),
+	     internal_record_view->computer_name_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 encoded computer name
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevt_record_view_get_utf16_computer_name(
+     libevt_record_view_t *record_view,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_view_t *internal_record_view = NULL;
+	static char *function                               = "libevt_record_view_get_utf16_computer_name";
+
+	if( record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_view = (libevt_internal_record_view_t *) record_view;
+
+	if( internal_record_view->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_view->computer_name_size == 0 )
+	{
+		return( 0 );
+	}
+	if( libuna_utf16_string_copy_from_utf16_stream(
+	     (libuna_utf16_character_t *) utf16_string,
+	     utf16_string_size,
+	     &( internal_record_view->data[ internal_record_view->computer_name_offset ] ),
+	     internal_record_view->computer_name_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded user security identifier (SID)
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevt_record_view_get_utf8_user_security_identifier_size(
+     libevt_record_view_t *record_view,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_view_t *internal_record_view = NULL;
+	static char *function                               = "libevt_record_view_get_utf8_user_security_identifier_size";
+
+	if( record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_view = (libevt_internal_record_view_t *) record_view;
+
+	if( internal_record_view->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_view->user_security_identifier_size == 0 )
+	{
+		return( 0 );
+	}
+	if( internal_record_view->user_security_identifier == NULL )
+	{
+		if( libfwnt_security_identifier_initialize(
+		     &( internal_record_view->user_security_identifier ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create user security identifier.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libfwnt_security_identifier_copy_from_byte_stream(
+	     internal_record_view->user_security_identifier,
+	     &( internal_record_view->data[ internal_record_view->user_security_identifier_offset ] ),
+	     internal_record_view->user_security_identifier_size,
+	     LIBFWNT_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy user security identifier from byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_security_identifier_get_string_size(
+	     internal_record_view->user_security_identifier,
+	     utf8_string_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded user security identifier (SID)
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevt_record_view_get_utf8_user_security_identifier(
+     libevt_record_view_t *record_view,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_view_t *internal_record_view = NULL;
+	static char *function                               = "libevt_record_view_get_utf8_user_security_identifier";
+
+	if( record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_view = (libevt_internal_record_view_t *) record_view;
+
+	if( internal_record_view->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_view->user_security_identifier_size == 0 )
+	{
+		return( 0 );
+	}
+	if( internal_record_view->user_security_identifier == NULL )
+	{
+		if( libfwnt_security_identifier_initialize(
+		     &( internal_record_view->user_security_identifier ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create user security identifier.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libfwnt_security_identifier_copy_from_byte_stream(
+	     internal_record_view->user_security_identifier,
+	     &( internal_record_view->data[ internal_record_view->user_security_identifier_offset ] ),
+	     internal_record_view->user_security_identifier_size,
+	     LIBFWNT_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy user security identifier from byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_security_identifier_copy_to_utf8_string(
+	     internal_record_view->user_security_identifier,
+	     utf8_string,
+	     utf8_string_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-16 encoded user security identifier (SID)
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevt_record_view_get_utf16_user_security_identifier_size(
+     libevt_record_view_t *record_view,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_view_t *internal_record_view = NULL;
+	static char *function                               = "libevt_record_view_get_utf16_user_security_identifier_size";
+
+	if( record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_view = (libevt_internal_record_view_t *) record_view;
+
+	if( internal_record_view->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_view->user_security_identifier_size == 0 )
+	{
+		return( 0 );
+	}
+	if( internal_record_view->user_security_identifier == NULL )
+	{
+		if( libfwnt_security_identifier_initialize(
+		     &( internal_record_view->user_security_identifier ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create user security identifier.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libfwnt_security_identifier_copy_from_byte_stream(
+	     internal_record_view->user_security_identifier,
+	     &( internal_record_view->data[ internal_record_view->user_security_identifier_offset ] ),
+	     internal_record_view->user_security_identifier_size,
+	     LIBFWNT_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy user security identifier from byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_security_identifier_get_string_size(
+	     internal_record_view->user_security_identifier,
+	     utf16_string_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 encoded user security identifier (SID)
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevt_record_view_get_utf16_user_security_identifier(
+     libevt_record_view_t *record_view,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_view_t *internal_record_view = NULL;
+	static char *function                               = "libevt_record_view_get_utf16_user_security_identifier";
+
+	if( record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_view = (libevt_internal_record_view_t *) record_view;
+
+	if( internal_record_view->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_view->user_security_identifier_size == 0 )
+	{
+		return( 0 );
+	}
+	if( internal_record_view->user_security_identifier == NULL )
+	{
+		if( libfwnt_security_identifier_initialize(
+		     &( internal_record_view->user_security_identifier ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create user security identifier.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libfwnt_security_identifier_copy_from_byte_stream(
+	     internal_record_view->user_security_identifier,
+	     &( internal_record_view->data[ internal_record_view->user_security_identifier_offset ] ),
+	     internal_record_view->user_security_identifier_size,
+	     LIBFWNT_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy user security identifier from byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_security_identifier_copy_to_utf16_string(
+	     internal_record_view->user_security_identifier,
+	     utf16_string,
+	     utf16_string_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of strings
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_view_get_number_of_strings(
+     libevt_record_view_t *record_view,
+     int *number_of_strings,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_view_t *internal_record_view = NULL;
+	const uint8_t *strings_data                         = NULL;
+	static char *function                               = "libevt_record_view_get_number_of_strings";
+	size_t data_offset                                  = 0;
+	int safe_number_of_strings                          = 0;
+
+	if( record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_view = (libevt_internal_record_view_t *) record_view;
+
+	if( internal_record_view->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of strings.",
+		 function );
+
+		return( -1 );
+	}
+	strings_data = &( internal_record_view->data[ internal_record_view->strings_offset ] );
+
+	for( data_offset = 0;
+	     data_offset < internal_record_view->strings_size;
+	     data_offset += 2 )
+	{
+		if( ( strings_data[ data_offset ] == 0 )
+		 && ( strings_data[ data_offset + 1 ] == 0 ) )
+		{
+			safe_number_of_strings++;
+		}
+	}
+	*number_of_strings = safe_number_of_strings;
+
+	return( 1 );
+}
+
+/* Retrieves the size of a specific UTF-8 encoded string
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_view_get_utf8_string_size(
+     libevt_record_view_t *record_view,
+     int string_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_view_t *internal_record_view = NULL;
+	static char *function                               = "libevt_record_view_get_utf8_string_size";
+	const uint8_t *string_data                          = NULL;
+	size_t string_data_size                             = 0;
+
+	if( record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_view = (libevt_internal_record_view_t *) record_view;
+
+	if( libevt_record_view_get_string_data(
+	     internal_record_view,
+	     string_index,
+	     &string_data,
+	     &string_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data of string: %d.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	if( libuna_utf8_string_size_from_utf16_stream(
+	     string_data,
+	     string_data_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-8 string: %d.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific UTF-8 encoded string
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_view_get_utf8_string(
+     libevt_record_view_t *record_view,
+     int string_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_view_t *internal_record_view = NULL;
+	static char *function                               = "libevt_record_view_get_utf8_string";
+	const uint8_t *string_data                          = NULL;
+	size_t string_data_size                             = 0;
+
+	if( record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_view = (libevt_internal_record_view_t *) record_view;
+
+	if( libevt_record_view_get_string_data(
+	     internal_record_view,
+	     string_index,
+	     &string_data,
+	     &string_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data of string: %d.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	if( libuna_utf8_string_copy_from_utf16_stream(
+	     (libuna_utf8_character_t *) utf8_string,
+	     utf8_string_size,
+	     string_data,
+	     string_data_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-8 string: %d.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of a specific UTF-16 encoded string
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_view_get_utf16_string_size(
+     libevt_record_view_t *record_view,
+     int string_index,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_view_t *internal_record_view = NULL;
+	static char *function                               = "libevt_record_view_get_utf16_string_size";
+	const uint8_t *string_data                          = NULL;
+	size_t string_data_size                             = 0;
+
+	if( record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_view = (libevt_internal_record_view_t *) record_view;
+
+	if( libevt_record_view_get_string_data(
+	     internal_record_view,
+	     string_index,
+	     &string_data,
+	     &string_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data of string: %d.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	if( libuna_utf16_string_size_from_utf16_stream(
+	     string_data,
+	     string_data_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-16 string: %d.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific UTF-16 encoded string
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_view_get_utf16_string(
+     libevt_record_view_t *record_view,
+     int string_index,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_view_t *internal_record_view = NULL;
+	static char *function                               = "libevt_record_view_get_utf16_string";
+	const uint8_t *string_data                          = NULL;
+	size_t string_data_size                             = 0;
+
+	if( record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_view = (libevt_internal_record_view_t *) record_view;
+
+	if( libevt_record_view_get_string_data(
+	     internal_record_view,
+	     string_index,
+	     &string_data,
+	     &string_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data of string: %d.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	if( libuna_utf16_string_copy_from_utf16_stream(
+	     (libuna_utf16_character_t *) utf16_string,
+	     utf16_string_size,
+	     string_data,
+	     string_data_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-16 string: %d.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the data
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevt_record_view_get_data_size(
+     libevt_record_view_t *record_view,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_view_t *internal_record_view = NULL;
+	static char *function                               = "libevt_record_view_get_data_size";
+
+	if( record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_view = (libevt_internal_record_view_t *) record_view;
+
+	if( internal_record_view->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_view->event_data_size == 0 )
+	{
+		return( 0 );
+	}
+	*data_size = internal_record_view->event_data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the data
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevt_record_view_get_data(
+     libevt_record_view_t *record_view,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_view_t *internal_record_view = NULL;
+	static char *function                               = "libevt_record_view_get_data";
+
+	if( record_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_view = (libevt_internal_record_view_t *) record_view;
+
+	if( internal_record_view->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_view->event_data_size == 0 )
+	{
+		return( 0 );
+	}
+	if( data_size < internal_record_view->event_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     data,
+	     &( internal_record_view->data[ internal_record_view->event_data_offset ] ),
+	     internal_record_view->event_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
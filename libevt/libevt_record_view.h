@@ -0,0 +1,320 @@
+/*
+ * Record view functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVT_RECORD_VIEW_H )
+#define _LIBEVT_RECORD_VIEW_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevt_extern.h"
+#include "libevt_file_data.h"
+#include "libevt_io_handle.h"
+#include "libevt_libbfio.h"
+#include "libevt_libcerror.h"
+#include "libevt_libfwnt.h"
+#include "libevt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevt_internal_record_view libevt_internal_record_view_t;
+
+struct libevt_internal_record_view
+{
+	/* The record offset
+	 */
+	off64_t offset;
+
+	/* The record data
+	 */
+	const uint8_t *data;
+
+	/* The record data size
+	 */
+	size_t data_size;
+
+	/* The managed file data the record data is stored in, a reference is held
+	 * so that the record data remains available when the file is refreshed or closed
+	 */
+	libevt_file_data_t *file_data;
+
+	/* The record data buffer, used when the record data is not available in memory
+	 */
+	uint8_t *data_buffer;
+
+	/* The record data buffer size
+	 */
+	size_t data_buffer_size;
+
+	/* The source name offset
+	 */
+	size_t source_name_offset;
+
+	/* The source name size
+	 */
+	size_t source_name_size;
+
+	/* The computer name offset
+	 */
+	size_t computer_name_offset;
+
+	/* The computer name size
+	 */
+	size_t computer_name_size;
+
+	/* The user security identifier offset
+	 */
+	size_t user_security_identifier_offset;
+
+	/* The user security identifier size
+	 */
+	size_t user_security_identifier_size;
+
+	/* The strings offset
+	 */
+	size_t strings_offset;
+
+	/* The strings size
+	 */
+	size_t strings_size;
+
+	/* The event data offset
+	 */
+	size_t event_data_offset;
+
+	/* The event data size
+	 */
+	size_t event_data_size;
+
+	/* The user security identifier, reused between records
+	 */
+	libfwnt_security_identifier_t *user_security_identifier;
+};
+
+LIBEVT_EXTERN \
+int libevt_record_view_initialize(
+     libevt_record_view_t **record_view,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_view_free(
+     libevt_record_view_t **record_view,
+     libcerror_error_t **error );
+
+int libevt_record_view_set_data(
+     libevt_internal_record_view_t *internal_record_view,
+     off64_t record_offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libevt_record_view_read_file_io_handle(
+     libevt_internal_record_view_t *internal_record_view,
+     libevt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t record_offset,
+     size64_t record_size,
+     libcerror_error_t **error );
+
+int libevt_record_view_get_string_data(
+     libevt_internal_record_view_t *internal_record_view,
+     int string_index,
+     const uint8_t **string_data,
+     size_t *string_data_size,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_view_get_offset(
+     libevt_record_view_t *record_view,
+     off64_t *offset,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_view_get_identifier(
+     libevt_record_view_t *record_view,
+     uint32_t *identifier,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_view_get_creation_time(
+     libevt_record_view_t *record_view,
+     uint32_t *posix_time,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_view_get_written_time(
+     libevt_record_view_t *record_view,
+     uint32_t *posix_time,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_view_get_event_identifier(
+     libevt_record_view_t *record_view,
+     uint32_t *event_identifier,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_view_get_event_type(
+     libevt_record_view_t *record_view,
+     uint16_t *event_type,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_view_get_event_category(
+     libevt_record_view_t *record_view,
+     uint16_t *event_category,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_view_get_utf8_source_name_size(
+     libevt_record_view_t *record_view,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_view_get_utf8_source_name(
+     libevt_record_view_t *record_view,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_view_get_utf16_source_name_size(
+     libevt_record_view_t *record_view,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_view_get_utf16_source_name(
+     libevt_record_view_t *record_view,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_view_get_utf8_computer_name_size(
+     libevt_record_view_t *record_view,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_view_get_utf8_computer_name(
+     libevt_record_view_t *record_view,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_view_get_utf16_computer_name_size(
+     libevt_record_view_t *record_view,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_view_get_utf16_computer_name(
+     libevt_record_view_t *record_view,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_view_get_utf8_user_security_identifier_size(
+     libevt_record_view_t *record_view,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_view_get_utf8_user_security_identifier(
+     libevt_record_view_t *record_view,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_view_get_utf16_user_security_identifier_size(
+     libevt_record_view_t *record_view,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_view_get_utf16_user_security_identifier(
+     libevt_record_view_t *record_view,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_view_get_number_of_strings(
+     libevt_record_view_t *record_view,
+     int *number_of_strings,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_view_get_utf8_string_size(
+     libevt_record_view_t *record_view,
+     int string_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_view_get_utf8_string(
+     libevt_record_view_t *record_view,
+     int string_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_view_get_utf16_string_size(
+     libevt_record_view_t *record_view,
+     int string_index,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_view_get_utf16_string(
+     libevt_record_view_t *record_view,
+     int string_index,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_view_get_data_size(
+     libevt_record_view_t *record_view,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_view_get_data(
+     libevt_record_view_t *record_view,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVT_RECORD_VIEW_H ) */
+
@@ -0,0 +1,1969 @@
+/*
+ * Records parser functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevt_definitions.h"
+#include "libevt_filter.h"
+#include "libevt_io_handle.h"
+#include "libevt_libbfio.h"
+#include "libevt_libcerror.h"
+#include "libevt_libcthreads.h"
+#include "libevt_libfdata.h"
+#include "libevt_record.h"
+#include "libevt_record_values.h"
+#include "libevt_records_parser.h"
+
+/* Creates a records parser
+ * Make sure the value records_parser is referencing, is set to NULL
+ * If filter is set only records that match the filter are passed to the callback function
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_records_parser_initialize(
+     libevt_records_parser_t **records_parser,
+     libevt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfdata_list_t *records_list,
+     libevt_internal_filter_t *filter,
+     int number_of_threads,
+     int (*callback_function)(
+            libevt_record_t *record,
+            int record_index,
+            void *user_data,
+            libcerror_error_t **error ),
+     void *user_data,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	static char *function    = "libevt_records_parser_initialize";
+	int chunk_index          = 0;
+	int number_of_records    = 0;
+	int record_index         = 0;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	int file_io_handle_index = 0;
+	int result               = 0;
+#endif
+
+	if( records_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( *records_parser != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid records parser value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > LIBEVT_RECORDS_PARSER_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & ~( LIBEVT_PARSE_RECORDS_FLAG_PRESERVE_ORDER ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	if( libfdata_list_get_number_of_elements(
+	     records_list,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	*records_parser = memory_allocate_structure(
+	                   libevt_records_parser_t );
+
+	if( *records_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create records parser.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *records_parser,
+	     0,
+	     sizeof( libevt_records_parser_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear records parser.",
+		 function );
+
+		memory_free(
+		 *records_parser );
+
+		*records_parser = NULL;
+
+		return( -1 );
+	}
+	( *records_parser )->io_handle         = io_handle;
+	( *records_parser )->file_io_handle    = file_io_handle;
+	( *records_parser )->records_list      = records_list;
+	( *records_parser )->filter            = filter;
+	( *records_parser )->callback_function = callback_function;
+	( *records_parser )->user_data         = user_data;
+	( *records_parser )->flags             = flags;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	( *records_parser )->number_of_threads = number_of_threads;
+#else
+	( *records_parser )->number_of_threads = 1;
+#endif
+
+	if( number_of_records > 0 )
+	{
+		( *records_parser )->number_of_chunks = number_of_records / LIBEVT_RECORDS_PARSER_CHUNK_SIZE;
+
+		if( ( number_of_records % LIBEVT_RECORDS_PARSER_CHUNK_SIZE ) != 0 )
+		{
+			( *records_parser )->number_of_chunks += 1;
+		}
+		( *records_parser )->chunks = (libevt_records_parser_chunk_t *) memory_allocate(
+		                                                                 sizeof( libevt_records_parser_chunk_t ) * ( *records_parser )->number_of_chunks );
+
+		if( ( *records_parser )->chunks == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create chunks.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     ( *records_parser )->chunks,
+		     0,
+		     sizeof( libevt_records_parser_chunk_t ) * ( *records_parser )->number_of_chunks ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear chunks.",
+			 function );
+
+			goto on_error;
+		}
+		for( chunk_index = 0;
+		     chunk_index < ( *records_parser )->number_of_chunks;
+		     chunk_index++ )
+		{
+			( *records_parser )->chunks[ chunk_index ].first_record_index = record_index;
+			( *records_parser )->chunks[ chunk_index ].number_of_records  = number_of_records - record_index;
+
+			if( ( *records_parser )->chunks[ chunk_index ].number_of_records > LIBEVT_RECORDS_PARSER_CHUNK_SIZE )
+			{
+				( *records_parser )->chunks[ chunk_index ].number_of_records = LIBEVT_RECORDS_PARSER_CHUNK_SIZE;
+			}
+			record_index += ( *records_parser )->chunks[ chunk_index ].number_of_records;
+		}
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( ( *records_parser )->number_of_threads > 1 )
+	{
+		( *records_parser )->file_io_handles = (libbfio_handle_t **) memory_allocate(
+		                                                              sizeof( libbfio_handle_t * ) * number_of_threads );
+
+		if( ( *records_parser )->file_io_handles == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create file IO handles.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     ( *records_parser )->file_io_handles,
+		     0,
+		     sizeof( libbfio_handle_t * ) * number_of_threads ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear file IO handles.",
+			 function );
+
+			memory_free(
+			 ( *records_parser )->file_io_handles );
+
+			( *records_parser )->file_io_handles = NULL;
+
+			goto on_error;
+		}
+		( *records_parser )->file_io_handles_in_use = (uint8_t *) memory_allocate(
+		                                                           sizeof( uint8_t ) * number_of_threads );
+
+		if( ( *records_parser )->file_io_handles_in_use == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create file IO handles in use.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     ( *records_parser )->file_io_handles_in_use,
+		     0,
+		     sizeof( uint8_t ) * number_of_threads ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear file IO handles in use.",
+			 function );
+
+			goto on_error;
+		}
+		/* Every worker thread reads using its own clone of the file IO handle
+		 * so that reads of different threads do not contend for the same handle.
+		 * If the file data was read into memory no reads are done and the file IO
+		 * handle is shared.
+		 */
+		for( file_io_handle_index = 0;
+		     file_io_handle_index < number_of_threads;
+		     file_io_handle_index++ )
+		{
+			if( io_handle->file_data != NULL )
+			{
+				( *records_parser )->file_io_handles[ file_io_handle_index ] = file_io_handle;
+
+				continue;
+			}
+			if( libbfio_handle_clone(
+			     &( ( *records_parser )->file_io_handles[ file_io_handle_index ] ),
+			     file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create file IO handle: %d.",
+				 function,
+				 file_io_handle_index );
+
+				goto on_error;
+			}
+			result = libbfio_handle_is_open(
+			          ( *records_parser )->file_io_handles[ file_io_handle_index ],
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if file IO handle: %d is open.",
+				 function,
+				 file_io_handle_index );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				if( libbfio_handle_open(
+				     ( *records_parser )->file_io_handles[ file_io_handle_index ],
+				     LIBBFIO_OPEN_READ,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_OPEN_FAILED,
+					 "%s: unable to open file IO handle: %d.",
+					 function,
+					 file_io_handle_index );
+
+					goto on_error;
+				}
+			}
+		}
+		if( libcthreads_mutex_initialize(
+		     &( ( *records_parser )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_condition_initialize(
+		     &( ( *records_parser )->delivery_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize delivery condition.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	/* The arena is used by the records parser until it is freed, after which
+	 * none of the parsed records remain
+	 */
+	if( io_handle->arena != NULL )
+	{
+		if( libevt_arena_add_user(
+		     io_handle->arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add user to arena.",
+			 function );
+
+			goto on_error;
+		}
+		( *records_parser )->arena = io_handle->arena;
+	}
+	return( 1 );
+
+on_error:
+	if( *records_parser != NULL )
+	{
+		libevt_records_parser_free(
+		 records_parser,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a records parser
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_records_parser_free(
+     libevt_records_parser_t **records_parser,
+     libcerror_error_t **error )
+{
+	static char *function    = "libevt_records_parser_free";
+	int chunk_index          = 0;
+	int record_index         = 0;
+	int result               = 1;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	int file_io_handle_index = 0;
+#endif
+
+	if( records_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( *records_parser != NULL )
+	{
+		/* The io_handle, file_io_handle and records_list references are freed elsewhere
+		 */
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+		if( ( *records_parser )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *records_parser )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *records_parser )->delivery_condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *records_parser )->delivery_condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free delivery condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *records_parser )->file_io_handles != NULL )
+		{
+			for( file_io_handle_index = 0;
+			     file_io_handle_index < ( *records_parser )->number_of_threads;
+			     file_io_handle_index++ )
+			{
+				/* Only the cloned file IO handles are owned by the records parser
+				 */
+				if( ( ( *records_parser )->file_io_handles[ file_io_handle_index ] == NULL )
+				 || ( ( *records_parser )->file_io_handles[ file_io_handle_index ] == ( *records_parser )->file_io_handle ) )
+				{
+					continue;
+				}
+				if( libbfio_handle_is_open(
+				     ( *records_parser )->file_io_handles[ file_io_handle_index ],
+				     NULL ) == 1 )
+				{
+					if( libbfio_handle_close(
+					     ( *records_parser )->file_io_handles[ file_io_handle_index ],
+					     error ) != 0 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+						 "%s: unable to close file IO handle: %d.",
+						 function,
+						 file_io_handle_index );
+
+						result = -1;
+					}
+				}
+				if( libbfio_handle_free(
+				     &( ( *records_parser )->file_io_handles[ file_io_handle_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free file IO handle: %d.",
+					 function,
+					 file_io_handle_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *records_parser )->file_io_handles );
+		}
+		if( ( *records_parser )->file_io_handles_in_use != NULL )
+		{
+			memory_free(
+			 ( *records_parser )->file_io_handles_in_use );
+		}
+#endif
+		if( ( *records_parser )->chunks != NULL )
+		{
+			/* Records that were parsed but not passed to the callback function
+			 * are left behind when parsing was aborted
+			 */
+			for( chunk_index = 0;
+			     chunk_index < ( *records_parser )->number_of_chunks;
+			     chunk_index++ )
+			{
+				if( ( *records_parser )->chunks[ chunk_index ].records == NULL )
+				{
+					continue;
+				}
+				for( record_index = 0;
+				     record_index < ( *records_parser )->chunks[ chunk_index ].number_of_records;
+				     record_index++ )
+				{
+					if( ( *records_parser )->chunks[ chunk_index ].records[ record_index ] != NULL )
+					{
+						if( libevt_record_free(
+						     &( ( *records_parser )->chunks[ chunk_index ].records[ record_index ] ),
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+							 "%s: unable to free record: %d.",
+							 function,
+							 ( *records_parser )->chunks[ chunk_index ].first_record_index + record_index );
+
+							result = -1;
+						}
+					}
+				}
+				memory_free(
+				 ( *records_parser )->chunks[ chunk_index ].records );
+			}
+			memory_free(
+			 ( *records_parser )->chunks );
+		}
+		if( ( *records_parser )->worker_error != NULL )
+		{
+			libcerror_error_free(
+			 &( ( *records_parser )->worker_error ) );
+		}
+		/* The arena memory is released once the last records parser is freed,
+		 * since all the records it parsed have been freed
+		 */
+		if( ( *records_parser )->arena != NULL )
+		{
+			if( libevt_arena_remove_user(
+			     ( *records_parser )->arena,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to remove user from arena.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *records_parser );
+
+		*records_parser = NULL;
+	}
+	return( result );
+}
+
+/* Signals the records parser to stop parsing
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_records_parser_signal_abort(
+     libevt_records_parser_t *records_parser,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_records_parser_signal_abort";
+
+	if( records_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records parser.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( records_parser->mutex != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     records_parser->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	records_parser->abort = 1;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( records_parser->delivery_condition != NULL )
+	{
+		if( libcthreads_condition_broadcast(
+		     records_parser->delivery_condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast delivery condition.",
+			 function );
+
+			libcthreads_mutex_release(
+			 records_parser->mutex,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	if( records_parser->mutex != NULL )
+	{
+		if( libcthreads_mutex_release(
+		     records_parser->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
+}
+
+/* Determines if the records parser should stop parsing
+ * Returns 1 if parsing should stop, 0 if not or -1 on error
+ */
+int libevt_records_parser_is_aborted(
+     libevt_records_parser_t *records_parser,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_records_parser_is_aborted";
+	int result            = 0;
+
+	if( records_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records parser.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( records_parser->mutex != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     records_parser->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( records_parser->abort != 0 )
+	{
+		result = 1;
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( records_parser->mutex != NULL )
+	{
+		if( libcthreads_mutex_release(
+		     records_parser->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( records_parser->io_handle->abort != 0 )
+	{
+		result = 1;
+	}
+	return( result );
+}
+
+/* Reads a specific record
+ * The record values are read directly and are not stored in the records cache
+ * If the records parser has a filter, the filter is evaluated before the record
+ * values are read
+ * Returns 1 if successful, 0 if the record does not match the filter or -1 on error
+ */
+int libevt_records_parser_read_record(
+     libevt_records_parser_t *records_parser,
+     libbfio_handle_t *file_io_handle,
+     int record_index,
+     libevt_record_t **record,
+     libcerror_error_t **error )
+{
+	libevt_record_values_t *record_values = NULL;
+	static char *function                 = "libevt_records_parser_read_record";
+	off64_t element_offset                = 0;
+	off64_t file_offset                   = 0;
+	size64_t element_size                 = 0;
+	uint32_t element_flags                = 0;
+	uint8_t has_wrapped                   = 0;
+	int element_file_index                = 0;
+	int result                            = 0;
+
+	if( records_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_get_element_by_index(
+	     records_parser->records_list,
+	     record_index,
+	     &element_file_index,
+	     &element_offset,
+	     &element_size,
+	     &element_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record: %d.",
+		 function,
+		 record_index );
+
+		goto on_error;
+	}
+	if( records_parser->filter != NULL )
+	{
+		result = libevt_filter_match_record(
+		          records_parser->filter,
+		          records_parser->io_handle,
+		          file_io_handle,
+		          element_offset,
+		          element_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to match record: %d with filter.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( libevt_record_values_initialize(
+	     &record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record values.",
+		 function );
+
+		goto on_error;
+	}
+	/* Only the records delivered by the records parser are carved from the arena
+	 * since these are not stored in the records cache
+	 */
+	record_values->arena = records_parser->arena;
+
+	file_offset = element_offset;
+
+	if( libevt_record_values_read_file_io_handle(
+	     record_values,
+	     file_io_handle,
+	     records_parser->io_handle,
+	     &file_offset,
+	     &has_wrapped,
+	     0,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 element_offset,
+		 element_offset );
+
+		goto on_error;
+	}
+	if( libevt_record_initialize(
+	     record,
+	     records_parser->io_handle,
+	     records_parser->file_io_handle,
+	     record_values,
+	     LIBEVT_RECORD_FLAG_MANAGED_RECORD_VALUES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( record_values != NULL )
+	{
+		libevt_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Parses the records of a chunk
+ * The records are passed to the callback function directly, unless the record
+ * order is preserved and multiple threads are used, in which case the records
+ * are stored in the chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_records_parser_parse_chunk(
+     libevt_records_parser_t *records_parser,
+     libevt_records_parser_chunk_t *chunk,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libevt_record_t *record = NULL;
+	static char *function   = "libevt_records_parser_parse_chunk";
+	uint8_t store_records   = 0;
+	int chunk_record_index  = 0;
+	int record_index        = 0;
+	int result              = 0;
+
+	if( records_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk->records != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk - records value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( records_parser->flags & LIBEVT_PARSE_RECORDS_FLAG_PRESERVE_ORDER ) != 0 )
+	 && ( records_parser->number_of_threads > 1 ) )
+	{
+		store_records = 1;
+	}
+	if( store_records != 0 )
+	{
+		chunk->records = (libevt_record_t **) memory_allocate(
+		                                       sizeof( libevt_record_t * ) * chunk->number_of_records );
+
+		if( chunk->records == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create records.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     chunk->records,
+		     0,
+		     sizeof( libevt_record_t * ) * chunk->number_of_records ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear records.",
+			 function );
+
+			memory_free(
+			 chunk->records );
+
+			chunk->records = NULL;
+
+			goto on_error;
+		}
+	}
+	for( chunk_record_index = 0;
+	     chunk_record_index < chunk->number_of_records;
+	     chunk_record_index++ )
+	{
+		result = libevt_records_parser_is_aborted(
+		          records_parser,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if parsing was aborted.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			break;
+		}
+		record_index = chunk->first_record_index + chunk_record_index;
+
+		result = libevt_records_parser_read_record(
+		          records_parser,
+		          file_io_handle,
+		          record_index,
+		          &record,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			/* The record does not match the filter
+			 */
+			continue;
+		}
+		if( store_records != 0 )
+		{
+			chunk->records[ chunk_record_index ] = record;
+			record                               = NULL;
+
+			continue;
+		}
+		result = records_parser->callback_function(
+		          record,
+		          record_index,
+		          records_parser->user_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to process record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		if( libevt_record_free(
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		/* The callback function returns 0 to stop parsing
+		 */
+		if( result == 0 )
+		{
+			if( libevt_records_parser_signal_abort(
+			     records_parser,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to signal abort.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( record != NULL )
+	{
+		libevt_record_free(
+		 &record,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Passes the records of parsed chunks to the callback function in chunk order
+ * Only one thread at a time passes records, other threads return directly
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_records_parser_deliver_chunks(
+     libevt_records_parser_t *records_parser,
+     libcerror_error_t **error )
+{
+	libevt_records_parser_chunk_t *chunk = NULL;
+	static char *function                = "libevt_records_parser_deliver_chunks";
+	int abort_result                     = 0;
+	int callback_result                  = 0;
+	int chunk_record_index               = 0;
+	int record_index                     = 0;
+	int result                           = 1;
+
+	if( records_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records parser.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     records_parser->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( records_parser->is_delivering == 0 )
+	{
+		records_parser->is_delivering = 1;
+
+		while( ( records_parser->abort == 0 )
+		    && ( records_parser->next_chunk_index < records_parser->number_of_chunks ) )
+		{
+			chunk = &( records_parser->chunks[ records_parser->next_chunk_index ] );
+
+			if( chunk->is_parsed == 0 )
+			{
+				break;
+			}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+			if( libcthreads_mutex_release(
+			     records_parser->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release mutex.",
+				 function );
+
+				return( -1 );
+			}
+#endif
+			for( chunk_record_index = 0;
+			     chunk_record_index < chunk->number_of_records;
+			     chunk_record_index++ )
+			{
+				abort_result = libevt_records_parser_is_aborted(
+				                records_parser,
+				                error );
+
+				if( abort_result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to determine if parsing was aborted.",
+					 function );
+
+					result = -1;
+				}
+				if( abort_result != 0 )
+				{
+					break;
+				}
+				/* Records that do not match the filter are not stored
+				 */
+				if( chunk->records[ chunk_record_index ] == NULL )
+				{
+					continue;
+				}
+				record_index = chunk->first_record_index + chunk_record_index;
+
+				callback_result = records_parser->callback_function(
+				                   chunk->records[ chunk_record_index ],
+				                   record_index,
+				                   records_parser->user_data,
+				                   error );
+
+				if( callback_result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to process record: %d.",
+					 function,
+					 record_index );
+
+					result = -1;
+				}
+				else if( libevt_record_free(
+				          &( chunk->records[ chunk_record_index ] ),
+				          error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free record: %d.",
+					 function,
+					 record_index );
+
+					result = -1;
+				}
+				/* The callback function returns 0 to stop parsing
+				 */
+				if( ( result == -1 )
+				 || ( callback_result == 0 ) )
+				{
+					break;
+				}
+			}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+			if( libcthreads_mutex_grab(
+			     records_parser->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab mutex.",
+				 function );
+
+				return( -1 );
+			}
+#endif
+			/* The records of a chunk that was not passed completely are freed
+			 * with the records parser
+			 */
+			if( chunk_record_index < chunk->number_of_records )
+			{
+				records_parser->abort = 1;
+			}
+			if( records_parser->abort == 0 )
+			{
+				memory_free(
+				 chunk->records );
+
+				chunk->records = NULL;
+
+				records_parser->next_chunk_index += 1;
+			}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+			/* Wake up the thread that waits to push the next chunk
+			 */
+			if( libcthreads_condition_broadcast(
+			     records_parser->delivery_condition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to broadcast delivery condition.",
+				 function );
+
+				result = -1;
+
+				records_parser->abort = 1;
+			}
+#endif
+		}
+		records_parser->is_delivering = 0;
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     records_parser->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+
+/* Grabs an unused file IO handle for a worker thread
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_records_parser_grab_file_io_handle(
+     libevt_records_parser_t *records_parser,
+     int *file_io_handle_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_records_parser_grab_file_io_handle";
+	int safe_handle_index = 0;
+	int result            = 0;
+
+	if( records_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     records_parser->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	/* The thread pool runs at most number of threads callbacks at the same time
+	 * hence there always is an unused file IO handle
+	 */
+	for( safe_handle_index = 0;
+	     safe_handle_index < records_parser->number_of_threads;
+	     safe_handle_index++ )
+	{
+		if( records_parser->file_io_handles_in_use[ safe_handle_index ] == 0 )
+		{
+			records_parser->file_io_handles_in_use[ safe_handle_index ] = 1;
+
+			*file_io_handle_index = safe_handle_index;
+
+			result = 1;
+
+			break;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     records_parser->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing unused file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Releases a file IO handle of a worker thread
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_records_parser_release_file_io_handle(
+     libevt_records_parser_t *records_parser,
+     int file_io_handle_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_records_parser_release_file_io_handle";
+
+	if( records_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_io_handle_index < 0 )
+	 || ( file_io_handle_index >= records_parser->number_of_threads ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file IO handle index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     records_parser->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	records_parser->file_io_handles_in_use[ file_io_handle_index ] = 0;
+
+	if( libcthreads_mutex_release(
+	     records_parser->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Waits until the chunks before a specific chunk have been passed to the callback
+ * function, such that at most the pending chunks per thread are parsed ahead of the
+ * chunk that is passed to the callback function, or until parsing should stop
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_records_parser_wait_for_delivery(
+     libevt_records_parser_t *records_parser,
+     int chunk_index,
+     libcerror_error_t **error )
+{
+	static char *function                = "libevt_records_parser_wait_for_delivery";
+	int maximum_number_of_pending_chunks = 0;
+	int result                           = 1;
+
+	if( records_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records parser.",
+		 function );
+
+		return( -1 );
+	}
+	maximum_number_of_pending_chunks = records_parser->number_of_threads * LIBEVT_RECORDS_PARSER_PENDING_CHUNKS_PER_THREAD;
+
+	if( libcthreads_mutex_grab(
+	     records_parser->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( records_parser->abort == 0 )
+	    && ( ( chunk_index - records_parser->next_chunk_index ) >= maximum_number_of_pending_chunks ) )
+	{
+		if( libcthreads_condition_wait(
+		     records_parser->delivery_condition,
+		     records_parser->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to wait for delivery condition.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     records_parser->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Parses a chunk in a worker thread of the thread pool
+ * The first error of the worker threads is retained by the records parser
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_records_parser_worker_callback(
+     libevt_records_parser_chunk_t *chunk,
+     libevt_records_parser_t *records_parser )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "libevt_records_parser_worker_callback";
+	int file_io_handle_index = -1;
+	int result               = 0;
+
+	if( records_parser == NULL )
+	{
+		return( -1 );
+	}
+	result = libevt_records_parser_is_aborted(
+	          records_parser,
+	          &error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if parsing was aborted.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		/* The chunk is not parsed, hence the thread that waits to push
+		 * the next chunk has to be woken up
+		 */
+		if( libevt_records_parser_signal_abort(
+		     records_parser,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal abort.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+	if( libevt_records_parser_grab_file_io_handle(
+	     records_parser,
+	     &file_io_handle_index,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_records_parser_parse_chunk(
+	     records_parser,
+	     chunk,
+	     records_parser->file_io_handles[ file_io_handle_index ],
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to parse chunk.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_records_parser_release_file_io_handle(
+	     records_parser,
+	     file_io_handle_index,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file IO handle.",
+		 function );
+
+		file_io_handle_index = -1;
+
+		goto on_error;
+	}
+	file_io_handle_index = -1;
+
+	if( chunk->records != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     records_parser->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+		chunk->is_parsed = 1;
+
+		if( libcthreads_mutex_release(
+		     records_parser->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( libevt_records_parser_deliver_chunks(
+		     records_parser,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to pass records to callback function.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle_index != -1 )
+	{
+		libevt_records_parser_release_file_io_handle(
+		 records_parser,
+		 file_io_handle_index,
+		 NULL );
+	}
+	if( libcthreads_mutex_grab(
+	     records_parser->mutex,
+	     NULL ) == 1 )
+	{
+		if( records_parser->worker_error == NULL )
+		{
+			records_parser->worker_error = error;
+			error                        = NULL;
+		}
+		records_parser->abort = 1;
+
+		libcthreads_condition_broadcast(
+		 records_parser->delivery_condition,
+		 NULL );
+
+		libcthreads_mutex_release(
+		 records_parser->mutex,
+		 NULL );
+	}
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT ) */
+
+/* Parses the records
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_records_parser_parse(
+     libevt_records_parser_t *records_parser,
+     libcerror_error_t **error )
+{
+	static char *function                  = "libevt_records_parser_parse";
+	int chunk_index                        = 0;
+	int result                             = 0;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool = NULL;
+#endif
+
+	if( records_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records parser.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( records_parser->number_of_threads > 1 )
+	{
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     records_parser->number_of_threads,
+		     records_parser->number_of_threads * 4,
+		     (int (*)(intptr_t *, void *)) &libevt_records_parser_worker_callback,
+		     (void *) records_parser,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		/* When the record order is preserved the parsed records are stored until
+		 * the preceding chunks are passed to the callback function, hence a chunk
+		 * is only pushed once few enough chunks are pending, which bounds the memory
+		 * used by a slow chunk
+		 */
+		for( chunk_index = 0;
+		     chunk_index < records_parser->number_of_chunks;
+		     chunk_index++ )
+		{
+			if( ( records_parser->flags & LIBEVT_PARSE_RECORDS_FLAG_PRESERVE_ORDER ) != 0 )
+			{
+				if( libevt_records_parser_wait_for_delivery(
+				     records_parser,
+				     chunk_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to wait for delivery of chunks before chunk: %d.",
+					 function,
+					 chunk_index );
+
+					goto on_error;
+				}
+			}
+			result = libevt_records_parser_is_aborted(
+			          records_parser,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if parsing was aborted.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				break;
+			}
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( records_parser->chunks[ chunk_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push chunk: %d onto thread pool queue.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+		}
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		if( records_parser->worker_error != NULL )
+		{
+			/* Pass the error of the worker thread on to the caller
+			 */
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error                       = records_parser->worker_error;
+				records_parser->worker_error = NULL;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse records.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+#endif
+	for( chunk_index = 0;
+	     chunk_index < records_parser->number_of_chunks;
+	     chunk_index++ )
+	{
+		result = libevt_records_parser_is_aborted(
+		          records_parser,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if parsing was aborted.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			break;
+		}
+		if( libevt_records_parser_parse_chunk(
+		     records_parser,
+		     &( records_parser->chunks[ chunk_index ] ),
+		     records_parser->file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse chunk: %d.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		libevt_records_parser_signal_abort(
+		 records_parser,
+		 NULL );
+
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
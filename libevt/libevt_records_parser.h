@@ -0,0 +1,227 @@
+/*
+ * Records parser functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVT_RECORDS_PARSER_H )
+#define _LIBEVT_RECORDS_PARSER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevt_arena.h"
+#include "libevt_filter.h"
+#include "libevt_io_handle.h"
+#include "libevt_libbfio.h"
+#include "libevt_libcerror.h"
+#include "libevt_libcthreads.h"
+#include "libevt_libfdata.h"
+#include "libevt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevt_records_parser_chunk libevt_records_parser_chunk_t;
+
+struct libevt_records_parser_chunk
+{
+	/* The index of the first record in the chunk
+	 */
+	int first_record_index;
+
+	/* The number of records in the chunk
+	 */
+	int number_of_records;
+
+	/* The parsed records, used when the record order is preserved
+	 */
+	libevt_record_t **records;
+
+	/* Value to indicate the chunk was parsed
+	 */
+	uint8_t is_parsed;
+};
+
+typedef struct libevt_records_parser libevt_records_parser_t;
+
+struct libevt_records_parser
+{
+	/* The IO handle
+	 */
+	libevt_io_handle_t *io_handle;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The records list
+	 */
+	libfdata_list_t *records_list;
+
+	/* The filter
+	 */
+	libevt_internal_filter_t *filter;
+
+	/* The arena the event record data of the parsed records is carved from, NULL if not used
+	 */
+	libevt_arena_t *arena;
+
+	/* The callback function
+	 */
+	int (*callback_function)(
+	       libevt_record_t *record,
+	       int record_index,
+	       void *user_data,
+	       libcerror_error_t **error );
+
+	/* The callback function user data
+	 */
+	void *user_data;
+
+	/* The parse records flags
+	 */
+	uint8_t flags;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* The file IO handles of the worker threads
+	 */
+	libbfio_handle_t **file_io_handles;
+
+	/* Values to indicate if a file IO handle is used by a worker thread
+	 */
+	uint8_t *file_io_handles_in_use;
+
+	/* The chunks
+	 */
+	libevt_records_parser_chunk_t *chunks;
+
+	/* The number of chunks
+	 */
+	int number_of_chunks;
+
+	/* The index of the next chunk to pass to the callback function
+	 */
+	int next_chunk_index;
+
+	/* Value to indicate a thread is passing chunks to the callback function
+	 */
+	uint8_t is_delivering;
+
+	/* Value to indicate parsing should stop, protected by the mutex
+	 */
+	int abort;
+
+	/* The error of a worker thread
+	 */
+	libcerror_error_t *worker_error;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that is broadcast when a chunk was passed to the callback
+	 * function or parsing should stop
+	 */
+	libcthreads_condition_t *delivery_condition;
+#endif
+};
+
+int libevt_records_parser_initialize(
+     libevt_records_parser_t **records_parser,
+     libevt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfdata_list_t *records_list,
+     libevt_internal_filter_t *filter,
+     int number_of_threads,
+     int (*callback_function)(
+            libevt_record_t *record,
+            int record_index,
+            void *user_data,
+            libcerror_error_t **error ),
+     void *user_data,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int libevt_records_parser_free(
+     libevt_records_parser_t **records_parser,
+     libcerror_error_t **error );
+
+int libevt_records_parser_signal_abort(
+     libevt_records_parser_t *records_parser,
+     libcerror_error_t **error );
+
+int libevt_records_parser_is_aborted(
+     libevt_records_parser_t *records_parser,
+     libcerror_error_t **error );
+
+int libevt_records_parser_read_record(
+     libevt_records_parser_t *records_parser,
+     libbfio_handle_t *file_io_handle,
+     int record_index,
+     libevt_record_t **record,
+     libcerror_error_t **error );
+
+int libevt_records_parser_parse_chunk(
+     libevt_records_parser_t *records_parser,
+     libevt_records_parser_chunk_t *chunk,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libevt_records_parser_deliver_chunks(
+     libevt_records_parser_t *records_parser,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+
+int libevt_records_parser_grab_file_io_handle(
+     libevt_records_parser_t *records_parser,
+     int *file_io_handle_index,
+     libcerror_error_t **error );
+
+int libevt_records_parser_release_file_io_handle(
+     libevt_records_parser_t *records_parser,
+     int file_io_handle_index,
+     libcerror_error_t **error );
+
+int libevt_records_parser_wait_for_delivery(
+     libevt_records_parser_t *records_parser,
+     int chunk_index,
+     libcerror_error_t **error );
+
+int libevt_records_parser_worker_callback(
+     libevt_records_parser_chunk_t *chunk,
+     libevt_records_parser_t *records_parser );
+
+#endif /* defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT ) */
+
+int libevt_records_parser_parse(
+     libevt_records_parser_t *records_parser,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVT_RECORDS_PARSER_H ) */
+
@@ -0,0 +1,1827 @@
+/*
+ * Scanner functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevt_definitions.h"
+#include "libevt_end_of_file_record.h"
+#include "libevt_event_record.h"
+#include "libevt_file_header.h"
+#include "libevt_libbfio.h"
+#include "libevt_libcerror.h"
+#include "libevt_libcthreads.h"
+#include "libevt_scanner.h"
+
+#include "evt_end_of_file_record.h"
+#include "evt_file_header.h"
+
+/* Creates a scanner
+ * Make sure the value scanner is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_scanner_initialize(
+     libevt_scanner_t **scanner,
+     libcerror_error_t **error )
+{
+	libevt_internal_scanner_t *internal_scanner = NULL;
+	static char *function                       = "libevt_scanner_initialize";
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scanner != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scanner value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = memory_allocate_structure(
+	                    libevt_internal_scanner_t );
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scanner.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_scanner,
+	     0,
+	     sizeof( libevt_internal_scanner_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scanner.",
+		 function );
+
+		memory_free(
+		 internal_scanner );
+
+		return( -1 );
+	}
+	internal_scanner->chunk_size        = (size_t) LIBEVT_SCANNER_DEFAULT_CHUNK_SIZE;
+	internal_scanner->number_of_threads = 1;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( internal_scanner->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_scanner->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*scanner = (libevt_scanner_t *) internal_scanner;
+
+	return( 1 );
+
+on_error:
+	if( internal_scanner != NULL )
+	{
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+		if( internal_scanner->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( internal_scanner->mutex ),
+			 NULL );
+		}
+#endif
+		memory_free(
+		 internal_scanner );
+	}
+	return( -1 );
+}
+
+/* Frees a scanner
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_scanner_free(
+     libevt_scanner_t **scanner,
+     libcerror_error_t **error )
+{
+	libevt_internal_scanner_t *internal_scanner = NULL;
+	static char *function                       = "libevt_scanner_free";
+	int result                                  = 1;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scanner != NULL )
+	{
+		internal_scanner = (libevt_internal_scanner_t *) *scanner;
+		*scanner         = NULL;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_scanner->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( internal_scanner->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 internal_scanner );
+	}
+	return( result );
+}
+
+/* Signals the scanner to abort its current activity
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_scanner_signal_abort(
+     libevt_scanner_t *scanner,
+     libcerror_error_t **error )
+{
+	libevt_internal_scanner_t *internal_scanner = NULL;
+	static char *function                       = "libevt_scanner_signal_abort";
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libevt_internal_scanner_t *) scanner;
+
+	internal_scanner->abort = 1;
+
+	return( 1 );
+}
+
+/* Sets the number of threads used to scan
+ * Without multi-thread support the data is always scanned by a single thread
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_scanner_set_number_of_threads(
+     libevt_scanner_t *scanner,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libevt_internal_scanner_t *internal_scanner = NULL;
+	static char *function                       = "libevt_scanner_set_number_of_threads";
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libevt_internal_scanner_t *) scanner;
+
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > LIBEVT_SCANNER_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_scanner->number_of_threads = number_of_threads;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the size of the chunks the data is scanned in
+ * Every chunk is scanned by one thread at a time
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_scanner_set_chunk_size(
+     libevt_scanner_t *scanner,
+     size_t chunk_size,
+     libcerror_error_t **error )
+{
+	libevt_internal_scanner_t *internal_scanner = NULL;
+	static char *function                       = "libevt_scanner_set_chunk_size";
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libevt_internal_scanner_t *) scanner;
+
+	if( ( chunk_size < (size_t) LIBEVT_SCANNER_MAXIMUM_RECORD_SIZE )
+	 || ( chunk_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - LIBEVT_SCANNER_MAXIMUM_RECORD_SIZE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_scanner->chunk_size = chunk_size;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Checks if data contains a file header, an event record or an end-of-file record
+ * The data is validated with the same checks used when reading a file
+ * Returns 1 if the data contains a hit, 0 if not or -1 on error
+ */
+int libevt_scanner_check_data(
+     const uint8_t *data,
+     size_t data_size,
+     int *hit_type,
+     size32_t *hit_size,
+     libcerror_error_t **error )
+{
+	libevt_end_of_file_record_t *end_of_file_record = NULL;
+	libevt_file_header_t *file_header               = NULL;
+	libcerror_error_t *read_error                   = NULL;
+	static char *function                           = "libevt_scanner_check_data";
+	size_t maximum_record_size                      = 0;
+	uint32_t record_size                            = 0;
+	int result                                      = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hit_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hit type.",
+		 function );
+
+		return( -1 );
+	}
+	if( hit_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hit size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < 8 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 data,
+	 record_size );
+
+	/* The file header and the event record both have the signature directly after the size
+	 */
+	if( memory_compare(
+	     &( data[ 4 ] ),
+	     "LfLe",
+	     4 ) == 0 )
+	{
+		if( (size_t) record_size == sizeof( evt_file_header_t ) )
+		{
+			if( data_size < sizeof( evt_file_header_t ) )
+			{
+				return( 0 );
+			}
+			if( libevt_file_header_initialize(
+			     &file_header,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create file header.",
+				 function );
+
+				goto on_error;
+			}
+			result = libevt_file_header_read_data(
+			          file_header,
+			          data,
+			          sizeof( evt_file_header_t ),
+			          &read_error );
+
+			if( result != 1 )
+			{
+				libcerror_error_free(
+				 &read_error );
+
+				result = 0;
+			}
+			else if( ( file_header->copy_of_size != file_header->size )
+			      || ( file_header->major_format_version != 1 )
+			      || ( file_header->minor_format_version != 1 ) )
+			{
+				result = 0;
+			}
+			if( libevt_file_header_free(
+			     &file_header,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file header.",
+				 function );
+
+				goto on_error;
+			}
+			if( result != 0 )
+			{
+				*hit_type = LIBEVT_SCANNER_HIT_TYPE_FILE_HEADER;
+				*hit_size = (size32_t) sizeof( evt_file_header_t );
+			}
+			return( result );
+		}
+		/* Only event records that are completely stored in the data are reported
+		 * so that the copy of the size at the end of the record is checked as well
+		 */
+		if( (size_t) record_size > data_size )
+		{
+			return( 0 );
+		}
+		maximum_record_size = data_size;
+
+		if( maximum_record_size > (size_t) LIBEVT_SCANNER_MAXIMUM_RECORD_SIZE )
+		{
+			maximum_record_size = (size_t) LIBEVT_SCANNER_MAXIMUM_RECORD_SIZE;
+		}
+		result = libevt_event_record_check_data(
+		          data,
+		          data_size,
+		          maximum_record_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to check event record data.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			*hit_type = LIBEVT_SCANNER_HIT_TYPE_EVENT_RECORD;
+			*hit_size = (size32_t) record_size;
+		}
+		return( result );
+	}
+	if( ( (size_t) record_size != sizeof( evt_end_of_file_record_t ) )
+	 || ( data_size < sizeof( evt_end_of_file_record_t ) )
+	 || ( memory_compare(
+	       ( (evt_end_of_file_record_t *) data )->signature1,
+	       "\x11\x11\x11\x11",
+	       4 ) != 0 ) )
+	{
+		return( 0 );
+	}
+	if( libevt_end_of_file_record_initialize(
+	     &end_of_file_record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create end-of-file record.",
+		 function );
+
+		goto on_error;
+	}
+	result = libevt_end_of_file_record_read_data(
+	          end_of_file_record,
+	          data,
+	          sizeof( evt_end_of_file_record_t ),
+	          &read_error );
+
+	if( result != 1 )
+	{
+		libcerror_error_free(
+		 &read_error );
+
+		result = 0;
+	}
+	if( libevt_end_of_file_record_free(
+	     &end_of_file_record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free end-of-file record.",
+		 function );
+
+		goto on_error;
+	}
+	if( result != 0 )
+	{
+		*hit_type = LIBEVT_SCANNER_HIT_TYPE_END_OF_FILE_RECORD;
+		*hit_size = (size32_t) sizeof( evt_end_of_file_record_t );
+	}
+	return( result );
+
+on_error:
+	if( end_of_file_record != NULL )
+	{
+		libevt_end_of_file_record_free(
+		 &end_of_file_record,
+		 NULL );
+	}
+	if( file_header != NULL )
+	{
+		libevt_file_header_free(
+		 &file_header,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Passes a hit to the callback function
+ * The callback function is called by one thread at a time
+ * Returns 1 if scanning should continue, 0 if it should stop or -1 on error
+ */
+int libevt_scanner_report_hit(
+     libevt_internal_scanner_t *internal_scanner,
+     int hit_type,
+     off64_t offset,
+     size32_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_scanner_report_hit";
+	int result            = 0;
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scanner->callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scanner - missing callback function.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_scanner->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Once scanning was stopped hits of other threads are no longer passed on
+	 */
+	if( internal_scanner->abort == 0 )
+	{
+		result = internal_scanner->callback_function(
+		          hit_type,
+		          offset,
+		          size,
+		          internal_scanner->user_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: callback function failed for hit at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+		}
+		else if( result == 0 )
+		{
+			internal_scanner->abort = 1;
+		}
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_scanner->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Scans a chunk for hits
+ * The chunk is read with the file IO handle and buffer of a specific slot
+ * Only hits that start inside the chunk are reported, the data that is read
+ * beyond the chunk is used to validate the records that start near its end
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_scanner_scan_chunk(
+     libevt_internal_scanner_t *internal_scanner,
+     libevt_scanner_chunk_t *chunk,
+     int slot_index,
+     libcerror_error_t **error )
+{
+	uint8_t *buffer       = NULL;
+	static char *function = "libevt_scanner_scan_chunk";
+	size_t buffer_offset  = 0;
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+	size32_t hit_size     = 0;
+	uint8_t byte_value    = 0;
+	int hit_type          = 0;
+	int result            = 0;
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk->offset < 0 )
+	 || ( (size64_t) chunk->offset >= internal_scanner->data_size )
+	 || ( chunk->size == 0 )
+	 || ( chunk->size > (size64_t) internal_scanner->chunk_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot_index < 0 )
+	 || ( slot_index >= internal_scanner->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scanner->buffers[ slot_index ] == NULL )
+	{
+		internal_scanner->buffers[ slot_index ] = (uint8_t *) memory_allocate(
+		                                                       sizeof( uint8_t ) * ( internal_scanner->chunk_size + LIBEVT_SCANNER_MAXIMUM_RECORD_SIZE ) );
+
+		if( internal_scanner->buffers[ slot_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	buffer    = internal_scanner->buffers[ slot_index ];
+	read_size = (size_t) chunk->size + LIBEVT_SCANNER_MAXIMUM_RECORD_SIZE;
+
+	if( (size64_t) read_size > ( internal_scanner->data_size - chunk->offset ) )
+	{
+		read_size = (size_t) ( internal_scanner->data_size - chunk->offset );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              internal_scanner->file_io_handles[ slot_index ],
+	              buffer,
+	              read_size,
+	              chunk->offset,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunk at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 chunk->offset,
+		 chunk->offset );
+
+		return( -1 );
+	}
+	while( ( buffer_offset < (size_t) chunk->size )
+	    && ( ( read_size - buffer_offset ) >= 8 ) )
+	{
+		/* Only bytes that can start the signature of a hit are checked further,
+		 * the event record and file header signature "LfLe" or the first byte of
+		 * the end-of-file record signature
+		 */
+		byte_value = buffer[ buffer_offset + 4 ];
+
+		if( ( byte_value != (uint8_t) 'L' )
+		 && ( byte_value != 0x11 ) )
+		{
+			buffer_offset++;
+
+			continue;
+		}
+		result = libevt_scanner_check_data(
+		          &( buffer[ buffer_offset ] ),
+		          read_size - buffer_offset,
+		          &hit_type,
+		          &hit_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to check data at offset: %" PRIi64 ".",
+			 function,
+			 chunk->offset + (off64_t) buffer_offset );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			buffer_offset++;
+
+			continue;
+		}
+		result = libevt_scanner_report_hit(
+		          internal_scanner,
+		          hit_type,
+		          chunk->offset + (off64_t) buffer_offset,
+		          hit_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to report hit at offset: %" PRIi64 ".",
+			 function,
+			 chunk->offset + (off64_t) buffer_offset );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		/* A hit cannot contain the start of another hit
+		 */
+		buffer_offset += (size_t) hit_size;
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+
+/* Grabs an unused slot, with a file IO handle and buffer, for a worker thread
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_scanner_grab_slot(
+     libevt_internal_scanner_t *internal_scanner,
+     int *slot_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_scanner_grab_slot";
+	int safe_slot_index   = 0;
+	int result            = 0;
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( slot_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_scanner->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	/* The thread pool runs at most number of slots callbacks at the same time
+	 * hence there always is an unused slot
+	 */
+	for( safe_slot_index = 0;
+	     safe_slot_index < internal_scanner->number_of_slots;
+	     safe_slot_index++ )
+	{
+		if( internal_scanner->file_io_handles_in_use[ safe_slot_index ] == 0 )
+		{
+			internal_scanner->file_io_handles_in_use[ safe_slot_index ] = 1;
+
+			*slot_index = safe_slot_index;
+
+			result = 1;
+
+			break;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     internal_scanner->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing unused slot.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Releases a slot of a worker thread
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_scanner_release_slot(
+     libevt_internal_scanner_t *internal_scanner,
+     int slot_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_scanner_release_slot";
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( slot_index < 0 )
+	 || ( slot_index >= internal_scanner->number_of_slots ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid slot index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_scanner->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner->file_io_handles_in_use[ slot_index ] = 0;
+
+	if( libcthreads_mutex_release(
+	     internal_scanner->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Scans a chunk in a worker thread of the thread pool
+ * The first error of the worker threads is retained by the scanner
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_scanner_worker_callback(
+     libevt_scanner_chunk_t *chunk,
+     libevt_internal_scanner_t *internal_scanner )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "libevt_scanner_worker_callback";
+	int slot_index           = -1;
+
+	if( internal_scanner == NULL )
+	{
+		return( -1 );
+	}
+	if( internal_scanner->abort != 0 )
+	{
+		return( 1 );
+	}
+	if( libevt_scanner_grab_slot(
+	     internal_scanner,
+	     &slot_index,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab slot.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_scanner_scan_chunk(
+	     internal_scanner,
+	     chunk,
+	     slot_index,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan chunk.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_scanner_release_slot(
+	     internal_scanner,
+	     slot_index,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release slot.",
+		 function );
+
+		slot_index = -1;
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( slot_index != -1 )
+	{
+		libevt_scanner_release_slot(
+		 internal_scanner,
+		 slot_index,
+		 NULL );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_scanner->mutex,
+	     NULL ) == 1 )
+	{
+		if( internal_scanner->worker_error == NULL )
+		{
+			internal_scanner->worker_error = error;
+			error                          = NULL;
+		}
+		internal_scanner->abort = 1;
+
+		libcthreads_mutex_release(
+		 internal_scanner->mutex,
+		 NULL );
+	}
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT ) */
+
+/* Frees the values of the current scan
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_scanner_free_scan_values(
+     libevt_internal_scanner_t *internal_scanner,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_scanner_free_scan_values";
+	int result            = 1;
+	int slot_index        = 0;
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scanner->file_io_handles != NULL )
+	{
+		for( slot_index = 0;
+		     slot_index < internal_scanner->number_of_slots;
+		     slot_index++ )
+		{
+			/* Only the cloned file IO handles are owned by the scanner
+			 */
+			if( ( internal_scanner->file_io_handles[ slot_index ] == NULL )
+			 || ( internal_scanner->file_io_handles[ slot_index ] == internal_scanner->file_io_handle ) )
+			{
+				continue;
+			}
+			if( libbfio_handle_is_open(
+			     internal_scanner->file_io_handles[ slot_index ],
+			     NULL ) == 1 )
+			{
+				if( libbfio_handle_close(
+				     internal_scanner->file_io_handles[ slot_index ],
+				     error ) != 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+					 "%s: unable to close file IO handle: %d.",
+					 function,
+					 slot_index );
+
+					result = -1;
+				}
+			}
+			if( libbfio_handle_free(
+			     &( internal_scanner->file_io_handles[ slot_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file IO handle: %d.",
+				 function,
+				 slot_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 internal_scanner->file_io_handles );
+
+		internal_scanner->file_io_handles = NULL;
+	}
+	if( internal_scanner->file_io_handles_in_use != NULL )
+	{
+		memory_free(
+		 internal_scanner->file_io_handles_in_use );
+
+		internal_scanner->file_io_handles_in_use = NULL;
+	}
+	if( internal_scanner->buffers != NULL )
+	{
+		for( slot_index = 0;
+		     slot_index < internal_scanner->number_of_slots;
+		     slot_index++ )
+		{
+			if( internal_scanner->buffers[ slot_index ] != NULL )
+			{
+				memory_free(
+				 internal_scanner->buffers[ slot_index ] );
+			}
+		}
+		memory_free(
+		 internal_scanner->buffers );
+
+		internal_scanner->buffers = NULL;
+	}
+	if( internal_scanner->chunks != NULL )
+	{
+		memory_free(
+		 internal_scanner->chunks );
+
+		internal_scanner->chunks = NULL;
+	}
+	if( internal_scanner->worker_error != NULL )
+	{
+		libcerror_error_free(
+		 &( internal_scanner->worker_error ) );
+	}
+	internal_scanner->file_io_handle    = NULL;
+	internal_scanner->data_size         = 0;
+	internal_scanner->callback_function = NULL;
+	internal_scanner->user_data         = NULL;
+	internal_scanner->number_of_slots   = 0;
+	internal_scanner->number_of_chunks  = 0;
+
+	return( result );
+}
+
+/* Scans the data of a file IO handle for file headers, event records and end-of-file records
+ * The callback function is called for every hit, it should return 1 to continue scanning,
+ * 0 to stop scanning or -1 on error. The callback function is called by one thread at a time
+ * but when multiple threads are used the hits are not necessarily reported in offset order
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_scanner_scan_file_io_handle(
+     libevt_scanner_t *scanner,
+     libbfio_handle_t *file_io_handle,
+     int (*callback_function)(
+            int hit_type,
+            off64_t offset,
+            size32_t size,
+            void *user_data,
+            libcerror_error_t **error ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	libevt_internal_scanner_t *internal_scanner = NULL;
+	static char *function                       = "libevt_scanner_scan_file_io_handle";
+	size64_t number_of_chunks                   = 0;
+	off64_t chunk_offset                        = 0;
+	int chunk_index                             = 0;
+	int file_io_handle_opened_in_scanner        = 0;
+	int result                                  = 0;
+	int slot_index                              = 0;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool      = NULL;
+#endif
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libevt_internal_scanner_t *) scanner;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_scanner->abort             = 0;
+	internal_scanner->file_io_handle    = file_io_handle;
+	internal_scanner->callback_function = callback_function;
+	internal_scanner->user_data         = user_data;
+
+	result = libbfio_handle_is_open(
+	          file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_opened_in_scanner = 1;
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &( internal_scanner->data_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_scanner->data_size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_chunks = internal_scanner->data_size / internal_scanner->chunk_size;
+
+	if( ( internal_scanner->data_size % internal_scanner->chunk_size ) != 0 )
+	{
+		number_of_chunks++;
+	}
+	if( number_of_chunks > (size64_t) ( INT_MAX / sizeof( libevt_scanner_chunk_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of chunks value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	internal_scanner->number_of_chunks = (int) number_of_chunks;
+
+	if( internal_scanner->number_of_chunks == 0 )
+	{
+		goto on_finish;
+	}
+	internal_scanner->chunks = (libevt_scanner_chunk_t *) memory_allocate(
+	                                                       sizeof( libevt_scanner_chunk_t ) * internal_scanner->number_of_chunks );
+
+	if( internal_scanner->chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunks.",
+		 function );
+
+		goto on_error;
+	}
+	for( chunk_index = 0;
+	     chunk_index < internal_scanner->number_of_chunks;
+	     chunk_index++ )
+	{
+		internal_scanner->chunks[ chunk_index ].offset = chunk_offset;
+		internal_scanner->chunks[ chunk_index ].size   = internal_scanner->data_size - (size64_t) chunk_offset;
+
+		if( internal_scanner->chunks[ chunk_index ].size > (size64_t) internal_scanner->chunk_size )
+		{
+			internal_scanner->chunks[ chunk_index ].size = (size64_t) internal_scanner->chunk_size;
+		}
+		chunk_offset += (off64_t) internal_scanner->chunks[ chunk_index ].size;
+	}
+	internal_scanner->number_of_slots = 1;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	internal_scanner->number_of_slots = internal_scanner->number_of_threads;
+
+	if( internal_scanner->number_of_slots > internal_scanner->number_of_chunks )
+	{
+		internal_scanner->number_of_slots = internal_scanner->number_of_chunks;
+	}
+#endif
+	internal_scanner->file_io_handles = (libbfio_handle_t **) memory_allocate(
+	                                                           sizeof( libbfio_handle_t * ) * internal_scanner->number_of_slots );
+
+	if( internal_scanner->file_io_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file IO handles.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_scanner->file_io_handles,
+	     0,
+	     sizeof( libbfio_handle_t * ) * internal_scanner->number_of_slots ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file IO handles.",
+		 function );
+
+		goto on_error;
+	}
+	internal_scanner->file_io_handles_in_use = (uint8_t *) memory_allocate(
+	                                                        sizeof( uint8_t ) * internal_scanner->number_of_slots );
+
+	if( internal_scanner->file_io_handles_in_use == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file IO handles in use.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_scanner->file_io_handles_in_use,
+	     0,
+	     sizeof( uint8_t ) * internal_scanner->number_of_slots ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file IO handles in use.",
+		 function );
+
+		goto on_error;
+	}
+	internal_scanner->buffers = (uint8_t **) memory_allocate(
+	                                          sizeof( uint8_t * ) * internal_scanner->number_of_slots );
+
+	if( internal_scanner->buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_scanner->buffers,
+	     0,
+	     sizeof( uint8_t * ) * internal_scanner->number_of_slots ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buffers.",
+		 function );
+
+		goto on_error;
+	}
+	/* A single thread reads with the file IO handle of the caller, every worker
+	 * thread reads using its own clone of the file IO handle so that reads of
+	 * different threads do not contend for the same handle.
+	 */
+	for( slot_index = 0;
+	     slot_index < internal_scanner->number_of_slots;
+	     slot_index++ )
+	{
+		if( internal_scanner->number_of_slots == 1 )
+		{
+			internal_scanner->file_io_handles[ slot_index ] = file_io_handle;
+
+			break;
+		}
+		if( libbfio_handle_clone(
+		     &( internal_scanner->file_io_handles[ slot_index ] ),
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle: %d.",
+			 function,
+			 slot_index );
+
+			goto on_error;
+		}
+		result = libbfio_handle_is_open(
+		          internal_scanner->file_io_handles[ slot_index ],
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if file IO handle: %d is open.",
+			 function,
+			 slot_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libbfio_handle_open(
+			     internal_scanner->file_io_handles[ slot_index ],
+			     LIBBFIO_OPEN_READ,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open file IO handle: %d.",
+				 function,
+				 slot_index );
+
+				goto on_error;
+			}
+		}
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( internal_scanner->number_of_slots > 1 )
+	{
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     internal_scanner->number_of_slots,
+		     internal_scanner->number_of_slots * 4,
+		     (int (*)(intptr_t *, void *)) &libevt_scanner_worker_callback,
+		     (void *) internal_scanner,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( chunk_index = 0;
+		     chunk_index < internal_scanner->number_of_chunks;
+		     chunk_index++ )
+		{
+			if( internal_scanner->abort != 0 )
+			{
+				break;
+			}
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( internal_scanner->chunks[ chunk_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push chunk: %d onto thread pool queue.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+		}
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		if( internal_scanner->worker_error != NULL )
+		{
+			/* Pass the error of the worker thread on to the caller
+			 */
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error                         = internal_scanner->worker_error;
+				internal_scanner->worker_error = NULL;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan chunks.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	if( internal_scanner->number_of_slots == 1 )
+	{
+		for( chunk_index = 0;
+		     chunk_index < internal_scanner->number_of_chunks;
+		     chunk_index++ )
+		{
+			if( internal_scanner->abort != 0 )
+			{
+				break;
+			}
+			if( libevt_scanner_scan_chunk(
+			     internal_scanner,
+			     &( internal_scanner->chunks[ chunk_index ] ),
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to scan chunk: %d.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+		}
+	}
+on_finish:
+	if( libevt_scanner_free_scan_values(
+	     internal_scanner,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free scan values.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_io_handle_opened_in_scanner != 0 )
+	{
+		file_io_handle_opened_in_scanner = 0;
+
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		internal_scanner->abort = 1;
+
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+#endif
+	libevt_scanner_free_scan_values(
+	 internal_scanner,
+	 NULL );
+
+	if( file_io_handle_opened_in_scanner != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_scanner->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
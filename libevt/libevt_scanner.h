@@ -0,0 +1,215 @@
+/*
+ * Scanner functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVT_SCANNER_H )
+#define _LIBEVT_SCANNER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevt_extern.h"
+#include "libevt_libbfio.h"
+#include "libevt_libcerror.h"
+#include "libevt_libcthreads.h"
+#include "libevt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevt_scanner_chunk libevt_scanner_chunk_t;
+
+struct libevt_scanner_chunk
+{
+	/* The offset of the chunk
+	 */
+	off64_t offset;
+
+	/* The size of the chunk
+	 * The data read for the chunk extends beyond the chunk by the maximum record size
+	 */
+	size64_t size;
+};
+
+typedef struct libevt_internal_scanner libevt_internal_scanner_t;
+
+struct libevt_internal_scanner
+{
+	/* The chunk size
+	 */
+	size_t chunk_size;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* The file IO handle of the current scan
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The size of the data of the current scan
+	 */
+	size64_t data_size;
+
+	/* The callback function of the current scan
+	 */
+	int (*callback_function)(
+	       int hit_type,
+	       off64_t offset,
+	       size32_t size,
+	       void *user_data,
+	       libcerror_error_t **error );
+
+	/* The callback function user data
+	 */
+	void *user_data;
+
+	/* The number of worker thread slots of the current scan
+	 */
+	int number_of_slots;
+
+	/* The file IO handles of the worker threads
+	 */
+	libbfio_handle_t **file_io_handles;
+
+	/* Values to indicate if a file IO handle is used by a worker thread
+	 */
+	uint8_t *file_io_handles_in_use;
+
+	/* The read buffers of the worker threads
+	 */
+	uint8_t **buffers;
+
+	/* The chunks of the current scan
+	 */
+	libevt_scanner_chunk_t *chunks;
+
+	/* The number of chunks
+	 */
+	int number_of_chunks;
+
+	/* Value to indicate scanning should stop
+	 */
+	int abort;
+
+	/* The error of a worker thread
+	 */
+	libcerror_error_t *worker_error;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+LIBEVT_EXTERN \
+int libevt_scanner_initialize(
+     libevt_scanner_t **scanner,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_scanner_free(
+     libevt_scanner_t **scanner,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_scanner_signal_abort(
+     libevt_scanner_t *scanner,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_scanner_set_number_of_threads(
+     libevt_scanner_t *scanner,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_scanner_set_chunk_size(
+     libevt_scanner_t *scanner,
+     size_t chunk_size,
+     libcerror_error_t **error );
+
+int libevt_scanner_check_data(
+     const uint8_t *data,
+     size_t data_size,
+     int *hit_type,
+     size32_t *hit_size,
+     libcerror_error_t **error );
+
+int libevt_scanner_report_hit(
+     libevt_internal_scanner_t *internal_scanner,
+     int hit_type,
+     off64_t offset,
+     size32_t size,
+     libcerror_error_t **error );
+
+int libevt_scanner_scan_chunk(
+     libevt_internal_scanner_t *internal_scanner,
+     libevt_scanner_chunk_t *chunk,
+     int slot_index,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+
+int libevt_scanner_grab_slot(
+     libevt_internal_scanner_t *internal_scanner,
+     int *slot_index,
+     libcerror_error_t **error );
+
+int libevt_scanner_release_slot(
+     libevt_internal_scanner_t *internal_scanner,
+     int slot_index,
+     libcerror_error_t **error );
+
+int libevt_scanner_worker_callback(
+     libevt_scanner_chunk_t *chunk,
+     libevt_internal_scanner_t *internal_scanner );
+
+#endif /* defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT ) */
+
+int libevt_scanner_free_scan_values(
+     libevt_internal_scanner_t *internal_scanner,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_scanner_scan_file_io_handle(
+     libevt_scanner_t *scanner,
+     libbfio_handle_t *file_io_handle,
+     int (*callback_function)(
+            int hit_type,
+            off64_t offset,
+            size32_t size,
+            void *user_data,
+            libcerror_error_t **error ),
+     void *user_data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVT_SCANNER_H ) */
+
@@ -0,0 +1,375 @@
+/*
+ * Signature scanner functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevt_definitions.h"
+#include "libevt_libcerror.h"
+#include "libevt_signature_scanner.h"
+
+/* SSE2 is part of the x86-64 baseline, hence no run-time detection is needed
+ */
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) )
+#define LIBEVT_SIGNATURE_SCANNER_HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+/* Creates a signature scanner
+ * Make sure the value signature_scanner is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_signature_scanner_initialize(
+     libevt_signature_scanner_t **signature_scanner,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_signature_scanner_initialize";
+
+	if( signature_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( *signature_scanner != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid signature scanner value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*signature_scanner = memory_allocate_structure(
+	                      libevt_signature_scanner_t );
+
+	if( *signature_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create signature scanner.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *signature_scanner,
+	     0,
+	     sizeof( libevt_signature_scanner_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear signature scanner.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *signature_scanner != NULL )
+	{
+		memory_free(
+		 *signature_scanner );
+
+		*signature_scanner = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a signature scanner
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_signature_scanner_free(
+     libevt_signature_scanner_t **signature_scanner,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_signature_scanner_free";
+
+	if( signature_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( *signature_scanner != NULL )
+	{
+		memory_free(
+		 *signature_scanner );
+
+		*signature_scanner = NULL;
+	}
+	return( 1 );
+}
+
+/* Adds a 4-byte signature
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_signature_scanner_add_signature(
+     libevt_signature_scanner_t *signature_scanner,
+     const uint8_t *signature,
+     size_t signature_size,
+     int *signature_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_signature_scanner_add_signature";
+
+	if( signature_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature_scanner->number_of_signatures >= LIBEVT_SIGNATURE_SCANNER_MAXIMUM_NUMBER_OF_SIGNATURES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid signature scanner - number of signatures value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature_size != 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature size.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature index.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 signature,
+	 signature_scanner->signatures[ signature_scanner->number_of_signatures ] );
+
+	*signature_index = signature_scanner->number_of_signatures;
+
+	signature_scanner->number_of_signatures += 1;
+
+	return( 1 );
+}
+
+/* Scans a buffer for the first occurrence of any of the signatures
+ * Only the 4-byte aligned offsets relative to the initial buffer offset are scanned
+ * On return buffer_offset contains the offset of the signature if found,
+ * otherwise the offset directly after the last scanned offset
+ * Returns 1 if a signature was found, 0 if not or -1 on error
+ */
+int libevt_signature_scanner_scan_buffer(
+     libevt_signature_scanner_t *signature_scanner,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t *buffer_offset,
+     int *signature_index,
+     libcerror_error_t **error )
+{
+#if defined( LIBEVT_SIGNATURE_SCANNER_HAVE_SSE2 )
+	__m128i sse2_signatures[ LIBEVT_SIGNATURE_SCANNER_MAXIMUM_NUMBER_OF_SIGNATURES ];
+	__m128i sse2_buffer_data;
+	__m128i sse2_matches;
+#endif
+	static char *function     = "libevt_signature_scanner_scan_buffer";
+	size_t safe_buffer_offset = 0;
+	uint32_t value_32bit      = 0;
+	int safe_signature_index  = 0;
+
+#if defined( LIBEVT_SIGNATURE_SCANNER_HAVE_SSE2 )
+	int sse2_mask             = 0;
+#endif
+
+	if( signature_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature index.",
+		 function );
+
+		return( -1 );
+	}
+	safe_buffer_offset = *buffer_offset;
+
+#if defined( LIBEVT_SIGNATURE_SCANNER_HAVE_SSE2 )
+	/* Compare 4 aligned values against all signatures at once and skip blocks
+	 * without a match, the matching value is determined by the scalar scan below
+	 */
+	for( safe_signature_index = 0;
+	     safe_signature_index < signature_scanner->number_of_signatures;
+	     safe_signature_index++ )
+	{
+		sse2_signatures[ safe_signature_index ] = _mm_set1_epi32(
+		                                           (int) signature_scanner->signatures[ safe_signature_index ] );
+	}
+	while( ( safe_buffer_offset < buffer_size )
+	    && ( ( buffer_size - safe_buffer_offset ) >= 16 ) )
+	{
+		sse2_buffer_data = _mm_loadu_si128(
+		                    (const __m128i *) &( buffer[ safe_buffer_offset ] ) );
+
+		sse2_matches = _mm_setzero_si128();
+
+		for( safe_signature_index = 0;
+		     safe_signature_index < signature_scanner->number_of_signatures;
+		     safe_signature_index++ )
+		{
+			sse2_matches = _mm_or_si128(
+			                sse2_matches,
+			                _mm_cmpeq_epi32(
+			                 sse2_buffer_data,
+			                 sse2_signatures[ safe_signature_index ] ) );
+		}
+		sse2_mask = _mm_movemask_epi8(
+		             sse2_matches );
+
+		if( sse2_mask != 0 )
+		{
+			while( ( sse2_mask & 0x000f ) == 0 )
+			{
+				safe_buffer_offset += 4;
+
+				sse2_mask >>= 4;
+			}
+			break;
+		}
+		safe_buffer_offset += 16;
+	}
+#endif /* defined( LIBEVT_SIGNATURE_SCANNER_HAVE_SSE2 ) */
+
+	while( ( safe_buffer_offset < buffer_size )
+	    && ( ( buffer_size - safe_buffer_offset ) >= 4 ) )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( buffer[ safe_buffer_offset ] ),
+		 value_32bit );
+
+		for( safe_signature_index = 0;
+		     safe_signature_index < signature_scanner->number_of_signatures;
+		     safe_signature_index++ )
+		{
+			if( value_32bit == signature_scanner->signatures[ safe_signature_index ] )
+			{
+				*buffer_offset   = safe_buffer_offset;
+				*signature_index = safe_signature_index;
+
+				return( 1 );
+			}
+		}
+		safe_buffer_offset += 4;
+	}
+	*buffer_offset = safe_buffer_offset;
+
+	return( 0 );
+}
+
@@ -0,0 +1,79 @@
+/*
+ * Signature scanner functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVT_SIGNATURE_SCANNER_H )
+#define _LIBEVT_SIGNATURE_SCANNER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevt_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of signatures
+ */
+#define LIBEVT_SIGNATURE_SCANNER_MAXIMUM_NUMBER_OF_SIGNATURES	8
+
+typedef struct libevt_signature_scanner libevt_signature_scanner_t;
+
+struct libevt_signature_scanner
+{
+	/* The signatures as 32-bit little-endian values
+	 */
+	uint32_t signatures[ LIBEVT_SIGNATURE_SCANNER_MAXIMUM_NUMBER_OF_SIGNATURES ];
+
+	/* The number of signatures
+	 */
+	int number_of_signatures;
+};
+
+int libevt_signature_scanner_initialize(
+     libevt_signature_scanner_t **signature_scanner,
+     libcerror_error_t **error );
+
+int libevt_signature_scanner_free(
+     libevt_signature_scanner_t **signature_scanner,
+     libcerror_error_t **error );
+
+int libevt_signature_scanner_add_signature(
+     libevt_signature_scanner_t *signature_scanner,
+     const uint8_t *signature,
+     size_t signature_size,
+     int *signature_index,
+     libcerror_error_t **error );
+
+int libevt_signature_scanner_scan_buffer(
+     libevt_signature_scanner_t *signature_scanner,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t *buffer_offset,
+     int *signature_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVT_SIGNATURE_SCANNER_H ) */
+
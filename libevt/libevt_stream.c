@@ -0,0 +1,1496 @@
+/*
+ * Stream functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevt_definitions.h"
+#include "libevt_file_header.h"
+#include "libevt_io_handle.h"
+#include "libevt_libbfio.h"
+#include "libevt_libcerror.h"
+#include "libevt_libcthreads.h"
+#include "libevt_record.h"
+#include "libevt_record_values.h"
+#include "libevt_stream.h"
+
+#include "evt_file_header.h"
+
+/* Creates a stream
+ * Make sure the value stream is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_stream_initialize(
+     libevt_stream_t **stream,
+     libcerror_error_t **error )
+{
+	libevt_internal_stream_t *internal_stream = NULL;
+	static char *function                     = "libevt_stream_initialize";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream = memory_allocate_structure(
+	                   libevt_internal_stream_t );
+
+	if( internal_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_stream,
+	     0,
+	     sizeof( libevt_internal_stream_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear stream.",
+		 function );
+
+		memory_free(
+		 internal_stream );
+
+		return( -1 );
+	}
+	if( libevt_io_handle_initialize(
+	     &( internal_stream->io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	internal_stream->block_size = LIBEVT_STREAM_DEFAULT_BLOCK_SIZE;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_stream->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*stream = (libevt_stream_t *) internal_stream;
+
+	return( 1 );
+
+on_error:
+	if( internal_stream != NULL )
+	{
+		if( internal_stream->io_handle != NULL )
+		{
+			libevt_io_handle_free(
+			 &( internal_stream->io_handle ),
+			 NULL );
+		}
+		memory_free(
+		 internal_stream );
+	}
+	return( -1 );
+}
+
+/* Frees a stream
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_stream_free(
+     libevt_stream_t **stream,
+     libcerror_error_t **error )
+{
+	libevt_internal_stream_t *internal_stream = NULL;
+	static char *function                     = "libevt_stream_free";
+	int result                                = 1;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream != NULL )
+	{
+		internal_stream = (libevt_internal_stream_t *) *stream;
+
+		if( internal_stream->read_function != NULL )
+		{
+			if( libevt_stream_close(
+			     *stream,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close stream.",
+				 function );
+
+				result = -1;
+			}
+		}
+		*stream = NULL;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_stream->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( libevt_io_handle_free(
+		     &( internal_stream->io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free IO handle.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_stream );
+	}
+	return( result );
+}
+
+/* Sets the size of the blocks the stream reads from its input
+ * The block size can only be set before the stream is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_stream_set_block_size(
+     libevt_stream_t *stream,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	libevt_internal_stream_t *internal_stream = NULL;
+	static char *function                     = "libevt_stream_set_block_size";
+	int result                                = 1;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream = (libevt_internal_stream_t *) stream;
+
+	if( ( block_size < (size_t) LIBEVT_STREAM_MINIMUM_BLOCK_SIZE )
+	 || ( block_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_stream->read_function != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stream - stream already open.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		internal_stream->block_size = block_size;
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Opens a stream using a Basic File IO (bfio) handle
+ * The file IO handle is only read sequentially from its current offset,
+ * which must be the start of the file, and is never seeked
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_stream_open_file_io_handle(
+     libevt_stream_t *stream,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libevt_internal_stream_t *internal_stream = NULL;
+	static char *function                     = "libevt_stream_open_file_io_handle";
+	uint8_t file_io_handle_opened_in_library  = 0;
+	int bfio_access_flags                     = 0;
+	int file_io_handle_is_open                = 0;
+	int result                                = 1;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream = (libevt_internal_stream_t *) stream;
+
+	if( internal_stream->read_function != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stream - read function already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBEVT_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBEVT_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBEVT_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBEVT_ACCESS_FLAG_READ ) != 0 )
+	{
+		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		return( -1 );
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     bfio_access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			return( -1 );
+		}
+		file_io_handle_opened_in_library = 1;
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_stream->file_io_handle                   = file_io_handle;
+	internal_stream->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+	internal_stream->read_function                    = &libevt_stream_read_file_io_handle;
+	internal_stream->io_data                          = (void *) file_io_handle;
+
+	if( libevt_stream_open_read(
+	     internal_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file IO handle.",
+		 function );
+
+		internal_stream->file_io_handle                   = NULL;
+		internal_stream->file_io_handle_opened_in_library = 0;
+		internal_stream->read_function                    = NULL;
+		internal_stream->io_data                          = NULL;
+
+		result = -1;
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 error );
+	}
+	return( -1 );
+}
+
+/* Opens a stream using a read function
+ * The read function is called with the IO data to read the next data of
+ * the input and returns the number of bytes read, 0 at the end of the input
+ * or -1 on error. This allows to read from inputs that cannot be seeked.
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_stream_open_read_function(
+     libevt_stream_t *stream,
+     ssize_t (*read_function)(
+                void *io_data,
+                uint8_t *data,
+                size_t data_size,
+                libcerror_error_t **error ),
+     void *io_data,
+     libcerror_error_t **error )
+{
+	libevt_internal_stream_t *internal_stream = NULL;
+	static char *function                     = "libevt_stream_open_read_function";
+	int result                                = 1;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream = (libevt_internal_stream_t *) stream;
+
+	if( internal_stream->read_function != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stream - read function already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read function.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_stream->read_function = read_function;
+	internal_stream->io_data       = io_data;
+
+	if( libevt_stream_open_read(
+	     internal_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from input.",
+		 function );
+
+		internal_stream->read_function = NULL;
+		internal_stream->io_data       = NULL;
+
+		result = -1;
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads the file header and positions the stream at the first (oldest) record
+ * When the record data has wrapped the data between the file header and the
+ * first record is retained, since it contains the newest records, which are
+ * read after the end of the input has been reached
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_stream_open_read(
+     libevt_internal_stream_t *internal_stream,
+     libcerror_error_t **error )
+{
+	uint8_t file_header_data[ sizeof( evt_file_header_t ) ];
+
+	libevt_file_header_t *file_header = NULL;
+	static char *function             = "libevt_stream_open_read";
+	size_t skip_size                  = 0;
+
+	if( internal_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_stream->buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stream - buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream->buffer = (uint8_t *) memory_allocate(
+	                                       sizeof( uint8_t ) * internal_stream->block_size );
+
+	if( internal_stream->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	internal_stream->buffer_size = internal_stream->block_size;
+
+	if( libevt_stream_read_data(
+	     internal_stream,
+	     file_header_data,
+	     sizeof( evt_file_header_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_file_header_initialize(
+	     &file_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_file_header_read_data(
+	     file_header,
+	     file_header_data,
+	     sizeof( evt_file_header_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_header->first_record_offset < (uint32_t) sizeof( evt_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first record offset value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	skip_size = (size_t) file_header->first_record_offset - sizeof( evt_file_header_t );
+
+	if( file_header->first_record_offset > file_header->end_of_file_record_offset )
+	{
+		if( skip_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid wrapped data size value exceeds maximum allocation size.",
+			 function );
+
+			goto on_error;
+		}
+		internal_stream->wrapped_data = (uint8_t *) memory_allocate(
+		                                             sizeof( uint8_t ) * skip_size );
+
+		if( internal_stream->wrapped_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create wrapped data.",
+			 function );
+
+			goto on_error;
+		}
+		internal_stream->wrapped_data_size = skip_size;
+	}
+	if( libevt_stream_read_data(
+	     internal_stream,
+	     internal_stream->wrapped_data,
+	     skip_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data before first record.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_file_header_free(
+	     &file_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file header.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_header != NULL )
+	{
+		libevt_file_header_free(
+		 &file_header,
+		 NULL );
+	}
+	if( internal_stream->wrapped_data != NULL )
+	{
+		memory_free(
+		 internal_stream->wrapped_data );
+
+		internal_stream->wrapped_data = NULL;
+	}
+	internal_stream->wrapped_data_size = 0;
+
+	if( internal_stream->buffer != NULL )
+	{
+		memory_free(
+		 internal_stream->buffer );
+
+		internal_stream->buffer = NULL;
+	}
+	internal_stream->buffer_size        = 0;
+	internal_stream->buffer_data_offset = 0;
+	internal_stream->buffer_data_size   = 0;
+	internal_stream->input_size         = 0;
+	internal_stream->consumed_size      = 0;
+	internal_stream->flags              = 0;
+
+	return( -1 );
+}
+
+/* Closes a stream
+ * Returns 0 if successful or -1 on error
+ */
+int libevt_stream_close(
+     libevt_stream_t *stream,
+     libcerror_error_t **error )
+{
+	libevt_internal_stream_t *internal_stream = NULL;
+	static char *function                     = "libevt_stream_close";
+	int result                                = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream = (libevt_internal_stream_t *) stream;
+
+	if( internal_stream->read_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid stream - missing read function.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_stream->file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     internal_stream->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_stream->file_io_handle_opened_in_library = 0;
+	}
+	internal_stream->file_io_handle = NULL;
+	internal_stream->read_function  = NULL;
+	internal_stream->io_data        = NULL;
+
+	if( internal_stream->wrapped_data != NULL )
+	{
+		memory_free(
+		 internal_stream->wrapped_data );
+
+		internal_stream->wrapped_data = NULL;
+	}
+	internal_stream->wrapped_data_size   = 0;
+	internal_stream->wrapped_data_offset = 0;
+
+	if( internal_stream->buffer != NULL )
+	{
+		memory_free(
+		 internal_stream->buffer );
+
+		internal_stream->buffer = NULL;
+	}
+	internal_stream->buffer_size        = 0;
+	internal_stream->buffer_data_offset = 0;
+	internal_stream->buffer_data_size   = 0;
+	internal_stream->input_size         = 0;
+	internal_stream->consumed_size      = 0;
+	internal_stream->flags              = 0;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads data from a file IO handle
+ * This function is used as the read function of a stream opened with a file IO handle
+ * Returns the number of bytes read, 0 at the end of the input or -1 on error
+ */
+ssize_t libevt_stream_read_file_io_handle(
+         void *io_data,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error )
+{
+	static char *function = "libevt_stream_read_file_io_handle";
+	ssize_t read_count    = 0;
+
+	read_count = libbfio_handle_read_buffer(
+	              (libbfio_handle_t *) io_data,
+	              data,
+	              data_size,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data.",
+		 function );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Fills the buffer until it contains at least the required size of unconsumed data
+ * The input is read in blocks of the buffer size, after the end of the input
+ * has been reached the wrapped data, if any, is appended
+ * Returns 1 if successful, 0 if not enough data is available or -1 on error
+ */
+int libevt_stream_fill_buffer(
+     libevt_internal_stream_t *internal_stream,
+     size_t required_size,
+     libcerror_error_t **error )
+{
+	uint8_t *buffer       = NULL;
+	static char *function = "libevt_stream_fill_buffer";
+	size_t buffer_index   = 0;
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+
+	if( internal_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_stream->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid stream - missing buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_stream->read_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid stream - missing read function.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid required size value exceeds maximum allocation size.",
+		 function );
+
+		return( -1 );
+	}
+	while( internal_stream->buffer_data_size < required_size )
+	{
+		if( ( internal_stream->buffer_data_offset + required_size ) > internal_stream->buffer_size )
+		{
+			/* Move the unconsumed data to the start of the buffer, the data can overlap
+			 */
+			for( buffer_index = 0;
+			     buffer_index < internal_stream->buffer_data_size;
+			     buffer_index++ )
+			{
+				internal_stream->buffer[ buffer_index ] = internal_stream->buffer[ internal_stream->buffer_data_offset + buffer_index ];
+			}
+			internal_stream->buffer_data_offset = 0;
+
+			/* Records that are larger than the block size require a larger buffer
+			 */
+			if( required_size > internal_stream->buffer_size )
+			{
+				buffer = (uint8_t *) memory_reallocate(
+				                      internal_stream->buffer,
+				                      sizeof( uint8_t ) * required_size );
+
+				if( buffer == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize buffer.",
+					 function );
+
+					return( -1 );
+				}
+				internal_stream->buffer      = buffer;
+				internal_stream->buffer_size = required_size;
+			}
+		}
+		buffer    = &( internal_stream->buffer[ internal_stream->buffer_data_offset + internal_stream->buffer_data_size ] );
+		read_size = internal_stream->buffer_size - ( internal_stream->buffer_data_offset + internal_stream->buffer_data_size );
+
+		if( ( internal_stream->flags & LIBEVT_STREAM_FLAG_END_OF_INPUT ) == 0 )
+		{
+			read_count = internal_stream->read_function(
+			              internal_stream->io_data,
+			              buffer,
+			              read_size,
+			              error );
+
+			if( ( read_count < 0 )
+			 || ( (size_t) read_count > read_size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data from input.",
+				 function );
+
+				return( -1 );
+			}
+			else if( read_count == 0 )
+			{
+				internal_stream->flags |= LIBEVT_STREAM_FLAG_END_OF_INPUT;
+			}
+			internal_stream->buffer_data_size += (size_t) read_count;
+			internal_stream->input_size       += (size64_t) read_count;
+		}
+		else if( internal_stream->wrapped_data_offset < internal_stream->wrapped_data_size )
+		{
+			if( read_size > ( internal_stream->wrapped_data_size - internal_stream->wrapped_data_offset ) )
+			{
+				read_size = internal_stream->wrapped_data_size - internal_stream->wrapped_data_offset;
+			}
+			if( memory_copy(
+			     buffer,
+			     &( internal_stream->wrapped_data[ internal_stream->wrapped_data_offset ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy wrapped data.",
+				 function );
+
+				return( -1 );
+			}
+			internal_stream->buffer_data_size    += read_size;
+			internal_stream->wrapped_data_offset += read_size;
+		}
+		else
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads data from the stream
+ * If data is NULL the data is skipped
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_stream_read_data(
+     libevt_internal_stream_t *internal_stream,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_stream_read_data";
+	size_t copy_size      = 0;
+	size_t data_offset    = 0;
+	int result            = 0;
+
+	if( internal_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	while( data_offset < data_size )
+	{
+		if( internal_stream->buffer_data_size == 0 )
+		{
+			internal_stream->buffer_data_offset = 0;
+
+			result = libevt_stream_fill_buffer(
+			          internal_stream,
+			          1,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to fill buffer.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unexpected end of input.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		copy_size = data_size - data_offset;
+
+		if( copy_size > internal_stream->buffer_data_size )
+		{
+			copy_size = internal_stream->buffer_data_size;
+		}
+		if( data != NULL )
+		{
+			if( memory_copy(
+			     &( data[ data_offset ] ),
+			     &( internal_stream->buffer[ internal_stream->buffer_data_offset ] ),
+			     copy_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		internal_stream->buffer_data_offset += copy_size;
+		internal_stream->buffer_data_size   -= copy_size;
+		internal_stream->consumed_size      += copy_size;
+
+		data_offset += copy_size;
+	}
+	return( 1 );
+}
+
+/* Reads the next record from the stream
+ * The records are read in order from the first (oldest) record onwards
+ * Returns 1 if successful, 0 if no more records are available or -1 on error
+ */
+int libevt_stream_read_record(
+     libevt_stream_t *stream,
+     libevt_record_t **record,
+     libcerror_error_t **error )
+{
+	libevt_internal_stream_t *internal_stream = NULL;
+	libevt_record_values_t *record_values     = NULL;
+	static char *function                     = "libevt_stream_read_record";
+	off64_t record_offset                     = 0;
+	uint32_t record_data_size                 = 0;
+	uint8_t record_type                       = 0;
+	int result                                = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream = (libevt_internal_stream_t *) stream;
+
+	if( internal_stream->read_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid stream - missing read function.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	while( ( internal_stream->flags & LIBEVT_STREAM_FLAG_END_OF_RECORDS ) == 0 )
+	{
+		result = libevt_stream_fill_buffer(
+		          internal_stream,
+		          4,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to fill buffer.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( internal_stream->buffer_data_size != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unexpected end of input in record size.",
+				 function );
+
+				goto on_error;
+			}
+			/* The input ended without an end-of-file record
+			 */
+			internal_stream->flags |= LIBEVT_STREAM_FLAG_END_OF_RECORDS;
+
+			break;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( internal_stream->buffer[ internal_stream->buffer_data_offset ] ),
+		 record_data_size );
+
+		if( ( record_data_size < 8 )
+		 || ( record_data_size > (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: record data size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		result = libevt_stream_fill_buffer(
+		          internal_stream,
+		          (size_t) record_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to fill buffer.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unexpected end of input in record data.",
+			 function );
+
+			goto on_error;
+		}
+		/* The records after the end of the input have wrapped to directly after the file header
+		 */
+		if( internal_stream->consumed_size < internal_stream->input_size )
+		{
+			record_offset = (off64_t) internal_stream->consumed_size;
+		}
+		else
+		{
+			record_offset = (off64_t) ( sizeof( evt_file_header_t ) + ( internal_stream->consumed_size - internal_stream->input_size ) );
+		}
+		if( libevt_record_values_initialize(
+		     &record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record values.",
+			 function );
+
+			goto on_error;
+		}
+		if( libevt_record_values_read_data(
+		     record_values,
+		     &( internal_stream->buffer[ internal_stream->buffer_data_offset ] ),
+		     (size_t) record_data_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record values at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 record_offset,
+			 record_offset );
+
+			goto on_error;
+		}
+		record_values->offset = record_offset;
+
+		internal_stream->buffer_data_offset += (size_t) record_data_size;
+		internal_stream->buffer_data_size   -= (size_t) record_data_size;
+		internal_stream->consumed_size      += (size64_t) record_data_size;
+
+		if( libevt_record_values_get_type(
+		     record_values,
+		     &record_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record type.",
+			 function );
+
+			goto on_error;
+		}
+		if( record_type == LIBEVT_RECORD_TYPE_END_OF_FILE )
+		{
+			if( libevt_record_values_free(
+			     &record_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record values.",
+				 function );
+
+				goto on_error;
+			}
+			internal_stream->flags |= LIBEVT_STREAM_FLAG_END_OF_RECORDS;
+
+			break;
+		}
+		if( libevt_record_initialize(
+		     record,
+		     internal_stream->io_handle,
+		     internal_stream->file_io_handle,
+		     record_values,
+		     LIBEVT_RECORD_FLAG_MANAGED_RECORD_VALUES,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record.",
+			 function );
+
+			goto on_error;
+		}
+		record_values = NULL;
+
+		break;
+	}
+	if( ( internal_stream->flags & LIBEVT_STREAM_FLAG_END_OF_RECORDS ) != 0 )
+	{
+		result = 0;
+	}
+	else
+	{
+		result = 1;
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		if( *record != NULL )
+		{
+			libevt_record_free(
+			 record,
+			 NULL );
+		}
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+	if( record_values != NULL )
+	{
+		libevt_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_stream->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
@@ -0,0 +1,189 @@
+/*
+ * Stream functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVT_STREAM_H )
+#define _LIBEVT_STREAM_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevt_extern.h"
+#include "libevt_io_handle.h"
+#include "libevt_libbfio.h"
+#include "libevt_libcerror.h"
+#include "libevt_libcthreads.h"
+#include "libevt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevt_internal_stream libevt_internal_stream_t;
+
+struct libevt_internal_stream
+{
+	/* The IO handle
+	 */
+	libevt_io_handle_t *io_handle;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* Value to indicate if the file IO handle was opened inside the library
+	 */
+	uint8_t file_io_handle_opened_in_library;
+
+	/* The read function
+	 */
+	ssize_t (*read_function)(
+	           void *io_data,
+	           uint8_t *data,
+	           size_t data_size,
+	           libcerror_error_t **error );
+
+	/* The IO data of the read function
+	 */
+	void *io_data;
+
+	/* The buffer
+	 */
+	uint8_t *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The size of the blocks read from the input
+	 */
+	size_t block_size;
+
+	/* The offset of the unconsumed data in the buffer
+	 */
+	size_t buffer_data_offset;
+
+	/* The size of the unconsumed data in the buffer
+	 */
+	size_t buffer_data_size;
+
+	/* The record data that wrapped to the start of the file
+	 */
+	uint8_t *wrapped_data;
+
+	/* The wrapped data size
+	 */
+	size_t wrapped_data_size;
+
+	/* The offset of the next wrapped data to consume
+	 */
+	size_t wrapped_data_offset;
+
+	/* The number of bytes read from the input
+	 */
+	size64_t input_size;
+
+	/* The number of bytes consumed
+	 */
+	size64_t consumed_size;
+
+	/* The stream flags
+	 */
+	uint8_t flags;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+LIBEVT_EXTERN \
+int libevt_stream_initialize(
+     libevt_stream_t **stream,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_stream_free(
+     libevt_stream_t **stream,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_stream_set_block_size(
+     libevt_stream_t *stream,
+     size_t block_size,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_stream_open_file_io_handle(
+     libevt_stream_t *stream,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_stream_open_read_function(
+     libevt_stream_t *stream,
+     ssize_t (*read_function)(
+                void *io_data,
+                uint8_t *data,
+                size_t data_size,
+                libcerror_error_t **error ),
+     void *io_data,
+     libcerror_error_t **error );
+
+int libevt_stream_open_read(
+     libevt_internal_stream_t *internal_stream,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_stream_close(
+     libevt_stream_t *stream,
+     libcerror_error_t **error );
+
+ssize_t libevt_stream_read_file_io_handle(
+         void *io_data,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error );
+
+int libevt_stream_fill_buffer(
+     libevt_internal_stream_t *internal_stream,
+     size_t required_size,
+     libcerror_error_t **error );
+
+int libevt_stream_read_data(
+     libevt_internal_stream_t *internal_stream,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_stream_read_record(
+     libevt_stream_t *stream,
+     libevt_record_t **record,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVT_STREAM_H ) */
+
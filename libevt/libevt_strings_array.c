@@ -23,9 +23,11 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libevt_arena.h"
 #include "libevt_libcerror.h"
 #include "libevt_libcnotify.h"
 #include "libevt_libuna.h"
+#include "libevt_memory.h"
 #include "libevt_strings_array.h"
 
 /* Creates a strings array
@@ -60,8 +62,8 @@ int libevt_strings_array_initialize(
 
 		return( -1 );
 	}
-	*strings_array = memory_allocate_structure(
-	                  libevt_strings_array_t );
+	*strings_array = (libevt_strings_array_t *) libevt_memory_allocate(
+	                                             sizeof( libevt_strings_array_t ) );
 
 	if( *strings_array == NULL )
 	{
@@ -93,7 +95,7 @@ int libevt_strings_array_initialize(
 on_error:
 	if( *strings_array != NULL )
 	{
-		memory_free(
+		libevt_memory_free(
 		 *strings_array );
 
 		*strings_array = NULL;
@@ -125,20 +127,23 @@ int libevt_strings_array_free(
 	{
 		if( ( *strings_array )->string_sizes != NULL )
 		{
-			memory_free(
+			libevt_arena_free_buffer(
+			 ( *strings_array )->arena,
 			 ( *strings_array )->string_sizes );
 		}
 		if( ( *strings_array )->strings != NULL )
 		{
-			memory_free(
+			libevt_arena_free_buffer(
+			 ( *strings_array )->arena,
 			 ( *strings_array )->strings );
 		}
 		if( ( *strings_array )->strings_data != NULL )
 		{
-			memory_free(
+			libevt_arena_free_buffer(
+			 ( *strings_array )->arena,
 			 ( *strings_array )->strings_data );
 		}
-		memory_free(
+		libevt_memory_free(
 		 *strings_array );
 
 		*strings_array = NULL;
@@ -251,7 +256,8 @@ int libevt_strings_array_read_data(
 		 "\n" );
 	}
 #endif
-	strings_array->strings_data = (uint8_t *) memory_allocate(
+	strings_array->strings_data = (uint8_t *) libevt_arena_allocate_buffer(
+	                                           strings_array->arena,
 	                                           sizeof( uint8_t ) * data_size );
 
 	if( strings_array->strings_data == NULL )
@@ -281,7 +287,8 @@ int libevt_strings_array_read_data(
 	}
 	strings_array->strings_data_size = data_size;
 
-	strings_array->strings = (uint8_t **) memory_allocate(
+	strings_array->strings = (uint8_t **) libevt_arena_allocate_buffer(
+	                                       strings_array->arena,
 	                                       sizeof( uint8_t* ) * number_of_strings );
 
 	if( strings_array->strings == NULL )
@@ -309,7 +316,8 @@ int libevt_strings_array_read_data(
 
 		goto on_error;
 	}
-	strings_array->string_sizes = (size_t *) memory_allocate(
+	strings_array->string_sizes = (size_t *) libevt_arena_allocate_buffer(
+	                                          strings_array->arena,
 	                                          sizeof( size_t ) * number_of_strings );
 
 	if( strings_array->string_sizes == NULL )
@@ -383,21 +391,24 @@ int libevt_strings_array_read_data(
 on_error:
 	if( strings_array->string_sizes != NULL )
 	{
-		memory_free(
+		libevt_arena_free_buffer(
+		 strings_array->arena,
 		 strings_array->string_sizes );
 
 		strings_array->string_sizes = NULL;
 	}
 	if( strings_array->strings != NULL )
 	{
-		memory_free(
+		libevt_arena_free_buffer(
+		 strings_array->arena,
 		 strings_array->strings );
 
 		strings_array->strings = NULL;
 	}
 	if( strings_array->strings_data != NULL )
 	{
-		memory_free(
+		libevt_arena_free_buffer(
+		 strings_array->arena,
 		 strings_array->strings_data );
 
 		strings_array->strings_data = NULL;
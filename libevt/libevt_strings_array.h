@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libevt_arena.h"
 #include "libevt_libcerror.h"
 
 #if defined( __cplusplus )
@@ -54,6 +55,10 @@ struct libevt_strings_array
 	/* The string sizes
 	 */
 	size_t *string_sizes;
+
+	/* The arena the strings data is carved from, NULL if not used
+	 */
+	libevt_arena_t *arena;
 };
 
 int libevt_strings_array_initialize(
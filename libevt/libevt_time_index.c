@@ -0,0 +1,622 @@
+/*
+ * Written time index functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevt_io_handle.h"
+#include "libevt_libbfio.h"
+#include "libevt_libcerror.h"
+#include "libevt_libfdata.h"
+#include "libevt_time_index.h"
+
+#include "evt_event_record.h"
+
+/* Creates a time index
+ * Make sure the value time_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_time_index_initialize(
+     libevt_time_index_t **time_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_time_index_initialize";
+
+	if( time_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid time index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *time_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid time index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*time_index = memory_allocate_structure(
+	                   libevt_time_index_t );
+
+	if( *time_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create time index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *time_index,
+	     0,
+	     sizeof( libevt_time_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear time index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *time_index != NULL )
+	{
+		memory_free(
+		 *time_index );
+
+		*time_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a time index
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_time_index_free(
+     libevt_time_index_t **time_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_time_index_free";
+
+	if( time_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid time index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *time_index != NULL )
+	{
+		if( ( *time_index )->run_start_indexes != NULL )
+		{
+			memory_free(
+			 ( *time_index )->run_start_indexes );
+		}
+		if( ( *time_index )->entries != NULL )
+		{
+			memory_free(
+			 ( *time_index )->entries );
+		}
+		memory_free(
+		 *time_index );
+
+		*time_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the written times of the records into the time index
+ * Only the last written time is read from the record data
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_time_index_read_records(
+     libevt_time_index_t *time_index,
+     libevt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfdata_list_t *records_list,
+     libcerror_error_t **error )
+{
+	uint8_t written_time_data[ 4 ];
+
+	libevt_time_index_entry_t *entries = NULL;
+	static char *function              = "libevt_time_index_read_records";
+	size64_t element_size              = 0;
+	off64_t element_offset             = 0;
+	uint32_t element_flags             = 0;
+	int *run_start_indexes             = NULL;
+	int element_file_index             = 0;
+	int entry_index                    = 0;
+	int number_of_records              = 0;
+	int number_of_runs                 = 0;
+	int record_index                   = 0;
+
+	if( time_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid time index.",
+		 function );
+
+		return( -1 );
+	}
+	if( time_index->entries != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid time index - entries value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( time_index->run_start_indexes != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid time index - run start indexes value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_get_number_of_elements(
+	     records_list,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_records <= 0 )
+	{
+		return( 1 );
+	}
+	if( (size_t) number_of_records > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libevt_time_index_entry_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of records value exceeds maximum allocation size.",
+		 function );
+
+		goto on_error;
+	}
+	entries = (libevt_time_index_entry_t *) memory_allocate(
+	                                         sizeof( libevt_time_index_entry_t ) * (size_t) number_of_records );
+
+	if( entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	run_start_indexes = (int *) memory_allocate(
+	                             sizeof( int ) * (size_t) number_of_records );
+
+	if( run_start_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create run start indexes.",
+		 function );
+
+		goto on_error;
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( libfdata_list_get_element_by_index(
+		     records_list,
+		     record_index,
+		     &element_file_index,
+		     &element_offset,
+		     &element_size,
+		     &element_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d from records list.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		/* Only event records contain a written time
+		 */
+		if( element_size < (size64_t) sizeof( evt_event_record_t ) )
+		{
+			continue;
+		}
+		if( libevt_io_handle_read_record_data(
+		     io_handle,
+		     file_io_handle,
+		     element_offset,
+		     16,
+		     written_time_data,
+		     4,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read written time of record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 written_time_data,
+		 entries[ entry_index ].written_time );
+
+		entries[ entry_index ].record_index = record_index;
+
+		/* The records are stored in a ring buffer and are read from the oldest
+		 * record onwards, hence the written times are mostly increasing and
+		 * a new run only starts when the written time decreases
+		 */
+		if( ( entry_index == 0 )
+		 || ( entries[ entry_index ].written_time < entries[ entry_index - 1 ].written_time ) )
+		{
+			run_start_indexes[ number_of_runs++ ] = entry_index;
+		}
+		entry_index++;
+	}
+	time_index->entries           = entries;
+	time_index->number_of_entries = entry_index;
+	time_index->run_start_indexes = run_start_indexes;
+	time_index->number_of_runs    = number_of_runs;
+
+	return( 1 );
+
+on_error:
+	if( run_start_indexes != NULL )
+	{
+		memory_free(
+		 run_start_indexes );
+	}
+	if( entries != NULL )
+	{
+		memory_free(
+		 entries );
+	}
+	return( -1 );
+}
+
+/* Retrieves the range of entries of a specific run that have a written time
+ * within the start and end time, where both start and end time are inclusive
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_time_index_get_run_entry_range(
+     libevt_time_index_t *time_index,
+     int run_index,
+     uint32_t start_time,
+     uint32_t end_time,
+     int *first_entry_index,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_time_index_get_run_entry_range";
+	int entry_index       = 0;
+	int lower_index       = 0;
+	int run_end_index     = 0;
+	int run_start_index   = 0;
+	int upper_index       = 0;
+
+	if( time_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid time index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( run_index < 0 )
+	 || ( run_index >= time_index->number_of_runs ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid run index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	run_start_index = time_index->run_start_indexes[ run_index ];
+
+	if( ( run_index + 1 ) < time_index->number_of_runs )
+	{
+		run_end_index = time_index->run_start_indexes[ run_index + 1 ];
+	}
+	else
+	{
+		run_end_index = time_index->number_of_entries;
+	}
+	/* Find the first entry with a written time that is equal or greater than the start time
+	 */
+	lower_index = run_start_index;
+	upper_index = run_end_index;
+
+	while( lower_index < upper_index )
+	{
+		entry_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( time_index->entries[ entry_index ].written_time < start_time )
+		{
+			lower_index = entry_index + 1;
+		}
+		else
+		{
+			upper_index = entry_index;
+		}
+	}
+	*first_entry_index = lower_index;
+
+	/* Find the first entry with a written time that is greater than the end time
+	 */
+	upper_index = run_end_index;
+
+	while( lower_index < upper_index )
+	{
+		entry_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( time_index->entries[ entry_index ].written_time <= end_time )
+		{
+			lower_index = entry_index + 1;
+		}
+		else
+		{
+			upper_index = entry_index;
+		}
+	}
+	*number_of_entries = lower_index - *first_entry_index;
+
+	return( 1 );
+}
+
+/* Retrieves the indexes of the records that have a written time within
+ * the start and end time, where both start and end time are inclusive
+ * The record indexes are returned in increasing order and must be freed
+ * by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_time_index_get_record_indexes(
+     libevt_time_index_t *time_index,
+     uint32_t start_time,
+     uint32_t end_time,
+     int **record_indexes,
+     int *number_of_record_indexes,
+     libcerror_error_t **error )
+{
+	int *safe_record_indexes          = NULL;
+	static char *function             = "libevt_time_index_get_record_indexes";
+	int entry_index                   = 0;
+	int first_entry_index             = 0;
+	int number_of_entries             = 0;
+	int run_index                     = 0;
+	int safe_number_of_record_indexes = 0;
+
+	if( time_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid time index.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_indexes != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record indexes value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_record_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of record indexes.",
+		 function );
+
+		return( -1 );
+	}
+	/* The runs are in record index order, hence the record indexes of
+	 * the matching entries of all runs are increasing
+	 */
+	for( run_index = 0;
+	     run_index < time_index->number_of_runs;
+	     run_index++ )
+	{
+		if( libevt_time_index_get_run_entry_range(
+		     time_index,
+		     run_index,
+		     start_time,
+		     end_time,
+		     &first_entry_index,
+		     &number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry range of run: %d.",
+			 function,
+			 run_index );
+
+			goto on_error;
+		}
+		safe_number_of_record_indexes += number_of_entries;
+	}
+	if( safe_number_of_record_indexes > 0 )
+	{
+		safe_record_indexes = (int *) memory_allocate(
+		                               sizeof( int ) * (size_t) safe_number_of_record_indexes );
+
+		if( safe_record_indexes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create record indexes.",
+			 function );
+
+			goto on_error;
+		}
+		safe_number_of_record_indexes = 0;
+
+		for( run_index = 0;
+		     run_index < time_index->number_of_runs;
+		     run_index++ )
+		{
+			if( libevt_time_index_get_run_entry_range(
+			     time_index,
+			     run_index,
+			     start_time,
+			     end_time,
+			     &first_entry_index,
+			     &number_of_entries,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve entry range of run: %d.",
+				 function,
+				 run_index );
+
+				goto on_error;
+			}
+			for( entry_index = first_entry_index;
+			     entry_index < ( first_entry_index + number_of_entries );
+			     entry_index++ )
+			{
+				safe_record_indexes[ safe_number_of_record_indexes++ ] = time_index->entries[ entry_index ].record_index;
+			}
+		}
+	}
+	*record_indexes           = safe_record_indexes;
+	*number_of_record_indexes = safe_number_of_record_indexes;
+
+	return( 1 );
+
+on_error:
+	if( safe_record_indexes != NULL )
+	{
+		memory_free(
+		 safe_record_indexes );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,108 @@
+/*
+ * Written time index functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVT_TIME_INDEX_H )
+#define _LIBEVT_TIME_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevt_io_handle.h"
+#include "libevt_libbfio.h"
+#include "libevt_libcerror.h"
+#include "libevt_libfdata.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevt_time_index_entry libevt_time_index_entry_t;
+
+struct libevt_time_index_entry
+{
+	/* The last written time
+	 */
+	uint32_t written_time;
+
+	/* The record index
+	 */
+	int record_index;
+};
+
+typedef struct libevt_time_index libevt_time_index_t;
+
+struct libevt_time_index
+{
+	/* The entries in record index order
+	 */
+	libevt_time_index_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The entry indexes at which a run of entries with non-decreasing written times starts
+	 */
+	int *run_start_indexes;
+
+	/* The number of runs
+	 */
+	int number_of_runs;
+};
+
+int libevt_time_index_initialize(
+     libevt_time_index_t **time_index,
+     libcerror_error_t **error );
+
+int libevt_time_index_free(
+     libevt_time_index_t **time_index,
+     libcerror_error_t **error );
+
+int libevt_time_index_read_records(
+     libevt_time_index_t *time_index,
+     libevt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfdata_list_t *records_list,
+     libcerror_error_t **error );
+
+int libevt_time_index_get_run_entry_range(
+     libevt_time_index_t *time_index,
+     int run_index,
+     uint32_t start_time,
+     uint32_t end_time,
+     int *first_entry_index,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libevt_time_index_get_record_indexes(
+     libevt_time_index_t *time_index,
+     uint32_t start_time,
+     uint32_t end_time,
+     int **record_indexes,
+     int *number_of_record_indexes,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVT_TIME_INDEX_H ) */
+
@@ -35,11 +35,21 @@
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
 typedef struct libevt_file {}	libevt_file_t;
+typedef struct libevt_file_set {}	libevt_file_set_t;
+typedef struct libevt_filter {}	libevt_filter_t;
 typedef struct libevt_record {}	libevt_record_t;
+typedef struct libevt_record_view {}	libevt_record_view_t;
+typedef struct libevt_scanner {}	libevt_scanner_t;
+typedef struct libevt_stream {}	libevt_stream_t;
 
 #else
 typedef intptr_t libevt_file_t;
+typedef intptr_t libevt_file_set_t;
+typedef intptr_t libevt_filter_t;
 typedef intptr_t libevt_record_t;
+typedef intptr_t libevt_record_view_t;
+typedef intptr_t libevt_scanner_t;
+typedef intptr_t libevt_stream_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
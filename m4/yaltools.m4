@@ -77,6 +77,11 @@ AC_DEFUN([AX_EVTTOOLS_CHECK_LOCAL],
 
   AC_CHECK_FUNCS([close getopt setvbuf])
 
+  dnl Headers and functions included in evttools/output_handle.c
+  AC_CHECK_HEADERS([errno.h sys/uio.h])
+
+  AC_CHECK_FUNCS([writev])
+
   AS_IF(
    [test "x$ac_cv_func_close" != xyes],
    [AC_MSG_FAILURE(
@@ -0,0 +1,65 @@
+/*
+ * OSS-Fuzz target for libevt file type opened from memory
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Note that some of the OSS-Fuzz engines use C++
+ */
+extern "C" {
+
+#include "ossfuzz_libevt.h"
+
+int LLVMFuzzerTestOneInput(
+     const uint8_t *data,
+     size_t size )
+{
+	libevt_file_t *file = NULL;
+
+	if( libevt_file_initialize(
+	     &file,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	if( libevt_file_open_memory(
+	     file,
+	     data,
+	     size,
+	     LIBEVT_OPEN_READ,
+	     NULL ) != 1 )
+	{
+		goto on_error_libevt;
+	}
+	libevt_file_close(
+	 file,
+	 NULL );
+
+on_error_libevt:
+	libevt_file_free(
+	 &file,
+	 NULL );
+
+	return( 0 );
+}
+
+} /* extern "C" */
+
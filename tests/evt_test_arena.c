@@ -0,0 +1,766 @@
+/*
+ * Library arena type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evt_test_libcerror.h"
+#include "evt_test_libevt.h"
+#include "evt_test_macros.h"
+#include "evt_test_memory.h"
+#include "evt_test_unused.h"
+
+#include "../libevt/libevt_arena.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
+
+/* Tests the libevt_arena_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_arena_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libevt_arena_t *arena           = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevt_arena_initialize(
+	          &arena,
+	          4096,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_arena_free(
+	          &arena,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_arena_initialize(
+	          NULL,
+	          4096,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	arena = (libevt_arena_t *) 0x12345678UL;
+
+	result = libevt_arena_initialize(
+	          &arena,
+	          4096,
+	          &error );
+
+	arena = NULL;
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_arena_initialize(
+	          &arena,
+	          16,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevt_arena_initialize with malloc failing
+		 */
+		evt_test_malloc_attempts_before_fail = test_number;
+
+		result = libevt_arena_initialize(
+		          &arena,
+		          4096,
+		          &error );
+
+		if( evt_test_malloc_attempts_before_fail != -1 )
+		{
+			evt_test_malloc_attempts_before_fail = -1;
+
+			if( arena != NULL )
+			{
+				libevt_arena_free(
+				 &arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "arena",
+			 arena );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevt_arena_initialize with memset failing
+		 */
+		evt_test_memset_attempts_before_fail = test_number;
+
+		result = libevt_arena_initialize(
+		          &arena,
+		          4096,
+		          &error );
+
+		if( evt_test_memset_attempts_before_fail != -1 )
+		{
+			evt_test_memset_attempts_before_fail = -1;
+
+			if( arena != NULL )
+			{
+				libevt_arena_free(
+				 &arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "arena",
+			 arena );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libevt_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_arena_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_arena_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevt_arena_free(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_arena_allocate_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_arena_allocate_buffer(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libevt_arena_t *arena    = NULL;
+	uint8_t *buffer1         = NULL;
+	uint8_t *buffer2         = NULL;
+	uint8_t *buffer3         = NULL;
+	size64_t allocated_size  = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_arena_initialize(
+	          &arena,
+	          4096,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	buffer1 = (uint8_t *) libevt_arena_allocate_buffer(
+	                       arena,
+	                       5 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer1",
+	 buffer1 );
+
+	buffer2 = (uint8_t *) libevt_arena_allocate_buffer(
+	                       arena,
+	                       64 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer2",
+	 buffer2 );
+
+	/* The buffers are aligned and carved from the same block
+	 */
+	EVT_TEST_ASSERT_EQUAL_INTPTR(
+	 "buffer2",
+	 (intptr_t) buffer2,
+	 (intptr_t) ( buffer1 + 16 ) );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "arena->number_of_blocks",
+	 arena->number_of_blocks,
+	 1 );
+
+	/* A buffer larger than a quarter of the block size is stored in a block of its own
+	 */
+	buffer3 = (uint8_t *) libevt_arena_allocate_buffer(
+	                       arena,
+	                       8192 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer3",
+	 buffer3 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "arena->number_of_blocks",
+	 arena->number_of_blocks,
+	 2 );
+
+	buffer3 = (uint8_t *) libevt_arena_allocate_buffer(
+	                       arena,
+	                       16 );
+
+	EVT_TEST_ASSERT_EQUAL_INTPTR(
+	 "buffer3",
+	 (intptr_t) buffer3,
+	 (intptr_t) ( buffer2 + 64 ) );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "arena->number_of_blocks",
+	 arena->number_of_blocks,
+	 2 );
+
+	/* Freeing a buffer carved from the arena is a no-op
+	 */
+	libevt_arena_free_buffer(
+	 arena,
+	 buffer1 );
+
+	result = libevt_arena_get_allocated_size(
+	          arena,
+	          &allocated_size,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_GREATER_THAN_INT(
+	 "allocated_size",
+	 (int) allocated_size,
+	 4096 + 8192 );
+
+	/* Test buffers allocated without an arena
+	 */
+	buffer1 = (uint8_t *) libevt_arena_allocate_buffer(
+	                       NULL,
+	                       64 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer1",
+	 buffer1 );
+
+	libevt_arena_free_buffer(
+	 NULL,
+	 buffer1 );
+
+	/* Test error cases
+	 */
+	buffer1 = (uint8_t *) libevt_arena_allocate_buffer(
+	                       arena,
+	                       (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE + 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "buffer1",
+	 buffer1 );
+
+	result = libevt_arena_get_allocated_size(
+	          NULL,
+	          &allocated_size,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_arena_get_allocated_size(
+	          arena,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_arena_free(
+	          &arena,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libevt_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_arena_add_user and libevt_arena_remove_user functions
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_arena_add_user(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libevt_arena_t *arena    = NULL;
+	uint8_t *buffer          = NULL;
+	size64_t allocated_size  = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_arena_initialize(
+	          &arena,
+	          4096,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_arena_add_user(
+	          arena,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_arena_add_user(
+	          arena,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	buffer = (uint8_t *) libevt_arena_allocate_buffer(
+	                      arena,
+	                      64 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	/* The blocks are kept while the arena has users
+	 */
+	result = libevt_arena_remove_user(
+	          arena,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "arena->number_of_blocks",
+	 arena->number_of_blocks,
+	 1 );
+
+	/* The blocks are released when the last user is removed
+	 */
+	result = libevt_arena_remove_user(
+	          arena,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "arena->number_of_blocks",
+	 arena->number_of_blocks,
+	 0 );
+
+	result = libevt_arena_get_allocated_size(
+	          arena,
+	          &allocated_size,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT64(
+	 "allocated_size",
+	 allocated_size,
+	 (uint64_t) 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The arena can be used again after the blocks were released
+	 */
+	buffer = (uint8_t *) libevt_arena_allocate_buffer(
+	                      arena,
+	                      64 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "arena->number_of_blocks",
+	 arena->number_of_blocks,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libevt_arena_add_user(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_arena_remove_user(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_arena_free(
+	          &arena,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libevt_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVT_TEST_UNREFERENCED_PARAMETER( argc )
+	EVT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
+
+	EVT_TEST_RUN(
+	 "libevt_arena_initialize",
+	 evt_test_arena_initialize );
+
+	EVT_TEST_RUN(
+	 "libevt_arena_free",
+	 evt_test_arena_free );
+
+	EVT_TEST_RUN(
+	 "libevt_arena_allocate_buffer",
+	 evt_test_arena_allocate_buffer );
+
+	EVT_TEST_RUN(
+	 "libevt_arena_add_user",
+	 evt_test_arena_add_user );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
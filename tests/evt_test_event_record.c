@@ -611,6 +611,226 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libevt_event_record_check_data function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_event_record_check_data(
+     void )
+{
+	uint8_t data[ 144 ];
+
+	libcerror_error_t *error = NULL;
+	void *memcpy_result      = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevt_event_record_check_data(
+	          evt_test_event_record_data1,
+	          144,
+	          4096,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test data that contains part of the record
+	 */
+	result = libevt_event_record_check_data(
+	          evt_test_event_record_data1,
+	          64,
+	          4096,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test record size that exceeds the maximum record size
+	 */
+	result = libevt_event_record_check_data(
+	          evt_test_event_record_data1,
+	          144,
+	          128,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test invalid signature
+	 */
+	memcpy_result = memory_copy(
+	          data,
+	          evt_test_event_record_data1,
+	          144 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "memcpy_result",
+	 memcpy_result );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 4 ] ),
+	 0x41414141 );
+
+	result = libevt_event_record_check_data(
+	          data,
+	          144,
+	          4096,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test mismatch of record size and copy of record size
+	 */
+	memcpy_result = memory_copy(
+	          data,
+	          evt_test_event_record_data1,
+	          144 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "memcpy_result",
+	 memcpy_result );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 140 ] ),
+	 0x00000080 );
+
+	result = libevt_event_record_check_data(
+	          data,
+	          144,
+	          4096,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test event data offset out of bounds
+	 */
+	memcpy_result = memory_copy(
+	          data,
+	          evt_test_event_record_data1,
+	          144 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "memcpy_result",
+	 memcpy_result );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 52 ] ),
+	 0x00000090 );
+
+	result = libevt_event_record_check_data(
+	          data,
+	          144,
+	          4096,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_event_record_check_data(
+	          NULL,
+	          144,
+	          4096,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_event_record_check_data(
+	          evt_test_event_record_data1,
+	          4,
+	          4096,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_event_record_check_data(
+	          evt_test_event_record_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          4096,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libevt_event_record_get_record_number function
  * Returns 1 if successful or 0 if not
  */
@@ -2944,6 +3164,10 @@ int main(
 	 "libevt_event_record_read_data",
 	 evt_test_event_record_read_data );
 
+	EVT_TEST_RUN(
+	 "libevt_event_record_check_data",
+	 evt_test_event_record_check_data );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	/* Initialize test
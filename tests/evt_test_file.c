@@ -20,7 +20,9 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -55,6 +57,20 @@ int libevt_file_open_file_io_handle(
      int access_flags,
      libevt_error_t **error );
 
+LIBEVT_EXTERN \
+int libevt_file_open_file_io_handle_with_index(
+     libevt_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     libbfio_handle_t *index_file_io_handle,
+     int access_flags,
+     libevt_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_file_write_index_file_io_handle(
+     libevt_file_t *file,
+     libbfio_handle_t *index_file_io_handle,
+     libevt_error_t **error );
+
 #endif /* !defined( LIBEVT_HAVE_BFIO ) */
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
@@ -65,6 +81,35 @@ int libevt_file_open_file_io_handle(
 #define EVT_TEST_FILE_VERBOSE
  */
 
+#define EVT_TEST_FILE_INDEX_DATA_SIZE	1048576
+
+uint8_t evt_test_file_index_data[ EVT_TEST_FILE_INDEX_DATA_SIZE ];
+
+/* The size of the EVT image used by the refresh tests, which fits 3 event records
+ */
+#define EVT_TEST_FILE_REFRESH_IMAGE_SIZE	528
+
+uint8_t evt_test_file_file_header_data1[ 48 ] = {
+	0x30, 0x00, 0x00, 0x00, 0x4c, 0x66, 0x4c, 0x65, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x30, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0b, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00 };
+
+uint8_t evt_test_file_event_record_data1[ 144 ] = {
+	0x90, 0x00, 0x00, 0x00, 0x4c, 0x66, 0x4c, 0x65, 0x01, 0x00, 0x00, 0x00, 0x79, 0x42, 0xdb, 0x4c,
+	0x79, 0x42, 0xdb, 0x4c, 0xe8, 0x03, 0x00, 0x40, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x6f, 0x00, 0x61, 0x00, 0x64, 0x00,
+	0x50, 0x00, 0x65, 0x00, 0x72, 0x00, 0x66, 0x00, 0x00, 0x00, 0x57, 0x00, 0x4b, 0x00, 0x53, 0x00,
+	0x2d, 0x00, 0x57, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x58, 0x00, 0x50, 0x00, 0x33, 0x00, 0x32, 0x00,
+	0x42, 0x00, 0x49, 0x00, 0x54, 0x00, 0x00, 0x00, 0x52, 0x00, 0x53, 0x00, 0x56, 0x00, 0x50, 0x00,
+	0x00, 0x00, 0x51, 0x00, 0x6f, 0x00, 0x53, 0x00, 0x20, 0x00, 0x52, 0x00, 0x53, 0x00, 0x56, 0x00,
+	0x50, 0x00, 0x00, 0x00, 0x0c, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00 };
+
+uint8_t evt_test_file_end_of_file_record_data1[ 40 ] = {
+	0x28, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33,
+	0x44, 0x44, 0x44, 0x44, 0x30, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00 };
+
 /* Creates and opens a source file
  * Returns 1 if successful or -1 on error
  */
@@ -1002,56 +1047,91 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libevt_file_close function
+/* Tests the libevt_file_open_memory function
  * Returns 1 if successful or 0 if not
  */
-int evt_test_file_close(
-     void )
+int evt_test_file_open_memory(
+     libbfio_handle_t *file_io_handle )
 {
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libcerror_error_t *error   = NULL;
+	libevt_file_t *file        = NULL;
+	uint8_t *buffer            = NULL;
+	size64_t file_size         = 0;
+	ssize_t read_count         = 0;
+	int number_of_records      = 0;
+	int result                 = 0;
 
-	/* Test error cases
+	/* Initialize test
 	 */
-	result = libevt_file_close(
-	          NULL,
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
 	          &error );
 
 	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	EVT_TEST_ASSERT_IS_NOT_NULL(
+	EVT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = libbfio_handle_get_size(
+	          file_io_handle,
+	          &file_size,
+	          &error );
 
-	return( 1 );
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-/* Tests the libevt_file_open and libevt_file_close functions
- * Returns 1 if successful or 0 if not
- */
-int evt_test_file_open_close(
-     const system_character_t *source )
-{
-	libcerror_error_t *error = NULL;
-	libevt_file_t *file      = NULL;
-	int result               = 0;
+	EVT_TEST_ASSERT_LESS_THAN_UINT64(
+	 "file_size",
+	 (uint64_t) file_size,
+	 (uint64_t) SSIZE_MAX );
+
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * (size_t) file_size );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              buffer,
+	              (size_t) file_size,
+	              0,
+	              &error );
+
+	EVT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) file_size );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_close(
+	          file_io_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Initialize test
-	 */
 	result = libevt_file_initialize(
 	          &file,
 	          &error );
@@ -1069,59 +1149,106 @@ int evt_test_file_open_close(
 	 "error",
 	 error );
 
-	/* Test open and close
+	/* Test error cases
 	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libevt_file_open_wide(
+	result = libevt_file_open_memory(
+	          NULL,
+	          buffer,
+	          (size_t) file_size,
+	          LIBEVT_OPEN_READ,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_open_memory(
 	          file,
-	          source,
+	          NULL,
+	          (size_t) file_size,
 	          LIBEVT_OPEN_READ,
 	          &error );
-#else
-	result = libevt_file_open(
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_open_memory(
 	          file,
-	          source,
+	          buffer,
+	          0,
 	          LIBEVT_OPEN_READ,
 	          &error );
-#endif
 
 	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	EVT_TEST_ASSERT_IS_NULL(
+	EVT_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libevt_file_close(
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_open_memory(
 	          file,
+	          buffer,
+	          (size_t) file_size,
+	          -1,
 	          &error );
 
 	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	EVT_TEST_ASSERT_IS_NULL(
+	EVT_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test open and close a second time to validate clean up on close
+	libcerror_error_free(
+	 &error );
+
+	/* Test open
 	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libevt_file_open_wide(
+	result = libevt_file_open_memory(
 	          file,
-	          source,
+	          buffer,
+	          (size_t) file_size,
 	          LIBEVT_OPEN_READ,
 	          &error );
-#else
-	result = libevt_file_open(
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_get_number_of_records(
 	          file,
-	          source,
-	          LIBEVT_OPEN_READ,
+	          &number_of_records,
 	          &error );
-#endif
 
 	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1132,6 +1259,29 @@ int evt_test_file_open_close(
 	 "error",
 	 error );
 
+	/* Test open when already opened
+	 */
+	result = libevt_file_open_memory(
+	          file,
+	          buffer,
+	          (size_t) file_size,
+	          LIBEVT_OPEN_READ,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
 	result = libevt_file_close(
 	          file,
 	          &error );
@@ -1145,8 +1295,6 @@ int evt_test_file_open_close(
 	 "error",
 	 error );
 
-	/* Clean up
-	 */
 	result = libevt_file_free(
 	          &file,
 	          &error );
@@ -1164,6 +1312,9 @@ int evt_test_file_open_close(
 	 "error",
 	 error );
 
+	memory_free(
+	 buffer );
+
 	return( 1 );
 
 on_error:
@@ -1178,36 +1329,26 @@ on_error:
 		 &file,
 		 NULL );
 	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
 	return( 0 );
 }
 
-/* Tests the libevt_file_signal_abort function
+/* Tests the libevt_file_close function
  * Returns 1 if successful or 0 if not
  */
-int evt_test_file_signal_abort(
-     libevt_file_t *file )
+int evt_test_file_close(
+     void )
 {
 	libcerror_error_t *error = NULL;
 	int result               = 0;
 
-	/* Test regular cases
-	 */
-	result = libevt_file_signal_abort(
-	          file,
-	          &error );
-
-	EVT_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	EVT_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	/* Test error cases
 	 */
-	result = libevt_file_signal_abort(
+	result = libevt_file_close(
 	          NULL,
 	          &error );
 
@@ -1234,73 +1375,168 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libevt_file_get_ascii_codepage function
+/* Tests the libevt_file_open and libevt_file_close functions
  * Returns 1 if successful or 0 if not
  */
-int evt_test_file_get_ascii_codepage(
-     libevt_file_t *file )
+int evt_test_file_open_close(
+     const system_character_t *source )
 {
-	libcerror_error_t *error  = NULL;
-	int ascii_codepage        = 0;
-	int ascii_codepage_is_set = 0;
-	int result                = 0;
+	libcerror_error_t *error = NULL;
+	libevt_file_t *file      = NULL;
+	int result               = 0;
 
-	/* Test regular cases
+	/* Initialize test
 	 */
-	result = libevt_file_get_ascii_codepage(
-	          file,
-	          &ascii_codepage,
+	result = libevt_file_initialize(
+	          &file,
 	          &error );
 
-	EVT_TEST_ASSERT_NOT_EQUAL_INT(
+	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
 
 	EVT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	ascii_codepage_is_set = result;
-
-	/* Test error cases
+	/* Test open and close
 	 */
-	result = libevt_file_get_ascii_codepage(
-	          NULL,
-	          &ascii_codepage,
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libevt_file_open_wide(
+	          file,
+	          source,
+	          LIBEVT_OPEN_READ,
+	          &error );
+#else
+	result = libevt_file_open(
+	          file,
+	          source,
+	          LIBEVT_OPEN_READ,
 	          &error );
+#endif
 
 	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	EVT_TEST_ASSERT_IS_NOT_NULL(
+	EVT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = libevt_file_close(
+	          file,
+	          &error );
 
-	if( ascii_codepage_is_set != 0 )
-	{
-		result = libevt_file_get_ascii_codepage(
-		          file,
-		          NULL,
-		          &error );
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-		EVT_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		EVT_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	/* Test open and close a second time to validate clean up on close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libevt_file_open_wide(
+	          file,
+	          source,
+	          LIBEVT_OPEN_READ,
+	          &error );
+#else
+	result = libevt_file_open(
+	          file,
+	          source,
+	          LIBEVT_OPEN_READ,
+	          &error );
+#endif
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_close(
+	          file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close with the file data read into memory
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libevt_file_open_wide(
+	          file,
+	          source,
+	          LIBEVT_OPEN_READ_IN_MEMORY,
+	          &error );
+#else
+	result = libevt_file_open(
+	          file,
+	          source,
+	          LIBEVT_OPEN_READ_IN_MEMORY,
+	          &error );
+#endif
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_close(
+	          file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libevt_file_free(
+	          &file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
 	return( 1 );
 
 on_error:
@@ -1309,67 +1545,63 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( file != NULL )
+	{
+		libevt_file_free(
+		 &file,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libevt_file_set_ascii_codepage function
+/* Tests the libevt_file_set_maximum_cache_entries, libevt_file_set_cache_policy
+ * and libevt_file_get_cache_statistics functions
  * Returns 1 if successful or 0 if not
  */
-int evt_test_file_set_ascii_codepage(
-     libevt_file_t *file )
+int evt_test_file_cache_policy(
+     const system_character_t *source )
 {
-	int supported_codepages[ 15 ] = {
-		LIBEVT_CODEPAGE_ASCII,
-		LIBEVT_CODEPAGE_WINDOWS_874,
-		LIBEVT_CODEPAGE_WINDOWS_932,
-		LIBEVT_CODEPAGE_WINDOWS_936,
-		LIBEVT_CODEPAGE_WINDOWS_949,
-		LIBEVT_CODEPAGE_WINDOWS_950,
-		LIBEVT_CODEPAGE_WINDOWS_1250,
-		LIBEVT_CODEPAGE_WINDOWS_1251,
-		LIBEVT_CODEPAGE_WINDOWS_1252,
-		LIBEVT_CODEPAGE_WINDOWS_1253,
-		LIBEVT_CODEPAGE_WINDOWS_1254,
-		LIBEVT_CODEPAGE_WINDOWS_1255,
-		LIBEVT_CODEPAGE_WINDOWS_1256,
-		LIBEVT_CODEPAGE_WINDOWS_1257,
-		LIBEVT_CODEPAGE_WINDOWS_1258 };
-
-	int unsupported_codepages[ 17 ] = {
-		LIBEVT_CODEPAGE_ISO_8859_1,
-		LIBEVT_CODEPAGE_ISO_8859_2,
-		LIBEVT_CODEPAGE_ISO_8859_3,
-		LIBEVT_CODEPAGE_ISO_8859_4,
-		LIBEVT_CODEPAGE_ISO_8859_5,
-		LIBEVT_CODEPAGE_ISO_8859_6,
-		LIBEVT_CODEPAGE_ISO_8859_7,
-		LIBEVT_CODEPAGE_ISO_8859_8,
-		LIBEVT_CODEPAGE_ISO_8859_9,
-		LIBEVT_CODEPAGE_ISO_8859_10,
-		LIBEVT_CODEPAGE_ISO_8859_11,
-		LIBEVT_CODEPAGE_ISO_8859_13,
-		LIBEVT_CODEPAGE_ISO_8859_14,
-		LIBEVT_CODEPAGE_ISO_8859_15,
-		LIBEVT_CODEPAGE_ISO_8859_16,
-		LIBEVT_CODEPAGE_KOI8_R,
-		LIBEVT_CODEPAGE_KOI8_U };
+	int cache_policies[ 3 ] = {
+		LIBEVT_CACHE_POLICY_DIRECT_MAPPED,
+		LIBEVT_CACHE_POLICY_LEAST_RECENTLY_USED,
+		LIBEVT_CACHE_POLICY_DISABLED };
 
-	libcerror_error_t *error = NULL;
-	int codepage             = 0;
-	int index                = 0;
-	int result               = 0;
+	libcerror_error_t *error  = NULL;
+	libevt_file_t *file       = NULL;
+	libevt_record_t *record   = NULL;
+	uint64_t number_of_hits   = 0;
+	uint64_t number_of_misses = 0;
+	int number_of_records     = 0;
+	int policy_index          = 0;
+	int record_index          = 0;
+	int result                = 0;
 
-	/* Test set ASCII codepage
-	 */
-	for( index = 0;
-	     index < 15;
-	     index++ )
+	for( policy_index = 0;
+	     policy_index < 3;
+	     policy_index++ )
 	{
-		codepage = supported_codepages[ index ];
+		/* Initialize test
+		 */
+		result = libevt_file_initialize(
+		          &file,
+		          &error );
 
-		result = libevt_file_set_ascii_codepage(
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NOT_NULL(
+		 "file",
+		 file );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevt_file_set_maximum_cache_entries(
 		          file,
-		          codepage,
+		          4,
 		          &error );
 
 		EVT_TEST_ASSERT_EQUAL_INT(
@@ -1380,54 +1612,4042 @@ int evt_test_file_set_ascii_codepage(
 		EVT_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
-	}
-	/* Test error cases
-	 */
-	result = libevt_file_set_ascii_codepage(
-	          NULL,
-	          LIBEVT_CODEPAGE_ASCII,
-	          &error );
 
-	EVT_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+		result = libevt_file_set_cache_policy(
+		          file,
+		          cache_policies[ policy_index ],
+		          &error );
 
-	EVT_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	libcerror_error_free(
-	 &error );
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	for( index = 0;
-	     index < 17;
-	     index++ )
-	{
-		codepage = unsupported_codepages[ index ];
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libevt_file_open_wide(
+		          file,
+		          source,
+		          LIBEVT_OPEN_READ,
+		          &error );
+#else
+		result = libevt_file_open(
+		          file,
+		          source,
+		          LIBEVT_OPEN_READ,
+		          &error );
+#endif
 
-		result = libevt_file_set_ascii_codepage(
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevt_file_get_number_of_records(
 		          file,
-		          codepage,
+		          &number_of_records,
 		          &error );
 
 		EVT_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
-		 -1 );
+		 1 );
 
-		EVT_TEST_ASSERT_IS_NOT_NULL(
+		EVT_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Clean up
+		/* Test regular cases
+		 */
+		for( record_index = 0;
+		     record_index < ( 2 * number_of_records );
+		     record_index++ )
+		{
+			result = libevt_file_get_record_by_index(
+			          file,
+			          record_index / 2,
+			          &record,
+			          &error );
+
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libevt_record_free(
+			          &record,
+			          &error );
+
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libevt_file_get_cache_statistics(
+		          file,
+		          &number_of_hits,
+		          &number_of_misses,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( cache_policies[ policy_index ] == LIBEVT_CACHE_POLICY_DISABLED )
+		{
+			EVT_TEST_ASSERT_EQUAL_UINT64(
+			 "number_of_hits",
+			 number_of_hits,
+			 (uint64_t) 0 );
+
+			EVT_TEST_ASSERT_EQUAL_UINT64(
+			 "number_of_misses",
+			 number_of_misses,
+			 (uint64_t) 2 * number_of_records );
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_UINT64(
+			 "number_of_hits",
+			 number_of_hits,
+			 (uint64_t) number_of_records );
+
+			EVT_TEST_ASSERT_EQUAL_UINT64(
+			 "number_of_misses",
+			 number_of_misses,
+			 (uint64_t) number_of_records );
+		}
+		/* Test error cases
+		 */
+		result = libevt_file_set_maximum_cache_entries(
+		          file,
+		          32,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libevt_file_set_cache_policy(
+		          file,
+		          LIBEVT_CACHE_POLICY_DIRECT_MAPPED,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		/* Clean up
+		 */
+		result = libevt_file_close(
+		          file,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevt_file_free(
+		          &file,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libevt_file_set_maximum_cache_entries(
+	          NULL,
+	          4,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_set_cache_policy(
+	          NULL,
+	          LIBEVT_CACHE_POLICY_DIRECT_MAPPED,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_get_cache_statistics(
+	          NULL,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libevt_record_free(
+		 &record,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libevt_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_set_arena_block_size function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_set_arena_block_size(
+     const system_character_t *source )
+{
+	libcerror_error_t *error  = NULL;
+	libevt_file_t *file       = NULL;
+	libevt_record_t *record   = NULL;
+	size_t utf8_string_size   = 0;
+	int number_of_records     = 0;
+	int record_index          = 0;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_file_initialize(
+	          &file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_file_set_arena_block_size(
+	          file,
+	          64 * 1024,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libevt_file_open_wide(
+	          file,
+	          source,
+	          LIBEVT_OPEN_READ,
+	          &error );
+#else
+	result = libevt_file_open(
+	          file,
+	          source,
+	          LIBEVT_OPEN_READ,
+	          &error );
+#endif
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		result = libevt_file_get_record_by_index(
+		          file,
+		          record_index,
+		          &record,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevt_record_get_utf8_source_name_size(
+		          record,
+		          &utf8_string_size,
+		          &error );
+
+		EVT_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevt_record_free(
+		          &record,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libevt_file_set_arena_block_size(
+	          file,
+	          64 * 1024,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_file_close(
+	          file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_file_set_arena_block_size(
+	          NULL,
+	          64 * 1024,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_set_arena_block_size(
+	          file,
+	          16,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_file_free(
+	          &file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libevt_record_free(
+		 &record,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libevt_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_signal_abort function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_signal_abort(
+     libevt_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevt_file_signal_abort(
+	          file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_file_signal_abort(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_get_ascii_codepage function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_get_ascii_codepage(
+     libevt_file_t *file )
+{
+	libcerror_error_t *error  = NULL;
+	int ascii_codepage        = 0;
+	int ascii_codepage_is_set = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libevt_file_get_ascii_codepage(
+	          file,
+	          &ascii_codepage,
+	          &error );
+
+	EVT_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ascii_codepage_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevt_file_get_ascii_codepage(
+	          NULL,
+	          &ascii_codepage,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( ascii_codepage_is_set != 0 )
+	{
+		result = libevt_file_get_ascii_codepage(
+		          file,
+		          NULL,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_set_ascii_codepage function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_set_ascii_codepage(
+     libevt_file_t *file )
+{
+	int supported_codepages[ 15 ] = {
+		LIBEVT_CODEPAGE_ASCII,
+		LIBEVT_CODEPAGE_WINDOWS_874,
+		LIBEVT_CODEPAGE_WINDOWS_932,
+		LIBEVT_CODEPAGE_WINDOWS_936,
+		LIBEVT_CODEPAGE_WINDOWS_949,
+		LIBEVT_CODEPAGE_WINDOWS_950,
+		LIBEVT_CODEPAGE_WINDOWS_1250,
+		LIBEVT_CODEPAGE_WINDOWS_1251,
+		LIBEVT_CODEPAGE_WINDOWS_1252,
+		LIBEVT_CODEPAGE_WINDOWS_1253,
+		LIBEVT_CODEPAGE_WINDOWS_1254,
+		LIBEVT_CODEPAGE_WINDOWS_1255,
+		LIBEVT_CODEPAGE_WINDOWS_1256,
+		LIBEVT_CODEPAGE_WINDOWS_1257,
+		LIBEVT_CODEPAGE_WINDOWS_1258 };
+
+	int unsupported_codepages[ 17 ] = {
+		LIBEVT_CODEPAGE_ISO_8859_1,
+		LIBEVT_CODEPAGE_ISO_8859_2,
+		LIBEVT_CODEPAGE_ISO_8859_3,
+		LIBEVT_CODEPAGE_ISO_8859_4,
+		LIBEVT_CODEPAGE_ISO_8859_5,
+		LIBEVT_CODEPAGE_ISO_8859_6,
+		LIBEVT_CODEPAGE_ISO_8859_7,
+		LIBEVT_CODEPAGE_ISO_8859_8,
+		LIBEVT_CODEPAGE_ISO_8859_9,
+		LIBEVT_CODEPAGE_ISO_8859_10,
+		LIBEVT_CODEPAGE_ISO_8859_11,
+		LIBEVT_CODEPAGE_ISO_8859_13,
+		LIBEVT_CODEPAGE_ISO_8859_14,
+		LIBEVT_CODEPAGE_ISO_8859_15,
+		LIBEVT_CODEPAGE_ISO_8859_16,
+		LIBEVT_CODEPAGE_KOI8_R,
+		LIBEVT_CODEPAGE_KOI8_U };
+
+	libcerror_error_t *error = NULL;
+	int codepage             = 0;
+	int index                = 0;
+	int result               = 0;
+
+	/* Test set ASCII codepage
+	 */
+	for( index = 0;
+	     index < 15;
+	     index++ )
+	{
+		codepage = supported_codepages[ index ];
+
+		result = libevt_file_set_ascii_codepage(
+		          file,
+		          codepage,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libevt_file_set_ascii_codepage(
+	          NULL,
+	          LIBEVT_CODEPAGE_ASCII,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	for( index = 0;
+	     index < 17;
+	     index++ )
+	{
+		codepage = unsupported_codepages[ index ];
+
+		result = libevt_file_set_ascii_codepage(
+		          file,
+		          codepage,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libevt_file_set_ascii_codepage(
+	          file,
+	          LIBEVT_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_get_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_get_flags(
+     libevt_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t flags           = 0;
+	int flags_is_set         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevt_file_get_flags(
+	          file,
+	          &flags,
+	          &error );
+
+	EVT_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	flags_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevt_file_get_flags(
+	          NULL,
+	          &flags,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( flags_is_set != 0 )
+	{
+		result = libevt_file_get_flags(
+		          file,
+		          NULL,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_get_number_of_records function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_get_number_of_records(
+     libevt_file_t *file )
+{
+	libcerror_error_t *error     = NULL;
+	int number_of_records        = 0;
+	int number_of_records_is_set = 0;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = libevt_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVT_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_records_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevt_file_get_number_of_records(
+	          NULL,
+	          &number_of_records,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( number_of_records_is_set != 0 )
+	{
+		result = libevt_file_get_number_of_records(
+		          file,
+		          NULL,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_get_record_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_get_record_by_index(
+     libevt_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	libevt_record_t *record  = 0;
+	int number_of_records    = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVT_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_records == 0 )
+	{
+		return( 1 );
+	}
+	/* Test regular cases
+	 */
+	result = libevt_file_get_record_by_index(
+	          file,
+	          0,
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	result = libevt_record_free(
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_file_get_record_by_index(
+	          NULL,
+	          0,
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_get_record_by_index(
+	          file,
+	          -1,
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_get_record_by_index(
+	          file,
+	          0,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_get_number_of_recovered_records function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_get_number_of_recovered_records(
+     libevt_file_t *file )
+{
+	libcerror_error_t *error               = NULL;
+	int number_of_recovered_records        = 0;
+	int number_of_recovered_records_is_set = 0;
+	int result                             = 0;
+
+	/* Test regular cases
+	 */
+	result = libevt_file_get_number_of_recovered_records(
+	          file,
+	          &number_of_recovered_records,
+	          &error );
+
+	EVT_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_recovered_records_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevt_file_get_number_of_recovered_records(
+	          NULL,
+	          &number_of_recovered_records,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( number_of_recovered_records_is_set != 0 )
+	{
+		result = libevt_file_get_number_of_recovered_records(
+		          file,
+		          NULL,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_get_number_of_duplicate_recovered_records function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_get_number_of_duplicate_recovered_records(
+     libevt_file_t *file )
+{
+	libcerror_error_t *error        = NULL;
+	int number_of_duplicate_records = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libevt_file_get_number_of_duplicate_recovered_records(
+	          file,
+	          &number_of_duplicate_records,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_file_get_number_of_duplicate_recovered_records(
+	          NULL,
+	          &number_of_duplicate_records,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_get_number_of_duplicate_recovered_records(
+	          file,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_get_recovered_record_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_get_recovered_record_by_index(
+     libevt_file_t *file )
+{
+	libcerror_error_t *error          = NULL;
+	libevt_record_t *recovered_record = 0;
+	int number_of_recovered_records   = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_file_get_number_of_recovered_records(
+	          file,
+	          &number_of_recovered_records,
+	          &error );
+
+	EVT_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_recovered_records == 0 )
+	{
+		return( 1 );
+	}
+	/* Test regular cases
+	 */
+	result = libevt_file_get_recovered_record_by_index(
+	          file,
+	          0,
+	          &recovered_record,
+	          &error );
+
+	EVT_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "recovered_record",
+	 recovered_record );
+
+	result = libevt_record_free(
+	          &recovered_record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_file_get_recovered_record_by_index(
+	          NULL,
+	          0,
+	          &recovered_record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "recovered_record",
+	 recovered_record );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_get_recovered_record_by_index(
+	          file,
+	          -1,
+	          &recovered_record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "recovered_record",
+	 recovered_record );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_get_recovered_record_by_index(
+	          file,
+	          0,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "recovered_record",
+	 recovered_record );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_get_record_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_get_record_by_identifier(
+     libevt_file_t *file )
+{
+	libcerror_error_t *error   = NULL;
+	libevt_record_t *record    = 0;
+	uint32_t identifier        = 0;
+	uint32_t record_identifier = 0;
+	int number_of_records      = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_records == 0 )
+	{
+		return( 1 );
+	}
+	result = libevt_file_get_record_by_index(
+	          file,
+	          0,
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_get_identifier(
+	          record,
+	          &identifier,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_free(
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_file_get_record_by_identifier(
+	          file,
+	          identifier,
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_get_identifier(
+	          record,
+	          &record_identifier,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "record_identifier",
+	 record_identifier,
+	 identifier );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_free(
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_file_get_record_by_identifier(
+	          NULL,
+	          identifier,
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_get_record_by_identifier(
+	          file,
+	          identifier,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libevt_record_free(
+		 &record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Callback function for the libevt_file_parse_records_parallel tests
+ * Returns 1 to continue, 0 to stop or -1 on error
+ */
+int evt_test_file_parse_records_callback(
+     libevt_record_t *record,
+     int record_index,
+     void *user_data,
+     libcerror_error_t **error EVT_TEST_ATTRIBUTE_UNUSED )
+{
+	int *values = (int *) user_data;
+
+	EVT_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( ( record == NULL )
+	 || ( values == NULL ) )
+	{
+		return( -1 );
+	}
+	/* values[ 0 ] contains the number of records processed
+	 * values[ 1 ] contains the index of the next expected record
+	 * values[ 2 ] is set if records were processed out of order
+	 * values[ 3 ] contains the number of records after which to stop
+	 */
+	if( record_index != values[ 1 ] )
+	{
+		values[ 2 ] = 1;
+	}
+	values[ 0 ] += 1;
+	values[ 1 ]  = record_index + 1;
+
+	if( values[ 0 ] == values[ 3 ] )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Tests the libevt_file_parse_records_parallel function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_parse_records_parallel(
+     libevt_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_records    = 0;
+	int result               = 0;
+	int values[ 4 ]          = { 0, 0, 0, 0 };
+
+	result = libevt_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_file_parse_records_parallel(
+	          file,
+	          4,
+	          &evt_test_file_parse_records_callback,
+	          (void *) values,
+	          LIBEVT_PARSE_RECORDS_FLAG_PRESERVE_ORDER,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 values[ 0 ],
+	 number_of_records );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "out_of_order",
+	 values[ 2 ],
+	 0 );
+
+	values[ 0 ] = 0;
+	values[ 1 ] = 0;
+	values[ 2 ] = 0;
+
+	result = libevt_file_parse_records_parallel(
+	          file,
+	          1,
+	          &evt_test_file_parse_records_callback,
+	          (void *) values,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 values[ 0 ],
+	 number_of_records );
+
+	if( number_of_records > 1 )
+	{
+		values[ 0 ] = 0;
+		values[ 1 ] = 0;
+		values[ 2 ] = 0;
+		values[ 3 ] = 1;
+
+		result = libevt_file_parse_records_parallel(
+		          file,
+		          1,
+		          &evt_test_file_parse_records_callback,
+		          (void *) values,
+		          0,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "number_of_records",
+		 values[ 0 ],
+		 1 );
+	}
+	/* Test error cases
+	 */
+	result = libevt_file_parse_records_parallel(
+	          NULL,
+	          1,
+	          &evt_test_file_parse_records_callback,
+	          (void *) values,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_parse_records_parallel(
+	          file,
+	          0,
+	          &evt_test_file_parse_records_callback,
+	          (void *) values,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_parse_records_parallel(
+	          file,
+	          1,
+	          NULL,
+	          (void *) values,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_parse_records_parallel(
+	          file,
+	          1,
+	          &evt_test_file_parse_records_callback,
+	          (void *) values,
+	          0xff,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_get_records_in_time_range function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_get_records_in_time_range(
+     libevt_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	libevt_record_t *record  = NULL;
+	uint32_t written_time    = 0;
+	int number_of_records    = 0;
+	int result               = 0;
+	int values[ 4 ]          = { 0, 0, 0, 0 };
+
+	/* Initialize test
+	 */
+	result = libevt_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_file_get_records_in_time_range(
+	          file,
+	          0,
+	          0xffffffffUL,
+	          &evt_test_file_parse_records_callback,
+	          (void *) values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "values[ 0 ]",
+	 values[ 0 ],
+	 number_of_records );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "values[ 2 ]",
+	 values[ 2 ],
+	 0 );
+
+	if( number_of_records > 1 )
+	{
+		/* Test stopping after the first record
+		 */
+		values[ 0 ] = 0;
+		values[ 1 ] = 0;
+		values[ 2 ] = 0;
+		values[ 3 ] = 1;
+
+		result = libevt_file_get_records_in_time_range(
+		          file,
+		          0,
+		          0xffffffffUL,
+		          &evt_test_file_parse_records_callback,
+		          (void *) values,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "values[ 0 ]",
+		 values[ 0 ],
+		 1 );
+	}
+	if( number_of_records > 0 )
+	{
+		/* Test a time range that contains the written time of the first record
+		 */
+		result = libevt_file_get_record_by_index(
+		          file,
+		          0,
+		          &record,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevt_record_get_written_time(
+		          record,
+		          &written_time,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevt_record_free(
+		          &record,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		values[ 0 ] = 0;
+		values[ 1 ] = 0;
+		values[ 2 ] = 0;
+		values[ 3 ] = 0;
+
+		result = libevt_file_get_records_in_time_range(
+		          file,
+		          written_time,
+		          written_time,
+		          &evt_test_file_parse_records_callback,
+		          (void *) values,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EVT_TEST_ASSERT_GREATER_THAN_INT(
+		 "values[ 0 ]",
+		 values[ 0 ],
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = libevt_file_get_records_in_time_range(
+	          NULL,
+	          0,
+	          0xffffffffUL,
+	          &evt_test_file_parse_records_callback,
+	          (void *) values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_get_records_in_time_range(
+	          file,
+	          2,
+	          1,
+	          &evt_test_file_parse_records_callback,
+	          (void *) values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_get_records_in_time_range(
+	          file,
+	          0,
+	          0xffffffffUL,
+	          NULL,
+	          (void *) values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libevt_record_free(
+		 &record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_get_record_columns function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_get_record_columns(
+     libevt_file_t *file )
+{
+	uint32_t creation_times[ 1 ];
+	uint32_t event_identifiers[ 1 ];
+	uint32_t record_numbers[ 1 ];
+	uint32_t written_times[ 1 ];
+	uint16_t event_categories[ 1 ];
+	uint16_t event_types[ 1 ];
+	off64_t record_offsets[ 1 ];
+
+	libcerror_error_t *error  = NULL;
+	libevt_record_t *record   = NULL;
+	off64_t record_offset     = 0;
+	uint32_t event_identifier = 0;
+	uint32_t record_number    = 0;
+	uint32_t written_time     = 0;
+	uint16_t event_type       = 0;
+	int number_of_records     = 0;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_file_get_record_columns(
+	          file,
+	          0,
+	          number_of_records,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_records > 0 )
+	{
+		result = libevt_file_get_record_columns(
+		          file,
+		          0,
+		          1,
+		          record_numbers,
+		          creation_times,
+		          written_times,
+		          event_identifiers,
+		          event_types,
+		          event_categories,
+		          record_offsets,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Compare the values with those of the record
+		 */
+		result = libevt_file_get_record_by_index(
+		          file,
+		          0,
+		          &record,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevt_record_get_offset(
+		          record,
+		          &record_offset,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_EQUAL_INT64(
+		 "record_offsets[ 0 ]",
+		 (int64_t) record_offsets[ 0 ],
+		 (int64_t) record_offset );
+
+		result = libevt_record_get_identifier(
+		          record,
+		          &record_number,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_EQUAL_UINT32(
+		 "record_numbers[ 0 ]",
+		 record_numbers[ 0 ],
+		 record_number );
+
+		result = libevt_record_get_written_time(
+		          record,
+		          &written_time,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_EQUAL_UINT32(
+		 "written_times[ 0 ]",
+		 written_times[ 0 ],
+		 written_time );
+
+		result = libevt_record_get_event_identifier(
+		          record,
+		          &event_identifier,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_EQUAL_UINT32(
+		 "event_identifiers[ 0 ]",
+		 event_identifiers[ 0 ],
+		 event_identifier );
+
+		result = libevt_record_get_event_type(
+		          record,
+		          &event_type,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_EQUAL_UINT16(
+		 "event_types[ 0 ]",
+		 event_types[ 0 ],
+		 event_type );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevt_record_free(
+		          &record,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libevt_file_get_record_columns(
+	          NULL,
+	          0,
+	          0,
+	          record_numbers,
+	          creation_times,
+	          written_times,
+	          event_identifiers,
+	          event_types,
+	          event_categories,
+	          record_offsets,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_get_record_columns(
+	          file,
+	          -1,
+	          0,
+	          record_numbers,
+	          creation_times,
+	          written_times,
+	          event_identifiers,
+	          event_types,
+	          event_categories,
+	          record_offsets,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_get_record_columns(
+	          file,
+	          0,
+	          number_of_records + 1,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libevt_record_free(
+		 &record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_parse_records_with_filter function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_parse_records_with_filter(
+     libevt_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	libevt_filter_t *filter  = NULL;
+	int number_of_records    = 0;
+	int result               = 0;
+	int values[ 4 ]          = { 0, 0, 0, 0 };
+
+	/* Initialize test
+	 */
+	result = libevt_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_filter_initialize(
+	          &filter,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "filter",
+	 filter );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_filter_set_time_range(
+	          filter,
+	          0,
+	          0xffffffffUL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_file_parse_records_with_filter(
+	          file,
+	          filter,
+	          4,
+	          &evt_test_file_parse_records_callback,
+	          (void *) values,
+	          LIBEVT_PARSE_RECORDS_FLAG_PRESERVE_ORDER,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 values[ 0 ],
+	 number_of_records );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "out_of_order",
+	 values[ 2 ],
+	 0 );
+
+	/* Test a filter that does not match any record
+	 */
+	result = libevt_filter_add_event_identifier(
+	          filter,
+	          0xfffffffeUL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	values[ 0 ] = 0;
+	values[ 1 ] = 0;
+	values[ 2 ] = 0;
+
+	result = libevt_file_parse_records_with_filter(
+	          file,
+	          filter,
+	          1,
+	          &evt_test_file_parse_records_callback,
+	          (void *) values,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 values[ 0 ],
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libevt_file_parse_records_with_filter(
+	          NULL,
+	          filter,
+	          1,
+	          &evt_test_file_parse_records_callback,
+	          (void *) values,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_filter_free(
+	          &filter,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "filter",
+	 filter );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filter != NULL )
+	{
+		libevt_filter_free(
+		 &filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_refresh function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_refresh(
+     libevt_file_t *file )
+{
+	libcerror_error_t *error        = NULL;
+	int number_of_records           = 0;
+	int refreshed_number_of_records = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_file_refresh(
+	          file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The file has not changed hence the number of records should be the same
+	 */
+	result = libevt_file_get_number_of_records(
+	          file,
+	          &refreshed_number_of_records,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "refreshed_number_of_records",
+	 refreshed_number_of_records,
+	 number_of_records );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_file_refresh(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Writes data into the ring buffer of an EVT image
+ * Data that does not fit before the end of the image continues directly after the file header
+ * Returns 1 if successful or -1 on error
+ */
+int evt_test_file_write_image_data(
+     uint8_t *image_data,
+     size_t image_size,
+     size_t image_offset,
+     const uint8_t *data,
+     size_t data_size )
+{
+	size_t data_offset = 0;
+
+	if( ( image_data == NULL )
+	 || ( image_size <= 48 )
+	 || ( image_offset < 48 )
+	 || ( image_offset >= image_size )
+	 || ( data == NULL )
+	 || ( data_size > ( image_size - 48 ) ) )
+	{
+		return( -1 );
+	}
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		if( image_offset >= image_size )
+		{
+			image_offset = 48;
+		}
+		image_data[ image_offset++ ] = data[ data_offset ];
+	}
+	return( 1 );
+}
+
+/* Writes an event record into the ring buffer of an EVT image
+ * Returns 1 if successful or -1 on error
+ */
+int evt_test_file_write_event_record(
+     uint8_t *image_data,
+     size_t image_size,
+     size_t record_offset,
+     uint32_t record_number )
+{
+	uint8_t record_data[ 144 ];
+
+	if( memory_copy(
+	     record_data,
+	     evt_test_file_event_record_data1,
+	     144 ) == NULL )
+	{
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( record_data[ 8 ] ),
+	 record_number );
+
+	return( evt_test_file_write_image_data(
+	         image_data,
+	         image_size,
+	         record_offset,
+	         record_data,
+	         144 ) );
+}
+
+/* Writes an end-of-file record into the ring buffer of an EVT image
+ * Returns 1 if successful or -1 on error
+ */
+int evt_test_file_write_end_of_file_record(
+     uint8_t *image_data,
+     size_t image_size,
+     size_t record_offset,
+     uint32_t first_record_offset,
+     uint32_t first_record_number,
+     uint32_t last_record_number )
+{
+	uint8_t record_data[ 40 ];
+
+	if( memory_copy(
+	     record_data,
+	     evt_test_file_end_of_file_record_data1,
+	     40 ) == NULL )
+	{
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( record_data[ 20 ] ),
+	 first_record_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( record_data[ 24 ] ),
+	 (uint32_t) record_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( record_data[ 28 ] ),
+	 last_record_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( record_data[ 32 ] ),
+	 first_record_number );
+
+	return( evt_test_file_write_image_data(
+	         image_data,
+	         image_size,
+	         record_offset,
+	         record_data,
+	         40 ) );
+}
+
+/* Builds an EVT image that contains 2 event records, with identifiers 1 and 2,
+ * followed by an end-of-file record
+ * Returns 1 if successful or -1 on error
+ */
+int evt_test_file_build_image(
+     uint8_t *image_data,
+     size_t image_size )
+{
+	if( ( image_data == NULL )
+	 || ( image_size < ( 48 + 144 + 144 + 40 ) ) )
+	{
+		return( -1 );
+	}
+	if( memory_set(
+	     image_data,
+	     0,
+	     image_size ) == NULL )
+	{
+		return( -1 );
+	}
+	if( memory_copy(
+	     image_data,
+	     evt_test_file_file_header_data1,
+	     48 ) == NULL )
+	{
+		return( -1 );
+	}
+	if( evt_test_file_write_event_record(
+	     image_data,
+	     image_size,
+	     48,
+	     1 ) != 1 )
+	{
+		return( -1 );
+	}
+	if( evt_test_file_write_event_record(
+	     image_data,
+	     image_size,
+	     192,
+	     2 ) != 1 )
+	{
+		return( -1 );
+	}
+	return( evt_test_file_write_end_of_file_record(
+	         image_data,
+	         image_size,
+	         336,
+	         48,
+	         1,
+	         3 ) );
+}
+
+/* Tests the records of a refreshed file
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_check_refreshed_records(
+     libevt_file_t *file,
+     int expected_number_of_records,
+     uint32_t expected_first_identifier,
+     uint32_t expected_last_identifier )
+{
+	libcerror_error_t *error = NULL;
+	libevt_record_t *record  = NULL;
+	uint32_t identifier      = 0;
+	int number_of_records    = 0;
+	int result               = 0;
+	int values[ 4 ]          = { 0, 0, 0, 0 };
+
+	result = libevt_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 expected_number_of_records );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the first record
+	 */
+	result = libevt_file_get_record_by_index(
+	          file,
+	          0,
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_get_identifier(
+	          record,
+	          &identifier,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "identifier",
+	 identifier,
+	 expected_first_identifier );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_free(
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the last record
+	 */
+	result = libevt_file_get_record_by_index(
+	          file,
+	          number_of_records - 1,
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_get_identifier(
+	          record,
+	          &identifier,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "identifier",
+	 identifier,
+	 expected_last_identifier );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_free(
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the identifier map, which is created again after the refresh
+	 */
+	result = libevt_file_get_record_by_identifier(
+	          file,
+	          expected_last_identifier,
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_free(
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the time index, which is created again after the refresh
+	 */
+	result = libevt_file_get_records_in_time_range(
+	          file,
+	          0,
+	          0xffffffffUL,
+	          &evt_test_file_parse_records_callback,
+	          (void *) values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "values[ 0 ]",
+	 values[ 0 ],
+	 expected_number_of_records );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "values[ 2 ]",
+	 values[ 2 ],
+	 0 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libevt_record_free(
+		 &record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_refresh function on a file that changes
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_refresh_changes(
+     void )
+{
+	uint8_t image_data[ EVT_TEST_FILE_REFRESH_IMAGE_SIZE ];
+
+	libbfio_handle_t *file_io_handle   = NULL;
+	libcerror_error_t *error           = NULL;
+	libevt_file_t *file                = NULL;
+	libevt_record_t *record            = NULL;
+	libevt_record_view_t *record_view  = NULL;
+	uint32_t identifier                = 0;
+	int number_of_recovered_records    = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 * The file header is not updated while the file is in use, only the
+	 * end-of-file record that directly follows the last record
+	 */
+	result = evt_test_file_build_image(
+	          image_data,
+	          EVT_TEST_FILE_REFRESH_IMAGE_SIZE );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* A record in the unused space after the end-of-file record is recovered
+	 */
+	result = evt_test_file_write_event_record(
+	          image_data,
+	          EVT_TEST_FILE_REFRESH_IMAGE_SIZE,
+	          376,
+	          7 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_memory_range_initialize(
+	          &file_io_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          file_io_handle,
+	          image_data,
+	          EVT_TEST_FILE_REFRESH_IMAGE_SIZE,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_initialize(
+	          &file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The file data is read into memory so that record views reference it
+	 */
+	result = libevt_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBEVT_OPEN_READ_IN_MEMORY,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evt_test_file_check_refreshed_records(
+	          file,
+	          2,
+	          1,
+	          2 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevt_file_get_number_of_recovered_records(
+	          file,
+	          &number_of_recovered_records,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_recovered_records",
+	 number_of_recovered_records,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Hold a record view of the second record across the refreshes
+	 */
+	result = libevt_record_view_initialize(
+	          &record_view,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "record_view",
+	 record_view );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_get_record_view_by_index(
+	          file,
+	          1,
+	          record_view,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test refresh after a record was appended
+	 */
+	result = evt_test_file_write_event_record(
+	          image_data,
+	          EVT_TEST_FILE_REFRESH_IMAGE_SIZE,
+	          336,
+	          3 );
+
+	if( result == 1 )
+	{
+		result = evt_test_file_write_end_of_file_record(
+		          image_data,
+		          EVT_TEST_FILE_REFRESH_IMAGE_SIZE,
+		          480,
+		          48,
+		          1,
+		          4 );
+	}
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevt_file_refresh(
+	          file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evt_test_file_check_refreshed_records(
+	          file,
+	          3,
+	          1,
+	          3 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* The recovered record was overwritten by the appended record
+	 */
+	result = libevt_file_get_number_of_recovered_records(
+	          file,
+	          &number_of_recovered_records,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_recovered_records",
+	 number_of_recovered_records,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test refresh after a record was appended that wraps past the previous
+	 * end-of-file record offset and overwrites the first record
+	 */
+	result = evt_test_file_write_event_record(
+	          image_data,
+	          EVT_TEST_FILE_REFRESH_IMAGE_SIZE,
+	          480,
+	          4 );
+
+	if( result == 1 )
+	{
+		result = evt_test_file_write_end_of_file_record(
+		          image_data,
+		          EVT_TEST_FILE_REFRESH_IMAGE_SIZE,
+		          144,
+		          192,
+		          2,
+		          5 );
+	}
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevt_file_refresh(
+	          file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The second record is now the first record
+	 */
+	result = evt_test_file_check_refreshed_records(
+	          file,
+	          3,
+	          2,
+	          4 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevt_file_get_record_by_identifier(
+	          file,
+	          1,
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test refresh after a record was appended that overwrites the held record
+	 */
+	result = evt_test_file_write_event_record(
+	          image_data,
+	          EVT_TEST_FILE_REFRESH_IMAGE_SIZE,
+	          144,
+	          5 );
+
+	if( result == 1 )
+	{
+		result = evt_test_file_write_end_of_file_record(
+		          image_data,
+		          EVT_TEST_FILE_REFRESH_IMAGE_SIZE,
+		          288,
+		          336,
+		          3,
+		          6 );
+	}
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevt_file_refresh(
+	          file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evt_test_file_check_refreshed_records(
+	          file,
+	          3,
+	          3,
+	          5 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevt_file_get_record_by_identifier(
+	          file,
+	          2,
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The record view retrieved before the refreshes still contains the data from before them
+	 */
+	result = libevt_record_view_get_identifier(
+	          record_view,
+	          &identifier,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "identifier",
+	 identifier,
+	 2 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test refresh of a file that has not changed
+	 */
+	result = libevt_file_refresh(
+	          file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evt_test_file_check_refreshed_records(
+	          file,
+	          3,
+	          3,
+	          5 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Clean up
+	 */
+	result = libevt_record_view_free(
+	          &record_view,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record_view",
+	 record_view );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_close(
+	          file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_free(
+	          &file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libevt_record_free(
+		 &record,
+		 NULL );
+	}
+	if( record_view != NULL )
+	{
+		libevt_record_view_free(
+		 &record_view,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libevt_file_close(
+		 file,
+		 NULL );
+		libevt_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Callback function that retrieves the identifiers of the records
+ * Returns 1 to continue, 0 to stop or -1 on error
+ */
+int evt_test_file_parse_records_identifier_callback(
+     libevt_record_t *record,
+     int record_index,
+     void *user_data,
+     libcerror_error_t **error )
+{
+	uint32_t *identifiers = (uint32_t *) user_data;
+
+	if( ( identifiers == NULL )
+	 || ( record_index < 0 )
+	 || ( record_index >= 2 ) )
+	{
+		return( -1 );
+	}
+	/* The record passed to the callback function can be used, the file cannot
+	 */
+	if( libevt_record_get_identifier(
+	     record,
+	     &( identifiers[ record_index ] ),
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests that the file is unlocked after libevt_file_parse_records_with_filter
+ * returns, also when the callback function stops parsing or fails
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_parse_records_callbacks(
+     void )
+{
+	uint8_t image_data[ EVT_TEST_FILE_REFRESH_IMAGE_SIZE ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libevt_file_t *file              = NULL;
+	uint32_t identifiers[ 2 ]        = { 0, 0 };
+	int number_of_records            = 0;
+	int result                       = 0;
+	int values[ 4 ]                  = { 0, 0, 0, 1 };
+
+	/* Initialize test
+	 */
+	result = evt_test_file_build_image(
+	          image_data,
+	          EVT_TEST_FILE_REFRESH_IMAGE_SIZE );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_memory_range_initialize(
+	          &file_io_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          file_io_handle,
+	          image_data,
+	          EVT_TEST_FILE_REFRESH_IMAGE_SIZE,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_initialize(
+	          &file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBEVT_OPEN_READ,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a callback function that uses the record passed to it
+	 */
+	result = libevt_file_parse_records_with_filter(
+	          file,
+	          NULL,
+	          2,
+	          &evt_test_file_parse_records_identifier_callback,
+	          (void *) identifiers,
+	          LIBEVT_PARSE_RECORDS_FLAG_PRESERVE_ORDER,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "identifiers[ 0 ]",
+	 identifiers[ 0 ],
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "identifiers[ 1 ]",
+	 identifiers[ 1 ],
+	 2 );
+
+	/* Test a callback function that stops parsing after the first record
+	 */
+	result = libevt_file_parse_records_with_filter(
+	          file,
+	          NULL,
+	          2,
+	          &evt_test_file_parse_records_callback,
+	          (void *) values,
+	          LIBEVT_PARSE_RECORDS_FLAG_PRESERVE_ORDER,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "values[ 0 ]",
+	 values[ 0 ],
+	 1 );
+
+	/* Test a callback function that fails
+	 */
+	result = libevt_file_parse_records_with_filter(
+	          file,
+	          NULL,
+	          2,
+	          &evt_test_file_parse_records_callback,
+	          NULL,
+	          LIBEVT_PARSE_RECORDS_FLAG_PRESERVE_ORDER,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Functions that lock the file for writing can be called once parsing returned
+	 */
+	result = libevt_file_refresh(
+	          file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 2 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libevt_file_close(
+	          file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_free(
+	          &file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libevt_file_close(
+		 file,
+		 NULL );
+		libevt_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_write_index_file_io_handle and libevt_file_open_file_io_handle_with_index functions
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_write_index(
+     libevt_file_t *file,
+     libbfio_handle_t *file_io_handle )
+{
+	libbfio_handle_t *index_file_io_handle  = NULL;
+	libcerror_error_t *error                = NULL;
+	libevt_file_t *indexed_file             = NULL;
+	int indexed_number_of_records           = 0;
+	int indexed_number_of_recovered_records = 0;
+	int number_of_records                   = 0;
+	int number_of_recovered_records         = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_get_number_of_recovered_records(
+	          file,
+	          &number_of_recovered_records,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_initialize(
+	          &index_file_io_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "index_file_io_handle",
+	 index_file_io_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          index_file_io_handle,
+	          evt_test_file_index_data,
+	          EVT_TEST_FILE_INDEX_DATA_SIZE,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_file_write_index_file_io_handle(
+	          file,
+	          index_file_io_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open with a records index that matches the file
+	 */
+	result = libevt_file_initialize(
+	          &indexed_file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "indexed_file",
+	 indexed_file );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_open_file_io_handle_with_index(
+	          indexed_file,
+	          file_io_handle,
+	          index_file_io_handle,
+	          LIBEVT_OPEN_READ,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_get_number_of_records(
+	          indexed_file,
+	          &indexed_number_of_records,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "indexed_number_of_records",
+	 indexed_number_of_records,
+	 number_of_records );
+
+	result = libevt_file_get_number_of_recovered_records(
+	          indexed_file,
+	          &indexed_number_of_recovered_records,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "indexed_number_of_recovered_records",
+	 indexed_number_of_recovered_records,
+	 number_of_recovered_records );
+
+	result = libevt_file_close(
+	          indexed_file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_free(
+	          &indexed_file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "indexed_file",
+	 indexed_file );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open with a records index that does not match the file
 	 */
-	result = libevt_file_set_ascii_codepage(
-	          file,
-	          LIBEVT_CODEPAGE_WINDOWS_1252,
+	evt_test_file_index_data[ 0 ] = 0;
+
+	result = libevt_file_initialize(
+	          &indexed_file,
 	          &error );
 
 	EVT_TEST_ASSERT_EQUAL_INT(
@@ -1435,133 +5655,120 @@ int evt_test_file_set_ascii_codepage(
 	 result,
 	 1 );
 
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "indexed_file",
+	 indexed_file );
+
 	EVT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
+	result = libevt_file_open_file_io_handle_with_index(
+	          indexed_file,
+	          file_io_handle,
+	          index_file_io_handle,
+	          LIBEVT_OPEN_READ,
+	          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-/* Tests the libevt_file_get_flags function
- * Returns 1 if successful or 0 if not
- */
-int evt_test_file_get_flags(
-     libevt_file_t *file )
-{
-	libcerror_error_t *error = NULL;
-	uint32_t flags           = 0;
-	int flags_is_set         = 0;
-	int result               = 0;
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Test regular cases
-	 */
-	result = libevt_file_get_flags(
-	          file,
-	          &flags,
+	result = libevt_file_get_number_of_records(
+	          indexed_file,
+	          &indexed_number_of_records,
 	          &error );
 
-	EVT_TEST_ASSERT_NOT_EQUAL_INT(
+	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	EVT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	flags_is_set = result;
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "indexed_number_of_records",
+	 indexed_number_of_records,
+	 number_of_records );
 
-	/* Test error cases
-	 */
-	result = libevt_file_get_flags(
-	          NULL,
-	          &flags,
+	result = libevt_file_get_number_of_recovered_records(
+	          indexed_file,
+	          &indexed_number_of_recovered_records,
 	          &error );
 
 	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	EVT_TEST_ASSERT_IS_NOT_NULL(
+	EVT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "indexed_number_of_recovered_records",
+	 indexed_number_of_recovered_records,
+	 number_of_recovered_records );
 
-	if( flags_is_set != 0 )
-	{
-		result = libevt_file_get_flags(
-		          file,
-		          NULL,
-		          &error );
+	result = libevt_file_close(
+	          indexed_file,
+	          &error );
 
-		EVT_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-		EVT_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	return( 1 );
+	result = libevt_file_free(
+	          &indexed_file,
+	          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-/* Tests the libevt_file_get_number_of_records function
- * Returns 1 if successful or 0 if not
- */
-int evt_test_file_get_number_of_records(
-     libevt_file_t *file )
-{
-	libcerror_error_t *error     = NULL;
-	int number_of_records        = 0;
-	int number_of_records_is_set = 0;
-	int result                   = 0;
+	EVT_TEST_ASSERT_IS_NULL(
+	 "indexed_file",
+	 indexed_file );
 
-	/* Test regular cases
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
 	 */
-	result = libevt_file_get_number_of_records(
-	          file,
-	          &number_of_records,
+	result = libevt_file_write_index_file_io_handle(
+	          NULL,
+	          index_file_io_handle,
 	          &error );
 
-	EVT_TEST_ASSERT_NOT_EQUAL_INT(
+	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
-	EVT_TEST_ASSERT_IS_NULL(
+	EVT_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	number_of_records_is_set = result;
+	libcerror_error_free(
+	 &error );
 
-	/* Test error cases
-	 */
-	result = libevt_file_get_number_of_records(
+	result = libevt_file_write_index_file_io_handle(
+	          file,
 	          NULL,
-	          &number_of_records,
 	          &error );
 
 	EVT_TEST_ASSERT_EQUAL_INT(
@@ -1576,25 +5783,25 @@ int evt_test_file_get_number_of_records(
 	libcerror_error_free(
 	 &error );
 
-	if( number_of_records_is_set != 0 )
-	{
-		result = libevt_file_get_number_of_records(
-		          file,
-		          NULL,
-		          &error );
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &index_file_io_handle,
+	          &error );
 
-		EVT_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		EVT_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	EVT_TEST_ASSERT_IS_NULL(
+	 "index_file_io_handle",
+	 index_file_io_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
 	return( 1 );
 
 on_error:
@@ -1603,63 +5810,113 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( indexed_file != NULL )
+	{
+		libevt_file_free(
+		 &indexed_file,
+		 NULL );
+	}
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libevt_file_get_record_by_index function
+/* Tests that the number of duplicate recovered records is stored in the records index
  * Returns 1 if successful or 0 if not
  */
-int evt_test_file_get_record_by_index(
-     libevt_file_t *file )
+int evt_test_file_write_index_duplicate_records(
+     void )
 {
-	libcerror_error_t *error = NULL;
-	libevt_record_t *record  = 0;
-	int number_of_records    = 0;
-	int result               = 0;
+	uint8_t image_data[ EVT_TEST_FILE_REFRESH_IMAGE_SIZE ];
+
+	libbfio_handle_t *file_io_handle                  = NULL;
+	libbfio_handle_t *index_file_io_handle            = NULL;
+	libcerror_error_t *error                          = NULL;
+	libevt_file_t *file                               = NULL;
+	int indexed_number_of_duplicate_recovered_records = 0;
+	int number_of_duplicate_recovered_records         = 0;
+	int result                                        = 0;
 
 	/* Initialize test
+	 * A copy of the first record is left in the unused space after the end-of-file record
 	 */
-	result = libevt_file_get_number_of_records(
-	          file,
-	          &number_of_records,
+	result = evt_test_file_build_image(
+	          image_data,
+	          EVT_TEST_FILE_REFRESH_IMAGE_SIZE );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = evt_test_file_write_event_record(
+	          image_data,
+	          EVT_TEST_FILE_REFRESH_IMAGE_SIZE,
+	          376,
+	          1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_memory_range_initialize(
+	          &file_io_handle,
 	          &error );
 
-	EVT_TEST_ASSERT_NOT_EQUAL_INT(
+	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
 
 	EVT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	if( number_of_records == 0 )
-	{
-		return( 1 );
-	}
-	/* Test regular cases
-	 */
-	result = libevt_file_get_record_by_index(
-	          file,
-	          0,
-	          &record,
+	result = libbfio_memory_range_set(
+	          file_io_handle,
+	          image_data,
+	          EVT_TEST_FILE_REFRESH_IMAGE_SIZE,
 	          &error );
 
-	EVT_TEST_ASSERT_NOT_EQUAL_INT(
+	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	EVT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	result = libbfio_memory_range_initialize(
+	          &index_file_io_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
 	EVT_TEST_ASSERT_IS_NOT_NULL(
-	 "record",
-	 record );
+	 "index_file_io_handle",
+	 index_file_io_handle );
 
-	result = libevt_record_free(
-	          &record,
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          index_file_io_handle,
+	          evt_test_file_index_data,
+	          EVT_TEST_FILE_INDEX_DATA_SIZE,
 	          &error );
 
 	EVT_TEST_ASSERT_EQUAL_INT(
@@ -1671,296 +5928,189 @@ int evt_test_file_get_record_by_index(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test open without a records index
 	 */
-	result = libevt_file_get_record_by_index(
-	          NULL,
-	          0,
-	          &record,
+	result = libevt_file_initialize(
+	          &file,
 	          &error );
 
 	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
-
-	EVT_TEST_ASSERT_IS_NULL(
-	 "record",
-	 record );
+	 1 );
 
 	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EVT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libevt_file_get_record_by_index(
+	result = libevt_file_open_file_io_handle(
 	          file,
-	          -1,
-	          &record,
+	          file_io_handle,
+	          LIBEVT_OPEN_READ,
 	          &error );
 
 	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	EVT_TEST_ASSERT_IS_NULL(
-	 "record",
-	 record );
-
-	EVT_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libevt_file_get_record_by_index(
+	result = libevt_file_get_number_of_duplicate_recovered_records(
 	          file,
-	          0,
-	          NULL,
+	          &number_of_duplicate_recovered_records,
 	          &error );
 
 	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	EVT_TEST_ASSERT_IS_NULL(
-	 "record",
-	 record );
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_duplicate_recovered_records",
+	 number_of_duplicate_recovered_records,
+	 1 );
 
-	EVT_TEST_ASSERT_IS_NOT_NULL(
+	EVT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libevt_file_get_number_of_recovered_records function
- * Returns 1 if successful or 0 if not
- */
-int evt_test_file_get_number_of_recovered_records(
-     libevt_file_t *file )
-{
-	libcerror_error_t *error               = NULL;
-	int number_of_recovered_records        = 0;
-	int number_of_recovered_records_is_set = 0;
-	int result                             = 0;
-
-	/* Test regular cases
-	 */
-	result = libevt_file_get_number_of_recovered_records(
+	result = libevt_file_write_index_file_io_handle(
 	          file,
-	          &number_of_recovered_records,
+	          index_file_io_handle,
 	          &error );
 
-	EVT_TEST_ASSERT_NOT_EQUAL_INT(
+	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	EVT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	number_of_recovered_records_is_set = result;
-
-	/* Test error cases
-	 */
-	result = libevt_file_get_number_of_recovered_records(
-	          NULL,
-	          &number_of_recovered_records,
+	result = libevt_file_close(
+	          file,
 	          &error );
 
 	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
-	EVT_TEST_ASSERT_IS_NOT_NULL(
+	EVT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	if( number_of_recovered_records_is_set != 0 )
-	{
-		result = libevt_file_get_number_of_recovered_records(
-		          file,
-		          NULL,
-		          &error );
-
-		EVT_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		EVT_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libevt_file_get_recovered_record_by_index function
- * Returns 1 if successful or 0 if not
- */
-int evt_test_file_get_recovered_record_by_index(
-     libevt_file_t *file )
-{
-	libcerror_error_t *error          = NULL;
-	libevt_record_t *recovered_record = 0;
-	int number_of_recovered_records   = 0;
-	int result                        = 0;
-
-	/* Initialize test
+	/* Test open with a records index that matches the file
 	 */
-	result = libevt_file_get_number_of_recovered_records(
+	result = libevt_file_open_file_io_handle_with_index(
 	          file,
-	          &number_of_recovered_records,
+	          file_io_handle,
+	          index_file_io_handle,
+	          LIBEVT_OPEN_READ,
 	          &error );
 
-	EVT_TEST_ASSERT_NOT_EQUAL_INT(
+	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	EVT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	if( number_of_recovered_records == 0 )
-	{
-		return( 1 );
-	}
-	/* Test regular cases
-	 */
-	result = libevt_file_get_recovered_record_by_index(
+	result = libevt_file_get_number_of_duplicate_recovered_records(
 	          file,
-	          0,
-	          &recovered_record,
+	          &indexed_number_of_duplicate_recovered_records,
 	          &error );
 
-	EVT_TEST_ASSERT_NOT_EQUAL_INT(
+	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "indexed_number_of_duplicate_recovered_records",
+	 indexed_number_of_duplicate_recovered_records,
+	 number_of_duplicate_recovered_records );
 
 	EVT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	EVT_TEST_ASSERT_IS_NOT_NULL(
-	 "recovered_record",
-	 recovered_record );
-
-	result = libevt_record_free(
-	          &recovered_record,
+	/* Clean up
+	 */
+	result = libevt_file_close(
+	          file,
 	          &error );
 
 	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
 	EVT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libevt_file_get_recovered_record_by_index(
-	          NULL,
-	          0,
-	          &recovered_record,
+	result = libevt_file_free(
+	          &file,
 	          &error );
 
 	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	EVT_TEST_ASSERT_IS_NULL(
-	 "recovered_record",
-	 recovered_record );
+	 "file",
+	 file );
 
-	EVT_TEST_ASSERT_IS_NOT_NULL(
+	EVT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libevt_file_get_recovered_record_by_index(
-	          file,
-	          -1,
-	          &recovered_record,
+	result = libbfio_handle_free(
+	          &index_file_io_handle,
 	          &error );
 
 	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	EVT_TEST_ASSERT_IS_NULL(
-	 "recovered_record",
-	 recovered_record );
+	 "index_file_io_handle",
+	 index_file_io_handle );
 
-	EVT_TEST_ASSERT_IS_NOT_NULL(
+	EVT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libevt_file_get_recovered_record_by_index(
-	          file,
-	          0,
-	          NULL,
+	result = libbfio_handle_free(
+	          &file_io_handle,
 	          &error );
 
 	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	EVT_TEST_ASSERT_IS_NULL(
-	 "recovered_record",
-	 recovered_record );
+	 "file_io_handle",
+	 file_io_handle );
 
-	EVT_TEST_ASSERT_IS_NOT_NULL(
+	EVT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
 	return( 1 );
 
 on_error:
@@ -1969,6 +6119,24 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( file != NULL )
+	{
+		libevt_file_free(
+		 &file,
+		 NULL );
+	}
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
 	return( 0 );
 }
 
@@ -2030,6 +6198,19 @@ int main(
 	 evt_test_file_free );
 
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	EVT_TEST_RUN(
+	 "libevt_file_refresh",
+	 evt_test_file_refresh_changes );
+
+	EVT_TEST_RUN(
+	 "libevt_file_parse_records_with_filter",
+	 evt_test_file_parse_records_callbacks );
+
+	EVT_TEST_RUN(
+	 "libevt_file_write_index",
+	 evt_test_file_write_index_duplicate_records );
+
 	if( source != NULL )
 	{
 		result = libbfio_file_initialize(
@@ -2117,6 +6298,21 @@ int main(
 		 evt_test_file_open_close,
 		 source );
 
+		EVT_TEST_RUN_WITH_ARGS(
+		 "libevt_file_cache_policy",
+		 evt_test_file_cache_policy,
+		 source );
+
+		EVT_TEST_RUN_WITH_ARGS(
+		 "libevt_file_set_arena_block_size",
+		 evt_test_file_set_arena_block_size,
+		 source );
+
+		EVT_TEST_RUN_WITH_ARGS(
+		 "libevt_file_open_memory",
+		 evt_test_file_open_memory,
+		 file_io_handle );
+
 		/* Initialize file for tests
 		 */
 		result = evt_test_file_open_source(
@@ -2184,11 +6380,52 @@ int main(
 		 evt_test_file_get_number_of_recovered_records,
 		 file );
 
+		EVT_TEST_RUN_WITH_ARGS(
+		 "libevt_file_get_number_of_duplicate_recovered_records",
+		 evt_test_file_get_number_of_duplicate_recovered_records,
+		 file );
+
 		EVT_TEST_RUN_WITH_ARGS(
 		 "libevt_file_get_recovered_record_by_index",
 		 evt_test_file_get_recovered_record_by_index,
 		 file );
 
+		EVT_TEST_RUN_WITH_ARGS(
+		 "libevt_file_get_record_by_identifier",
+		 evt_test_file_get_record_by_identifier,
+		 file );
+
+		EVT_TEST_RUN_WITH_ARGS(
+		 "libevt_file_parse_records_parallel",
+		 evt_test_file_parse_records_parallel,
+		 file );
+
+		EVT_TEST_RUN_WITH_ARGS(
+		 "libevt_file_get_records_in_time_range",
+		 evt_test_file_get_records_in_time_range,
+		 file );
+
+		EVT_TEST_RUN_WITH_ARGS(
+		 "libevt_file_get_record_columns",
+		 evt_test_file_get_record_columns,
+		 file );
+
+		EVT_TEST_RUN_WITH_ARGS(
+		 "libevt_file_parse_records_with_filter",
+		 evt_test_file_parse_records_with_filter,
+		 file );
+
+		EVT_TEST_RUN_WITH_ARGS(
+		 "libevt_file_refresh",
+		 evt_test_file_refresh,
+		 file );
+
+		EVT_TEST_RUN_WITH_ARGS(
+		 "libevt_file_write_index",
+		 evt_test_file_write_index,
+		 file,
+		 file_io_handle );
+
 		/* Clean up
 		 */
 		result = evt_test_file_close_source(
@@ -0,0 +1,865 @@
+/*
+ * Library file_set type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evt_test_getopt.h"
+#include "evt_test_libcerror.h"
+#include "evt_test_libevt.h"
+#include "evt_test_macros.h"
+#include "evt_test_memory.h"
+#include "evt_test_unused.h"
+
+#include "../libevt/libevt_file_set.h"
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
+#error Unsupported size of wchar_t
+#endif
+
+/* Tests the libevt_file_set_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_set_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libevt_file_set_t *file_set     = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevt_file_set_initialize(
+	          &file_set,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_set",
+	 file_set );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_set_free(
+	          &file_set,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "file_set",
+	 file_set );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_file_set_initialize(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	file_set = (libevt_file_set_t *) 0x12345678UL;
+
+	result = libevt_file_set_initialize(
+	          &file_set,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	file_set = NULL;
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevt_file_set_initialize with malloc failing
+		 */
+		evt_test_malloc_attempts_before_fail = test_number;
+
+		result = libevt_file_set_initialize(
+		          &file_set,
+		          &error );
+
+		if( evt_test_malloc_attempts_before_fail != -1 )
+		{
+			evt_test_malloc_attempts_before_fail = -1;
+
+			if( file_set != NULL )
+			{
+				libevt_file_set_free(
+				 &file_set,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "file_set",
+			 file_set );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevt_file_set_initialize with memset failing
+		 */
+		evt_test_memset_attempts_before_fail = test_number;
+
+		result = libevt_file_set_initialize(
+		          &file_set,
+		          &error );
+
+		if( evt_test_memset_attempts_before_fail != -1 )
+		{
+			evt_test_memset_attempts_before_fail = -1;
+
+			if( file_set != NULL )
+			{
+				libevt_file_set_free(
+				 &file_set,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "file_set",
+			 file_set );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_set != NULL )
+	{
+		libevt_file_set_free(
+		 &file_set,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_set_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_set_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevt_file_set_free(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_set_open, libevt_file_set_get_next_record and libevt_file_set_close functions
+ * The source is opened twice, hence every record of the second copy is a duplicate
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_set_open_get_next_record(
+     const system_character_t *source )
+{
+	system_character_t *filenames[ 2 ];
+
+	libcerror_error_t *error        = NULL;
+	libevt_file_t *file             = NULL;
+	libevt_file_set_t *file_set     = NULL;
+	libevt_record_t *record         = NULL;
+	uint32_t previous_written_time  = 0;
+	uint32_t written_time           = 0;
+	int file_index                  = 0;
+	int number_of_duplicate_records = 0;
+	int number_of_files             = 0;
+	int number_of_merged_records    = 0;
+	int number_of_records           = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	filenames[ 0 ] = (system_character_t *) source;
+	filenames[ 1 ] = (system_character_t *) source;
+
+	result = libevt_file_initialize(
+	          &file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libevt_file_open_wide(
+	          file,
+	          source,
+	          LIBEVT_OPEN_READ,
+	          &error );
+#else
+	result = libevt_file_open(
+	          file,
+	          source,
+	          LIBEVT_OPEN_READ,
+	          &error );
+#endif
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_free(
+	          &file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_set_initialize(
+	          &file_set,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_set",
+	 file_set );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libevt_file_set_open_wide(
+	          file_set,
+	          filenames,
+	          2,
+	          LIBEVT_OPEN_READ,
+	          &error );
+#else
+	result = libevt_file_set_open(
+	          file_set,
+	          filenames,
+	          2,
+	          LIBEVT_OPEN_READ,
+	          &error );
+#endif
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_set_get_number_of_files(
+	          file_set,
+	          &number_of_files,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_files",
+	 number_of_files,
+	 2 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open when already opened
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libevt_file_set_open_wide(
+	          file_set,
+	          filenames,
+	          2,
+	          LIBEVT_OPEN_READ,
+	          &error );
+#else
+	result = libevt_file_set_open(
+	          file_set,
+	          filenames,
+	          2,
+	          LIBEVT_OPEN_READ,
+	          &error );
+#endif
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test get next record
+	 */
+	do
+	{
+		result = libevt_file_set_get_next_record(
+		          file_set,
+		          &file_index,
+		          &record,
+		          &error );
+
+		EVT_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result == 0 )
+		{
+			break;
+		}
+		EVT_TEST_ASSERT_IS_NOT_NULL(
+		 "record",
+		 record );
+
+		/* Only the first copy contains records that are not duplicates
+		 */
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "file_index",
+		 file_index,
+		 0 );
+
+		result = libevt_record_get_written_time(
+		          record,
+		          &written_time,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The records are returned in written time order
+		 */
+		EVT_TEST_ASSERT_LESS_THAN_UINT32(
+		 "previous_written_time",
+		 previous_written_time,
+		 written_time + 1 );
+
+		previous_written_time = written_time;
+
+		result = libevt_record_free(
+		          &record,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		number_of_merged_records++;
+	}
+	while( number_of_merged_records <= number_of_records );
+
+	EVT_TEST_ASSERT_LESS_THAN_INT(
+	 "number_of_merged_records",
+	 number_of_merged_records,
+	 number_of_records + 1 );
+
+	result = libevt_file_set_get_number_of_duplicate_records(
+	          file_set,
+	          &number_of_duplicate_records,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_LESS_THAN_INT(
+	 "number_of_merged_records",
+	 number_of_merged_records,
+	 number_of_duplicate_records + 1 );
+
+	/* Test error cases
+	 */
+	result = libevt_file_set_get_next_record(
+	          NULL,
+	          &file_index,
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_set_get_next_record(
+	          file_set,
+	          NULL,
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_set_get_next_record(
+	          file_set,
+	          &file_index,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_file_set_close(
+	          file_set,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_set_free(
+	          &file_set,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "file_set",
+	 file_set );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libevt_record_free(
+		 &record,
+		 NULL );
+	}
+	if( file_set != NULL )
+	{
+		libevt_file_set_free(
+		 &file_set,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libevt_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_set_open function with invalid arguments
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_set_open(
+     void )
+{
+	char *filenames[ 1 ]        = { "test" };
+
+	libcerror_error_t *error    = NULL;
+	libevt_file_set_t *file_set = NULL;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_file_set_initialize(
+	          &file_set,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_set",
+	 file_set );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_file_set_open(
+	          NULL,
+	          filenames,
+	          1,
+	          LIBEVT_OPEN_READ,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_set_open(
+	          file_set,
+	          NULL,
+	          1,
+	          LIBEVT_OPEN_READ,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_set_open(
+	          file_set,
+	          filenames,
+	          0,
+	          LIBEVT_OPEN_READ,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_file_set_free(
+	          &file_set,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "file_set",
+	 file_set );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_set != NULL )
+	{
+		libevt_file_set_free(
+		 &file_set,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	system_character_t *source = NULL;
+	system_integer_t option    = 0;
+
+	while( ( option = evt_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+	EVT_TEST_RUN(
+	 "libevt_file_set_initialize",
+	 evt_test_file_set_initialize );
+
+	EVT_TEST_RUN(
+	 "libevt_file_set_free",
+	 evt_test_file_set_free );
+
+	EVT_TEST_RUN(
+	 "libevt_file_set_open",
+	 evt_test_file_set_open );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		EVT_TEST_RUN_WITH_ARGS(
+		 "libevt_file_set_get_next_record",
+		 evt_test_file_set_open_get_next_record,
+		 source );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
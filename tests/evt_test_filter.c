@@ -0,0 +1,1071 @@
+/*
+ * Library filter type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evt_test_libcerror.h"
+#include "evt_test_libevt.h"
+#include "evt_test_macros.h"
+#include "evt_test_memory.h"
+#include "evt_test_unused.h"
+
+#include "../libevt/libevt_filter.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
+
+/* Tests the libevt_filter_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_filter_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libevt_filter_t *filter         = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevt_filter_initialize(
+	          &filter,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "filter",
+	 filter );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_filter_free(
+	          &filter,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "filter",
+	 filter );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_filter_initialize(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	filter = (libevt_filter_t *) 0x12345678UL;
+
+	result = libevt_filter_initialize(
+	          &filter,
+	          &error );
+
+	filter = NULL;
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevt_filter_initialize with malloc failing
+		 */
+		evt_test_malloc_attempts_before_fail = test_number;
+
+		result = libevt_filter_initialize(
+		          &filter,
+		          &error );
+
+		if( evt_test_malloc_attempts_before_fail != -1 )
+		{
+			evt_test_malloc_attempts_before_fail = -1;
+
+			if( filter != NULL )
+			{
+				libevt_filter_free(
+				 &filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "filter",
+			 filter );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevt_filter_initialize with memset failing
+		 */
+		evt_test_memset_attempts_before_fail = test_number;
+
+		result = libevt_filter_initialize(
+		          &filter,
+		          &error );
+
+		if( evt_test_memset_attempts_before_fail != -1 )
+		{
+			evt_test_memset_attempts_before_fail = -1;
+
+			if( filter != NULL )
+			{
+				libevt_filter_free(
+				 &filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "filter",
+			 filter );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filter != NULL )
+	{
+		libevt_filter_free(
+		 &filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_filter_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_filter_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevt_filter_free(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_filter_add_event_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_filter_add_event_identifier(
+     void )
+{
+	libcerror_error_t *error                  = NULL;
+	libevt_filter_t *filter                   = NULL;
+	libevt_internal_filter_t *internal_filter = NULL;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_filter_initialize(
+	          &filter,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "filter",
+	 filter );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_filter = (libevt_internal_filter_t *) filter;
+
+	/* Test regular cases
+	 */
+	result = libevt_filter_add_event_identifier(
+	          filter,
+	          4624,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_filter_add_event_identifier(
+	          filter,
+	          528,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Adding a duplicate event identifier should not change the filter
+	 */
+	result = libevt_filter_add_event_identifier(
+	          filter,
+	          4624,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "internal_filter->number_of_event_identifiers",
+	 internal_filter->number_of_event_identifiers,
+	 2 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_filter->event_identifiers[ 0 ]",
+	 internal_filter->event_identifiers[ 0 ],
+	 (uint32_t) 528 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_filter->event_identifiers[ 1 ]",
+	 internal_filter->event_identifiers[ 1 ],
+	 (uint32_t) 4624 );
+
+	result = libevt_filter_has_event_identifier(
+	          internal_filter,
+	          528 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevt_filter_has_event_identifier(
+	          internal_filter,
+	          529 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libevt_filter_add_event_identifier(
+	          NULL,
+	          4624,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_filter_free(
+	          &filter,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "filter",
+	 filter );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filter != NULL )
+	{
+		libevt_filter_free(
+		 &filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_filter_set_time_range function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_filter_set_time_range(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libevt_filter_t *filter  = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_filter_initialize(
+	          &filter,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "filter",
+	 filter );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_filter_set_time_range(
+	          filter,
+	          1000,
+	          2000,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_filter_set_time_range(
+	          NULL,
+	          1000,
+	          2000,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_filter_set_time_range(
+	          filter,
+	          2000,
+	          1000,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_filter_free(
+	          &filter,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "filter",
+	 filter );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filter != NULL )
+	{
+		libevt_filter_free(
+		 &filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_filter_match_record_data function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_filter_match_record_data(
+     void )
+{
+	uint8_t record_data[ 80 ];
+
+	uint16_t other_name[ 6 ] = {
+		'S', 'y', 's', 't', 'e', 'm' };
+
+	uint16_t source_name[ 8 ] = {
+		'S', 'e', 'c', 'u', 'r', 'i', 't', 'y' };
+
+	libcerror_error_t *error = NULL;
+	libevt_filter_t *filter  = NULL;
+	size_t source_name_index = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 record_data,
+	 0,
+	 80 );
+
+	/* Event record with event identifier 0x40001210, event type 0x0008,
+	 * event category 12, last written time 1500 and source name "SECURITY"
+	 */
+	record_data[ 16 ] = 0xdc;
+	record_data[ 17 ] = 0x05;
+	record_data[ 20 ] = 0x10;
+	record_data[ 21 ] = 0x12;
+	record_data[ 23 ] = 0x40;
+	record_data[ 24 ] = 0x08;
+	record_data[ 28 ] = 0x0c;
+
+	for( source_name_index = 0;
+	     source_name_index < 8;
+	     source_name_index++ )
+	{
+		record_data[ 56 + ( source_name_index * 2 ) ] = (uint8_t) "SECURITY"[ source_name_index ];
+	}
+	result = libevt_filter_initialize(
+	          &filter,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "filter",
+	 filter );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_filter_match_record_data(
+	          (libevt_internal_filter_t *) filter,
+	          record_data,
+	          80,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test matching on the event code, the lower 16 bits of the event identifier
+	 */
+	result = libevt_filter_add_event_identifier(
+	          filter,
+	          0x1210,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevt_filter_set_event_types(
+	          filter,
+	          0x0018,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevt_filter_set_event_category(
+	          filter,
+	          12,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevt_filter_set_time_range(
+	          filter,
+	          1000,
+	          2000,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevt_filter_set_utf16_source_name(
+	          filter,
+	          source_name,
+	          8,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_filter_match_record_data(
+	          (libevt_internal_filter_t *) filter,
+	          record_data,
+	          80,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a record that is too small to contain the source name
+	 */
+	result = libevt_filter_match_record_data(
+	          (libevt_internal_filter_t *) filter,
+	          record_data,
+	          64,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a record that has a different source name
+	 */
+	result = libevt_filter_set_utf16_source_name(
+	          filter,
+	          other_name,
+	          6,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevt_filter_match_record_data(
+	          (libevt_internal_filter_t *) filter,
+	          record_data,
+	          80,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_filter_set_utf16_source_name(
+	          filter,
+	          source_name,
+	          8,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test a record that is outside the time range
+	 */
+	result = libevt_filter_set_time_range(
+	          filter,
+	          1501,
+	          2000,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevt_filter_match_record_data(
+	          (libevt_internal_filter_t *) filter,
+	          record_data,
+	          80,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_filter_set_time_range(
+	          filter,
+	          1000,
+	          2000,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test a record that has a different event category
+	 */
+	result = libevt_filter_set_event_category(
+	          filter,
+	          13,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevt_filter_match_record_data(
+	          (libevt_internal_filter_t *) filter,
+	          record_data,
+	          80,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_filter_set_event_category(
+	          filter,
+	          12,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test a record that has a different event type
+	 */
+	result = libevt_filter_set_event_types(
+	          filter,
+	          0x0003,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevt_filter_match_record_data(
+	          (libevt_internal_filter_t *) filter,
+	          record_data,
+	          80,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a record that has the success event type, which is 0
+	 */
+	record_data[ 24 ] = 0x00;
+
+	result = libevt_filter_match_record_data(
+	          (libevt_internal_filter_t *) filter,
+	          record_data,
+	          80,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_filter_set_event_types(
+	          filter,
+	          LIBEVT_EVENT_TYPE_SUCCESS | LIBEVT_EVENT_TYPE_AUDIT_SUCCESS,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevt_filter_match_record_data(
+	          (libevt_internal_filter_t *) filter,
+	          record_data,
+	          80,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	record_data[ 24 ] = 0x08;
+
+	result = libevt_filter_match_record_data(
+	          (libevt_internal_filter_t *) filter,
+	          record_data,
+	          80,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a record that is too small to be an event record
+	 */
+	result = libevt_filter_match_record_data(
+	          (libevt_internal_filter_t *) filter,
+	          record_data,
+	          48,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_filter_match_record_data(
+	          NULL,
+	          record_data,
+	          80,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_filter_match_record_data(
+	          (libevt_internal_filter_t *) filter,
+	          NULL,
+	          80,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_filter_free(
+	          &filter,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "filter",
+	 filter );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filter != NULL )
+	{
+		libevt_filter_free(
+		 &filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVT_TEST_UNREFERENCED_PARAMETER( argc )
+	EVT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
+
+	EVT_TEST_RUN(
+	 "libevt_filter_initialize",
+	 evt_test_filter_initialize );
+
+	EVT_TEST_RUN(
+	 "libevt_filter_free",
+	 evt_test_filter_free );
+
+	EVT_TEST_RUN(
+	 "libevt_filter_add_event_identifier",
+	 evt_test_filter_add_event_identifier );
+
+	/* TODO: add tests for libevt_filter_set_utf8_source_name */
+
+	EVT_TEST_RUN(
+	 "libevt_filter_set_time_range",
+	 evt_test_filter_set_time_range );
+
+	EVT_TEST_RUN(
+	 "libevt_filter_match_record_data",
+	 evt_test_filter_match_record_data );
+
+	/* TODO: add tests for libevt_filter_match_record */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,609 @@
+/*
+ * Library identifier_map type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evt_test_libcerror.h"
+#include "evt_test_libevt.h"
+#include "evt_test_macros.h"
+#include "evt_test_memory.h"
+#include "evt_test_unused.h"
+
+#include "../libevt/libevt_identifier_map.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
+
+/* Tests the libevt_identifier_map_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_identifier_map_initialize(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libevt_identifier_map_t *identifier_map = NULL;
+	int result                              = 0;
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+	int number_of_malloc_fail_tests         = 1;
+	int number_of_memset_fail_tests         = 1;
+	int test_number                         = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevt_identifier_map_initialize(
+	          &identifier_map,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "identifier_map",
+	 identifier_map );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_identifier_map_free(
+	          &identifier_map,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "identifier_map",
+	 identifier_map );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_identifier_map_initialize(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	identifier_map = (libevt_identifier_map_t *) 0x12345678UL;
+
+	result = libevt_identifier_map_initialize(
+	          &identifier_map,
+	          &error );
+
+	identifier_map = NULL;
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevt_identifier_map_initialize with malloc failing
+		 */
+		evt_test_malloc_attempts_before_fail = test_number;
+
+		result = libevt_identifier_map_initialize(
+		          &identifier_map,
+		          &error );
+
+		if( evt_test_malloc_attempts_before_fail != -1 )
+		{
+			evt_test_malloc_attempts_before_fail = -1;
+
+			if( identifier_map != NULL )
+			{
+				libevt_identifier_map_free(
+				 &identifier_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "identifier_map",
+			 identifier_map );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevt_identifier_map_initialize with memset failing
+		 */
+		evt_test_memset_attempts_before_fail = test_number;
+
+		result = libevt_identifier_map_initialize(
+		          &identifier_map,
+		          &error );
+
+		if( evt_test_memset_attempts_before_fail != -1 )
+		{
+			evt_test_memset_attempts_before_fail = -1;
+
+			if( identifier_map != NULL )
+			{
+				libevt_identifier_map_free(
+				 &identifier_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "identifier_map",
+			 identifier_map );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( identifier_map != NULL )
+	{
+		libevt_identifier_map_free(
+		 &identifier_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_identifier_map_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_identifier_map_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevt_identifier_map_free(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_identifier_map_entry_compare function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_identifier_map_entry_compare(
+     void )
+{
+	libevt_identifier_map_entry_t first_entry;
+	libevt_identifier_map_entry_t second_entry;
+
+	int result = 0;
+
+	first_entry.identifier          = 5;
+	first_entry.records_list_index  = 0;
+	first_entry.record_index        = 3;
+	second_entry.identifier         = 5;
+	second_entry.records_list_index = 0;
+	second_entry.record_index       = 3;
+
+	/* Test regular cases
+	 */
+	result = libevt_identifier_map_entry_compare(
+	          &first_entry,
+	          &second_entry );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	second_entry.records_list_index = 1;
+
+	result = libevt_identifier_map_entry_compare(
+	          &first_entry,
+	          &second_entry );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	second_entry.identifier = 4;
+
+	result = libevt_identifier_map_entry_compare(
+	          &first_entry,
+	          &second_entry );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libevt_identifier_map_get_record_index_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_identifier_map_get_record_index_by_identifier(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libevt_identifier_map_t *identifier_map = NULL;
+	int record_index                        = 0;
+	int records_list_index                  = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_identifier_map_initialize(
+	          &identifier_map,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "identifier_map",
+	 identifier_map );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	identifier_map->entries = (libevt_identifier_map_entry_t *) memory_allocate(
+	                                                             sizeof( libevt_identifier_map_entry_t ) * 4 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "identifier_map->entries",
+	 identifier_map->entries );
+
+	identifier_map->entries[ 0 ].identifier         = 1;
+	identifier_map->entries[ 0 ].records_list_index = 0;
+	identifier_map->entries[ 0 ].record_index       = 0;
+	identifier_map->entries[ 1 ].identifier         = 2;
+	identifier_map->entries[ 1 ].records_list_index = 0;
+	identifier_map->entries[ 1 ].record_index       = 1;
+	identifier_map->entries[ 2 ].identifier         = 2;
+	identifier_map->entries[ 2 ].records_list_index = 1;
+	identifier_map->entries[ 2 ].record_index       = 0;
+	identifier_map->entries[ 3 ].identifier         = 7;
+	identifier_map->entries[ 3 ].records_list_index = 1;
+	identifier_map->entries[ 3 ].record_index       = 1;
+
+	identifier_map->number_of_entries = 4;
+
+	/* Test regular cases
+	 */
+	result = libevt_identifier_map_get_record_index_by_identifier(
+	          identifier_map,
+	          2,
+	          &records_list_index,
+	          &record_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "records_list_index",
+	 records_list_index,
+	 0 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "record_index",
+	 record_index,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_identifier_map_get_record_index_by_identifier(
+	          identifier_map,
+	          7,
+	          &records_list_index,
+	          &record_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "records_list_index",
+	 records_list_index,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "record_index",
+	 record_index,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_identifier_map_get_record_index_by_identifier(
+	          identifier_map,
+	          3,
+	          &records_list_index,
+	          &record_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_identifier_map_get_record_index_by_identifier(
+	          identifier_map,
+	          8,
+	          &records_list_index,
+	          &record_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_identifier_map_get_record_index_by_identifier(
+	          NULL,
+	          2,
+	          &records_list_index,
+	          &record_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_identifier_map_get_record_index_by_identifier(
+	          identifier_map,
+	          2,
+	          NULL,
+	          &record_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_identifier_map_get_record_index_by_identifier(
+	          identifier_map,
+	          2,
+	          &records_list_index,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_identifier_map_free(
+	          &identifier_map,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "identifier_map",
+	 identifier_map );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( identifier_map != NULL )
+	{
+		libevt_identifier_map_free(
+		 &identifier_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVT_TEST_UNREFERENCED_PARAMETER( argc )
+	EVT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
+
+	EVT_TEST_RUN(
+	 "libevt_identifier_map_initialize",
+	 evt_test_identifier_map_initialize );
+
+	EVT_TEST_RUN(
+	 "libevt_identifier_map_free",
+	 evt_test_identifier_map_free );
+
+	EVT_TEST_RUN(
+	 "libevt_identifier_map_entry_compare",
+	 evt_test_identifier_map_entry_compare );
+
+	/* TODO: add tests for libevt_identifier_map_read_records */
+
+	EVT_TEST_RUN(
+	 "libevt_identifier_map_get_record_index_by_identifier",
+	 evt_test_identifier_map_get_record_index_by_identifier );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
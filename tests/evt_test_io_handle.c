@@ -27,6 +27,8 @@
 #include <stdlib.h>
 #endif
 
+#include "evt_test_functions.h"
+#include "evt_test_libbfio.h"
 #include "evt_test_libcerror.h"
 #include "evt_test_libevt.h"
 #include "evt_test_macros.h"
@@ -34,6 +36,23 @@
 #include "evt_test_unused.h"
 
 #include "../libevt/libevt_io_handle.h"
+#include "../libevt/libevt_record_values.h"
+
+uint8_t evt_test_io_handle_data1[ 88 ] = {
+	0x30, 0x00, 0x00, 0x00, 0x4c, 0x66, 0x4c, 0x65, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+	0x28, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33,
+	0x44, 0x44, 0x44, 0x44, 0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00 };
+
+uint8_t evt_test_io_handle_data2[ 88 ] = {
+	0x30, 0x00, 0x00, 0x00, 0x4c, 0x66, 0x4c, 0x65, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x44, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+	0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
+	0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33 };
 
 #if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
 
@@ -398,6 +417,389 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libevt_io_handle_read_record_size function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_io_handle_read_record_size(
+     void )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libevt_io_handle_t *io_handle    = NULL;
+	off64_t file_offset              = 0;
+	uint32_t record_size             = 0;
+	uint8_t has_wrapped              = 0;
+	uint8_t record_type              = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->file_size = 88;
+
+	result = evt_test_open_file_io_handle(
+	          &file_io_handle,
+	          evt_test_io_handle_data1,
+	          88,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	file_offset = 48;
+
+	result = libevt_io_handle_read_record_size(
+	          io_handle,
+	          file_io_handle,
+	          &file_offset,
+	          &has_wrapped,
+	          &record_size,
+	          &record_type,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT64(
+	 "file_offset",
+	 (int64_t) file_offset,
+	 (int64_t) 88 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "record_size",
+	 record_size,
+	 (uint32_t) 40 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT8(
+	 "record_type",
+	 record_type,
+	 (uint8_t) LIBEVT_RECORD_TYPE_END_OF_FILE );
+
+	EVT_TEST_ASSERT_EQUAL_UINT8(
+	 "has_wrapped",
+	 has_wrapped,
+	 (uint8_t) 0 );
+
+	/* Test error cases
+	 */
+	file_offset = 48;
+
+	result = libevt_io_handle_read_record_size(
+	          NULL,
+	          file_io_handle,
+	          &file_offset,
+	          &has_wrapped,
+	          &record_size,
+	          &record_type,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_io_handle_read_record_size(
+	          io_handle,
+	          file_io_handle,
+	          NULL,
+	          &has_wrapped,
+	          &record_size,
+	          &record_type,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_io_handle_read_record_size(
+	          io_handle,
+	          file_io_handle,
+	          &file_offset,
+	          NULL,
+	          &record_size,
+	          &record_type,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_io_handle_read_record_size(
+	          io_handle,
+	          file_io_handle,
+	          &file_offset,
+	          &has_wrapped,
+	          NULL,
+	          &record_type,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_io_handle_read_record_size(
+	          io_handle,
+	          file_io_handle,
+	          &file_offset,
+	          &has_wrapped,
+	          &record_size,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test invalid signature
+	 */
+	file_offset = 52;
+
+	result = libevt_io_handle_read_record_size(
+	          io_handle,
+	          file_io_handle,
+	          &file_offset,
+	          &has_wrapped,
+	          &record_size,
+	          &record_type,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up file IO handle
+	 */
+	result = evt_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test record data that wraps around to the end of the file header
+	 */
+	result = evt_test_open_file_io_handle(
+	          &file_io_handle,
+	          evt_test_io_handle_data2,
+	          88,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_offset = 68;
+	has_wrapped = 0;
+
+	result = libevt_io_handle_read_record_size(
+	          io_handle,
+	          file_io_handle,
+	          &file_offset,
+	          &has_wrapped,
+	          &record_size,
+	          &record_type,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT64(
+	 "file_offset",
+	 (int64_t) file_offset,
+	 (int64_t) 68 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "record_size",
+	 record_size,
+	 (uint32_t) 40 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT8(
+	 "has_wrapped",
+	 has_wrapped,
+	 (uint8_t) 1 );
+
+	/* Test record data that wraps around a second time
+	 */
+	file_offset = 68;
+
+	result = libevt_io_handle_read_record_size(
+	          io_handle,
+	          file_io_handle,
+	          &file_offset,
+	          &has_wrapped,
+	          &record_size,
+	          &record_type,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = evt_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libevt_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
 
 /* The main program
@@ -429,6 +831,12 @@ int main(
 	 "libevt_io_handle_clear",
 	 evt_test_io_handle_clear );
 
+	/* TODO: add tests for libevt_io_handle_read_record_data */
+
+	EVT_TEST_RUN(
+	 "libevt_io_handle_read_record_size",
+	 evt_test_io_handle_read_record_size );
+
 	/* TODO: add tests for libevt_io_handle_read_records */
 
 	/* TODO: add tests for libevt_io_handle_end_of_file_record_scan */
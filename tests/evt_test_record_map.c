@@ -0,0 +1,810 @@
+/*
+ * Library record_map type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evt_test_libcerror.h"
+#include "evt_test_libevt.h"
+#include "evt_test_macros.h"
+#include "evt_test_memory.h"
+#include "evt_test_unused.h"
+
+#include "../libevt/libevt_record_map.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
+
+/* Tests the libevt_record_map_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_record_map_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libevt_record_map_t *record_map = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevt_record_map_initialize(
+	          &record_map,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "record_map",
+	 record_map );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_map_free(
+	          &record_map,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record_map",
+	 record_map );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_record_map_initialize(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record_map = (libevt_record_map_t *) 0x12345678UL;
+
+	result = libevt_record_map_initialize(
+	          &record_map,
+	          &error );
+
+	record_map = NULL;
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevt_record_map_initialize with malloc failing
+		 */
+		evt_test_malloc_attempts_before_fail = test_number;
+
+		result = libevt_record_map_initialize(
+		          &record_map,
+		          &error );
+
+		if( evt_test_malloc_attempts_before_fail != -1 )
+		{
+			evt_test_malloc_attempts_before_fail = -1;
+
+			if( record_map != NULL )
+			{
+				libevt_record_map_free(
+				 &record_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "record_map",
+			 record_map );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevt_record_map_initialize with memset failing
+		 */
+		evt_test_memset_attempts_before_fail = test_number;
+
+		result = libevt_record_map_initialize(
+		          &record_map,
+		          &error );
+
+		if( evt_test_memset_attempts_before_fail != -1 )
+		{
+			evt_test_memset_attempts_before_fail = -1;
+
+			if( record_map != NULL )
+			{
+				libevt_record_map_free(
+				 &record_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "record_map",
+			 record_map );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_map != NULL )
+	{
+		libevt_record_map_free(
+		 &record_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_record_map_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_record_map_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevt_record_map_free(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_record_map_append_record function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_record_map_append_record(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libevt_record_map_t *record_map = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_record_map_initialize(
+	          &record_map,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "record_map",
+	 record_map );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_record_map_append_record(
+	          record_map,
+	          600,
+	          200,
+	          1024,
+	          5,
+	          100,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "record_map->number_of_ranges",
+	 record_map->number_of_ranges,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "record_map->number_of_keys",
+	 record_map->number_of_keys,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT8(
+	 "record_map->is_sorted",
+	 record_map->is_sorted,
+	 1 );
+
+	/* Test a record that wraps at the end of the file
+	 */
+	result = libevt_record_map_append_record(
+	          record_map,
+	          1000,
+	          100,
+	          1024,
+	          6,
+	          110,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "record_map->number_of_ranges",
+	 record_map->number_of_ranges,
+	 3 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "record_map->number_of_keys",
+	 record_map->number_of_keys,
+	 2 );
+
+	EVT_TEST_ASSERT_EQUAL_INT64(
+	 "record_map->ranges[ 2 ].start_offset",
+	 (int64_t) record_map->ranges[ 2 ].start_offset,
+	 (int64_t) 48 );
+
+	EVT_TEST_ASSERT_EQUAL_INT64(
+	 "record_map->ranges[ 2 ].end_offset",
+	 (int64_t) record_map->ranges[ 2 ].end_offset,
+	 (int64_t) 124 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT8(
+	 "record_map->is_sorted",
+	 record_map->is_sorted,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libevt_record_map_append_record(
+	          NULL,
+	          600,
+	          200,
+	          1024,
+	          5,
+	          100,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_record_map_append_record(
+	          record_map,
+	          16,
+	          200,
+	          1024,
+	          5,
+	          100,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_record_map_append_record(
+	          record_map,
+	          600,
+	          0,
+	          1024,
+	          5,
+	          100,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_record_map_free(
+	          &record_map,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record_map",
+	 record_map );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_map != NULL )
+	{
+		libevt_record_map_free(
+		 &record_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_record_map_check_record function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_record_map_check_record(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libevt_record_map_t *record_map = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_record_map_initialize(
+	          &record_map,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "record_map",
+	 record_map );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_map_append_record(
+	          record_map,
+	          600,
+	          200,
+	          1024,
+	          5,
+	          100,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_map_append_record(
+	          record_map,
+	          800,
+	          200,
+	          1024,
+	          6,
+	          110,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_map_append_record(
+	          record_map,
+	          1000,
+	          100,
+	          1024,
+	          7,
+	          120,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_record_map_check_record(
+	          record_map,
+	          124,
+	          100,
+	          1024,
+	          1,
+	          50,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a record that overlaps with a record
+	 */
+	result = libevt_record_map_check_record(
+	          record_map,
+	          500,
+	          120,
+	          1024,
+	          2,
+	          60,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a record that overlaps with the wrapped part of a record
+	 */
+	result = libevt_record_map_check_record(
+	          record_map,
+	          100,
+	          40,
+	          1024,
+	          3,
+	          70,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a record that duplicates a record
+	 */
+	result = libevt_record_map_check_record(
+	          record_map,
+	          300,
+	          100,
+	          1024,
+	          6,
+	          110,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a record with the same record number but a different creation time
+	 */
+	result = libevt_record_map_check_record(
+	          record_map,
+	          300,
+	          100,
+	          1024,
+	          6,
+	          999,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_record_map_check_record(
+	          NULL,
+	          300,
+	          100,
+	          1024,
+	          6,
+	          110,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_record_map_check_record(
+	          record_map,
+	          1024,
+	          100,
+	          1024,
+	          6,
+	          110,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_record_map_check_record(
+	          record_map,
+	          300,
+	          2048,
+	          1024,
+	          6,
+	          110,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_record_map_free(
+	          &record_map,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record_map",
+	 record_map );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_map != NULL )
+	{
+		libevt_record_map_free(
+		 &record_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVT_TEST_UNREFERENCED_PARAMETER( argc )
+	EVT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
+
+	EVT_TEST_RUN(
+	 "libevt_record_map_initialize",
+	 evt_test_record_map_initialize );
+
+	EVT_TEST_RUN(
+	 "libevt_record_map_free",
+	 evt_test_record_map_free );
+
+	EVT_TEST_RUN(
+	 "libevt_record_map_append_record",
+	 evt_test_record_map_append_record );
+
+	EVT_TEST_RUN(
+	 "libevt_record_map_check_record",
+	 evt_test_record_map_check_record );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -35,6 +35,11 @@
 
 #include "../libevt/libevt_record_values.h"
 
+uint8_t evt_test_record_values_data1[ 40 ] = {
+	0x28, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33,
+	0x44, 0x44, 0x44, 0x44, 0x30, 0x00, 0x00, 0x00, 0xe0, 0xea, 0x02, 0x00, 0x83, 0x03, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00 };
+
 #if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
 
 /* Tests the libevt_record_values_initialize function
@@ -380,6 +385,189 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libevt_record_values_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_record_values_read_data(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libevt_record_values_t *record_values = NULL;
+	uint8_t type                          = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_record_values_read_data(
+	          record_values,
+	          evt_test_record_values_data1,
+	          40,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_values_get_type(
+	          record_values,
+	          &type,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT8(
+	 "type",
+	 type,
+	 (uint8_t) LIBEVT_RECORD_TYPE_END_OF_FILE );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_record_values_read_data(
+	          NULL,
+	          evt_test_record_values_data1,
+	          40,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_record_values_read_data(
+	          record_values,
+	          NULL,
+	          40,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_record_values_read_data(
+	          record_values,
+	          evt_test_record_values_data1,
+	          4,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the signature is not supported
+	 */
+	result = libevt_record_values_read_data(
+	          record_values,
+	          &( evt_test_record_values_data1[ 4 ] ),
+	          36,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevt_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libevt_record_values_get_type function
  * Returns 1 if successful or 0 if not
  */
@@ -534,6 +722,10 @@ int main(
 	 "libevt_record_values_read_file_io_handle",
 	 evt_test_record_values_read_file_io_handle );
 
+	EVT_TEST_RUN(
+	 "libevt_record_values_read_data",
+	 evt_test_record_values_read_data );
+
 	/* TODO: add tests for libevt_record_values_read_event */
 
 	/* TODO: add tests for libevt_record_values_read_end_of_file */
@@ -0,0 +1,829 @@
+/*
+ * Library signature_scanner type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evt_test_libcerror.h"
+#include "evt_test_libevt.h"
+#include "evt_test_macros.h"
+#include "evt_test_memory.h"
+#include "evt_test_unused.h"
+
+#include "../libevt/libevt_signature_scanner.h"
+
+uint8_t evt_test_signature_scanner_data1[ 68 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x66, 0x4c, 0x65, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x11, 0x11, 0x11, 0x11 };
+
+uint8_t evt_test_signature_scanner_signature1[ 4 ] = {
+	'L', 'f', 'L', 'e' };
+
+uint8_t evt_test_signature_scanner_signature2[ 4 ] = {
+	0x11, 0x11, 0x11, 0x11 };
+
+#if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
+
+/* Tests the libevt_signature_scanner_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_signature_scanner_initialize(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libevt_signature_scanner_t *signature_scanner = NULL;
+	int result                                    = 0;
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+	int number_of_malloc_fail_tests               = 1;
+	int number_of_memset_fail_tests               = 1;
+	int test_number                               = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevt_signature_scanner_initialize(
+	          &signature_scanner,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "signature_scanner",
+	 signature_scanner );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_signature_scanner_free(
+	          &signature_scanner,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "signature_scanner",
+	 signature_scanner );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_signature_scanner_initialize(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	signature_scanner = (libevt_signature_scanner_t *) 0x12345678UL;
+
+	result = libevt_signature_scanner_initialize(
+	          &signature_scanner,
+	          &error );
+
+	signature_scanner = NULL;
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevt_signature_scanner_initialize with malloc failing
+		 */
+		evt_test_malloc_attempts_before_fail = test_number;
+
+		result = libevt_signature_scanner_initialize(
+		          &signature_scanner,
+		          &error );
+
+		if( evt_test_malloc_attempts_before_fail != -1 )
+		{
+			evt_test_malloc_attempts_before_fail = -1;
+
+			if( signature_scanner != NULL )
+			{
+				libevt_signature_scanner_free(
+				 &signature_scanner,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "signature_scanner",
+			 signature_scanner );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevt_signature_scanner_initialize with memset failing
+		 */
+		evt_test_memset_attempts_before_fail = test_number;
+
+		result = libevt_signature_scanner_initialize(
+		          &signature_scanner,
+		          &error );
+
+		if( evt_test_memset_attempts_before_fail != -1 )
+		{
+			evt_test_memset_attempts_before_fail = -1;
+
+			if( signature_scanner != NULL )
+			{
+				libevt_signature_scanner_free(
+				 &signature_scanner,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "signature_scanner",
+			 signature_scanner );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( signature_scanner != NULL )
+	{
+		libevt_signature_scanner_free(
+		 &signature_scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_signature_scanner_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_signature_scanner_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevt_signature_scanner_free(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_signature_scanner_add_signature function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_signature_scanner_add_signature(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libevt_signature_scanner_t *signature_scanner = NULL;
+	int result                                    = 0;
+	int signature_index                           = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_signature_scanner_initialize(
+	          &signature_scanner,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "signature_scanner",
+	 signature_scanner );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_signature_scanner_add_signature(
+	          signature_scanner,
+	          evt_test_signature_scanner_signature1,
+	          4,
+	          &signature_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "signature_index",
+	 signature_index,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_signature_scanner_add_signature(
+	          signature_scanner,
+	          evt_test_signature_scanner_signature2,
+	          4,
+	          &signature_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "signature_index",
+	 signature_index,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_signature_scanner_add_signature(
+	          NULL,
+	          evt_test_signature_scanner_signature1,
+	          4,
+	          &signature_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_signature_scanner_add_signature(
+	          signature_scanner,
+	          NULL,
+	          4,
+	          &signature_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_signature_scanner_add_signature(
+	          signature_scanner,
+	          evt_test_signature_scanner_signature1,
+	          3,
+	          &signature_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_signature_scanner_add_signature(
+	          signature_scanner,
+	          evt_test_signature_scanner_signature1,
+	          4,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_signature_scanner_free(
+	          &signature_scanner,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "signature_scanner",
+	 signature_scanner );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( signature_scanner != NULL )
+	{
+		libevt_signature_scanner_free(
+		 &signature_scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_signature_scanner_scan_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_signature_scanner_scan_buffer(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libevt_signature_scanner_t *signature_scanner = NULL;
+	size_t buffer_offset                          = 0;
+	int result                                    = 0;
+	int signature_index                           = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_signature_scanner_initialize(
+	          &signature_scanner,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "signature_scanner",
+	 signature_scanner );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_signature_scanner_add_signature(
+	          signature_scanner,
+	          evt_test_signature_scanner_signature1,
+	          4,
+	          &signature_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_signature_scanner_add_signature(
+	          signature_scanner,
+	          evt_test_signature_scanner_signature2,
+	          4,
+	          &signature_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	buffer_offset = 0;
+
+	result = libevt_signature_scanner_scan_buffer(
+	          signature_scanner,
+	          evt_test_signature_scanner_data1,
+	          68,
+	          &buffer_offset,
+	          &signature_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer_offset",
+	 buffer_offset,
+	 (size_t) 40 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "signature_index",
+	 signature_index,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	buffer_offset = 44;
+
+	result = libevt_signature_scanner_scan_buffer(
+	          signature_scanner,
+	          evt_test_signature_scanner_data1,
+	          68,
+	          &buffer_offset,
+	          &signature_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer_offset",
+	 buffer_offset,
+	 (size_t) 64 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "signature_index",
+	 signature_index,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Only the offsets aligned relative to the initial offset are scanned
+	 */
+	buffer_offset = 2;
+
+	result = libevt_signature_scanner_scan_buffer(
+	          signature_scanner,
+	          evt_test_signature_scanner_data1,
+	          68,
+	          &buffer_offset,
+	          &signature_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer_offset",
+	 buffer_offset,
+	 (size_t) 66 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	buffer_offset = 0;
+
+	result = libevt_signature_scanner_scan_buffer(
+	          signature_scanner,
+	          evt_test_signature_scanner_data1,
+	          40,
+	          &buffer_offset,
+	          &signature_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer_offset",
+	 buffer_offset,
+	 (size_t) 40 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	buffer_offset = 0;
+
+	result = libevt_signature_scanner_scan_buffer(
+	          NULL,
+	          evt_test_signature_scanner_data1,
+	          68,
+	          &buffer_offset,
+	          &signature_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_signature_scanner_scan_buffer(
+	          signature_scanner,
+	          NULL,
+	          68,
+	          &buffer_offset,
+	          &signature_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_signature_scanner_scan_buffer(
+	          signature_scanner,
+	          evt_test_signature_scanner_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &buffer_offset,
+	          &signature_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_signature_scanner_scan_buffer(
+	          signature_scanner,
+	          evt_test_signature_scanner_data1,
+	          68,
+	          NULL,
+	          &signature_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_signature_scanner_scan_buffer(
+	          signature_scanner,
+	          evt_test_signature_scanner_data1,
+	          68,
+	          &buffer_offset,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_signature_scanner_free(
+	          &signature_scanner,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "signature_scanner",
+	 signature_scanner );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( signature_scanner != NULL )
+	{
+		libevt_signature_scanner_free(
+		 &signature_scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVT_TEST_UNREFERENCED_PARAMETER( argc )
+	EVT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
+
+	EVT_TEST_RUN(
+	 "libevt_signature_scanner_initialize",
+	 evt_test_signature_scanner_initialize );
+
+	EVT_TEST_RUN(
+	 "libevt_signature_scanner_free",
+	 evt_test_signature_scanner_free );
+
+	EVT_TEST_RUN(
+	 "libevt_signature_scanner_add_signature",
+	 evt_test_signature_scanner_add_signature );
+
+	EVT_TEST_RUN(
+	 "libevt_signature_scanner_scan_buffer",
+	 evt_test_signature_scanner_scan_buffer );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1172 @@
+/*
+ * Library stream type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evt_test_libcerror.h"
+#include "evt_test_libevt.h"
+#include "evt_test_macros.h"
+#include "evt_test_memory.h"
+#include "evt_test_unused.h"
+
+#include "../libevt/libevt_record.h"
+#include "../libevt/libevt_stream.h"
+
+uint8_t evt_test_stream_file_header_data1[ 48 ] = {
+	0x30, 0x00, 0x00, 0x00, 0x4c, 0x66, 0x4c, 0x65, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x30, 0x00, 0x00, 0x00, 0x38, 0xe5, 0x0a, 0x00, 0x1b, 0x0f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0b, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00 };
+
+uint8_t evt_test_stream_event_record_data1[ 144 ] = {
+	0x90, 0x00, 0x00, 0x00, 0x4c, 0x66, 0x4c, 0x65, 0x01, 0x00, 0x00, 0x00, 0x79, 0x42, 0xdb, 0x4c,
+	0x79, 0x42, 0xdb, 0x4c, 0xe8, 0x03, 0x00, 0x40, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x6f, 0x00, 0x61, 0x00, 0x64, 0x00,
+	0x50, 0x00, 0x65, 0x00, 0x72, 0x00, 0x66, 0x00, 0x00, 0x00, 0x57, 0x00, 0x4b, 0x00, 0x53, 0x00,
+	0x2d, 0x00, 0x57, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x58, 0x00, 0x50, 0x00, 0x33, 0x00, 0x32, 0x00,
+	0x42, 0x00, 0x49, 0x00, 0x54, 0x00, 0x00, 0x00, 0x52, 0x00, 0x53, 0x00, 0x56, 0x00, 0x50, 0x00,
+	0x00, 0x00, 0x51, 0x00, 0x6f, 0x00, 0x53, 0x00, 0x20, 0x00, 0x52, 0x00, 0x53, 0x00, 0x56, 0x00,
+	0x50, 0x00, 0x00, 0x00, 0x0c, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00 };
+
+uint8_t evt_test_stream_end_of_file_record_data1[ 40 ] = {
+	0x28, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33,
+	0x44, 0x44, 0x44, 0x44, 0x30, 0x00, 0x00, 0x00, 0xe0, 0xea, 0x02, 0x00, 0x83, 0x03, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
+
+/* The maximum number of bytes returned by a single call of the test read function
+ */
+#define EVT_TEST_STREAM_MAXIMUM_READ_SIZE	100
+
+typedef struct evt_test_stream_input evt_test_stream_input_t;
+
+struct evt_test_stream_input
+{
+	/* The data
+	 */
+	const uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The data offset
+	 */
+	size_t data_offset;
+};
+
+/* Reads data from the test input
+ * Returns the number of bytes read, 0 at the end of the input or -1 on error
+ */
+ssize_t evt_test_stream_read_input(
+         void *io_data,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error EVT_TEST_ATTRIBUTE_UNUSED )
+{
+	evt_test_stream_input_t *input = NULL;
+	size_t read_size               = 0;
+
+	EVT_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( ( io_data == NULL )
+	 || ( data == NULL ) )
+	{
+		return( -1 );
+	}
+	input = (evt_test_stream_input_t *) io_data;
+
+	read_size = input->data_size - input->data_offset;
+
+	if( read_size > data_size )
+	{
+		read_size = data_size;
+	}
+	/* Return the data in small parts to test partial reads
+	 */
+	if( read_size > EVT_TEST_STREAM_MAXIMUM_READ_SIZE )
+	{
+		read_size = EVT_TEST_STREAM_MAXIMUM_READ_SIZE;
+	}
+	if( memory_copy(
+	     data,
+	     &( input->data[ input->data_offset ] ),
+	     read_size ) == NULL )
+	{
+		return( -1 );
+	}
+	input->data_offset += read_size;
+
+	return( (ssize_t) read_size );
+}
+
+/* Builds a test EVT image of a header, 2 event records and an end of file record
+ * If wrapped is set the first (oldest) record is stored at the end of the image
+ * and the second record and the end of file record directly after the header
+ * Returns the image size
+ */
+size_t evt_test_stream_build_image(
+        uint8_t *image_data,
+        uint8_t wrapped )
+{
+	size_t first_record_offset       = 0;
+	size_t second_record_offset      = 0;
+	size_t end_of_file_record_offset = 0;
+
+	if( wrapped == 0 )
+	{
+		first_record_offset       = 48;
+		second_record_offset      = 48 + 144;
+		end_of_file_record_offset = 48 + 144 + 144;
+	}
+	else
+	{
+		second_record_offset      = 48;
+		end_of_file_record_offset = 48 + 144;
+		first_record_offset       = 48 + 144 + 40;
+	}
+	memory_copy(
+	 image_data,
+	 evt_test_stream_file_header_data1,
+	 48 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( image_data[ 16 ] ),
+	 (uint32_t) first_record_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( image_data[ 20 ] ),
+	 (uint32_t) end_of_file_record_offset );
+
+	memory_copy(
+	 &( image_data[ first_record_offset ] ),
+	 evt_test_stream_event_record_data1,
+	 144 );
+
+	memory_copy(
+	 &( image_data[ second_record_offset ] ),
+	 evt_test_stream_event_record_data1,
+	 144 );
+
+	/* Set the record number of the second record
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( image_data[ second_record_offset + 8 ] ),
+	 2 );
+
+	memory_copy(
+	 &( image_data[ end_of_file_record_offset ] ),
+	 evt_test_stream_end_of_file_record_data1,
+	 40 );
+
+	return( 48 + 144 + 144 + 40 );
+}
+
+/* Tests the libevt_stream_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_stream_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libevt_stream_t *stream         = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevt_stream_initialize(
+	          &stream,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_stream_free(
+	          &stream,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_stream_initialize(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	stream = (libevt_stream_t *) 0x12345678UL;
+
+	result = libevt_stream_initialize(
+	          &stream,
+	          &error );
+
+	stream = NULL;
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevt_stream_initialize with malloc failing
+		 */
+		evt_test_malloc_attempts_before_fail = test_number;
+
+		result = libevt_stream_initialize(
+		          &stream,
+		          &error );
+
+		if( evt_test_malloc_attempts_before_fail != -1 )
+		{
+			evt_test_malloc_attempts_before_fail = -1;
+
+			if( stream != NULL )
+			{
+				libevt_stream_free(
+				 &stream,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "stream",
+			 stream );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevt_stream_initialize with memset failing
+		 */
+		evt_test_memset_attempts_before_fail = test_number;
+
+		result = libevt_stream_initialize(
+		          &stream,
+		          &error );
+
+		if( evt_test_memset_attempts_before_fail != -1 )
+		{
+			evt_test_memset_attempts_before_fail = -1;
+
+			if( stream != NULL )
+			{
+				libevt_stream_free(
+				 &stream,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "stream",
+			 stream );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		libevt_stream_free(
+		 &stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_stream_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_stream_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevt_stream_free(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_stream_set_block_size function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_stream_set_block_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libevt_stream_t *stream  = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_stream_initialize(
+	          &stream,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_stream_set_block_size(
+	          stream,
+	          4096,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_SIZE(
+	 "block_size",
+	 ( (libevt_internal_stream_t *) stream )->block_size,
+	 (size_t) 4096 );
+
+	/* Test error cases
+	 */
+	result = libevt_stream_set_block_size(
+	          NULL,
+	          4096,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_stream_set_block_size(
+	          stream,
+	          4095,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_stream_free(
+	          &stream,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		libevt_stream_free(
+		 &stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_stream_open_read_function function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_stream_open_read_function(
+     void )
+{
+	uint8_t image_data[ 376 ];
+
+	evt_test_stream_input_t input;
+
+	libcerror_error_t *error = NULL;
+	libevt_stream_t *stream  = NULL;
+	size_t image_size        = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	image_size = evt_test_stream_build_image(
+	              image_data,
+	              0 );
+
+	input.data        = image_data;
+	input.data_size   = image_size;
+	input.data_offset = 0;
+
+	result = libevt_stream_initialize(
+	          &stream,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_stream_open_read_function(
+	          stream,
+	          &evt_test_stream_read_input,
+	          (void *) &input,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_stream_open_read_function(
+	          stream,
+	          &evt_test_stream_read_input,
+	          (void *) &input,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_stream_set_block_size(
+	          stream,
+	          4096,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_stream_close(
+	          stream,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_stream_open_read_function(
+	          NULL,
+	          &evt_test_stream_read_input,
+	          (void *) &input,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_stream_open_read_function(
+	          stream,
+	          NULL,
+	          (void *) &input,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open with a truncated file header
+	 */
+	input.data_size   = 32;
+	input.data_offset = 0;
+
+	result = libevt_stream_open_read_function(
+	          stream,
+	          &evt_test_stream_read_input,
+	          (void *) &input,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_stream_free(
+	          &stream,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		libevt_stream_free(
+		 &stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_stream_read_record function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_stream_read_record(
+     void )
+{
+	uint8_t image_data[ 376 ];
+
+	evt_test_stream_input_t input;
+
+	libcerror_error_t *error = NULL;
+	libevt_record_t *record  = NULL;
+	libevt_stream_t *stream  = NULL;
+	off64_t record_offset    = 0;
+	size_t image_size        = 0;
+	uint32_t identifier      = 0;
+	uint8_t wrapped          = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_stream_initialize(
+	          &stream,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( wrapped = 0;
+	     wrapped < 2;
+	     wrapped++ )
+	{
+		image_size = evt_test_stream_build_image(
+		              image_data,
+		              wrapped );
+
+		input.data        = image_data;
+		input.data_size   = image_size;
+		input.data_offset = 0;
+
+		result = libevt_stream_open_read_function(
+		          stream,
+		          &evt_test_stream_read_input,
+		          (void *) &input,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Read the first (oldest) record
+		 */
+		result = libevt_stream_read_record(
+		          stream,
+		          &record,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NOT_NULL(
+		 "record",
+		 record );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevt_record_get_offset(
+		          record,
+		          &record_offset,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_EQUAL_INT64(
+		 "record_offset",
+		 (int64_t) record_offset,
+		 (int64_t) ( ( wrapped == 0 ) ? 48 : 232 ) );
+
+		result = libevt_record_get_identifier(
+		          record,
+		          &identifier,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_EQUAL_UINT32(
+		 "identifier",
+		 identifier,
+		 1 );
+
+		result = libevt_record_free(
+		          &record,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		/* Read the second record
+		 */
+		result = libevt_stream_read_record(
+		          stream,
+		          &record,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NOT_NULL(
+		 "record",
+		 record );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevt_record_get_offset(
+		          record,
+		          &record_offset,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_EQUAL_INT64(
+		 "record_offset",
+		 (int64_t) record_offset,
+		 (int64_t) ( ( wrapped == 0 ) ? 192 : 48 ) );
+
+		result = libevt_record_get_identifier(
+		          record,
+		          &identifier,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_EQUAL_UINT32(
+		 "identifier",
+		 identifier,
+		 2 );
+
+		result = libevt_record_free(
+		          &record,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		/* The end of file record ends the records
+		 */
+		result = libevt_stream_read_record(
+		          stream,
+		          &record,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "record",
+		 record );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevt_stream_read_record(
+		          stream,
+		          &record,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevt_stream_close(
+		          stream,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libevt_stream_read_record(
+	          stream,
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	image_size = evt_test_stream_build_image(
+	              image_data,
+	              0 );
+
+	/* Test read with a truncated record
+	 */
+	input.data        = image_data;
+	input.data_size   = 48 + 100;
+	input.data_offset = 0;
+
+	result = libevt_stream_open_read_function(
+	          stream,
+	          &evt_test_stream_read_input,
+	          (void *) &input,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_stream_read_record(
+	          NULL,
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_stream_read_record(
+	          stream,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_stream_read_record(
+	          stream,
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_stream_free(
+	          &stream,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libevt_record_free(
+		 &record,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		libevt_stream_free(
+		 &stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVT_TEST_UNREFERENCED_PARAMETER( argc )
+	EVT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
+
+	EVT_TEST_RUN(
+	 "libevt_stream_initialize",
+	 evt_test_stream_initialize );
+
+	EVT_TEST_RUN(
+	 "libevt_stream_free",
+	 evt_test_stream_free );
+
+	EVT_TEST_RUN(
+	 "libevt_stream_set_block_size",
+	 evt_test_stream_set_block_size );
+
+	/* TODO: add tests for libevt_stream_open_file_io_handle */
+
+	EVT_TEST_RUN(
+	 "libevt_stream_open_read_function",
+	 evt_test_stream_open_read_function );
+
+	EVT_TEST_RUN(
+	 "libevt_stream_read_record",
+	 evt_test_stream_read_record );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
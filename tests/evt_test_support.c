@@ -199,6 +199,125 @@ on_error:
 	return( 0 );
 }
 
+/* Allocates memory for the allocator test
+ */
+void *evt_test_allocate(
+       size_t size )
+{
+	return( malloc(
+	         size ) );
+}
+
+/* Reallocates memory for the allocator test
+ */
+void *evt_test_reallocate(
+       void *buffer,
+       size_t size )
+{
+	return( realloc(
+	         buffer,
+	         size ) );
+}
+
+/* Frees memory for the allocator test
+ */
+void evt_test_free(
+      void *buffer )
+{
+	free(
+	 buffer );
+}
+
+/* Tests the libevt_set_allocator function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_set_allocator(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevt_set_allocator(
+	          &evt_test_allocate,
+	          &evt_test_reallocate,
+	          &evt_test_free,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_set_allocator(
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_set_allocator(
+	          &evt_test_allocate,
+	          NULL,
+	          &evt_test_free,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_set_allocator(
+	          NULL,
+	          NULL,
+	          &evt_test_free,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libevt_check_file_signature function
  * Returns 1 if successful or 0 if not
  */
@@ -765,6 +884,10 @@ int main(
 	 "libevt_set_codepage",
 	 evt_test_set_codepage );
 
+	EVT_TEST_RUN(
+	 "libevt_set_allocator",
+	 evt_test_set_allocator );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	EVT_TEST_RUN_WITH_ARGS(
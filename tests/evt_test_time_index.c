@@ -0,0 +1,792 @@
+/*
+ * Library time_index type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evt_test_libcerror.h"
+#include "evt_test_libevt.h"
+#include "evt_test_macros.h"
+#include "evt_test_memory.h"
+#include "evt_test_unused.h"
+
+#include "../libevt/libevt_time_index.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
+
+/* Creates a time index with 2 runs of entries that mimics a ring buffer
+ * that has wrapped, where record index 5 is not an event record
+ * Returns 1 if successful or -1 on error
+ */
+int evt_test_time_index_initialize_with_entries(
+     libevt_time_index_t **time_index,
+     libcerror_error_t **error )
+{
+	uint32_t written_times[ 8 ] = {
+		100, 200, 250, 300, 400, 150, 250, 350 };
+
+	int entry_index = 0;
+
+	if( libevt_time_index_initialize(
+	     time_index,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	( *time_index )->entries = (libevt_time_index_entry_t *) memory_allocate(
+	                                                          sizeof( libevt_time_index_entry_t ) * 8 );
+
+	if( ( *time_index )->entries == NULL )
+	{
+		goto on_error;
+	}
+	( *time_index )->run_start_indexes = (int *) memory_allocate(
+	                                              sizeof( int ) * 2 );
+
+	if( ( *time_index )->run_start_indexes == NULL )
+	{
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < 8;
+	     entry_index++ )
+	{
+		( *time_index )->entries[ entry_index ].written_time = written_times[ entry_index ];
+		( *time_index )->entries[ entry_index ].record_index = ( entry_index < 5 ) ? entry_index : entry_index + 1;
+	}
+	( *time_index )->number_of_entries      = 8;
+	( *time_index )->run_start_indexes[ 0 ] = 0;
+	( *time_index )->run_start_indexes[ 1 ] = 5;
+	( *time_index )->number_of_runs         = 2;
+
+	return( 1 );
+
+on_error:
+	libevt_time_index_free(
+	 time_index,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Tests the libevt_time_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_time_index_initialize(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libevt_time_index_t *time_index = NULL;
+	int result                              = 0;
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+	int number_of_malloc_fail_tests         = 1;
+	int number_of_memset_fail_tests         = 1;
+	int test_number                         = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevt_time_index_initialize(
+	          &time_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "time_index",
+	 time_index );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_time_index_free(
+	          &time_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "time_index",
+	 time_index );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_time_index_initialize(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	time_index = (libevt_time_index_t *) 0x12345678UL;
+
+	result = libevt_time_index_initialize(
+	          &time_index,
+	          &error );
+
+	time_index = NULL;
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevt_time_index_initialize with malloc failing
+		 */
+		evt_test_malloc_attempts_before_fail = test_number;
+
+		result = libevt_time_index_initialize(
+		          &time_index,
+		          &error );
+
+		if( evt_test_malloc_attempts_before_fail != -1 )
+		{
+			evt_test_malloc_attempts_before_fail = -1;
+
+			if( time_index != NULL )
+			{
+				libevt_time_index_free(
+				 &time_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "time_index",
+			 time_index );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevt_time_index_initialize with memset failing
+		 */
+		evt_test_memset_attempts_before_fail = test_number;
+
+		result = libevt_time_index_initialize(
+		          &time_index,
+		          &error );
+
+		if( evt_test_memset_attempts_before_fail != -1 )
+		{
+			evt_test_memset_attempts_before_fail = -1;
+
+			if( time_index != NULL )
+			{
+				libevt_time_index_free(
+				 &time_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "time_index",
+			 time_index );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( time_index != NULL )
+	{
+		libevt_time_index_free(
+		 &time_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_time_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_time_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevt_time_index_free(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_time_index_get_run_entry_range function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_time_index_get_run_entry_range(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libevt_time_index_t *time_index = NULL;
+	int first_entry_index           = 0;
+	int number_of_entries           = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = evt_test_time_index_initialize_with_entries(
+	          &time_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "time_index",
+	 time_index );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_time_index_get_run_entry_range(
+	          time_index,
+	          0,
+	          200,
+	          300,
+	          &first_entry_index,
+	          &number_of_entries,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "first_entry_index",
+	 first_entry_index,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 3 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_time_index_get_run_entry_range(
+	          time_index,
+	          1,
+	          200,
+	          300,
+	          &first_entry_index,
+	          &number_of_entries,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "first_entry_index",
+	 first_entry_index,
+	 6 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_time_index_get_run_entry_range(
+	          NULL,
+	          0,
+	          200,
+	          300,
+	          &first_entry_index,
+	          &number_of_entries,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_time_index_get_run_entry_range(
+	          time_index,
+	          2,
+	          200,
+	          300,
+	          &first_entry_index,
+	          &number_of_entries,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_time_index_get_run_entry_range(
+	          time_index,
+	          0,
+	          200,
+	          300,
+	          NULL,
+	          &number_of_entries,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_time_index_get_run_entry_range(
+	          time_index,
+	          0,
+	          200,
+	          300,
+	          &first_entry_index,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_time_index_free(
+	          &time_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "time_index",
+	 time_index );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( time_index != NULL )
+	{
+		libevt_time_index_free(
+		 &time_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_time_index_get_record_indexes function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_time_index_get_record_indexes(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libevt_time_index_t *time_index = NULL;
+	int *record_indexes             = NULL;
+	int number_of_record_indexes    = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = evt_test_time_index_initialize_with_entries(
+	          &time_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "time_index",
+	 time_index );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_time_index_get_record_indexes(
+	          time_index,
+	          150,
+	          400,
+	          &record_indexes,
+	          &number_of_record_indexes,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_record_indexes",
+	 number_of_record_indexes,
+	 7 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "record_indexes",
+	 record_indexes );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "record_indexes[ 0 ]",
+	 record_indexes[ 0 ],
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "record_indexes[ 4 ]",
+	 record_indexes[ 4 ],
+	 6 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "record_indexes[ 6 ]",
+	 record_indexes[ 6 ],
+	 8 );
+
+	memory_free(
+	 record_indexes );
+
+	record_indexes = NULL;
+
+	result = libevt_time_index_get_record_indexes(
+	          time_index,
+	          500,
+	          600,
+	          &record_indexes,
+	          &number_of_record_indexes,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_record_indexes",
+	 number_of_record_indexes,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record_indexes",
+	 record_indexes );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_time_index_get_record_indexes(
+	          NULL,
+	          150,
+	          400,
+	          &record_indexes,
+	          &number_of_record_indexes,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_time_index_get_record_indexes(
+	          time_index,
+	          150,
+	          400,
+	          NULL,
+	          &number_of_record_indexes,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_time_index_get_record_indexes(
+	          time_index,
+	          150,
+	          400,
+	          &record_indexes,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_time_index_free(
+	          &time_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "time_index",
+	 time_index );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_indexes != NULL )
+	{
+		memory_free(
+		 record_indexes );
+	}
+	if( time_index != NULL )
+	{
+		libevt_time_index_free(
+		 &time_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVT_TEST_UNREFERENCED_PARAMETER( argc )
+	EVT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
+
+	EVT_TEST_RUN(
+	 "libevt_time_index_initialize",
+	 evt_test_time_index_initialize );
+
+	EVT_TEST_RUN(
+	 "libevt_time_index_free",
+	 evt_test_time_index_free );
+
+	/* TODO: add tests for libevt_time_index_read_records */
+
+	EVT_TEST_RUN(
+	 "libevt_time_index_get_run_entry_range",
+	 evt_test_time_index_get_run_entry_range );
+
+	EVT_TEST_RUN(
+	 "libevt_time_index_get_record_indexes",
+	 evt_test_time_index_get_record_indexes );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -22,6 +22,7 @@
 #include <common.h>
 #include <file_stream.h>
 #include <memory.h>
+#include <system_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -273,6 +274,180 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the message_string_copy function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_tools_message_string_copy(
+     void )
+{
+	system_character_t string[ 6 ]               = _SYSTEM_STRING( "Logon" );
+	libcerror_error_t *error                     = NULL;
+	message_string_t *destination_message_string = NULL;
+	message_string_t source_message_string;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = message_string_initialize(
+	          &destination_message_string,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_message_string",
+	 destination_message_string );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	source_message_string.identifier            = 3;
+	source_message_string.string                = string;
+	source_message_string.string_size           = 6;
+	source_message_string.allocated_string_size = 6;
+
+	/* Test regular cases
+	 */
+	result = message_string_copy(
+	          destination_message_string,
+	          &source_message_string,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "destination_message_string->identifier",
+	 destination_message_string->identifier,
+	 (uint32_t) 3 );
+
+	EVT_TEST_ASSERT_EQUAL_SIZE(
+	 "destination_message_string->string_size",
+	 destination_message_string->string_size,
+	 (size_t) 6 );
+
+	result = memory_compare(
+	          destination_message_string->string,
+	          string,
+	          sizeof( system_character_t ) * 6 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that a shorter string reuses the allocated string
+	 */
+	source_message_string.identifier  = 4;
+	source_message_string.string_size = 3;
+
+	result = message_string_copy(
+	          destination_message_string,
+	          &source_message_string,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_SIZE(
+	 "destination_message_string->string_size",
+	 destination_message_string->string_size,
+	 (size_t) 3 );
+
+	EVT_TEST_ASSERT_EQUAL_SIZE(
+	 "destination_message_string->allocated_string_size",
+	 destination_message_string->allocated_string_size,
+	 (size_t) 6 );
+
+	/* Test error cases
+	 */
+	result = message_string_copy(
+	          NULL,
+	          &source_message_string,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = message_string_copy(
+	          destination_message_string,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = message_string_free(
+	          &destination_message_string,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "destination_message_string",
+	 destination_message_string );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_message_string != NULL )
+	{
+		message_string_free(
+		 &destination_message_string,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -296,6 +471,10 @@ int main(
 	 "message_string_free",
 	 evt_test_tools_message_string_free );
 
+	EVT_TEST_RUN(
+	 "message_string_copy",
+	 evt_test_tools_message_string_copy );
+
 	return( EXIT_SUCCESS );
 
 on_error:
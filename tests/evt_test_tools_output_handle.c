@@ -0,0 +1,1138 @@
+/*
+ * Tools output_handle type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evt_test_libcerror.h"
+#include "evt_test_macros.h"
+#include "evt_test_memory.h"
+#include "evt_test_unused.h"
+
+#include "../evttools/output_handle.h"
+
+/* Tests the output_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_tools_output_handle_initialize(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	output_handle_t *output_handle   = NULL;
+	int result                       = 0;
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+	int number_of_malloc_fail_tests  = 2;
+	int number_of_memset_fail_tests  = 1;
+	int test_number                  = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = output_handle_initialize(
+	          &output_handle,
+	          stdout,
+	          64,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "output_handle",
+	 output_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_handle_free(
+	          &output_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "output_handle",
+	 output_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with the data kept in the buffer
+	 */
+	result = output_handle_initialize(
+	          &output_handle,
+	          NULL,
+	          64,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "output_handle",
+	 output_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_handle_free(
+	          &output_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "output_handle",
+	 output_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = output_handle_initialize(
+	          NULL,
+	          stdout,
+	          64,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	output_handle = (output_handle_t *) 0x12345678UL;
+
+	result = output_handle_initialize(
+	          &output_handle,
+	          stdout,
+	          64,
+	          &error );
+
+	output_handle = NULL;
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = output_handle_initialize(
+	          &output_handle,
+	          stdout,
+	          (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE + 1,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test output_handle_initialize with malloc failing
+		 */
+		evt_test_malloc_attempts_before_fail = test_number;
+
+		result = output_handle_initialize(
+		          &output_handle,
+		          stdout,
+		          64,
+		          &error );
+
+		if( evt_test_malloc_attempts_before_fail != -1 )
+		{
+			evt_test_malloc_attempts_before_fail = -1;
+
+			if( output_handle != NULL )
+			{
+				output_handle_free(
+				 &output_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "output_handle",
+			 output_handle );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test output_handle_initialize with memset failing
+		 */
+		evt_test_memset_attempts_before_fail = test_number;
+
+		result = output_handle_initialize(
+		          &output_handle,
+		          stdout,
+		          64,
+		          &error );
+
+		if( evt_test_memset_attempts_before_fail != -1 )
+		{
+			evt_test_memset_attempts_before_fail = -1;
+
+			if( output_handle != NULL )
+			{
+				output_handle_free(
+				 &output_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "output_handle",
+			 output_handle );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_handle != NULL )
+	{
+		output_handle_free(
+		 &output_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the output_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_tools_output_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = output_handle_free(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the output_handle_write functions
+ * The written data is checked in the buffer and discarded before the buffer is flushed
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_tools_output_handle_write(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	output_handle_t *output_handle = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = output_handle_initialize(
+	          &output_handle,
+	          stdout,
+	          64,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "output_handle",
+	 output_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = output_handle_write_string(
+	          output_handle,
+	          "Event: ",
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_handle_write_decimal(
+	          output_handle,
+	          1073742827,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_handle_write_character(
+	          output_handle,
+	          ' ',
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_handle_write_hexadecimal(
+	          output_handle,
+	          0x400003ebUL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_SIZE(
+	 "output_handle->buffer_offset",
+	 output_handle->buffer_offset,
+	 (size_t) 26 );
+
+	result = memory_compare(
+	          output_handle->buffer,
+	          "Event: 1073742827 400003eb",
+	          26 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	output_handle->buffer_offset = 0;
+
+	result = output_handle_write_decimal(
+	          output_handle,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_SIZE(
+	 "output_handle->buffer_offset",
+	 output_handle->buffer_offset,
+	 (size_t) 1 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT8(
+	 "output_handle->buffer[ 0 ]",
+	 output_handle->buffer[ 0 ],
+	 (uint8_t) '0' );
+
+	output_handle->buffer_offset = 0;
+
+	result = output_handle_write_posix_time(
+	          output_handle,
+	          1318161221,
+	          OUTPUT_HANDLE_DATE_TIME_FORMAT_CTIME,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_handle_write_posix_time(
+	          output_handle,
+	          951782400,
+	          OUTPUT_HANDLE_DATE_TIME_FORMAT_CTIME,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_handle_write_posix_time(
+	          output_handle,
+	          -1,
+	          OUTPUT_HANDLE_DATE_TIME_FORMAT_CTIME,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_SIZE(
+	 "output_handle->buffer_offset",
+	 output_handle->buffer_offset,
+	 (size_t) 63 );
+
+	result = memory_compare(
+	          output_handle->buffer,
+	          "Oct 09, 2011 11:53:41Feb 29, 2000 00:00:00Dec 31, 1969 23:59:59",
+	          63 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	output_handle->buffer_offset = 0;
+
+	result = output_handle_write_posix_time(
+	          output_handle,
+	          (int32_t) -2147483647L - 1,
+	          OUTPUT_HANDLE_DATE_TIME_FORMAT_CTIME,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_handle_write_posix_time(
+	          output_handle,
+	          (int32_t) 2147483647L,
+	          OUTPUT_HANDLE_DATE_TIME_FORMAT_CTIME,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_handle->buffer,
+	          "Dec 13, 1901 20:45:52Jan 19, 2038 03:14:07",
+	          42 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	output_handle->buffer_offset = 0;
+
+	result = output_handle_write_posix_time(
+	          output_handle,
+	          1318161221,
+	          OUTPUT_HANDLE_DATE_TIME_FORMAT_ISO8601,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_SIZE(
+	 "output_handle->buffer_offset",
+	 output_handle->buffer_offset,
+	 (size_t) 20 );
+
+	result = memory_compare(
+	          output_handle->buffer,
+	          "2011-10-09T11:53:41Z",
+	          20 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	output_handle->buffer_offset = 0;
+
+	result = output_handle_write_base64(
+	          output_handle,
+	          (uint8_t *) "ABCDE",
+	          5,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_SIZE(
+	 "output_handle->buffer_offset",
+	 output_handle->buffer_offset,
+	 (size_t) 8 );
+
+	result = memory_compare(
+	          output_handle->buffer,
+	          "QUJDREU=",
+	          8 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	output_handle->buffer_offset = 0;
+
+	result = output_handle_set_escape_mode(
+	          output_handle,
+	          OUTPUT_HANDLE_ESCAPE_MODE_JSON,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_handle_write_string(
+	          output_handle,
+	          "a\"b\\c\td\001",
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_handle_write_character(
+	          output_handle,
+	          '\n',
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_handle_set_escape_mode(
+	          output_handle,
+	          OUTPUT_HANDLE_ESCAPE_MODE_NONE,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_SIZE(
+	 "output_handle->buffer_offset",
+	 output_handle->buffer_offset,
+	 (size_t) 18 );
+
+	result = memory_compare(
+	          output_handle->buffer,
+	          "a\\\"b\\\\c\\td\\u0001\\n",
+	          18 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	output_handle->buffer_offset = 0;
+
+	/* Test error cases
+	 */
+	result = output_handle_write_data(
+	          NULL,
+	          (uint8_t *) "data",
+	          4,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = output_handle_write_data(
+	          output_handle,
+	          NULL,
+	          4,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = output_handle_write_data(
+	          output_handle,
+	          (uint8_t *) "data",
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = output_handle_set_escape_mode(
+	          output_handle,
+	          0xff,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = output_handle_write_string(
+	          output_handle,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = output_handle_free(
+	          &output_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "output_handle",
+	 output_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_handle != NULL )
+	{
+		output_handle->buffer_offset = 0;
+
+		output_handle_free(
+		 &output_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the output_handle_write_buffered_data and output_handle_clear_buffer functions
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_tools_output_handle_write_buffered_data(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	output_handle_t *output_handle        = NULL;
+	output_handle_t *record_output_handle = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = output_handle_initialize(
+	          &output_handle,
+	          stdout,
+	          64,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "output_handle",
+	 output_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_handle_initialize(
+	          &record_output_handle,
+	          NULL,
+	          4,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "record_output_handle",
+	 record_output_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = output_handle_write_string(
+	          record_output_handle,
+	          "0123456789",
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_SIZE(
+	 "record_output_handle->buffer_offset",
+	 record_output_handle->buffer_offset,
+	 (size_t) 10 );
+
+	result = memory_compare(
+	          record_output_handle->buffer,
+	          "0123456789",
+	          10 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = output_handle_clear_buffer(
+	          record_output_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_SIZE(
+	 "record_output_handle->buffer_offset",
+	 record_output_handle->buffer_offset,
+	 (size_t) 0 );
+
+	result = output_handle_write_string(
+	          record_output_handle,
+	          "Event",
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_handle_write_buffered_data(
+	          output_handle,
+	          record_output_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_SIZE(
+	 "record_output_handle->buffer_offset",
+	 record_output_handle->buffer_offset,
+	 (size_t) 0 );
+
+	EVT_TEST_ASSERT_EQUAL_SIZE(
+	 "output_handle->buffer_offset",
+	 output_handle->buffer_offset,
+	 (size_t) 5 );
+
+	result = memory_compare(
+	          output_handle->buffer,
+	          "Event",
+	          5 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	output_handle->buffer_offset = 0;
+
+	/* Test error cases
+	 */
+	result = output_handle_write_buffered_data(
+	          output_handle,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = output_handle_write_buffered_data(
+	          NULL,
+	          record_output_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = output_handle_clear_buffer(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = output_handle_free(
+	          &record_output_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record_output_handle",
+	 record_output_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_handle_free(
+	          &output_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "output_handle",
+	 output_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_output_handle != NULL )
+	{
+		output_handle_free(
+		 &record_output_handle,
+		 NULL );
+	}
+	if( output_handle != NULL )
+	{
+		output_handle->buffer_offset = 0;
+
+		output_handle_free(
+		 &output_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVT_TEST_UNREFERENCED_PARAMETER( argc )
+	EVT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EVT_TEST_RUN(
+	 "output_handle_initialize",
+	 evt_test_tools_output_handle_initialize );
+
+	EVT_TEST_RUN(
+	 "output_handle_free",
+	 evt_test_tools_output_handle_free );
+
+	EVT_TEST_RUN(
+	 "output_handle_write",
+	 evt_test_tools_output_handle_write );
+
+	EVT_TEST_RUN(
+	 "output_handle_write_buffered_data",
+	 evt_test_tools_output_handle_write_buffered_data );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
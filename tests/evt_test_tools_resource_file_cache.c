@@ -0,0 +1,791 @@
+/*
+ * Tools resource_file_cache type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evt_test_libcerror.h"
+#include "evt_test_macros.h"
+#include "evt_test_memory.h"
+#include "evt_test_unused.h"
+
+#include "../evttools/resource_file.h"
+#include "../evttools/resource_file_cache.h"
+
+/* Tests the resource_file_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_tools_resource_file_cache_initialize(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	resource_file_cache_t *resource_file_cache = NULL;
+	int result                                 = 0;
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+	int number_of_malloc_fail_tests            = 2;
+	int number_of_memset_fail_tests            = 2;
+	int test_number                            = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = resource_file_cache_initialize(
+	          &resource_file_cache,
+	          RESOURCE_FILE_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "resource_file_cache",
+	 resource_file_cache );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = resource_file_cache_free(
+	          &resource_file_cache,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "resource_file_cache",
+	 resource_file_cache );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = resource_file_cache_initialize(
+	          NULL,
+	          RESOURCE_FILE_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	resource_file_cache = (resource_file_cache_t *) 0x12345678UL;
+
+	result = resource_file_cache_initialize(
+	          &resource_file_cache,
+	          RESOURCE_FILE_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES,
+	          &error );
+
+	resource_file_cache = NULL;
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = resource_file_cache_initialize(
+	          &resource_file_cache,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test resource_file_cache_initialize with malloc failing
+		 */
+		evt_test_malloc_attempts_before_fail = test_number;
+
+		result = resource_file_cache_initialize(
+		          &resource_file_cache,
+		          RESOURCE_FILE_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES,
+		          &error );
+
+		if( evt_test_malloc_attempts_before_fail != -1 )
+		{
+			evt_test_malloc_attempts_before_fail = -1;
+
+			if( resource_file_cache != NULL )
+			{
+				resource_file_cache_free(
+				 &resource_file_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "resource_file_cache",
+			 resource_file_cache );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test resource_file_cache_initialize with memset failing
+		 */
+		evt_test_memset_attempts_before_fail = test_number;
+
+		result = resource_file_cache_initialize(
+		          &resource_file_cache,
+		          RESOURCE_FILE_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES,
+		          &error );
+
+		if( evt_test_memset_attempts_before_fail != -1 )
+		{
+			evt_test_memset_attempts_before_fail = -1;
+
+			if( resource_file_cache != NULL )
+			{
+				resource_file_cache_free(
+				 &resource_file_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "resource_file_cache",
+			 resource_file_cache );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( resource_file_cache != NULL )
+	{
+		resource_file_cache_free(
+		 &resource_file_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the resource_file_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_tools_resource_file_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = resource_file_cache_free(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the resource_file_cache_get_resource_file and resource_file_cache_set_resource_file functions
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_tools_resource_file_cache_get_resource_file(
+     void )
+{
+	system_character_t name[ 7 ]               = _SYSTEM_STRING( "a0.dll" );
+	libcerror_error_t *error                   = NULL;
+	resource_file_t *cached_resource_file      = NULL;
+	resource_file_t *resource_file             = NULL;
+	resource_file_cache_t *resource_file_cache = NULL;
+	int name_index                             = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = resource_file_cache_initialize(
+	          &resource_file_cache,
+	          2,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "resource_file_cache",
+	 resource_file_cache );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = resource_file_cache_get_resource_file(
+	          resource_file_cache,
+	          name,
+	          6,
+	          &cached_resource_file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "cached_resource_file",
+	 cached_resource_file );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Add a0.dll, a1.dll and a2.dll with a maximum of 2 entries
+	 */
+	for( name_index = 0;
+	     name_index < 3;
+	     name_index++ )
+	{
+		name[ 1 ] = (system_character_t) ( '0' + name_index );
+
+		result = resource_file_initialize(
+		          &resource_file,
+		          0x00000409UL,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = resource_file_set_name(
+		          resource_file,
+		          name,
+		          6,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = resource_file_cache_set_resource_file(
+		          resource_file_cache,
+		          resource_file,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		resource_file = NULL;
+
+		/* Make a0.dll the most recently used so that a1.dll is removed
+		 */
+		name[ 1 ] = (system_character_t) '0';
+
+		result = resource_file_cache_get_resource_file(
+		          resource_file_cache,
+		          name,
+		          6,
+		          &cached_resource_file,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NOT_NULL(
+		 "cached_resource_file",
+		 cached_resource_file );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "resource_file_cache->number_of_entries",
+	 resource_file_cache->number_of_entries,
+	 2 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT64(
+	 "resource_file_cache->number_of_evictions",
+	 resource_file_cache->number_of_evictions,
+	 (uint64_t) 1 );
+
+	name[ 1 ] = (system_character_t) '1';
+
+	result = resource_file_cache_get_resource_file(
+	          resource_file_cache,
+	          name,
+	          6,
+	          &cached_resource_file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	name[ 1 ] = (system_character_t) '2';
+
+	result = resource_file_cache_get_resource_file(
+	          resource_file_cache,
+	          name,
+	          6,
+	          &cached_resource_file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "cached_resource_file",
+	 cached_resource_file );
+
+	EVT_TEST_ASSERT_EQUAL_SIZE(
+	 "cached_resource_file->name_size",
+	 cached_resource_file->name_size,
+	 (size_t) 7 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The name must match exactly
+	 */
+	result = resource_file_cache_get_resource_file(
+	          resource_file_cache,
+	          name,
+	          5,
+	          &cached_resource_file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_UINT64(
+	 "resource_file_cache->number_of_hits",
+	 resource_file_cache->number_of_hits,
+	 (uint64_t) 4 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT64(
+	 "resource_file_cache->number_of_misses",
+	 resource_file_cache->number_of_misses,
+	 (uint64_t) 3 );
+
+	/* Test setting a resource file that is already in the cache
+	 */
+	result = resource_file_cache_set_resource_file(
+	          resource_file_cache,
+	          cached_resource_file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test reducing the maximum number of entries
+	 * a0.dll is least recently used and is removed
+	 */
+	result = resource_file_cache_set_maximum_number_of_entries(
+	          resource_file_cache,
+	          1,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "resource_file_cache->number_of_entries",
+	 resource_file_cache->number_of_entries,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT64(
+	 "resource_file_cache->number_of_evictions",
+	 resource_file_cache->number_of_evictions,
+	 (uint64_t) 2 );
+
+	result = resource_file_cache_get_resource_file(
+	          resource_file_cache,
+	          name,
+	          6,
+	          &cached_resource_file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = resource_file_cache_empty(
+	          resource_file_cache,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "resource_file_cache->number_of_entries",
+	 resource_file_cache->number_of_entries,
+	 0 );
+
+	result = resource_file_cache_get_resource_file(
+	          resource_file_cache,
+	          name,
+	          6,
+	          &cached_resource_file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = resource_file_cache_get_resource_file(
+	          NULL,
+	          name,
+	          6,
+	          &cached_resource_file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = resource_file_cache_get_resource_file(
+	          resource_file_cache,
+	          NULL,
+	          6,
+	          &cached_resource_file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = resource_file_cache_get_resource_file(
+	          resource_file_cache,
+	          name,
+	          6,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = resource_file_cache_set_resource_file(
+	          NULL,
+	          cached_resource_file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = resource_file_cache_set_resource_file(
+	          resource_file_cache,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = resource_file_cache_set_maximum_number_of_entries(
+	          resource_file_cache,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = resource_file_cache_free(
+	          &resource_file_cache,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "resource_file_cache",
+	 resource_file_cache );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( resource_file != NULL )
+	{
+		resource_file_free(
+		 &resource_file,
+		 NULL );
+	}
+	if( resource_file_cache != NULL )
+	{
+		resource_file_cache_free(
+		 &resource_file_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVT_TEST_UNREFERENCED_PARAMETER( argc )
+	EVT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EVT_TEST_RUN(
+	 "resource_file_cache_initialize",
+	 evt_test_tools_resource_file_cache_initialize );
+
+	EVT_TEST_RUN(
+	 "resource_file_cache_free",
+	 evt_test_tools_resource_file_cache_free );
+
+	EVT_TEST_RUN(
+	 "resource_file_cache_get_resource_file",
+	 evt_test_tools_resource_file_cache_get_resource_file );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,708 @@
+/*
+ * Tools string_cache type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evt_test_libcerror.h"
+#include "evt_test_macros.h"
+#include "evt_test_memory.h"
+#include "evt_test_unused.h"
+
+#include "../evttools/string_cache.h"
+
+/* Tests the string_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_tools_string_cache_initialize(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	string_cache_t *string_cache     = NULL;
+	int result                       = 0;
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+	int number_of_malloc_fail_tests  = 2;
+	int number_of_memset_fail_tests  = 2;
+	int test_number                  = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = string_cache_initialize(
+	          &string_cache,
+	          STRING_CACHE_DEFAULT_NUMBER_OF_BUCKETS,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "string_cache",
+	 string_cache );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = string_cache_free(
+	          &string_cache,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "string_cache",
+	 string_cache );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = string_cache_initialize(
+	          NULL,
+	          STRING_CACHE_DEFAULT_NUMBER_OF_BUCKETS,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	string_cache = (string_cache_t *) 0x12345678UL;
+
+	result = string_cache_initialize(
+	          &string_cache,
+	          STRING_CACHE_DEFAULT_NUMBER_OF_BUCKETS,
+	          &error );
+
+	string_cache = NULL;
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = string_cache_initialize(
+	          &string_cache,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test string_cache_initialize with malloc failing
+		 */
+		evt_test_malloc_attempts_before_fail = test_number;
+
+		result = string_cache_initialize(
+		          &string_cache,
+		          STRING_CACHE_DEFAULT_NUMBER_OF_BUCKETS,
+		          &error );
+
+		if( evt_test_malloc_attempts_before_fail != -1 )
+		{
+			evt_test_malloc_attempts_before_fail = -1;
+
+			if( string_cache != NULL )
+			{
+				string_cache_free(
+				 &string_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "string_cache",
+			 string_cache );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test string_cache_initialize with memset failing
+		 */
+		evt_test_memset_attempts_before_fail = test_number;
+
+		result = string_cache_initialize(
+		          &string_cache,
+		          STRING_CACHE_DEFAULT_NUMBER_OF_BUCKETS,
+		          &error );
+
+		if( evt_test_memset_attempts_before_fail != -1 )
+		{
+			evt_test_memset_attempts_before_fail = -1;
+
+			if( string_cache != NULL )
+			{
+				string_cache_free(
+				 &string_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "string_cache",
+			 string_cache );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string_cache != NULL )
+	{
+		string_cache_free(
+		 &string_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the string_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_tools_string_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = string_cache_free(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the string_cache_get_value and string_cache_set_value functions
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_tools_string_cache_get_value(
+     void )
+{
+	system_character_t event_source[ 8 ]  = _SYSTEM_STRING( "Source0" );
+	system_character_t value_name[ 17 ]   = _SYSTEM_STRING( "EventMessageFile" );
+	system_character_t value_string[ 10 ] = _SYSTEM_STRING( "test1.dll" );
+	const system_character_t *value       = NULL;
+	libcerror_error_t *error              = NULL;
+	string_cache_t *string_cache          = NULL;
+	size_t value_size                     = 0;
+	int entry_index                       = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = string_cache_initialize(
+	          &string_cache,
+	          2,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "string_cache",
+	 string_cache );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = string_cache_get_value(
+	          string_cache,
+	          value_name,
+	          16,
+	          event_source,
+	          7,
+	          &value,
+	          &value_size,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Add entries with and without a value, and enough to resize the buckets
+	 */
+	for( entry_index = 0;
+	     entry_index < 10;
+	     entry_index++ )
+	{
+		event_source[ 6 ] = (system_character_t) ( '0' + entry_index );
+		value_string[ 4 ] = (system_character_t) ( '0' + entry_index );
+
+		result = string_cache_set_value(
+		          string_cache,
+		          value_name,
+		          16,
+		          event_source,
+		          7,
+		          ( ( entry_index % 2 ) == 0 ) ? value_string : NULL,
+		          10,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "string_cache->number_of_entries",
+	 string_cache->number_of_entries,
+	 10 );
+
+	EVT_TEST_ASSERT_GREATER_THAN_INT(
+	 "string_cache->number_of_buckets",
+	 string_cache->number_of_buckets,
+	 2 );
+
+	for( entry_index = 0;
+	     entry_index < 10;
+	     entry_index++ )
+	{
+		event_source[ 6 ] = (system_character_t) ( '0' + entry_index );
+		value_string[ 4 ] = (system_character_t) ( '0' + entry_index );
+
+		result = string_cache_get_value(
+		          string_cache,
+		          value_name,
+		          16,
+		          event_source,
+		          7,
+		          &value,
+		          &value_size,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( ( entry_index % 2 ) == 0 )
+		{
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "value",
+			 value );
+
+			EVT_TEST_ASSERT_EQUAL_SIZE(
+			 "value_size",
+			 value_size,
+			 (size_t) 10 );
+
+			result = memory_compare(
+			          value,
+			          value_string,
+			          sizeof( system_character_t ) * 10 );
+
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+		else
+		{
+			EVT_TEST_ASSERT_IS_NULL(
+			 "value",
+			 value );
+		}
+	}
+	/* Test that the key is split into a first and second key
+	 */
+	result = string_cache_get_value(
+	          string_cache,
+	          value_name,
+	          15,
+	          event_source,
+	          7,
+	          &value,
+	          &value_size,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that setting an existing key replaces its value
+	 */
+	result = string_cache_set_value(
+	          string_cache,
+	          value_name,
+	          16,
+	          event_source,
+	          7,
+	          value_string,
+	          10,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "string_cache->number_of_entries",
+	 string_cache->number_of_entries,
+	 10 );
+
+	result = string_cache_get_value(
+	          string_cache,
+	          value_name,
+	          16,
+	          event_source,
+	          7,
+	          &value,
+	          &value_size,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "value",
+	 value );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = string_cache_empty(
+	          string_cache,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "string_cache->number_of_entries",
+	 string_cache->number_of_entries,
+	 0 );
+
+	result = string_cache_get_value(
+	          string_cache,
+	          value_name,
+	          16,
+	          event_source,
+	          7,
+	          &value,
+	          &value_size,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = string_cache_get_value(
+	          NULL,
+	          value_name,
+	          16,
+	          event_source,
+	          7,
+	          &value,
+	          &value_size,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = string_cache_get_value(
+	          string_cache,
+	          value_name,
+	          16,
+	          event_source,
+	          7,
+	          NULL,
+	          &value_size,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = string_cache_set_value(
+	          NULL,
+	          value_name,
+	          16,
+	          event_source,
+	          7,
+	          value_string,
+	          10,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = string_cache_set_value(
+	          string_cache,
+	          value_name,
+	          16,
+	          event_source,
+	          7,
+	          value_string,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = string_cache_free(
+	          &string_cache,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "string_cache",
+	 string_cache );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string_cache != NULL )
+	{
+		string_cache_free(
+		 &string_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVT_TEST_UNREFERENCED_PARAMETER( argc )
+	EVT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EVT_TEST_RUN(
+	 "string_cache_initialize",
+	 evt_test_tools_string_cache_initialize );
+
+	EVT_TEST_RUN(
+	 "string_cache_free",
+	 evt_test_tools_string_cache_free );
+
+	EVT_TEST_RUN(
+	 "string_cache_get_value",
+	 evt_test_tools_string_cache_get_value );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
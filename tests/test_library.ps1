@@ -1,7 +1,7 @@
 # Tests library functions and types.
 
-$LibraryTests = "end_of_file_record error event_record file_header io_handle notify record record_values strings_array"
-$LibraryTestsWithInput = "file support"
+$LibraryTests = "arena cache_index end_of_file_record error event_record file_data file_header filter identifier_map io_handle notify record record_map record_values record_view scanner signature_scanner stream strings_array time_index"
+$LibraryTestsWithInput = "file file_set support"
 $OptionSets = "" -split " "
 
 . .\test_functions.ps1
@@ -1,6 +1,6 @@
 # Tests tools functions and types.
 
-$ToolsTests = "info_handle message_handle message_string output path_handle registry_file resource_file signal"
+$ToolsTests = "info_handle message_handle message_string output output_handle path_handle record_buffer registry_file resource_file resource_file_cache signal string_cache"
 $OptionSets = "" -split " "
 
 . .\test_functions.ps1